@@ -0,0 +1,1928 @@
+// ai.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bitboard.h"
+#include "tt.h"
+#include "pattern.h"
+#include "ai.h"
+#include "mcts.h"
+#include "mpc.h"
+#include "nn.h"
+#if AI_SMP
+#include <pthread.h>
+#endif
+
+// 手の並べ替えの優先度
+#define ORDER_HASH_MOVE 0x40000000 // 置換表の最善手
+#define ORDER_KILLER_1  0x20000000 // キラー手（最新）
+#define ORDER_KILLER_2  0x10000000 // キラー手（ひとつ前）
+#define HISTORY_MAX     0x00100000 // ヒストリ値の上限. 超えたら全体を半分にする.
+
+// アスピレーション窓の半幅. 前の反復の最良スコア ± この値の窓でルートを探索する.
+#define ASPIRATION_WINDOW 150
+
+// Multi-ProbCut の確からしさ. 回帰の予測値が窓から (sigma x MPC_T16 / 16) 以上外れていれば刈る.
+// 大きいほど刈る回数が減り, 読み違いも減る.
+#ifndef MPC_T16
+#define MPC_T16 24
+#endif
+
+// Multi-ProbCut の浅い探索のノード数の見積もり. ヌルウィンドウなので1手あたり4手ほどに絞られる.
+// 時分割の持ち分の残りがこれより少なければ, 次の呼び出しの持ち分で浅い探索をする.
+// 持ち分全体より多ければ浅い探索をしない.
+#define MPC_PROBE_NODES(d) (1UL << (2 * (d)))
+
+// 終盤完全読み
+#define EG_DEPTH         100 // 完全読みの残り深さ. 置換表で通常探索の値と区別するため AI_MAX_DEPTH より十分大きくする.
+#define EG_LEAF_EMPTIES  6   // 空きマスがこの数以下になったら再帰の末端ソルバに任せる
+#define EG_SMALL_EMPTIES 4   // 空きマスがこの数以下なら合法手生成をせず空きマスに直接置いてみる
+#define EG_ORDER_MOBILITY 0x100 // 相手の着手可能数1つあたりの減点（速さ優先）
+#define EG_ORDER_CORNER   0x080 // 角の加点
+#define EG_ORDER_PARITY   0x040 // 空きマスが奇数の領域の加点
+#define EG_SORT_EMPTIES      12 // 空きマスがこの数以上のノードでは, 打った後の局面の評価値でも並べる
+#define EG_SORT_DEEP_EMPTIES 16 // 空きマスがこの数以上のノードでは, 評価値を EG_SORT_DEEP_DEPTH 手読んで求める
+#define EG_SORT_DEEP_DEPTH   2
+
+// 完全読みの反復探索の最大の深さ. 完全読みは最初から最後まで置換表を使う反復探索で進め,
+// 空きマスが EG_LEAF_EMPTIES 以下になったところだけ再帰の末端ソルバに任せる.
+// パスは相手が打てるときしか積まないので, 一番深くなるのは着手とパスを交互に繰り返すとき.
+#define EG_MAX_EMPTIES ((AI_ENDGAME_EMPTIES < MAT_WIDTH * MAT_HEIGHT - 4) ? AI_ENDGAME_EMPTIES : MAT_WIDTH * MAT_HEIGHT - 4)
+#define EG_MAX_PLY     ((EG_MAX_EMPTIES > EG_LEAF_EMPTIES) ? 2 * (EG_MAX_EMPTIES - EG_LEAF_EMPTIES) : 0)
+
+// 深さごとのバッファの大きさ. 通常探索の AI_MAX_DEPTH と完全読みの EG_MAX_PLY の大きい方.
+#define AI_MAX_PLY ((AI_MAX_DEPTH > EG_MAX_PLY) ? AI_MAX_DEPTH : EG_MAX_PLY)
+
+// 先読み（ポンダー）
+#define PONDER_ORDER_DEPTH 2 // 人間の候補手を並べる探索の深さ
+
+// 盤面の4分割. 終盤の偶数理論で, 空きマスが奇数個の領域から打つ.
+// 左上の領域は上半分の行の左半分の列. 8x8 では 0x000000000F0F0F0F.
+#define QUADRANT_TL ((0x0101010101010101ULL >> (BB_STRIDE * (8 - MAT_HEIGHT / 2))) * ((1U << (MAT_WIDTH / 2)) - 1))
+
+static const uint64_t QUADRANTS[4] =
+{
+    QUADRANT_TL,                                                  // 左上
+    QUADRANT_TL << (MAT_WIDTH / 2),                               // 右上
+    QUADRANT_TL << (BB_STRIDE * (MAT_HEIGHT / 2)),                // 左下
+    QUADRANT_TL << (BB_STRIDE * (MAT_HEIGHT / 2) + MAT_WIDTH / 2) // 右下
+};
+
+// 盤面のスコア定義. 8x8 の表で, 小さい盤では真ん中の行と列を除いて使う（POSITION_INDEX）.
+#define POSITION_INDEX(c) (((c) < MAT_WIDTH / 2) ? (c) : (c) + 8 - MAT_WIDTH)
+
+static const int POSITION_WEIGHTS[8][8] =
+{
+    {120, -40,  20,  10,  10,  20, -40, 120},
+    {-40, -50,  -5,  -5,  -5,  -5, -50, -40},
+    { 20,  -5,  15,  10,  10,  15,  -5,  20},
+    { 10,  -5,  10,   5,   5,  10,  -5,  10},
+    { 10,  -5,  10,   5,   5,  10,  -5,  10},
+    { 20,  -5,  15,  10,  10,  15,  -5,  20},
+    {-40, -50,  -5,  -5,  -5,  -5, -50, -40},
+    {120, -40,  20,  10,  10,  20, -40, 120}
+};
+
+// 差分更新する評価要素
+struct EvalTerms{
+    int                 empties; // 空きマス数. 評価関数の進行度にも使う.
+#if AI_EVAL == AI_EVAL_PATTERN
+    struct PatternState pat;     // パターン評価の部品
+#endif
+};
+
+// 先読みの候補. 人間が打った後の局面と, そこでのAIの最善手.
+struct PonderEntry{
+    struct Board  brd;      // 人間が打った後の局面
+    int           x, y;     // AIの最善手
+    int           depth;    // 完了した深さ. 0なら未完了, 完全読みで決めたら EG_DEPTH.
+    int           score;    // 最善手の評価値
+};
+
+// 時分割探索の段階
+enum job_stage{
+    job_idle,    // 探索していない
+    job_running, // 探索中
+    job_done     // 終わった. 結果が出ている.
+};
+
+// 時分割探索の状態
+// 探索を途中で止めて次の呼び出しで続きから再開できるよう, 各段階のループの状態をここに置く.
+struct SearchJob{
+    // 1手分の探索
+    enum job_stage   stage;
+    struct Board     brd;            // ルート局面
+    enum stone_color sc;             // 手番
+    int              max_depth;      // 反復深化の最大深さ
+    unsigned long    time_ms;        // 思考時間. 0なら無制限.
+    unsigned long    id_start_ms;    // 反復深化を始めた時刻
+    int              empties;        // ルート局面の空きマス数
+    int              done_depth;     // 完了した深さ. 完全読みで決めたら EG_DEPTH.
+    int              root_count;     // 完了した反復の候補手数. 0なら置ける場所がない.
+    int              best_score;     // 完了した反復の最良スコア
+    int              x, y;           // 最善手
+    // 1回の反復
+    int              depth;          // 深さ. 完全読みなら EG_DEPTH.
+    int              alpha, beta;    // アスピレーション窓
+    // ルートノード
+    int              root_idx;       // 調べている手
+    int              root_searching; // root_idx の手の探索中か
+    int              root_null;      // ヌルウィンドウで調べているか
+    int              root_lower;     // ヌルウィンドウの下限
+    int              root_best;      // 最良スコア
+    int              root_sym;       // ルート局面を変えない対称変換 k（bb_symmetry）のビット集合
+    // ネガマックス
+    int              nm_root;        // 探索を始めた深さ
+    int              nm_ply;         // 次に入るノードの深さ
+    int              nm_score;       // 評価値
+    int              nm_entering;    // ノードに入るところか
+};
+
+#if AI_SMP
+// ヘルパースレッドの引数
+struct SmpArg{
+    struct Board     brd;       // ルート局面
+    enum stone_color sc;        // 手番
+    int              max_depth; // 反復深化の最大深さ
+    int              id;        // スレッド番号. 1から.
+    unsigned long    nodes;     // 探索したノード数
+};
+#endif
+
+/************************************************** AI推論用グローバル変数 **************************************************/
+// スレッドごとの変数. ホストの並列探索ではスレッドごとに持つ.
+#if AI_SMP
+#define AI_LOCAL __thread
+#else
+#define AI_LOCAL
+#endif
+
+// グローバル静的バッファ
+static AI_LOCAL struct Board     ai_board;                             // 探索中の盤面. 手を打って進み, 取り消して戻る.
+static AI_LOCAL struct Undo      ai_undo[AI_MAX_PLY];                  // 深さごとの着手の取り消し情報
+static AI_LOCAL uint64_t         ai_hash[AI_MAX_PLY + 1];              // 深さごとの局面ハッシュ
+static AI_LOCAL enum stone_color ai_turn[AI_MAX_PLY + 1];              // 深さごとの手番
+static AI_LOCAL struct EvalTerms ai_eval[AI_MAX_PLY + 1];              // 深さごとの差分評価要素
+#if AI_EVAL == AI_EVAL_NN
+static AI_LOCAL struct NnAcc     ai_nn[AI_MAX_PLY + 1];                // 深さごとのニューラルネットのアキュムレータ
+#endif
+static AI_LOCAL int              ai_entry_idx[AI_MAX_MOVES];           // ソートに対応させるための座標配列のインデックス
+static AI_LOCAL int              ai_move_counts[AI_MAX_PLY];           // 各深さでの候補手数
+static AI_LOCAL struct Move      ai_moves[AI_MAX_PLY][AI_MAX_MOVES];   // 各深さでの候補手リスト
+static AI_LOCAL struct Move      ai_root_moves[AI_MAX_MOVES];          // 最後に完了した反復のルート候補手
+static AI_LOCAL int              ai_prev_score;                        // 前の反復の最良スコア. アスピレーション窓の中心.
+static AI_LOCAL int              ai_prev_valid;                        // ai_prev_score が使えるか
+
+// 探索スタック
+static AI_LOCAL int stack_depth[AI_MAX_PLY + 1];        // 残り探索深さ
+static AI_LOCAL int stack_alpha[AI_MAX_PLY + 1];        // α値：手番側が保証されている最小値
+static AI_LOCAL int stack_beta[AI_MAX_PLY + 1];         // β値：相手が許す最大値
+static AI_LOCAL int stack_alpha_orig[AI_MAX_PLY + 1];   // ノードに入った時のα値. 置換表の値の種類判定用.
+static AI_LOCAL int stack_best_score[AI_MAX_PLY + 1];   // 各深さでの最良スコア
+static AI_LOCAL int stack_best_move[AI_MAX_PLY + 1];    // 各深さでの最善手のマス番号
+static AI_LOCAL int stack_move_idx[AI_MAX_PLY + 1];     // 現在評価中の手のインデックス
+static AI_LOCAL int stack_null[AI_MAX_PLY + 1];         // 評価中の手をヌルウィンドウで調べているか
+
+// 手の並べ替え
+static AI_LOCAL int          ai_killers[AI_MAX_PLY][2];                // 深さごとのキラー手（βカットを起こした手）
+static AI_LOCAL unsigned int ai_history[2][BB_SQUARES];                // ヒストリ値 [色][マス]. βカットを起こした手ほど大きい.
+
+// 思考時間管理
+static AI_LOCAL unsigned long ai_start_ms;              // 探索開始時刻
+static AI_LOCAL unsigned long ai_limit_ms;              // この手の思考時間. 0なら無制限.
+static AI_LOCAL unsigned long ai_node_count;            // 時間確認用のノードカウンタ
+static AI_LOCAL int           ai_abort;                 // 時間切れで探索を打ち切ったか
+static AI_LOCAL int           ai_endgame;               // 終盤完全読み中か
+static AI_LOCAL int           ai_root_exact;            // ルートの全ての手を通常の窓で調べるか
+static unsigned long          ai_clock_ms[2];           // 各色の持ち時間の残り
+static AI_LOCAL unsigned long ai_charge_ms;             // 持ち時間から引き始めた時刻
+
+// 時分割探索
+#define AI_SLICE_UNLIMITED (~0UL)                       // 持ち分なし（最後まで探索する）
+static AI_LOCAL struct SearchJob ai_job;                // 探索の状態
+static AI_LOCAL unsigned long    ai_slice_size;         // 1回の呼び出しで入ってよいノード数
+static AI_LOCAL unsigned long    ai_slice_left;         // この呼び出しで入ってよいノード数の残り
+static AI_LOCAL unsigned long    ai_probe_left;         // 浅い探索で入ってよいノード数の残り
+static AI_LOCAL int              ai_probe_out;          // 浅い探索が持ち分を使い切ったか
+
+// 先読み
+static struct PonderEntry ai_ponder[AI_PONDER_MOVES]; // 先読みの候補. 人間の手の有望な順.
+static int                ai_ponder_count;            // 候補の数
+static int                ai_ponder_idx;              // 先読み中の候補
+static enum stone_color   ai_ponder_color;            // AIの色
+static int                ai_pondering;               // ai_job が先読みの探索か
+
+// 探索の統計. AI_STATS が0なら数えるコードごと消える.
+#if AI_STATS
+static AI_LOCAL struct AiStats ai_stats;
+#define STATS_RESET()         memset(&ai_stats, 0, sizeof(ai_stats))
+#define STATS_ADD(field)      (ai_stats.field++)
+#define STATS_SET(field, val) (ai_stats.field = (val))
+#else
+#define STATS_RESET()         ((void)0)
+#define STATS_ADD(field)      ((void)0)
+#define STATS_SET(field, val) ((void)0)
+#endif
+
+// 並列探索. ヘルパースレッドはメインスレッドと同じ局面を探索して置換表を埋める.
+#if AI_SMP
+static int           ai_threads = 1;                  // 探索スレッド数
+static AI_LOCAL int  ai_smp_helper;                   // ヘルパースレッドか
+static volatile int  ai_smp_stop;                     // ヘルパースレッドを止める
+static unsigned long ai_smp_nodes;                    // ヘルパースレッドの探索ノード数の合計
+static pthread_t     ai_smp_tid[AI_SMP_MAX_THREADS];  // ヘルパースレッド
+static struct SmpArg ai_smp_arg[AI_SMP_MAX_THREADS];  // ヘルパースレッドの引数
+#define SMP_HELPER() (ai_smp_helper)
+#else
+#define SMP_HELPER()     0
+#endif
+
+// 探索エンジン
+#if AI_MCTS
+static int ai_engine = AI_ENGINE;                     // AI_ENGINE_ALPHABETA か AI_ENGINE_MCTS
+#define USE_MCTS() (ai_engine == AI_ENGINE_MCTS)
+#else
+#define USE_MCTS() 0
+#endif
+/***************************************************************************************************************************/
+
+// 配置可能な場所を全てリストアップ. ビット番号順なのでy, xのラスタ順になる.
+static int generate_moves(const struct Board *brd, enum stone_color sc, struct Move *moves)
+{
+    uint64_t mask = get_placeable_mask(brd, sc);
+    int sq, n = 0;
+
+    while(mask)
+    {
+        sq = bb_first(mask);
+        mask &= mask - 1;
+
+        moves[n].x = BB_SQ_X(sq);
+        moves[n].y = BB_SQ_Y(sq);
+        moves[n].score = -INF;
+        n++;
+    }
+
+    return n;
+}
+
+// 差分更新する評価要素を盤面から計算. 探索のルートで1回だけ使う.
+static void init_eval_terms(const struct Board *brd, struct EvalTerms *et)
+{
+    et->empties = MAT_WIDTH * MAT_HEIGHT - bb_count(brd->stones[stone_red] | brd->stones[stone_green]);
+#if AI_EVAL == AI_EVAL_PATTERN
+    pattern_state_init(&et->pat, brd);
+#endif
+}
+
+// sc が sq に置いて flips を返したときの評価要素の差分更新
+static void update_eval_terms(struct EvalTerms *et, enum stone_color sc, int sq, uint64_t flips)
+{
+    et->empties -= 1;
+#if AI_EVAL == AI_EVAL_PATTERN
+    // 完全読みでは評価関数を使わないので部品は更新しない. 反復深化に戻るときは次の反復の開始で作り直す.
+    if(!ai_endgame) pattern_state_move(&et->pat, sc, sq, flips);
+#else
+    (void)sc;
+    (void)sq;
+    (void)flips;
+#endif
+}
+
+#if AI_EVAL == AI_EVAL_PATTERN
+// パターン評価. AI視点.
+// 辺・隅・斜めのコマの並びごとの学習済みの重みを, 差分更新した部品から足し合わせる.
+static int pattern_score(const struct EvalTerms *et, enum stone_color ai_color)
+{
+    return pattern_state_eval(&et->pat, ai_color, pattern_phase(et->empties));
+}
+
+// 配置可能数評価. AI視点.
+// 自分の手数が多く、相手の手数が少ないほど有利. 重みは進行度ごとに学習済み.
+static int mobility_eval(const struct Board *brd, const struct EvalTerms *et, enum stone_color ai_color)
+{
+    int mobility = count_placeable(brd, ai_color) - count_placeable(brd, OPPONENT(ai_color));
+
+    return mobility * pattern_mobility[pattern_phase(et->empties)];
+}
+#endif
+
+// 葉ノードの評価. AI視点.
+// 差分更新した評価要素から求める. ニューラルネット評価では差分更新したアキュムレータから求める.
+// 窓の外なら配置可能数（葉の評価の時間の約1/3）を省く遅延評価は, 粗い値で増えるノード
+// （ベンチマークで約5%）の方が高くつくのでやめた.
+static int leaf_eval(int ply, enum stone_color ai_color)
+{
+#if AI_EVAL == AI_EVAL_NN
+    return nn_acc_eval(&ai_nn[ply], ai_color);
+#else
+    return pattern_score(&ai_eval[ply], ai_color) + mobility_eval(&ai_board, &ai_eval[ply], ai_color);
+#endif
+}
+
+// 盤面評価関数
+// AI視点でのスコアを計算. 単位は 1/PATTERN_SCALE 石.
+int evaluate_board(const struct Board *brd, enum stone_color ai_color)
+{
+#if AI_EVAL == AI_EVAL_NN
+    return nn_eval(brd->stones[ai_color], brd->stones[OPPONENT(ai_color)]);
+#else
+    struct EvalTerms et;
+
+    init_eval_terms(brd, &et);
+
+    return pattern_score(&et, ai_color) + mobility_eval(brd, &et, ai_color);
+#endif
+}
+
+// 終局時の評価値. 勝ち負けはどんな盤面評価よりも優先する.
+// 手番側p, 相手側oから見た石差. 空きマスは勝った側の石として数える.
+static int final_score(uint64_t p, uint64_t o)
+{
+    int diff = bb_count(p) - bb_count(o);
+    int empties = MAT_WIDTH * MAT_HEIGHT - bb_count(p | o);
+
+    if(diff > 0) return SCORE_WIN + diff + empties;
+    if(diff < 0) return -SCORE_WIN + diff - empties;
+
+    return 0;
+}
+
+// 確定石による最終スコアの上限. 手番側p, 相手側oから見た値.
+// 相手の確定石は最後まで相手のものなので, 石差は 64 - 2 * (相手の確定石数) を超えない.
+// 確定石は評価関数には入れない. 確定石になる辺と隅の並びはパターン評価の辺・隅の形が最終石差から
+// 学習しているので, 別の項にすると二重に数える. 両者の確定石を数えると葉の評価の時間がほぼ倍になる.
+static int stability_bound(uint64_t p, uint64_t o)
+{
+    int diff = MAT_WIDTH * MAT_HEIGHT - 2 * bb_count(bb_stable(o, p));
+
+    if(diff > 0) return SCORE_WIN + diff;
+    if(diff < 0) return -SCORE_WIN + diff;
+
+    return 0;
+}
+
+static int evaluate_final(const struct Board *brd, enum stone_color sc)
+{
+    return final_score(brd->stones[sc], brd->stones[OPPONENT(sc)]);
+}
+
+// 空きマスが奇数個の領域のマスク
+static uint64_t odd_regions(uint64_t empties)
+{
+    uint64_t odd = 0;
+    int i;
+
+    for(i = 0; i < 4; i++)
+    {
+        if(bb_count(empties & QUADRANTS[i]) & 1) odd |= QUADRANTS[i];
+    }
+
+    return odd;
+}
+
+// 時間切れか. AI_TIME_CHECK_NODES ノードごとに時計を見る.
+// ヘルパースレッドはメインスレッドが探索を終えたら打ち切る.
+static int check_time(void)
+{
+    if((++ai_node_count & (AI_TIME_CHECK_NODES - 1)) == 0)
+    {
+        if(ai_limit_ms != 0 && ai_port_get_ms() - ai_start_ms >= ai_limit_ms) ai_abort = 1;
+#if AI_SMP
+        if(ai_smp_helper && ai_smp_stop) ai_abort = 1;
+#endif
+    }
+
+    return ai_abort;
+}
+
+// 浅い探索. 手番側p, 相手側oから見た評価値を返す. Multi-ProbCut と終盤の手の並べ替えで使う.
+// 葉は通常探索と同じ評価（パターン + 配置可能数）. 浅いので置換表と並べ替えは使わない.
+// パターン評価の部品 ps は手番側 sc の一手ごとに写して差分更新する.
+// ai_probe_left ノードを使い切ったら ai_probe_out を立てて打ち切る. 評価値は使われない.
+static int shallow_search(uint64_t p, uint64_t o, const struct PatternState *ps, enum stone_color sc,
+                          int depth, int alpha, int beta, int passed)
+{
+    uint64_t moves = bb_moves(p, o);
+    uint64_t flips;
+    int sq, score;
+#if AI_EVAL == AI_EVAL_PATTERN
+    struct PatternState child;
+    int phase;
+#endif
+    int best_score = -INF;
+
+    if(ai_probe_left == 0)
+    {
+        ai_probe_out = 1;
+        return 0;
+    }
+    ai_probe_left--;
+
+    if(check_time()) return 0;
+
+    if(depth <= 0)
+    {
+        STATS_ADD(leaves);
+#if AI_EVAL == AI_EVAL_NN
+        return nn_eval(p, o);
+#else
+        phase = pattern_phase(MAT_WIDTH * MAT_HEIGHT - bb_count(p | o));
+        return pattern_state_eval(ps, sc, phase) + (bb_count(moves) - bb_count(bb_moves(o, p))) * pattern_mobility[phase];
+#endif
+    }
+
+    if(!moves)
+    {
+        // 両者とも置けなければ終局
+        if(passed)
+        {
+            STATS_ADD(leaves);
+            return final_score(p, o);
+        }
+
+        STATS_ADD(pass_nodes);
+        return -shallow_search(o, p, ps, OPPONENT(sc), depth - 1, -beta, -alpha, 1);
+    }
+
+    while(moves)
+    {
+        sq = bb_first(moves);
+        moves &= moves - 1;
+
+        flips = bb_flips(p, o, sq);
+#if AI_EVAL == AI_EVAL_PATTERN
+        child = *ps;
+        pattern_state_move(&child, sc, sq, flips);
+        score = -shallow_search(o & ~flips, p | flips | BB_BIT(sq), &child, OPPONENT(sc), depth - 1, -beta, -alpha, 0);
+#else
+        score = -shallow_search(o & ~flips, p | flips | BB_BIT(sq), ps, OPPONENT(sc), depth - 1, -beta, -alpha, 0);
+#endif
+
+        if(ai_abort || ai_probe_out) return 0;
+
+        if(score > best_score)
+        {
+            best_score = score;
+            if(score > alpha) alpha = score;
+            if(alpha >= beta)
+            {
+                STATS_ADD(cutoffs);
+                break;
+            }
+        }
+    }
+
+    return best_score;
+}
+
+// 終盤完全読みの並べ替え用の優先度
+// 相手の着手可能数が少ない手ほど先に調べる（速さ優先）. 角と奇数領域の手を優先する.
+// sort_depth >= 0 なら, 打った後の局面を sort_depth 手読んだ評価値（1/PATTERN_SCALE 石）も足す.
+// 浅い探索のノードも持ち分から引く. 持ち分を超えた分は, 次のノードに入る前に止まる.
+static int endgame_order(const struct Board *brd, enum stone_color sc, int sq, uint64_t odd, int sort_depth)
+{
+    uint64_t p = brd->stones[sc];
+    uint64_t o = brd->stones[OPPONENT(sc)];
+    uint64_t flips = bb_flips(p, o, sq);
+    struct Board child;
+    struct PatternState ps;
+    unsigned long used;
+    int score;
+
+    score = -bb_count(bb_moves(o & ~flips, p | flips | BB_BIT(sq))) * EG_ORDER_MOBILITY;
+
+    if(BB_BIT(sq) & BB_CORNERS) score += EG_ORDER_CORNER;
+    if(BB_BIT(sq) & odd)        score += EG_ORDER_PARITY;
+
+    if(sort_depth >= 0)
+    {
+        child.stones[sc]           = p | flips | BB_BIT(sq);
+        child.stones[OPPONENT(sc)] = o & ~flips;
+#if AI_EVAL == AI_EVAL_PATTERN
+        pattern_state_init(&ps, &child);
+#endif
+        ai_probe_left = AI_SLICE_UNLIMITED;
+        ai_probe_out  = 0;
+        score -= shallow_search(child.stones[OPPONENT(sc)], child.stones[sc], &ps, OPPONENT(sc),
+                                sort_depth, -INF, INF, 0);
+
+        used = AI_SLICE_UNLIMITED - ai_probe_left;
+        ai_slice_left = (ai_slice_left > used) ? ai_slice_left - used : 0;
+    }
+
+    return score;
+}
+
+// 候補手に並べ替え用の優先度をつける
+// 置換表の最善手 > キラー手 > ヒストリ値 + 盤面のスコア定義
+// 終盤完全読み中は 置換表の最善手 > 速さ優先 + 偶数理論. 空きマスが多ければ浅い探索の評価値も使う.
+static void score_moves(int ply, enum stone_color sc, int hash_move)
+{
+    struct Move *m = ai_moves[ply];
+    const struct Board *brd = &ai_board;
+    uint64_t odd = 0;
+    int i, sq, sort_depth = -1;
+
+    if(ai_endgame)
+    {
+        odd = odd_regions(~(brd->stones[stone_red] | brd->stones[stone_green]));
+
+        // 空きマスが多いノードは部分木が大きいので, 浅い探索の評価値でも並べる
+        if(ai_eval[ply].empties >= EG_SORT_DEEP_EMPTIES) sort_depth = EG_SORT_DEEP_DEPTH;
+        else if(ai_eval[ply].empties >= EG_SORT_EMPTIES) sort_depth = 0;
+    }
+
+    for(i = 0; i < ai_move_counts[ply]; i++)
+    {
+        sq = BB_SQ(m[i].x, m[i].y);
+
+        if(sq == hash_move)
+        {
+            m[i].score = ORDER_HASH_MOVE;
+        }
+        else if(ai_endgame)
+        {
+            m[i].score = endgame_order(brd, sc, sq, odd, sort_depth);
+        }
+        else if(sq == ai_killers[ply][0])
+        {
+            m[i].score = ORDER_KILLER_1;
+        }
+        else if(sq == ai_killers[ply][1])
+        {
+            m[i].score = ORDER_KILLER_2;
+        }
+        else
+        {
+            m[i].score = (int)ai_history[sc][sq] + POSITION_WEIGHTS[POSITION_INDEX(m[i].y)][POSITION_INDEX(m[i].x)];
+        }
+    }
+}
+
+// idx番目以降で最も優先度の高い手をidx番目に持ってくる
+// βカットが起きると残りの手は並べ替え不要なので, 1手ずつ選択する
+static void pick_next_move(int ply, int idx)
+{
+    struct Move *m = ai_moves[ply];
+    struct Move tmp;
+    int i, best = idx;
+
+    for(i = idx + 1; i < ai_move_counts[ply]; i++)
+    {
+        if(m[i].score > m[best].score) best = i;
+    }
+
+    if(best != idx)
+    {
+        tmp     = m[idx];
+        m[idx]  = m[best];
+        m[best] = tmp;
+    }
+}
+
+// βカットを起こした手を覚える
+static void update_cutoff_move(int ply, enum stone_color sc, int sq, int depth)
+{
+    int i;
+
+    // キラー手
+    if(ai_killers[ply][0] != sq)
+    {
+        ai_killers[ply][1] = ai_killers[ply][0];
+        ai_killers[ply][0] = sq;
+    }
+
+    // ヒストリ値. 深い探索でのカットほど重くする.
+    ai_history[sc][sq] += (unsigned int)(depth * depth);
+
+    if(ai_history[sc][sq] > HISTORY_MAX)
+    {
+        for(i = 0; i < BB_SQUARES; i++)
+        {
+            ai_history[stone_red][i]   >>= 1;
+            ai_history[stone_green][i] >>= 1;
+        }
+    }
+}
+
+// 最後の1マス
+// 手番側が置けなければ相手が置き, どちらも置けなければそのまま終局.
+static int solve_last1(uint64_t p, uint64_t o, int sq)
+{
+    uint64_t flips = bb_flips(p, o, sq);
+
+    if(flips) return final_score(p | flips | BB_BIT(sq), o & ~flips);
+
+    flips = bb_flips(o, p, sq);
+
+    if(flips) return final_score(p & ~flips, o | flips | BB_BIT(sq));
+
+    return final_score(p, o);
+}
+
+// 終盤の末端ソルバ. 手番側p, 相手側oから見た最終石差を返す.
+// 空きマスが少ないので並べ替えは偶数理論だけにして, 再帰で素直に読む.
+// 空きマスが EG_SMALL_EMPTIES 以下なら合法手を生成せず, 空きマスに直接置いてみる.
+static int solve_exact(uint64_t p, uint64_t o, int alpha, int beta, int passed)
+{
+    uint64_t empties = BB_BOARD & ~(p | o);
+    uint64_t cand, odd, part, flips;
+    int n = bb_count(empties);
+    int i, sq, score;
+    int best_score = -INF;
+
+    if(check_time()) return 0;
+
+    if(n == 1)
+    {
+        STATS_ADD(leaves);
+        return solve_last1(p, o, bb_first(empties));
+    }
+
+    // 確定石による枝刈り. 勝ちが必要な窓でだけ調べる.
+    if(alpha >= 0 && n > EG_SMALL_EMPTIES)
+    {
+        score = stability_bound(p, o);
+        if(score <= alpha) return score;
+    }
+
+    cand = (n <= EG_SMALL_EMPTIES) ? empties : bb_moves(p, o);
+    odd  = odd_regions(empties);
+
+    // 奇数領域の手 → 残りの手 の順
+    for(i = 0; i < 2; i++)
+    {
+        part = (i == 0) ? (cand & odd) : (cand & ~odd);
+
+        while(part)
+        {
+            sq = bb_first(part);
+            part &= part - 1;
+
+            flips = bb_flips(p, o, sq);
+            if(!flips) continue;
+
+            score = -solve_exact(o & ~flips, p | flips | BB_BIT(sq), -beta, -alpha, 0);
+
+            if(ai_abort) return 0;
+
+            if(score > best_score)
+            {
+                best_score = score;
+                if(score > alpha) alpha = score;
+                if(alpha >= beta)
+                {
+                    STATS_ADD(cutoffs);
+                    return best_score;
+                }
+            }
+        }
+    }
+
+    if(best_score > -INF) return best_score;
+
+    // 両者とも置けなければ終局
+    if(passed)
+    {
+        STATS_ADD(leaves);
+        return final_score(p, o);
+    }
+
+    // パス
+    STATS_ADD(pass_nodes);
+    return -solve_exact(o, p, -beta, -alpha, 1);
+}
+
+#if AI_MPC
+// a > 0 での切り捨ての割り算
+static long floor_div(long x, long a)
+{
+    long q = x / a;
+
+    if(x % a != 0 && x < 0) q--;
+
+    return q;
+}
+
+// Multi-ProbCut の浅い探索の深さ. このノードで浅い探索をしないなら0を返す.
+// 完全読み中と浅いノードでは刈らない. 持ち分全体でも終わりそうにない深さなら刈らない.
+static int mpc_probe_depth(int ply)
+{
+    int depth = stack_depth[ply];
+    int d, shallow;
+
+    if(ai_endgame || depth < MPC_MIN_DEPTH) return 0;
+
+    d = (depth > MPC_MAX_DEPTH) ? MPC_MAX_DEPTH : depth;
+    shallow = mpc_params[pattern_phase(ai_eval[ply].empties)][d].shallow;
+    if(shallow == 0) return 0;
+
+    // 係数より深いノードは, 浅い探索も同じだけ深くする
+    shallow += depth - d;
+
+    // ノードに入るときに持ち分を1つ使うので, 新しい持ち分で使えるのは ai_slice_size - 1
+    if(MPC_PROBE_NODES(shallow) > ai_slice_size - 1) return 0;
+
+    return shallow;
+}
+
+// Multi-ProbCut
+// 深さ d の値 v を浅い探索の値 s から v ≒ a * s + b と見積もり, 予測が窓から十分外れていれば深い探索を省く.
+// v >= β + t * sigma が見込める s の下限でヌルウィンドウの浅い探索をし, 届けば β を返す（α側も同様）.
+// 刈れたら1を返し, score にこのノードの値を入れる. 刈った値は置換表に入れない.
+// 浅い探索は途中で止めて再開できないので, 呼び出し側はノードに入る前に mpc_probe_depth の見積もりが
+// 持ち分の残りに収まるか確かめ, 収まらなければ次の呼び出しでこのノードからやり直す.
+// 浅い探索のノードも持ち分から引き, 見積もりを超えて持ち分を使い切ったら打ち切って刈らない.
+static int mpc_cut(int ply, enum stone_color sc, int shallow, int *score)
+{
+    const struct MpcParam *mp;
+    uint64_t p   = ai_board.stones[sc];
+    uint64_t o   = ai_board.stones[OPPONENT(sc)];
+    int depth    = stack_depth[ply];
+    int alpha    = stack_alpha[ply];
+    int beta     = stack_beta[ply];
+    int d        = (depth > MPC_MAX_DEPTH) ? MPC_MAX_DEPTH : depth;
+    int margin, cut = 0;
+    long bound;
+#if AI_EVAL == AI_EVAL_PATTERN
+    const struct PatternState *ps = &ai_eval[ply].pat;
+#else
+    const struct PatternState *ps = NULL;
+#endif
+
+    mp     = &mpc_params[pattern_phase(ai_eval[ply].empties)][d];
+    margin = mp->sigma * MPC_T16 / 16;
+
+    ai_probe_left = ai_slice_left;
+    ai_probe_out  = 0;
+
+    // β側. 勝ち負けが決まる窓では刈らない.
+    if(beta < SCORE_WIN / 2)
+    {
+        bound = -floor_div(-((long)beta + margin - mp->b) * MPC_A_SCALE, mp->a);
+        if(bound < SCORE_WIN / 2 && shallow_search(p, o, ps, sc, shallow, (int)bound - 1, (int)bound, 0) >= bound
+        && !ai_abort && !ai_probe_out)
+        {
+            *score = beta;
+            cut = 1;
+        }
+    }
+
+    // α側
+    if(!cut && !ai_probe_out && alpha > -SCORE_WIN / 2)
+    {
+        bound = floor_div(((long)alpha - margin - mp->b) * MPC_A_SCALE, mp->a);
+        if(bound > -SCORE_WIN / 2 && shallow_search(p, o, ps, sc, shallow, (int)bound, (int)bound + 1, 0) <= bound
+        && !ai_abort && !ai_probe_out)
+        {
+            *score = alpha;
+            cut = 1;
+        }
+    }
+
+    // 浅い探索で使ったノードを持ち分から引く
+    ai_slice_left = ai_probe_left;
+
+    return cut;
+}
+#endif
+
+// 子ノードへ進む準備
+// 盤面に手を打ち（sq < 0 ならパス）, ハッシュと手番を更新して窓を反転して引き継ぐ.
+// 打った手は ai_undo[ply] に記録し, 子ノードから戻るときに pop_child で取り消す.
+// null_window が1なら (α, α+1) のヌルウィンドウで調べる.
+static void push_child(int ply, int sq, int null_window)
+{
+    enum stone_color sc = ai_turn[ply];
+
+    make_move(&ai_board, sq, sc, &ai_undo[ply]);
+
+    if(sq < 0)
+    {
+        ai_hash[ply + 1] = tt_hash_pass(ai_hash[ply]);
+        ai_eval[ply + 1] = ai_eval[ply];
+#if AI_EVAL == AI_EVAL_NN
+        ai_nn[ply + 1]   = ai_nn[ply];
+#endif
+    }
+    else
+    {
+        ai_hash[ply + 1] = tt_hash_move(ai_hash[ply], sq, ai_undo[ply].flips, sc);
+        ai_eval[ply + 1] = ai_eval[ply];
+        update_eval_terms(&ai_eval[ply + 1], sc, sq, ai_undo[ply].flips);
+#if AI_EVAL == AI_EVAL_NN
+        nn_acc_move(&ai_nn[ply], &ai_nn[ply + 1], sc, sq, ai_undo[ply].flips);
+#endif
+    }
+
+    ai_turn[ply + 1]     = OPPONENT(sc);
+    stack_depth[ply + 1] = stack_depth[ply] - 1;
+    stack_alpha[ply + 1] = null_window ? -(stack_alpha[ply] + 1) : -stack_beta[ply];
+    stack_beta[ply + 1]  = -stack_alpha[ply];
+    stack_null[ply]      = null_window;
+}
+
+// 子ノードから戻る. push_child で打った手を取り消す.
+// 差分評価要素とアキュムレータは深さごとに持つので戻さなくてよい.
+static void pop_child(int ply)
+{
+    unmake_move(&ai_board, ai_turn[ply], &ai_undo[ply]);
+}
+
+// ネガマックス法 + PVS(Principal Variation Search) + 置換表
+// 最初の手だけ通常の窓で調べ, 残りの手は「最善手より良くないこと」をヌルウィンドウで確かめる.
+// 確かめに失敗した（より良かった）手だけ通常の窓で再探索する.
+// 深さ優先探索をループで実装. ループの状態は ai_job に置き, 途中で止めて続きから再開できる.
+// 探索を始める. 続きは negamax_resume で進める.
+static void negamax_start(int root_ply, int depth, int alpha, int beta)
+{
+    stack_depth[root_ply] = depth;
+    stack_alpha[root_ply] = alpha;
+    stack_beta[root_ply]  = beta;
+
+    ai_job.nm_root     = root_ply;
+    ai_job.nm_ply      = root_ply;
+    ai_job.nm_score    = 0;
+    ai_job.nm_entering = 1;
+}
+
+// 探索を進める. 終わったら1を返し, ai_job.nm_score に深さ root_ply の局面をその手番側から見た評価値が入る.
+// 時分割の持ち分のノード数を使い切ったら, 次のノードに入る前で止めて0を返す.
+static int negamax_resume(void)
+{
+    struct TTEntry tte;
+    enum stone_color sc;
+    int root_ply = ai_job.nm_root;
+    int ply      = ai_job.nm_ply;
+    int score    = ai_job.nm_score;
+    int entering = ai_job.nm_entering; // 1..ノードに入る, 0..評価値を親ノードに返す
+    int idx, hash_move;
+    unsigned long need; // このノードに入るのに要る持ち分
+#if AI_MPC
+    int shallow;
+#endif
+
+    while(1)
+    {
+        // ノードに入る
+        if(entering)
+        {
+            // 持ち分を使い切った. このノードから再開する.
+            // Multi-ProbCut の浅い探索をするノードは, 浅い探索が持ち分の残りに収まらなければ
+            // 持ち分を使う前に止める. 浅い探索は途中で止めて再開できない.
+            need = 1;
+#if AI_MPC
+            shallow = mpc_probe_depth(ply);
+            if(shallow > 0) need += MPC_PROBE_NODES(shallow);
+#endif
+            if(ai_slice_left < need)
+            {
+                ai_job.nm_ply      = ply;
+                ai_job.nm_entering = 1;
+                return 0;
+            }
+            ai_slice_left--;
+
+            sc = ai_turn[ply];
+            entering = 0;
+
+            // 時間切れなら探索を打ち切る. 評価値は使われない.
+            if(check_time())
+            {
+                ai_job.nm_score = 0;
+                return 1;
+            }
+
+            // 終盤完全読みの末端. 空きマスが少なくなったら再帰のソルバで読み切る.
+            // 空きマスが少ないので一度に読み切っても時間はかからない. 深さは EG_MAX_PLY を超えない.
+            if(ai_endgame && ai_eval[ply].empties <= EG_LEAF_EMPTIES)
+            {
+                score = solve_exact(ai_board.stones[sc], ai_board.stones[OPPONENT(sc)],
+                                    stack_alpha[ply], stack_beta[ply], 0);
+                if(ai_abort)
+                {
+                    ai_job.nm_score = 0;
+                    return 1;
+                }
+                continue;
+            }
+
+            // 終盤完全読みの確定石による枝刈り. 最善でもαに届かなければ調べない.
+            if(ai_endgame && stack_alpha[ply] >= 0)
+            {
+                score = stability_bound(ai_board.stones[sc], ai_board.stones[OPPONENT(sc)]);
+                if(score <= stack_alpha[ply]) continue;
+            }
+
+            // 葉ノード到達
+            // 指定した深さまで探索完了
+            if(stack_depth[ply] <= 0)
+            {
+                STATS_ADD(leaves);
+                score = leaf_eval(ply, sc);
+                continue;
+            }
+
+            // 同じ局面を十分な深さで探索済みなら置換表の値を使う
+            hash_move = TT_NO_MOVE;
+            if(tt_probe(ai_hash[ply], &tte))
+            {
+                STATS_ADD(tt_hits);
+                hash_move = tte.move;
+                if(tte.depth >= stack_depth[ply]
+                && ((tte.bound == tt_exact)
+                 || (tte.bound == tt_lower && tte.score >= stack_beta[ply])
+                 || (tte.bound == tt_upper && tte.score <= stack_alpha[ply])))
+                {
+                    score = tte.score;
+                    continue;
+                }
+            }
+
+#if AI_MPC
+            // 深いノードは浅い探索で見込みを調べ, 窓の外になりそうなら調べない
+            if(shallow > 0 && mpc_cut(ply, sc, shallow, &score)) continue;
+#endif
+
+            // このノードの候補手を生成
+            ai_move_counts[ply]   = generate_moves(&ai_board, sc, ai_moves[ply]);
+            stack_alpha_orig[ply] = stack_alpha[ply];
+            stack_best_score[ply] = -INF;
+            stack_best_move[ply]  = TT_NO_MOVE;
+            stack_move_idx[ply]   = 0;
+
+            // 手がない場合
+            if(ai_move_counts[ply] == 0)
+            {
+                // 両者とも置けなければ終局
+                if(count_placeable(&ai_board, OPPONENT(sc)) == 0)
+                {
+                    STATS_ADD(leaves);
+                    score = evaluate_final(&ai_board, sc);
+                    continue;
+                }
+
+                // パス. 同じ盤面を相手の手番で探索する
+                STATS_ADD(pass_nodes);
+                push_child(ply, -1, 0);
+            }
+            else
+            {
+                // 有望な手から順に調べる
+                score_moves(ply, sc, hash_move);
+                pick_next_move(ply, 0);
+
+                // 最初の手を通常の窓で打つ
+                push_child(ply, BB_SQ(ai_moves[ply][0].x, ai_moves[ply][0].y), 0);
+            }
+
+            // 子ノードへ
+            ply++;
+            entering = 1;
+            continue;
+        }
+
+        // 評価値を親ノードに返す
+        if(ply == root_ply)
+        {
+            ai_job.nm_score = score;
+            return 1;
+        }
+
+        ply--;
+        pop_child(ply);
+        score = -score;
+
+        // パスしたノードは子の評価値がそのままこのノードの評価値
+        if(ai_move_counts[ply] == 0) continue;
+
+        idx = stack_move_idx[ply];
+
+        // ヌルウィンドウの確かめに失敗. 窓の中の値なので通常の窓で再探索する.
+        if(stack_null[ply] && score > stack_alpha[ply] && score < stack_beta[ply])
+        {
+            push_child(ply, BB_SQ(ai_moves[ply][idx].x, ai_moves[ply][idx].y), 0);
+            ply++;
+            entering = 1;
+            continue;
+        }
+
+        // より良いスコアを選択
+        if(score > stack_best_score[ply])
+        {
+            stack_best_score[ply] = score;
+            stack_best_move[ply]  = BB_SQ(ai_moves[ply][idx].x, ai_moves[ply][idx].y);
+        }
+
+        // α値更新
+        if(stack_best_score[ply] > stack_alpha[ply])
+        {
+            stack_alpha[ply] = stack_best_score[ply];
+        }
+
+        // β枝刈り
+        // 相手がこのルートを選ばないことが確定
+        if(stack_alpha[ply] >= stack_beta[ply])
+        {
+            STATS_ADD(cutoffs);
+            update_cutoff_move(ply, ai_turn[ply], stack_best_move[ply], stack_depth[ply]);
+            tt_store(ai_hash[ply], stack_depth[ply], stack_best_score[ply], tt_lower, stack_best_move[ply]);
+            score = stack_best_score[ply];
+            continue;
+        }
+
+        // すべての候補手を評価済みの場合
+        idx++;
+        if(idx >= ai_move_counts[ply])
+        {
+            tt_store(ai_hash[ply], stack_depth[ply], stack_best_score[ply],
+                     (stack_best_score[ply] > stack_alpha_orig[ply]) ? tt_exact : tt_upper, stack_best_move[ply]);
+            score = stack_best_score[ply];
+            continue;
+        }
+
+        // 次の手をヌルウィンドウで試す
+        stack_move_idx[ply] = idx;
+        pick_next_move(ply, idx);
+        push_child(ply, BB_SQ(ai_moves[ply][idx].x, ai_moves[ply][idx].y), 1);
+        ply++;
+        entering = 1;
+    }
+}
+
+// ルートの i 番目の手と対称な手を, この反復ですでに調べていればその番号を返す. なければ-1を返す.
+static int root_symmetric(int i)
+{
+    uint64_t m = BB_BIT(BB_SQ(ai_moves[0][i].x, ai_moves[0][i].y));
+    int j, k;
+
+    for(j = 0; j < i && ai_job.root_sym; j++)
+    {
+        for(k = 1; k < 8; k++)
+        {
+            if(((ai_job.root_sym >> k) & 1)
+            && bb_symmetry(BB_BIT(BB_SQ(ai_moves[0][j].x, ai_moves[0][j].y)), k) == m) return j;
+        }
+    }
+
+    return -1;
+}
+
+// ルートノードの探索
+// 窓 (alpha, beta) で全候補手を調べ, 最良スコアを ai_job.root_best に求める. 前の兄弟の最良スコアを次の手の下限に引き継ぐ.
+// 同点の手をランダムに選べるよう, 2手目以降は「最良スコア - 1」を下限にしたヌルウィンドウで調べる.
+// 最良スコアが beta 以上になった時点で打ち切る. ルート局面が対称なら, 対称な手は先に調べた手の値を使う.
+// 探索を始める. 続きは root_resume で進める.
+static void root_start(void)
+{
+    ai_job.root_idx       = 0;
+    ai_job.root_best      = -INF;
+    ai_job.root_searching = 0;
+    stack_best_move[0]    = TT_NO_MOVE;
+}
+
+// 探索を進める. 終わったら1, 持ち分を使い切ったら0を返す.
+static int root_resume(void)
+{
+    int i, j, sq, score;
+
+    while(1)
+    {
+        i = ai_job.root_idx;
+
+        // 次の手の探索を始める
+        if(!ai_job.root_searching)
+        {
+            if(i >= ai_move_counts[0]) return 1;
+
+            pick_next_move(0, i);
+            sq = BB_SQ(ai_moves[0][i].x, ai_moves[0][i].y);
+
+            // 対称な手を調べ終えていれば同じ値なので探索しない. 上限値なら上限値のまま使う.
+            j = root_symmetric(i);
+            if(j >= 0)
+            {
+                ai_moves[0][i].score = ai_moves[0][j].score;
+                ai_job.root_idx = i + 1;
+                continue;
+            }
+
+            // 手を打って深さ1から探索開始（相手のターン）
+            push_child(0, sq, 0);
+
+            // ai_root_exact なら全ての手の正確な値を求める（先読みの候補の並べ替え）
+            if(i == 0 || ai_root_exact)
+            {
+                ai_job.root_null = 0;
+                negamax_start(1, ai_job.depth - 1, -ai_job.beta, -ai_job.alpha);
+            }
+            else
+            {
+                ai_job.root_lower = (ai_job.root_best - 1 > ai_job.alpha) ? ai_job.root_best - 1 : ai_job.alpha;
+                ai_job.root_null  = 1;
+                negamax_start(1, ai_job.depth - 1, -(ai_job.root_lower + 1), -ai_job.root_lower);
+            }
+            ai_job.root_searching = 1;
+        }
+
+        if(!negamax_resume()) return 0;
+
+        score = -ai_job.nm_score;
+
+        // 時間切れ. この深さの結果は途中までなので使わない.
+        // 盤面は途中の局面のままだが, 次の反復の開始で戻す.
+        if(ai_abort)
+        {
+            ai_job.root_best = -INF;
+            return 1;
+        }
+
+        // 最良スコア以上の可能性がある手は正確な値を求める
+        if(ai_job.root_null && score > ai_job.root_lower && score < ai_job.beta)
+        {
+            ai_job.root_null = 0;
+            negamax_start(1, ai_job.depth - 1, -ai_job.beta, -ai_job.root_lower);
+            continue;
+        }
+
+        pop_child(0);
+        ai_job.root_searching = 0;
+
+        // ルートノードの各手のスコアを記録
+        // 最良スコアに届かなかった手は上限値が入る. ai_root_exact なら窓の中の正確な値が入る.
+        ai_moves[0][i].score = score;
+        if(score > ai_job.root_best)
+        {
+            ai_job.root_best   = score;
+            stack_best_move[0] = BB_SQ(ai_moves[0][i].x, ai_moves[0][i].y);
+        }
+
+        if(ai_job.root_best >= ai_job.beta)
+        {
+            STATS_ADD(cutoffs);
+            return 1;
+        }
+
+        ai_job.root_idx = i + 1;
+    }
+}
+
+// ルート局面 ai_job.brd をセットして深さ depth の探索を始める. 続きは iteration_resume で進める.
+// 前の反復の最良スコアが分かっていればその周りのアスピレーション窓で探索する.
+// 置ける場所がなければ0を返す.
+static int iteration_start(int depth)
+{
+    struct TTEntry tte;
+    int k;
+
+    // 初期化
+	// 現在の盤面をシミュレーション用バッファにコピー
+    ai_board       = ai_job.brd;
+    ai_hash[0]     = tt_hash(&ai_job.brd, ai_job.sc);
+    init_eval_terms(&ai_job.brd, &ai_eval[0]);
+#if AI_EVAL == AI_EVAL_NN
+    nn_acc_init(&ai_nn[0], &ai_job.brd);
+#endif
+    ai_turn[0]     = ai_job.sc;
+    stack_depth[0] = depth;
+
+    // ルートノード（深さ0）の候補手を生成
+    ai_move_counts[0] = generate_moves(&ai_board, ai_job.sc, ai_moves[0]);
+
+    // 配置可能な場所がない場合
+    if(ai_move_counts[0] == 0) return 0;
+
+    // 置換表の世代はメインスレッドだけが進める
+    if(!SMP_HELPER()) tt_new_search();
+
+    // 前の反復の最善手から順に調べる
+    score_moves(0, ai_job.sc, tt_probe(ai_hash[0], &tte) ? tte.move : TT_NO_MOVE);
+
+    // ルート局面が対称なら, 対称な手は同じ値になるので1つだけ調べる
+    ai_job.root_sym = 0;
+    for(k = 1; k < 8; k++)
+    {
+        if(bb_symmetry(ai_board.stones[stone_red], k) == ai_board.stones[stone_red]
+        && bb_symmetry(ai_board.stones[stone_green], k) == ai_board.stones[stone_green])
+        {
+            ai_job.root_sym |= 1 << k;
+        }
+    }
+
+    // アスピレーション窓
+    ai_job.depth = depth;
+    ai_job.alpha = -INF;
+    ai_job.beta  = INF;
+    if(ai_prev_valid)
+    {
+        ai_job.alpha = ai_prev_score - ASPIRATION_WINDOW;
+        ai_job.beta  = ai_prev_score + ASPIRATION_WINDOW;
+    }
+
+    root_start();
+
+    return 1;
+}
+
+// 探索を進める. 終わったら1, 持ち分を使い切ったら0を返す.
+// 窓を外れたら窓を広げて探索し直す. 最良スコアは ai_job.root_best に入る.
+static int iteration_resume(void)
+{
+    while(1)
+    {
+        if(!root_resume()) return 0;
+
+        if(ai_abort) return 1;
+
+        // 窓より下. 下側を広げて探索し直す.
+        if(ai_job.root_best <= ai_job.alpha && ai_job.alpha > -INF)
+        {
+            ai_job.alpha = -INF;
+            root_start();
+            continue;
+        }
+
+        // 窓より上. 上側を広げて探索し直す.
+        if(ai_job.root_best >= ai_job.beta && ai_job.beta < INF)
+        {
+            ai_job.beta = INF;
+            root_start();
+            continue;
+        }
+
+        break;
+    }
+
+    tt_store(ai_hash[0], ai_job.depth, ai_job.root_best, tt_exact, stack_best_move[0]);
+
+    return 1;
+}
+
+// ルート局面をセットして最後まで探索する
+static int search(const struct Board *brd, enum stone_color ai_color, int max_depth)
+{
+    ai_job.brd = *brd;
+    ai_job.sc  = ai_color;
+
+    if(!iteration_start(max_depth)) return -INF;
+
+    ai_slice_size = AI_SLICE_UNLIMITED;
+    ai_slice_left = AI_SLICE_UNLIMITED;
+    iteration_resume();
+
+    return ai_abort ? -INF : ai_job.root_best;
+}
+
+// ミニマックス法 + αβ枝刈り（ネガマックス + PVS で実装）
+// AIが最善の手を見つけるため、相手も最善手を打つと仮定して先読みする.
+int minimax_alphabeta(const struct Board *brd, enum stone_color ai_color, int max_depth)
+{
+    // バッファを超える深さは探索できない
+    if(max_depth > AI_MAX_DEPTH) max_depth = AI_MAX_DEPTH;
+    if(max_depth < 1) max_depth = 1;
+
+    // 探索用バッファを使うので時分割探索は打ち切る
+    ai_search_cancel();
+
+    return search(brd, ai_color, max_depth);
+}
+
+// 終盤完全読み
+// 終局まで読み切ってルートの各候補手の最終石差（SCORE_WIN 込みの評価値）を求める.
+static int solve_endgame(const struct Board *brd, enum stone_color ai_color)
+{
+    int score;
+
+    ai_endgame = 1;
+    score = search(brd, ai_color, EG_DEPTH);
+    ai_endgame = 0;
+
+    return score;
+}
+
+// キラー手とヒストリ値を消す
+static void clear_ordering(void)
+{
+    int i;
+
+    for(i = 0; i < BB_SQUARES; i++)
+    {
+        ai_history[stone_red][i]   = 0;
+        ai_history[stone_green][i] = 0;
+    }
+
+    for(i = 0; i < AI_MAX_PLY; i++)
+    {
+        ai_killers[i][0] = TT_NO_MOVE;
+        ai_killers[i][1] = TT_NO_MOVE;
+    }
+}
+
+// 新しい対局を始める. 前の対局の探索結果を捨てて持ち時間を戻す.
+void ai_new_game(void)
+{
+    ai_search_cancel();
+    tt_clear();
+    clear_ordering();
+#if AI_MCTS
+    mcts_new_game();
+#endif
+
+    ai_clock_ms[stone_red]   = AI_GAME_TIME_MS;
+    ai_clock_ms[stone_green] = AI_GAME_TIME_MS;
+
+    ai_ponder_count = 0;
+    ai_ponder_idx   = 0;
+}
+
+// 持ち時間の残りと空きマス数からこの手の思考時間を決める
+unsigned long ai_time_budget(const struct Board *brd, enum stone_color sc)
+{
+    int empties = MAT_WIDTH * MAT_HEIGHT - bb_count(brd->stones[stone_red] | brd->stones[stone_green]);
+    int moves_left = (empties + 1) / 2; // 自分の残り手数の目安
+    unsigned long budget;
+
+    if(moves_left < 1) moves_left = 1;
+
+    budget = ai_clock_ms[sc] / (unsigned long)moves_left;
+
+    if(budget < AI_MIN_MOVE_MS) budget = AI_MIN_MOVE_MS;
+    if(budget > AI_MAX_MOVE_MS) budget = AI_MAX_MOVE_MS;
+
+    return budget;
+}
+
+// 完全読みに使ってよい時間. 残りは読み切れなかったときの反復深化に回す.
+static unsigned long endgame_limit(unsigned long time_ms)
+{
+    return time_ms - time_ms / 2; // 0（無制限）は0のまま
+}
+
+// 1手分の探索
+// 終盤なら思考時間の半分まで完全読みを試し, 読み切れなければ time_ms まで反復深化する. 同点の手はランダムに選ぶ.
+// 探索を始める. 続きは think_resume で進める.
+static void think_start(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms)
+{
+    ai_job.brd        = *brd;
+    ai_job.sc         = sc;
+    ai_job.max_depth  = max_depth;
+    ai_job.time_ms    = time_ms;
+    ai_job.empties    = MAT_WIDTH * MAT_HEIGHT - bb_count(brd->stones[stone_red] | brd->stones[stone_green]);
+    ai_job.done_depth = 0;
+    ai_job.root_count = 0;
+    ai_job.best_score = -INF;
+    ai_job.stage      = job_running;
+
+    STATS_RESET();
+    ai_start_ms   = ai_port_get_ms();
+    ai_charge_ms  = ai_start_ms;
+    ai_node_count = 0;
+    ai_abort      = 0;
+    ai_endgame    = 0;
+    ai_prev_valid = 0;
+
+    ai_job.id_start_ms = ai_start_ms;
+
+    // 終盤完全読み. 時間内に読み切れたらその結果を使う.
+    if(ai_job.empties <= AI_ENDGAME_EMPTIES)
+    {
+        ai_endgame  = 1;
+        ai_limit_ms = endgame_limit(time_ms);
+        if(iteration_start(EG_DEPTH)) return;
+    }
+    // 反復深化
+    // 深さ1から順に探索し, 時間切れになったら最後に完了した深さの結果を使う
+    // 深さ1は必ず完了させる
+    else
+    {
+        ai_limit_ms = 0;
+        if(iteration_start(1)) return;
+    }
+
+    // 置ける場所がない
+    ai_endgame   = 0;
+    ai_job.stage = job_done;
+}
+
+// 完了した反復の結果を記録する
+static void think_record(void)
+{
+    int i;
+
+    ai_job.root_count = ai_move_counts[0];
+    ai_job.best_score = ai_job.root_best;
+    for(i = 0; i < ai_job.root_count; i++)
+    {
+        ai_root_moves[i] = ai_moves[0][i];
+    }
+}
+
+// 探索を終えて最善手を選ぶ. 同じスコアの手が複数あればランダムに選ぶ.
+static void think_finish(void)
+{
+    int i, best_idx, best_count;
+
+    ai_endgame   = 0;
+    ai_job.stage = job_done;
+
+    // ヘルパースレッドの結果は使わない. 乱数も消費しない.
+    if(SMP_HELPER()) return;
+
+    STATS_SET(nodes, ai_node_count);
+    STATS_SET(elapsed_ms, ai_port_get_ms() - ai_start_ms);
+
+    // 同じスコアの手が複数ある場合をカウント
+    best_count = 0;
+
+    for(i = 0; i < ai_job.root_count; i++)
+    {
+        if(ai_root_moves[i].score == ai_job.best_score)
+        {
+            ai_entry_idx[best_count] = i;  // 同点の手のインデックスを記録
+            best_count++;
+        }
+    }
+
+    // 同点の場合はランダムに選択
+    if(best_count > 1)
+    {
+        best_idx = ai_entry_idx[rand() % best_count];
+    }
+    else
+    {
+        best_idx = ai_entry_idx[0];
+    }
+
+    ai_job.x = ai_root_moves[best_idx].x;
+    ai_job.y = ai_root_moves[best_idx].y;
+}
+
+// 探索を進める. 終わったら1, 持ち分を使い切ったら0を返す.
+// 最善手は ai_job.x, ai_job.y, 完了した深さは ai_job.done_depth（完全読みで決めたら EG_DEPTH）に入る.
+static int think_resume(void)
+{
+    int next;
+    unsigned long elapsed, used;
+
+    if(ai_job.stage != job_running) return 1;
+
+    while(1)
+    {
+        if(!iteration_resume()) return 0;
+
+        if(ai_job.depth == EG_DEPTH)
+        {
+            ai_endgame = 0;
+
+            if(!ai_abort)
+            {
+                // 反復深化は不要
+                think_record();
+                ai_job.done_depth = EG_DEPTH;
+                STATS_SET(depth, ai_job.empties);
+                break;
+            }
+
+            // 読み切れなければ残り時間で反復深化する
+            ai_abort = 0;
+            ai_job.id_start_ms = ai_port_get_ms();
+            next = 1;
+        }
+        else
+        {
+            if(ai_abort) break;
+
+            // 完了した深さの結果を記録
+            think_record();
+            ai_prev_score     = ai_job.root_best;
+            ai_prev_valid     = 1;
+            ai_job.done_depth = ai_job.depth;
+            STATS_SET(depth, ai_job.depth);
+
+            // 残り時間で次の深さが終わりそうにない場合はやめる
+            // 完全読みに使った時間は除いて, 反復深化に残った時間と比べる.
+            if(ai_job.time_ms != 0)
+            {
+                elapsed = ai_port_get_ms() - ai_job.id_start_ms;
+                used    = ai_job.id_start_ms - ai_start_ms;
+                if(used >= ai_job.time_ms || elapsed * 2 >= ai_job.time_ms - used) break;
+            }
+
+            next = ai_job.depth + 1;
+            if(next > ai_job.max_depth) break;
+        }
+
+        ai_limit_ms = (next == 1) ? 0 : ai_job.time_ms;
+        iteration_start(next);
+    }
+
+    think_finish();
+
+    return 1;
+}
+
+// 先読みした局面を探す. なければNULL.
+static const struct PonderEntry *ponder_find(const struct Board *brd, enum stone_color sc)
+{
+    int i;
+
+    if(sc != ai_ponder_color) return NULL;
+
+    for(i = 0; i < ai_ponder_count; i++)
+    {
+        if(ai_ponder[i].brd.stones[stone_red]   == brd->stones[stone_red]
+        && ai_ponder[i].brd.stones[stone_green] == brd->stones[stone_green])
+        {
+            return &ai_ponder[i];
+        }
+    }
+
+    return NULL;
+}
+
+// 探索を始める
+void ai_search_start(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms)
+{
+    const struct PonderEntry *pe;
+
+    if(max_depth > AI_MAX_DEPTH) max_depth = AI_MAX_DEPTH;
+    if(max_depth < 1) max_depth = 1;
+
+#if AI_MCTS
+    // MCTSは前の木を引き継ぐので先読みしない. 終わったら ai_search_step で結果を ai_job に写す.
+    if(USE_MCTS())
+    {
+        ai_search_cancel();
+        ai_job.sc    = sc;
+        ai_job.stage = job_running;
+        ai_charge_ms = ai_port_get_ms();
+        mcts_search_start(brd, sc, max_depth, time_ms);
+        return;
+    }
+#endif
+
+    // 先読みの結果はこの手で使い切る
+    pe = ponder_find(brd, sc);
+    ai_ponder_count = 0;
+
+    // 先読みで読み終えていればすぐに返す
+    if(pe != NULL && pe->depth > 0)
+    {
+        ai_search_cancel();
+        STATS_RESET();
+        STATS_SET(depth, pe->depth);
+        ai_job.x          = pe->x;
+        ai_job.y          = pe->y;
+        ai_job.done_depth = pe->depth;
+        ai_job.best_score = pe->score;
+        ai_job.root_count = 1;
+        ai_job.stage      = job_done;
+        return;
+    }
+
+    // 先読みの途中の局面ならその探索を引き継ぐ. 先読みに使った時間も思考時間に含める.
+    if(pe == &ai_ponder[ai_ponder_idx] && ai_pondering && ai_job.stage == job_running)
+    {
+        ai_pondering     = 0;
+        ai_charge_ms     = ai_port_get_ms();
+        ai_job.max_depth = max_depth;
+        ai_job.time_ms   = time_ms;
+        if(ai_limit_ms != 0) ai_limit_ms = (ai_job.depth == EG_DEPTH) ? endgame_limit(time_ms) : time_ms;
+        return;
+    }
+
+    ai_search_cancel();
+    think_start(brd, sc, max_depth, time_ms);
+}
+
+// 探索を最大 nodes ノード進める
+int ai_search_step(unsigned long nodes, int *x, int *y)
+{
+    unsigned long elapsed;
+#if AI_MCTS
+    int state;
+#endif
+
+    if(ai_job.stage == job_running)
+    {
+#if AI_MCTS
+        if(USE_MCTS())
+        {
+            state = mcts_search_step((nodes + MCTS_PLAYOUT_NODES - 1) / MCTS_PLAYOUT_NODES, &ai_job.x, &ai_job.y);
+            if(state == ai_search_running) return ai_search_running;
+
+            ai_job.stage      = job_done;
+            ai_job.root_count = (state == ai_search_done);
+            ai_job.best_score = mcts_get_win_rate();
+            STATS_RESET();
+            STATS_SET(nodes, mcts_get_playouts());
+            STATS_SET(elapsed_ms, ai_port_get_ms() - ai_charge_ms);
+        }
+        else
+#endif
+        {
+            ai_slice_size = (nodes != 0) ? nodes : AI_SLICE_UNLIMITED;
+            ai_slice_left = ai_slice_size;
+            if(!think_resume()) return ai_search_running;
+        }
+
+        // 使った時間を持ち時間から引く
+        elapsed = ai_port_get_ms() - ai_charge_ms;
+        ai_clock_ms[ai_job.sc] = (ai_clock_ms[ai_job.sc] > elapsed) ? ai_clock_ms[ai_job.sc] - elapsed : 0;
+    }
+
+    if(ai_job.stage != job_done || ai_job.root_count == 0) return ai_search_no_move;
+
+    *x = ai_job.x;
+    *y = ai_job.y;
+
+    return ai_search_done;
+}
+
+// 探索を打ち切る
+void ai_search_cancel(void)
+{
+#if AI_MCTS
+    mcts_search_cancel();
+#endif
+    ai_job.stage = job_idle;
+    ai_pondering = 0;
+    ai_endgame   = 0;
+    ai_abort     = 0;
+}
+
+#if AI_SMP
+// ヘルパースレッド
+// メインスレッドと同じ局面を時間制限なしで反復深化し, 止められるまで置換表を埋める.
+// 奇数番のスレッドは深さ2から始めて, メインスレッドと違う深さを調べるようにする.
+static void *smp_helper(void *arg)
+{
+    struct SmpArg *a = (struct SmpArg *)arg;
+
+    ai_smp_helper = 1;
+    clear_ordering();
+
+    think_start(&a->brd, a->sc, a->max_depth, 0);
+    if(ai_job.stage == job_running && ai_job.depth == 1 && (a->id & 1) && a->max_depth > 1)
+    {
+        iteration_start(2);
+    }
+
+    ai_slice_size = AI_SLICE_UNLIMITED;
+    ai_slice_left = AI_SLICE_UNLIMITED;
+    think_resume();
+
+    a->nodes = ai_node_count;
+
+    return NULL;
+}
+
+// ヘルパースレッドを起動する
+static void smp_start(const struct Board *brd, enum stone_color sc, int max_depth)
+{
+    int i;
+
+    ai_smp_stop  = 0;
+    ai_smp_nodes = 0;
+
+    for(i = 1; i < ai_threads; i++)
+    {
+        ai_smp_arg[i].brd       = *brd;
+        ai_smp_arg[i].sc        = sc;
+        ai_smp_arg[i].max_depth = max_depth;
+        ai_smp_arg[i].id        = i;
+        ai_smp_arg[i].nodes     = 0;
+        pthread_create(&ai_smp_tid[i], NULL, smp_helper, &ai_smp_arg[i]);
+    }
+}
+
+// ヘルパースレッドを止めて待つ
+static void smp_stop(void)
+{
+    int i;
+
+    ai_smp_stop = 1;
+
+    for(i = 1; i < ai_threads; i++)
+    {
+        pthread_join(ai_smp_tid[i], NULL);
+        ai_smp_nodes += ai_smp_arg[i].nodes;
+    }
+}
+
+// 探索スレッド数を決める
+void ai_set_threads(int n)
+{
+    if(n < 1) n = 1;
+    if(n > AI_SMP_MAX_THREADS) n = AI_SMP_MAX_THREADS;
+
+    ai_threads = n;
+#if AI_MCTS
+    mcts_set_threads(n);
+#endif
+}
+#endif
+
+// 最善手を選ぶ
+int ai_select_move(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms, int *x, int *y)
+{
+    int state;
+
+    ai_search_start(brd, sc, max_depth, time_ms);
+
+#if AI_SMP
+    ai_smp_nodes = 0;
+    if(ai_job.stage == job_running && ai_threads > 1 && !USE_MCTS())
+    {
+        smp_start(brd, sc, ai_job.max_depth);
+        state = ai_search_step(0, x, y);
+        smp_stop();
+        return state == ai_search_done;
+    }
+#endif
+
+    state = ai_search_step(0, x, y);
+
+    return state == ai_search_done;
+}
+
+// 先読みを始める
+void ai_ponder_start(const struct Board *brd, enum stone_color human)
+{
+    struct PonderEntry *pe;
+    struct Move tmp;
+    uint64_t flips;
+    int i, j, n, sq;
+
+    ai_ponder_count = 0;
+    ai_ponder_idx   = 0;
+    ai_ponder_color = OPPONENT(human);
+
+    ai_search_cancel();
+
+    if(!get_placeable_mask(brd, human) || USE_MCTS()) return;
+
+    // 人間の候補手を浅い探索の評価の高い順に並べる
+    // ヌルウィンドウで調べた手の値は上限でしかないので, 全ての手を窓 (-INF, INF) で調べて正確な値で並べる.
+    ai_start_ms   = ai_port_get_ms();
+    ai_node_count = 0;
+    ai_limit_ms   = 0;
+    ai_prev_valid = 0;
+    ai_root_exact = 1;
+    minimax_alphabeta(brd, human, PONDER_ORDER_DEPTH);
+    ai_root_exact = 0;
+
+    n = ai_move_counts[0];
+    for(i = 1; i < n; i++)
+    {
+        tmp = ai_moves[0][i];
+        for(j = i; j > 0 && ai_moves[0][j - 1].score < tmp.score; j--)
+        {
+            ai_moves[0][j] = ai_moves[0][j - 1];
+        }
+        ai_moves[0][j] = tmp;
+    }
+
+    if(n > AI_PONDER_MOVES) n = AI_PONDER_MOVES;
+
+    // 人間が打った後の局面を先読みの候補にする
+    for(i = 0; i < n; i++)
+    {
+        pe  = &ai_ponder[i];
+        sq  = BB_SQ(ai_moves[0][i].x, ai_moves[0][i].y);
+        flips = bb_flips(brd->stones[human], brd->stones[ai_ponder_color], sq);
+
+        pe->brd = *brd;
+        pe->brd.stones[human]           |= flips | BB_BIT(sq);
+        pe->brd.stones[ai_ponder_color] &= ~flips;
+        pe->depth = 0;
+    }
+
+    ai_ponder_count = n;
+}
+
+// 先読みを最大 nodes ノード進める
+int ai_ponder_step(unsigned long nodes)
+{
+    struct PonderEntry *pe;
+
+    if(ai_ponder_idx >= ai_ponder_count) return 0;
+
+    pe = &ai_ponder[ai_ponder_idx];
+
+    // 次の候補の探索を始める. 実際の手番で使うのと同じだけの時間をかける.
+    if(!ai_pondering)
+    {
+        think_start(&pe->brd, ai_ponder_color, AI_MAX_DEPTH, ai_time_budget(&pe->brd, ai_ponder_color));
+        ai_pondering = 1;
+    }
+
+    ai_slice_size = (nodes != 0) ? nodes : AI_SLICE_UNLIMITED;
+    ai_slice_left = ai_slice_size;
+    if(!think_resume()) return 1;
+
+    // 読み終えたら次の候補へ. AIが置けない局面は深さ0のまま.
+    if(ai_job.root_count > 0)
+    {
+        pe->depth = ai_job.done_depth;
+        pe->x     = ai_job.x;
+        pe->y     = ai_job.y;
+        pe->score = ai_job.best_score;
+    }
+    ai_pondering = 0;
+    ai_job.stage = job_idle;
+    ai_ponder_idx++;
+
+    return 1;
+}
+
+// 局面の評価値. sc から見た深さ max_depth までの反復深化の値（時間制限なし）.
+int ai_search_score(const struct Board *brd, enum stone_color sc, int max_depth)
+{
+    int depth, score = 0;
+
+    // 置ける場所がなければパスして相手から見た値を反転する
+    if(!get_placeable_mask(brd, sc))
+    {
+        if(!get_placeable_mask(brd, OPPONENT(sc))) return evaluate_final(brd, sc);
+
+        return -ai_search_score(brd, OPPONENT(sc), max_depth);
+    }
+
+    if(max_depth > AI_MAX_DEPTH) max_depth = AI_MAX_DEPTH;
+    if(max_depth < 1) max_depth = 1;
+
+    ai_search_cancel();
+    ai_start_ms   = ai_port_get_ms();
+    ai_node_count = 0;
+    ai_limit_ms   = 0;
+    ai_prev_valid = 0;
+    STATS_RESET();
+
+    if(MAT_WIDTH * MAT_HEIGHT - bb_count(brd->stones[stone_red] | brd->stones[stone_green]) <= AI_ENDGAME_EMPTIES)
+    {
+        score = solve_endgame(brd, sc);
+        STATS_SET(depth, MAT_WIDTH * MAT_HEIGHT - bb_count(brd->stones[stone_red] | brd->stones[stone_green]));
+    }
+    else
+    {
+        for(depth = 1; depth <= max_depth; depth++)
+        {
+            score = minimax_alphabeta(brd, sc, depth);
+            ai_prev_score = score;
+            ai_prev_valid = 1;
+        }
+        STATS_SET(depth, max_depth);
+    }
+
+    STATS_SET(nodes, ai_node_count);
+    STATS_SET(elapsed_ms, ai_port_get_ms() - ai_start_ms);
+
+    return score;
+}
+
+// 直前の ai_select_move で探索したノード数
+unsigned long ai_get_node_count(void)
+{
+#if AI_MCTS
+    if(USE_MCTS()) return mcts_get_playouts();
+#endif
+#if AI_SMP
+    return ai_node_count + ai_smp_nodes;
+#else
+    return ai_node_count;
+#endif
+}
+
+// 直前の ai_select_move で選んだ手の評価値
+int ai_get_score(void)
+{
+    return ai_job.best_score;
+}
+
+#if AI_MCTS
+// 探索エンジンを切り替える
+void ai_set_engine(int engine)
+{
+    ai_search_cancel();
+    ai_engine = (engine == AI_ENGINE_MCTS) ? AI_ENGINE_MCTS : AI_ENGINE_ALPHABETA;
+}
+
+// 今の探索エンジン
+int ai_get_engine(void)
+{
+    return ai_engine;
+}
+#endif
+
+#if AI_STATS
+// 直前の探索の統計
+const struct AiStats *ai_get_stats(void)
+{
+    return &ai_stats;
+}
+#endif
@@ -0,0 +1,227 @@
+// ai.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// オセロAI（評価関数と探索）
+// 盤面はビットボード(bitboard.h)で扱う. ハードウェアに依存しない.
+
+#ifndef AI_H
+#define AI_H
+
+#include "bitboard.h"
+
+// AIの先読みの最大回数. 反復深化はこの深さまで1手ずつ深くする.
+#define AI_MAX_DEPTH 16
+
+// 候補手の最大数. オセロの合法手数は最大33.
+#define AI_MAX_MOVES 33
+
+// 思考時間の配分 [ms]
+// 1局分の持ち時間を, 残りの空きマス数から見積もった自分の残り手数で割って1手に配る.
+#define AI_GAME_TIME_MS 60000 // 1局あたりのAIの持ち時間
+#define AI_MIN_MOVE_MS  200   // 1手の思考時間の下限
+#define AI_MAX_MOVE_MS  5000  // 1手の思考時間の上限. AIの応答時間はこれを超えない.
+
+// 終盤完全読みを始める空きマス数
+// 空きマスがこの数以下になったら評価関数を使わず, 最終石差を読み切って手を選ぶ.
+// 思考時間の半分で読み切れなければ, 残りの時間で通常の反復深化に戻る.
+#ifndef AI_ENDGAME_EMPTIES
+#if defined(__RX)
+#define AI_ENDGAME_EMPTIES 10
+#else
+#define AI_ENDGAME_EMPTIES 16
+#endif
+#endif
+
+// 探索の統計
+// AI_STATS が1なら ai_select_move ごとにノード数・枝刈り数などを数える. 0なら数えるコードごと消える.
+// AI_STATS_LCD が1なら AIが手を決めるたびに統計をLCDの2行目に表示する（othello.c）.
+#ifndef AI_STATS_LCD
+#define AI_STATS_LCD 0
+#endif
+
+#ifndef AI_STATS
+#if defined(__RX) && !AI_STATS_LCD
+#define AI_STATS 0
+#else
+#define AI_STATS 1
+#endif
+#endif
+
+// ホストの並列探索（Lazy SMP）
+// AI_SMP が1なら ai_select_move を ai_set_threads で決めた数のスレッドで探索する（-pthread でビルド）.
+// 全スレッドが同じ局面を反復深化で探索し, ロックなしで共有する置換表を通して互いの結果を使う.
+// 手はメインスレッドの探索結果で決める. RX210では使わない.
+#ifndef AI_SMP
+#define AI_SMP 0
+#endif
+
+// 探索スレッド数の上限
+#define AI_SMP_MAX_THREADS 64
+
+// 先読み（ポンダー）で調べる人間の候補手の最大数
+#define AI_PONDER_MOVES 8
+
+// 探索エンジン
+// AI_ENGINE_ALPHABETA : αβ探索（パターン評価と終盤完全読み）
+// AI_ENGINE_MCTS      : モンテカルロ木探索（mcts.h）. 評価関数を使わずプレイアウトの勝率で手を選ぶ.
+// AI_ENGINE が既定のエンジン. ai_set_engine で実行中に切り替えられる.
+#define AI_ENGINE_ALPHABETA 0
+#define AI_ENGINE_MCTS      1
+
+#ifndef AI_ENGINE
+#define AI_ENGINE AI_ENGINE_ALPHABETA
+#endif
+
+// MCTSを組み込むか. RX210では木のノードプールがRAMを使うので, 既定のエンジンにしたときだけ組み込む.
+#ifndef AI_MCTS
+#if defined(__RX)
+#define AI_MCTS (AI_ENGINE == AI_ENGINE_MCTS)
+#else
+#define AI_MCTS 1
+#endif
+#endif
+
+// 評価関数
+// AI_EVAL_PATTERN : パターン評価 + 配置可能数（pattern.h）. 探索では形の部品を手を打つたびに差分更新する.
+// AI_EVAL_NN      : int8 に量子化した小さなニューラルネット（nn.h）. 探索では手を打つたびに差分更新する.
+//                   nn.c と nn_weights.c もリンクする.
+#define AI_EVAL_PATTERN 0
+#define AI_EVAL_NN      1
+
+#ifndef AI_EVAL
+#define AI_EVAL AI_EVAL_PATTERN
+#endif
+
+// Multi-ProbCut（mpc.h）
+// AI_MPC が1なら, 通常探索の深いノードで先に浅い探索をして, 深い探索の値が窓の外になると見込めれば枝を刈る.
+// 回帰係数を求めるツール（tools/mpcgen.c）は刈らない探索の値を使うので -DAI_MPC=0 でビルドする.
+// mpc_data.c の係数は 8x8 の盤のパターン評価のもの. 小さい盤（BOARD_SIZE）やニューラルネット評価では
+// 同じ設定でビルドした mpcgen で係数を求め直して -DAI_MPC=1 でビルドする.
+#ifndef AI_MPC
+#define AI_MPC (BOARD_SIZE == 8 && AI_EVAL == AI_EVAL_PATTERN)
+#endif
+
+// 時間切れを確認するノード間隔. 2のべき乗.
+#define AI_TIME_CHECK_NODES 256
+
+// 無限大の代わりに使用する大きな値
+#define INF 100000
+
+// 終局時の勝ちの評価値. 盤面評価がこれを超えることはない.
+#define SCORE_WIN 50000
+
+// 手の情報を保持する. AI推論用
+struct Move{
+    int x;     // x座標
+    int y;     // y座標
+    int score; // 手のスコア
+};
+
+#if AI_STATS
+// 探索の統計. 直前の ai_select_move（または ai_search_score）の1手分.
+struct AiStats{
+    unsigned long nodes;      // 探索ノード数（完全読みの末端ソルバを含む）
+    unsigned long leaves;     // 評価関数か終局で値を決めたノード数
+    unsigned long cutoffs;    // βカットの回数
+    unsigned long tt_hits;    // 置換表に局面があった回数
+    unsigned long pass_nodes; // パスしたノード数
+    int           depth;      // 完了した反復深化の深さ. 完全読みで決めたときは空きマス数.
+    unsigned long elapsed_ms; // 思考時間 [ms]. ai_port_get_ms の刻み（RX210は2ms）.
+};
+#endif
+
+// 盤面評価関数. AI視点でのスコアを計算. 単位は 1/PATTERN_SCALE 石.
+int evaluate_board(const struct Board *brd, enum stone_color ai_color);
+
+// ミニマックス法 + αβ枝刈り. 最良スコアを返す.
+// PVS なので, 最善手以外の候補手は最良スコアを超えないことを確かめるだけで正確な値は求めない.
+int minimax_alphabeta(const struct Board *brd, enum stone_color ai_color, int max_depth);
+
+// 新しい対局を始める. 置換表を消去する.
+void ai_new_game(void);
+
+// 持ち時間の残りと空きマス数からこの手の思考時間 [ms] を決める
+unsigned long ai_time_budget(const struct Board *brd, enum stone_color sc);
+
+// 最善手を選ぶ. 深さ1から max_depth まで反復深化し, time_ms を超えたら
+// 最後に完了した深さの結果を使う. time_ms が0なら max_depth まで必ず探索する.
+// 空きマスが AI_ENDGAME_EMPTIES 以下なら先に time_ms の半分まで終盤完全読みを試す.
+// 先読み（ai_ponder_start）した局面なら先読みの結果を使う.
+// 同点の手が複数ある場合はランダムに選択.
+// 置ける場所がなければ0を返す.
+// ai_search_start と ai_search_step で探索を最後まで進めるのと同じ.
+int ai_select_move(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms, int *x, int *y);
+
+// 時分割探索
+// ai_search_step を呼ぶたびに探索を決まったノード数だけ進める. 探索の状態はAIの中に残るので,
+// メインループから毎回呼べば1回の呼び出しにかかる時間は探索の深さによらず nodes で決まる.
+// 終盤完全読みの末端（空きマスが少ない局面）だけは一度に進めるので, その分だけ超えることがある. 末端の空きマス数は
+// 決まっているので, 超える量も探索の深さによらない. Multi-ProbCut の浅い探索は持ち分の残りの中で行う.
+
+// ai_search_step の戻り値
+enum ai_search_state{
+    ai_search_running, // 探索中
+    ai_search_done,    // 最善手が決まった
+    ai_search_no_move  // 置ける場所がない（または探索していない）
+};
+
+// 探索を始める. 引数は ai_select_move と同じ. 探索中の探索は打ち切る.
+void ai_search_start(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms);
+
+// 探索を最大 nodes ノード進める. 0なら最後まで進める.
+// 最善手が決まったら x, y に入れて ai_search_done を返す.
+int ai_search_step(unsigned long nodes, int *x, int *y);
+
+// 探索を打ち切る. 結果は捨てる.
+void ai_search_cancel(void);
+
+// 先読み（ポンダー）
+// 人間の手番の待ち時間に, 人間の有望な手ごとにその後のAIの手を探索しておく.
+// 人間が先読みした手を打てば, ai_select_move は先読みの結果を使ってすぐに（または短い思考時間で）返す.
+// 人間が先読み中の手を打てば, その探索を引き継ぐ. 先読みの結果は次の ai_search_start で捨てる.
+// 先読みは時分割探索と同じ状態を使うので, 先読み中に ai_search_start を呼ぶと先読みは終わる.
+
+// 先読みを始める. brd は人間の手番の局面, human は人間の色.
+void ai_ponder_start(const struct Board *brd, enum stone_color human);
+
+// 先読みを最大 nodes ノード進める.
+// 先読みすることが残っていなければ何もせず0を返す.
+int ai_ponder_step(unsigned long nodes);
+
+// 局面の評価値. sc から見た深さ max_depth の探索値（時間制限なし）.
+// 空きマスが AI_ENDGAME_EMPTIES 以下なら完全読みの値, 終局なら最終石差（どちらも SCORE_WIN 込み）.
+// 置ける場所がなければパスした局面の値を返す. 定石生成などのホストツール向け.
+int ai_search_score(const struct Board *brd, enum stone_color sc, int max_depth);
+
+// 直前の ai_select_move で探索したノード数（全反復の合計）. 並列探索では全スレッドの合計.
+// MCTSではプレイアウト数.
+unsigned long ai_get_node_count(void);
+
+// 直前の ai_select_move で選んだ手の評価値. 手番側から見た値.
+// 完全読みで決めたら SCORE_WIN 込みの石差. MCTSでは勝率 [1/1000].
+int ai_get_score(void);
+
+#if AI_SMP
+// 探索スレッド数を決める（1〜AI_SMP_MAX_THREADS）. 既定は1. MCTSのスレッド数も同じにする.
+void ai_set_threads(int n);
+#endif
+
+#if AI_MCTS
+// 探索エンジンを切り替える（AI_ENGINE_ALPHABETA か AI_ENGINE_MCTS）. 探索中の探索は打ち切る.
+void ai_set_engine(int engine);
+
+// 今の探索エンジン
+int ai_get_engine(void);
+#endif
+
+#if AI_STATS
+// 直前の探索の統計
+const struct AiStats *ai_get_stats(void);
+#endif
+
+/******************************** 移植層 ********************************/
+// 現在時刻 [ms]. ターゲットごとに実装する（RX210はCMTのタイマカウンタ）.
+unsigned long ai_port_get_ms(void);
+
+#endif /* AI_H */
@@ -0,0 +1,384 @@
+// bitboard.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include "bitboard.h"
+
+// 列・行のマスク（盤の大きさごとの定数. bitboard.h）
+#define FILE_A BB_FILE_A // 左端の列
+#define FILE_H BB_FILE_H // 右端の列
+#define RANK_1 BB_RANK_1 // 上端の行
+#define RANK_8 BB_RANK_8 // 下端の行
+#define EDGES  (FILE_A | FILE_H | RANK_1 | RANK_8)
+
+// はみ出し防止マスク. 8x8 ではそれぞれ 0x7E7E7E7E7E7E7E7E, 0x00FFFFFFFFFFFF00, 0x007E7E7E7E7E7E00.
+#define MASK_H (BB_BOARD & ~(FILE_A | FILE_H)) // 左右方向. 左端と右端の列を除外.
+#define MASK_V (BB_BOARD & ~(RANK_1 | RANK_8)) // 上下方向. 上端と下端の行を除外.
+#define MASK_D (MASK_H & MASK_V)               // 斜め方向. 盤の外周を除外.
+
+#if !defined(__GNUC__)
+// 32bit de Bruijn 系列による最下位ビット番号テーブル
+static const unsigned char DEBRUIJN_IDX[32] =
+{
+     0,  1, 28,  2, 29, 14, 24,  3, 30, 22, 20, 15, 25, 17,  4,  8,
+    31, 27, 13, 23, 21, 19, 16,  7, 26, 12, 18,  6, 11,  5, 10,  9
+};
+
+// 32bit 版ビットカウント. RXは32bit CPUなので64bit演算を避ける.
+static int count32(uint32_t b)
+{
+    b = b - ((b >> 1) & 0x55555555UL);
+    b = (b & 0x33333333UL) + ((b >> 2) & 0x33333333UL);
+    b = (b + (b >> 4)) & 0x0F0F0F0FUL;
+    return (int)((uint32_t)(b * 0x01010101UL) >> 24);
+}
+
+// 32bit 版最下位ビット番号
+static int first32(uint32_t b)
+{
+    return DEBRUIJN_IDX[(uint32_t)((b & (uint32_t)(0UL - b)) * 0x077CB531UL) >> 27];
+}
+#endif
+
+/******************************** ワード単位の基本演算 ********************************/
+// 立っているビットの数を数える
+int bb_count(uint64_t b)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(b);
+#else
+    return count32((uint32_t)b) + count32((uint32_t)(b >> 32));
+#endif
+}
+
+// 最下位の立っているビットの番号を返す
+int bb_first(uint64_t b)
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll(b);
+#else
+    if((uint32_t)b)
+    {
+        return first32((uint32_t)b);
+    }
+
+    return 32 + first32((uint32_t)(b >> 32));
+#endif
+}
+
+// 上位方向（左シフト）に挟める相手コマの先のマスを求める
+static uint64_t moves_l(uint64_t p, uint64_t mo, int s)
+{
+    uint64_t t = mo & (p << s);
+
+    // 相手コマは最大 BOARD_SIZE - 2 個まで連続できる
+    t |= mo & (t << s);
+#if BOARD_SIZE >= 6
+    t |= mo & (t << s);
+    t |= mo & (t << s);
+#endif
+#if BOARD_SIZE >= 8
+    t |= mo & (t << s);
+    t |= mo & (t << s);
+#endif
+
+    return t << s;
+}
+
+// 下位方向（右シフト）に挟める相手コマの先のマスを求める
+static uint64_t moves_r(uint64_t p, uint64_t mo, int s)
+{
+    uint64_t t = mo & (p >> s);
+
+    t |= mo & (t >> s);
+#if BOARD_SIZE >= 6
+    t |= mo & (t >> s);
+    t |= mo & (t >> s);
+#endif
+#if BOARD_SIZE >= 8
+    t |= mo & (t >> s);
+    t |= mo & (t >> s);
+#endif
+
+    return t >> s;
+}
+
+// 手番側p, 相手側oのときの合法手マスク
+uint64_t bb_moves(uint64_t p, uint64_t o)
+{
+    uint64_t oh = o & MASK_H;
+    uint64_t ov = o & MASK_V;
+    uint64_t od = o & MASK_D;
+    uint64_t moves;
+
+    moves  = moves_l(p, oh, 1) | moves_r(p, oh, 1); // 左右
+    moves |= moves_l(p, ov, 8) | moves_r(p, ov, 8); // 上下
+    moves |= moves_l(p, od, 7) | moves_r(p, od, 7); // 斜め
+    moves |= moves_l(p, od, 9) | moves_r(p, od, 9); // 斜め
+
+    // 盤の中の空きマスのみ
+    return moves & BB_BOARD & ~(p | o);
+}
+
+// 上位方向（左シフト）にひっくり返るコマ
+static uint64_t flips_l(uint64_t p, uint64_t mo, uint64_t m, int s)
+{
+    uint64_t f = 0;
+    uint64_t b = m << s;
+
+    while(b & mo)
+    {
+        f |= b;
+        b <<= s;
+    }
+
+    // 自色のコマで挟めていなければ何も返らない
+    return (b & p) ? f : 0;
+}
+
+// 下位方向（右シフト）にひっくり返るコマ
+static uint64_t flips_r(uint64_t p, uint64_t mo, uint64_t m, int s)
+{
+    uint64_t f = 0;
+    uint64_t b = m >> s;
+
+    while(b & mo)
+    {
+        f |= b;
+        b >>= s;
+    }
+
+    return (b & p) ? f : 0;
+}
+
+// 手番側p, 相手側oのとき, マスsqに置いてひっくり返るコマのマスク
+uint64_t bb_flips(uint64_t p, uint64_t o, int sq)
+{
+    uint64_t m  = BB_BIT(sq);
+    uint64_t oh = o & MASK_H;
+    uint64_t ov = o & MASK_V;
+    uint64_t od = o & MASK_D;
+    uint64_t flips;
+
+    flips  = flips_l(p, oh, m, 1) | flips_r(p, oh, m, 1);
+    flips |= flips_l(p, ov, m, 8) | flips_r(p, ov, m, 8);
+    flips |= flips_l(p, od, m, 7) | flips_r(p, od, m, 7);
+    flips |= flips_l(p, od, m, 9) | flips_r(p, od, m, 9);
+
+    return flips;
+}
+
+// 直線上のどこにも空きマスがないマスを求める.
+// 空きマスを直線の両方向へ広げ, 届かなかった埋まっているマスを返す.
+// ml, mr はシフト後に端を越えて回り込んだビットを消すマスク. 盤の外に出たビットも消す.
+static uint64_t full_lines(uint64_t filled, int s, uint64_t ml, uint64_t mr)
+{
+    uint64_t e = BB_BOARD & ~filled;
+    int i;
+
+    ml &= BB_BOARD;
+    mr &= BB_BOARD;
+
+    // 1つの直線は最大 BOARD_SIZE マス
+    for(i = 0; i < BOARD_SIZE - 1; i++)
+    {
+        e |= ((e << s) & ml) | ((e >> s) & mr);
+    }
+
+    return filled & ~e;
+}
+
+// 手番側p, 相手側oのとき, 手番側の確定石のマスク
+// 確定石は, 縦・横・斜めの4方向それぞれで次のどれかを満たすコマ.
+//   ・その方向の直線が全部埋まっている
+//   ・その方向の隣のどちらかが盤の外か, 同じ色の確定石
+// 角から始めて, 確定石が増えなくなるまで内側へ広げる.
+uint64_t bb_stable(uint64_t p, uint64_t o)
+{
+    uint64_t filled = p | o;
+    uint64_t full_h, full_v, full_d7, full_d9;
+    uint64_t stable, prev, h, v, d7, d9;
+
+    full_h  = full_lines(filled, 1, ~FILE_A, ~FILE_H);
+    full_v  = full_lines(filled, 8, ~(uint64_t)0, ~(uint64_t)0);
+    full_d7 = full_lines(filled, 7, ~FILE_H, ~FILE_A);
+    full_d9 = full_lines(filled, 9, ~FILE_A, ~FILE_H);
+
+    // 盤の端は外側を確定扱いにする
+    full_h  |= FILE_A | FILE_H;
+    full_v  |= RANK_1 | RANK_8;
+    full_d7 |= EDGES;
+    full_d9 |= EDGES;
+
+    stable = p & full_h & full_v & full_d7 & full_d9;
+
+    do
+    {
+        prev = stable;
+
+        h  = full_h  | ((stable << 1) & ~FILE_A) | ((stable >> 1) & ~FILE_H);
+        v  = full_v  | (stable << 8) | (stable >> 8);
+        d7 = full_d7 | ((stable << 7) & ~FILE_H) | ((stable >> 7) & ~FILE_A);
+        d9 = full_d9 | ((stable << 9) & ~FILE_A) | ((stable >> 9) & ~FILE_H);
+
+        stable |= p & h & v & d7 & d9;
+    } while(stable != prev);
+
+    return stable;
+}
+
+/******************************** 対称変換 ********************************/
+// 上下反転. (x, y) → (x, MAT_HEIGHT - 1 - y)
+// 8行分を反転してから, 盤の外の行の分だけ上に詰める.
+uint64_t bb_flip_vertical(uint64_t b)
+{
+    b = ((b >> 8)  & 0x00FF00FF00FF00FFULL) | ((b & 0x00FF00FF00FF00FFULL) << 8);
+    b = ((b >> 16) & 0x0000FFFF0000FFFFULL) | ((b & 0x0000FFFF0000FFFFULL) << 16);
+
+    return ((b >> 32) | (b << 32)) >> (BB_STRIDE * (8 - MAT_HEIGHT));
+}
+
+// 左右反転. (x, y) → (MAT_WIDTH - 1 - x, y)
+// 8列分を反転してから, 盤の外の列の分だけ左に詰める. 盤の外の列は空なので隣の行には混ざらない.
+uint64_t bb_mirror_horizontal(uint64_t b)
+{
+    b = ((b >> 1) & 0x5555555555555555ULL) | ((b & 0x5555555555555555ULL) << 1);
+    b = ((b >> 2) & 0x3333333333333333ULL) | ((b & 0x3333333333333333ULL) << 2);
+    b = ((b >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((b & 0x0F0F0F0F0F0F0F0FULL) << 4);
+
+    return b >> (8 - MAT_WIDTH);
+}
+
+// 左上-右下の対角線で折り返す. (x, y) → (y, x)
+// 盤は左上に寄せてあるので, 8x8 の転置で盤の中だけが入れ替わる.
+uint64_t bb_flip_diagonal(uint64_t b)
+{
+    uint64_t t;
+
+    t = 0x0F0F0F0F00000000ULL & (b ^ (b << 28));
+    b ^= t ^ (t >> 28);
+    t = 0x3333000033330000ULL & (b ^ (b << 14));
+    b ^= t ^ (t >> 14);
+    t = 0x5500550055005500ULL & (b ^ (b << 7));
+    b ^= t ^ (t >> 7);
+
+    return b;
+}
+
+// 8通りの対称形の k 番目. ビット0:上下反転, ビット1:左右反転, ビット2:対角線で折り返す（この順に行う）.
+uint64_t bb_symmetry(uint64_t b, int k)
+{
+    if(k & 1) b = bb_flip_vertical(b);
+    if(k & 2) b = bb_mirror_horizontal(b);
+    if(k & 4) b = bb_flip_diagonal(b);
+
+    return b;
+}
+
+/******************************** 盤面操作 ********************************/
+// 盤面初期化
+void init_board(struct Board *brd)
+{
+    // コマ全撤去
+    brd->stones[stone_red]   = 0;
+    brd->stones[stone_green] = 0;
+
+    // 真ん中に４つ置く
+    place(brd, MAT_WIDTH / 2 - 1, MAT_HEIGHT / 2 - 1, stone_red);
+    place(brd, MAT_WIDTH / 2,     MAT_HEIGHT / 2,     stone_red);
+    place(brd, MAT_WIDTH / 2 - 1, MAT_HEIGHT / 2,     stone_green);
+    place(brd, MAT_WIDTH / 2,     MAT_HEIGHT / 2 - 1, stone_green);
+}
+
+// 何も置かれてないか, または何色が置かれているか
+enum stone_color read_stone_at(const struct Board *brd, int x, int y)
+{
+    uint64_t m = BB_BIT(BB_SQ(x, y));
+
+    if(brd->stones[stone_red] & m)   return stone_red;
+    if(brd->stones[stone_green] & m) return stone_green;
+
+    return stone_black;
+}
+
+// 指定した色のコマを置く
+void place(struct Board *brd, int x, int y, enum stone_color sc)
+{
+    uint64_t m = BB_BIT(BB_SQ(x, y));
+
+    brd->stones[OPPONENT(sc)] &= ~m;
+    brd->stones[sc] |= m;
+}
+
+// 指定した座標のコマを消す
+void delete(struct Board *brd, int x, int y)
+{
+    uint64_t m = BB_BIT(BB_SQ(x, y));
+
+    brd->stones[stone_red]   &= ~m;
+    brd->stones[stone_green] &= ~m;
+}
+
+// その場所に置いたときにひっくり返るコマのマスク
+uint64_t make_flip_mask(const struct Board *brd, int x, int y, enum stone_color sc)
+{
+    return bb_flips(brd->stones[sc], brd->stones[OPPONENT(sc)], BB_SQ(x, y));
+}
+
+// その場所にその色は置けるか？
+int is_placeable(const struct Board *brd, int x, int y, enum stone_color sc)
+{
+    return (get_placeable_mask(brd, sc) & BB_BIT(BB_SQ(x, y))) != 0;
+}
+
+// 反転マスクをつかって相手のコマをひっくり返す
+void flip_stones(uint64_t flip_mask, struct Board *brd, enum stone_color sc)
+{
+    brd->stones[sc]           |= flip_mask;
+    brd->stones[OPPONENT(sc)] &= ~flip_mask;
+}
+
+// マスsqにその色を置いてひっくり返す. 取り消し情報を記録する.
+void make_move(struct Board *brd, int sq, enum stone_color sc, struct Undo *u)
+{
+    u->sq = sq;
+
+    // パス
+    if(sq < 0)
+    {
+        u->flips = 0;
+        return;
+    }
+
+    u->flips = bb_flips(brd->stones[sc], brd->stones[OPPONENT(sc)], sq);
+    brd->stones[sc]           ^= u->flips | BB_BIT(sq);
+    brd->stones[OPPONENT(sc)] ^= u->flips;
+}
+
+// make_move を取り消す. 置いたコマとひっくり返したコマのビットを戻すだけ.
+void unmake_move(struct Board *brd, enum stone_color sc, const struct Undo *u)
+{
+    if(u->sq < 0) return;
+
+    brd->stones[sc]           ^= u->flips | BB_BIT(u->sq);
+    brd->stones[OPPONENT(sc)] ^= u->flips;
+}
+
+// 配置可能な場所のマスク
+uint64_t get_placeable_mask(const struct Board *brd, enum stone_color sc)
+{
+    return bb_moves(brd->stones[sc], brd->stones[OPPONENT(sc)]);
+}
+
+// ボード上の配置可能数を数える
+int count_placeable(const struct Board *brd, enum stone_color sc)
+{
+    return bb_count(get_placeable_mask(brd, sc));
+}
+
+// 指定した色のコマの数を数える
+int count_stones(const struct Board *brd, enum stone_color sc)
+{
+    return bb_count(brd->stones[sc]);
+}
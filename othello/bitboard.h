@@ -0,0 +1,145 @@
+// bitboard.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// オセロ盤面のビットボード表現
+// 色ごとに64bitマスクを1つ持ち, 合法手生成・反転・コマ数計算をワード単位のシフトとマスクで行う.
+// ハードウェアに依存しないので, RX210とホスト(perft, 対局ツール等)の両方でビルドできる.
+//
+// ビット配置 : bit(y * 8 + x) が座標(x, y)に対応する.
+//              ビット番号の昇順 = y, x の順のラスタ順.
+//
+// 盤の大きさはビルド時に BOARD_SIZE で決める（4, 6, 8. 既定は8）. 6x6 は小型のLEDパネル用,
+// 4x4 と 6x6 は終局まで読み切れるので探索の検証用. ビット配置は盤の大きさによらず1行8ビットのままにし,
+// 盤の外のビットは常に0にする. 端のマスクは盤の大きさから定数として求める.
+
+#ifndef BITBOARD_H
+#define BITBOARD_H
+
+#include <stdint.h>
+
+// 盤の大きさ
+#ifndef BOARD_SIZE
+#define BOARD_SIZE 8
+#endif
+
+#if BOARD_SIZE != 4 && BOARD_SIZE != 6 && BOARD_SIZE != 8
+#error "BOARD_SIZE must be 4, 6 or 8"
+#endif
+
+// 盤面
+#define MAT_WIDTH  BOARD_SIZE // 横のコマ数
+#define MAT_HEIGHT BOARD_SIZE // 縦のコマ数
+
+// ビットボードの1行のビット数と, マス番号の範囲（マス番号で引く表の大きさ）
+#define BB_STRIDE  8
+#define BB_SQUARES 64
+
+// マス番号, ビット変換
+#define BB_SQ(x, y)  ((y) * BB_STRIDE + (x))
+#define BB_SQ_X(sq)  ((sq) % BB_STRIDE)
+#define BB_SQ_Y(sq)  ((sq) / BB_STRIDE)
+#define BB_BIT(sq)   ((uint64_t)1 << (sq))
+
+// 列・行のマスク
+#define BB_FILE_A (0x0101010101010101ULL >> (BB_STRIDE * (8 - MAT_HEIGHT))) // 左端の列
+#define BB_FILE_H (BB_FILE_A << (MAT_WIDTH - 1))                             // 右端の列
+#define BB_RANK_1 ((uint64_t)((1U << MAT_WIDTH) - 1))                        // 上端の行
+#define BB_RANK_8 (BB_RANK_1 << (BB_STRIDE * (MAT_HEIGHT - 1)))              // 下端の行
+
+// 盤のマス全部のマスク
+#define BB_BOARD (BB_FILE_A * BB_RANK_1)
+
+// 四隅のマスク
+#define BB_CORNERS ((BB_FILE_A | BB_FILE_H) & (BB_RANK_1 | BB_RANK_8))
+
+// コマの色
+enum stone_color{
+    stone_red,  // 赤コマ
+    stone_green,// 緑コマ
+    stone_black // 何も置かれていない
+};
+
+// 相手の色
+#define OPPONENT(sc) (((sc) == stone_red) ? stone_green : stone_red)
+
+// 盤面. stones[stone_red], stones[stone_green] で各色のマスクを参照する.
+struct Board{
+    uint64_t stones[2];
+};
+
+// 着手の取り消し情報. make_move が記録し, unmake_move で盤面を戻す.
+// 探索では盤面を1つだけ持ち, 深さごとにこれを積んで戻す.
+struct Undo{
+    uint64_t flips; // ひっくり返したコマのマスク
+    int      sq;    // 置いたマス. -1ならパス.
+};
+
+/******************************** ワード単位の基本演算 ********************************/
+// 立っているビットの数を数える
+int bb_count(uint64_t b);
+
+// 最下位の立っているビットの番号を返す. b != 0 であること.
+int bb_first(uint64_t b);
+
+// 手番側p, 相手側oのときの合法手マスク
+uint64_t bb_moves(uint64_t p, uint64_t o);
+
+// 手番側p, 相手側oのとき, マスsqに置いてひっくり返るコマのマスク
+uint64_t bb_flips(uint64_t p, uint64_t o, int sq);
+
+// 手番側p, 相手側oのとき, 手番側の確定石（二度と返されないコマ）のマスク
+uint64_t bb_stable(uint64_t p, uint64_t o);
+
+/******************************** 対称変換 ********************************/
+// 上下反転. (x, y) → (x, MAT_HEIGHT - 1 - y)
+uint64_t bb_flip_vertical(uint64_t b);
+
+// 左右反転. (x, y) → (MAT_WIDTH - 1 - x, y)
+uint64_t bb_mirror_horizontal(uint64_t b);
+
+// 左上-右下の対角線で折り返す. (x, y) → (y, x)
+uint64_t bb_flip_diagonal(uint64_t b);
+
+// 8通りの対称形の k 番目 (0〜7). 0はそのまま.
+uint64_t bb_symmetry(uint64_t b, int k);
+
+/******************************** 盤面操作 ********************************/
+// 盤面初期化. 真ん中に4つ置く.
+void init_board(struct Board *brd);
+
+// 何も置かれてないか, または何色が置かれているか
+enum stone_color read_stone_at(const struct Board *brd, int x, int y);
+
+// 指定した色のコマを置く
+void place(struct Board *brd, int x, int y, enum stone_color sc);
+
+// 指定した座標のコマを消す
+void delete(struct Board *brd, int x, int y);
+
+// その場所に置いたときにひっくり返るコマのマスク
+uint64_t make_flip_mask(const struct Board *brd, int x, int y, enum stone_color sc);
+
+// その場所にその色は置けるか？
+int is_placeable(const struct Board *brd, int x, int y, enum stone_color sc);
+
+// 反転マスクをつかって相手のコマをひっくり返す
+void flip_stones(uint64_t flip_mask, struct Board *brd, enum stone_color sc);
+
+// マスsqにその色を置いてひっくり返す. sq < 0 ならパス（盤面は変わらない）.
+// 取り消しに必要な情報を u に記録する.
+void make_move(struct Board *brd, int sq, enum stone_color sc, struct Undo *u);
+
+// make_move を取り消す. sc は make_move で打った色.
+void unmake_move(struct Board *brd, enum stone_color sc, const struct Undo *u);
+
+// 配置可能な場所のマスク
+uint64_t get_placeable_mask(const struct Board *brd, enum stone_color sc);
+
+// ボード上の配置可能数を数える
+int count_placeable(const struct Board *brd, enum stone_color sc);
+
+// 指定した色のコマの数を数える
+int count_stones(const struct Board *brd, enum stone_color sc);
+
+#endif /* BITBOARD_H */
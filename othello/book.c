@@ -0,0 +1,85 @@
+// book.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "book.h"
+
+// 64bit の値をかき混ぜる（splitmix64 の仕上げ部分）
+static uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+
+    return h;
+}
+
+// 手番側p, 相手側oの正規形のキー
+uint32_t book_key(uint64_t p, uint64_t o, int *sym)
+{
+    uint64_t h, best = 0;
+    int k;
+
+    for(k = 0; k < 8; k++)
+    {
+        h = mix64(bb_symmetry(p, k) ^ mix64(bb_symmetry(o, k)));
+
+        if(k == 0 || h < best)
+        {
+            best = h;
+            *sym = k;
+        }
+    }
+
+    return (uint32_t)(best >> 32);
+}
+
+// 定石を引く
+int book_lookup(const struct Board *brd, enum stone_color sc, int *x, int *y)
+{
+    uint64_t p = brd->stones[sc];
+    uint64_t o = brd->stones[OPPONENT(sc)];
+    uint64_t moves = bb_moves(p, o);
+    uint64_t target;
+    uint32_t key;
+    unsigned int lo = 0, hi = book_size, mid;
+    int sym, sq;
+
+    // 定石は 8x8 の盤で読んだもの. 小さい盤（BOARD_SIZE）では引かない.
+    if(BOARD_SIZE != 8 || !moves) return 0;
+
+    key = book_key(p, o, &sym);
+
+    // 二分探索
+    while(lo < hi)
+    {
+        mid = (lo + hi) / 2;
+
+        if(book_keys[mid] < key) lo = mid + 1;
+        else                     hi = mid;
+    }
+
+    if(lo == book_size || book_keys[lo] != key) return 0;
+
+    // 正規形での手を元の盤面の合法手から探す. キーの衝突で合法手に当たらなければ使わない.
+    target = BB_BIT(book_moves[lo]);
+
+    while(moves)
+    {
+        sq = bb_first(moves);
+        moves &= moves - 1;
+
+        if(bb_symmetry(BB_BIT(sq), sym) == target)
+        {
+            *x = BB_SQ_X(sq);
+            *y = BB_SQ_Y(sq);
+            return 1;
+        }
+    }
+
+    return 0;
+}
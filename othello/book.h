@@ -0,0 +1,31 @@
+// book.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 定石（序盤の手の表）
+// 序盤の局面ごとの最善手をホストで読んでおき（tools/bookgen.c）, const 配列として
+// book_data.c に書き出す（RX210ではROMに置かれる）. 表にある局面は探索せずに1回の検索で手が決まる.
+//
+// 表の形式 : 局面のキー（32bit）の昇順に並べた book_keys と, 同じ並びの最善手 book_moves.
+//            1局面 5バイト. 二分探索で引く.
+// キー     : 8通りの対称形のうちハッシュが最小のもの（正規形）の上位32bit.
+//            手番側・相手側で表すので色は区別しない. 最善手のマス番号は正規形での位置.
+
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+// 定石データ（book_data.c, tools/bookgen.c が生成）
+extern const uint32_t     book_keys[];  // 正規形のキー. 昇順.
+extern const uint8_t      book_moves[]; // 正規形での最善手のマス番号
+extern const unsigned int book_size;    // 局面数
+
+// 手番側p, 相手側oの正規形のキーを求める. sym には正規形にする対称変換の番号 (bb_symmetry) が入る.
+uint32_t book_key(uint64_t p, uint64_t o, int *sym);
+
+// 定石を引く. 盤面とその対称形が表にあれば最善手を x, y に入れて1を返す. なければ0.
+int book_lookup(const struct Board *brd, enum stone_color sc, int *x, int *y);
+
+#endif /* BOOK_H */
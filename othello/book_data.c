@@ -0,0 +1,185 @@
+// book_data.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 定石データ. tools/bookgen.c が生成する. 手で編集しない.
+// 序盤 10 手まで, 探索深さ 8, 最善から 2 石以内の手を展開. 局面数 942（4710 バイト）
+
+#include <stdint.h>
+#include "book.h"
+
+const unsigned int book_size = 942;
+
+const uint32_t book_keys[] =
+{
+    0x0000B19D, 0x00024A27, 0x0005957A, 0x0007E3F7, 0x00144DE5, 0x00226EDC, 0x002B9530, 0x002CFA46,
+    0x002F2DA2, 0x0034EC51, 0x003725CF, 0x0038CC08, 0x003FA375, 0x00461AFE, 0x00467007, 0x0046B6CC,
+    0x0049D788, 0x004ACB1D, 0x004B79D3, 0x005BBDED, 0x005BDD09, 0x007231DE, 0x00738E4B, 0x008F3458,
+    0x008F8624, 0x0099B5FB, 0x009C7475, 0x009DB9AC, 0x009F39D8, 0x009FC96B, 0x00A2E452, 0x00A54FF2,
+    0x00AA5815, 0x00AEC711, 0x00B08A3C, 0x00C588DB, 0x00CD941E, 0x00E284A7, 0x00F48710, 0x00F96FC4,
+    0x00FD2469, 0x010747B6, 0x0116838B, 0x012A1E59, 0x012D464E, 0x01347BA6, 0x0138D88D, 0x01404596,
+    0x015F03DF, 0x016969EF, 0x016BDF39, 0x01709FDE, 0x01722F0F, 0x0172712F, 0x0184495E, 0x0184BEF7,
+    0x0195FAB5, 0x01AFB8D4, 0x01B0FB45, 0x01B90847, 0x01B9CF8F, 0x01BAEF8D, 0x01C2BEA3, 0x01D3FB8C,
+    0x01EC42EF, 0x01EF3AF1, 0x02089FB8, 0x0217F41D, 0x022796D5, 0x0232870D, 0x02357381, 0x023964A2,
+    0x024FA4BF, 0x0254BE46, 0x025CC0BB, 0x0260D6F8, 0x02729D18, 0x027695E7, 0x027DD702, 0x0280FFDD,
+    0x02820C91, 0x0286A865, 0x0299A6C9, 0x02A21515, 0x02A48C97, 0x02A9CBD1, 0x02B0214F, 0x02B45DD3,
+    0x02B7F937, 0x02B9B5D8, 0x02BFAFE6, 0x02C6E06F, 0x02CEF801, 0x02CF643D, 0x02D1146C, 0x02D20126,
+    0x02ECB41B, 0x02F922E1, 0x03059744, 0x03083748, 0x0314D005, 0x03155E2B, 0x031AF52A, 0x031BE54C,
+    0x03216547, 0x032390CC, 0x03364DE6, 0x0344DB04, 0x0345EF62, 0x03470091, 0x034FC456, 0x03526644,
+    0x036693A0, 0x036810EE, 0x036AC34C, 0x036BFED8, 0x037600D1, 0x037AFD91, 0x0388810B, 0x03888D21,
+    0x0395B169, 0x03B0D153, 0x03B3CB23, 0x03B4CEF4, 0x03B4D922, 0x03C3DC6C, 0x03C4600B, 0x03C75264,
+    0x03C88DA4, 0x03DBCF81, 0x03DDCBC5, 0x03E2C98A, 0x040A7C9C, 0x040BA987, 0x0413526D, 0x0426EE5B,
+    0x043609C8, 0x0436AC3C, 0x043CB278, 0x043DA315, 0x0443676D, 0x04449E2D, 0x044D4D01, 0x045648F8,
+    0x045762EB, 0x045B3A1E, 0x0460F290, 0x046221D6, 0x046CE047, 0x0475B954, 0x048DBBF4, 0x049743E7,
+    0x04B6A4EC, 0x04BE5A46, 0x04FDDD08, 0x05088F17, 0x05270575, 0x05424DF7, 0x0544C44F, 0x0545CA5E,
+    0x0566CC3E, 0x0577F09B, 0x057C6FB4, 0x05943E1B, 0x059DAB48, 0x05A17BE8, 0x05AF645E, 0x05B01DD6,
+    0x05CED6F6, 0x05E46A58, 0x05E5F15C, 0x05F436FC, 0x05FF1E75, 0x0619FA21, 0x0622DDA2, 0x0625137F,
+    0x062DE4DA, 0x06415D62, 0x064673E0, 0x064EC1B2, 0x06611734, 0x0661C7F0, 0x066C8F78, 0x0670F686,
+    0x068CCFC5, 0x068F8D24, 0x0698A00A, 0x06AA2603, 0x06AFA210, 0x06B40742, 0x06B42967, 0x06BB9EF3,
+    0x06BF4C9E, 0x06C32CFA, 0x06CBE137, 0x06D57BD5, 0x06DE9792, 0x06E13CCB, 0x06EA6F75, 0x06F0C0EE,
+    0x06F562F7, 0x0706423C, 0x07189DD8, 0x071B1391, 0x07263BF7, 0x072AD4E4, 0x0731DC42, 0x075BA43D,
+    0x076A6D2F, 0x07773325, 0x077C125C, 0x07831887, 0x07964653, 0x07B681BF, 0x07B6D000, 0x07B73C0A,
+    0x07C734A7, 0x07CD16C2, 0x07CF9665, 0x07D6EFD9, 0x07E3EEE7, 0x07E9815B, 0x07F753F7, 0x07FB98F9,
+    0x080DFAFA, 0x0814FE13, 0x081F99A0, 0x082FEE19, 0x083659ED, 0x0858A86C, 0x085BC249, 0x0861BB5C,
+    0x0874E4BB, 0x088846FA, 0x088D0FA7, 0x089153F5, 0x08947D74, 0x089737AB, 0x08A23316, 0x08A2A432,
+    0x08AE4148, 0x08CD9189, 0x08D50643, 0x08FDEF8D, 0x0911E6BC, 0x092D812F, 0x093D39E7, 0x0987818B,
+    0x0988B713, 0x0991210D, 0x09ACCA2C, 0x09B1C00E, 0x09BE1D76, 0x09C3C5AF, 0x09E3A24B, 0x0A0597F4,
+    0x0A0C298E, 0x0A1A5F5C, 0x0A369B6C, 0x0A36EDC0, 0x0A4A9ED7, 0x0A653860, 0x0A6B35F0, 0x0A76C928,
+    0x0A7F2C48, 0x0A848439, 0x0A9B489B, 0x0AAC1234, 0x0AB0BFF3, 0x0AB48C8D, 0x0ABF59DC, 0x0AD7EA0B,
+    0x0ADCCA50, 0x0AEB6B3A, 0x0AFA8D4E, 0x0AFAA66E, 0x0B03873B, 0x0B16D2DE, 0x0B2DEB36, 0x0B2F9665,
+    0x0B38C0DD, 0x0B39E213, 0x0B3F5F71, 0x0B47A596, 0x0B4827E1, 0x0B5A7D0E, 0x0B7427FE, 0x0B79B8FB,
+    0x0B7C8F12, 0x0B83987D, 0x0BA4236E, 0x0BA823E6, 0x0BA83F11, 0x0BADCD2E, 0x0BC39F18, 0x0BE3138D,
+    0x0BECF4D7, 0x0BF33DCE, 0x0C04EE30, 0x0C0C7278, 0x0C0E4795, 0x0C1849A9, 0x0C19E300, 0x0C1D3840,
+    0x0C1EBF1D, 0x0C41F0FD, 0x0C59F4DE, 0x0C5A0B3F, 0x0C5BBB89, 0x0C717E8E, 0x0C7537A7, 0x0C795921,
+    0x0C86FDD1, 0x0C8B1159, 0x0C909CDA, 0x0C92D77E, 0x0C9A3DDD, 0x0CA2C1CE, 0x0CAD6DDB, 0x0CBC935C,
+    0x0CCBA437, 0x0CD7E944, 0x0CF44C02, 0x0CF77713, 0x0CF9065C, 0x0D2375B2, 0x0D508BB8, 0x0D5F4EFF,
+    0x0D9EADED, 0x0DA20600, 0x0DA5F6A1, 0x0DBE3C54, 0x0DC1FA26, 0x0DC337A9, 0x0DCC8345, 0x0E04EF3C,
+    0x0E14E926, 0x0E19EB1D, 0x0E1B39D2, 0x0E46CB78, 0x0E4A3F50, 0x0E55FCFF, 0x0E5F67EE, 0x0E76BF7A,
+    0x0EAAB48F, 0x0EACD926, 0x0EB0B3AD, 0x0EBB5C1F, 0x0ED159D2, 0x0EEBBB16, 0x0EF4DEEC, 0x0EF9794F,
+    0x0F08BBDD, 0x0F0B150E, 0x0F3F2CF5, 0x0F415128, 0x0F425636, 0x0F44DEE6, 0x0F47E0DA, 0x0F59EA46,
+    0x0F6FAFAF, 0x0F9D4D50, 0x0FBDE03A, 0x0FCD1B8C, 0x0FE25CB8, 0x0FE5A2AC, 0x0FF66133, 0x10033C7F,
+    0x1027476F, 0x104AD083, 0x104C4A8E, 0x1053C0F7, 0x1058F1D8, 0x1074648D, 0x108BC6A8, 0x108D1B85,
+    0x10985D3C, 0x10A037B9, 0x10A5D078, 0x10ABACDC, 0x10BFBCCE, 0x10D0B6ED, 0x10D81FE5, 0x10F59043,
+    0x10F5FFC2, 0x10F9A8E5, 0x11038201, 0x111022BC, 0x111F5A38, 0x115C08A4, 0x115F40B3, 0x116EADF8,
+    0x11756E40, 0x1180D1D3, 0x11B3056B, 0x11D13F40, 0x11DDBA6E, 0x11EDDA30, 0x11F9E9ED, 0x12023D2A,
+    0x1217E935, 0x1224BDB0, 0x12255356, 0x123165DC, 0x123C684B, 0x123D5DAB, 0x1247358D, 0x126602AE,
+    0x1268FC39, 0x126A653A, 0x127C377E, 0x127DB7C9, 0x127E6DDA, 0x128E2184, 0x12AB2068, 0x12AD81C5,
+    0x12CC8DC0, 0x12F4E4BE, 0x12F6439D, 0x130477A1, 0x130AEE12, 0x130B719D, 0x130D9D17, 0x131408D8,
+    0x1316749F, 0x1320BB39, 0x1322BB2D, 0x132445E5, 0x132AC6B3, 0x1337A345, 0x1341F897, 0x13542E64,
+    0x135D441D, 0x13648BC6, 0x13652C94, 0x1366BA06, 0x1380C5D7, 0x138A7A62, 0x13928A4F, 0x13AE773F,
+    0x13BD9576, 0x13C12706, 0x13CDE045, 0x13E14ADC, 0x140FDD3F, 0x14369E4C, 0x143C9DBD, 0x14413921,
+    0x14670D24, 0x1468328E, 0x146B6B7D, 0x14731A71, 0x147B56E4, 0x14882C25, 0x1498E26B, 0x14A25B74,
+    0x14AFD222, 0x14B9C632, 0x14C319AE, 0x14C7339A, 0x14C7F0EB, 0x14CADCAB, 0x14D8D217, 0x14E3256A,
+    0x1530BFF5, 0x1538C7C1, 0x153B5B35, 0x153D6F98, 0x153E217D, 0x154765E9, 0x15777E64, 0x157E5195,
+    0x15804C4A, 0x15847083, 0x15991427, 0x15B77AF8, 0x15C3FE76, 0x15C706DC, 0x15C75397, 0x15CED133,
+    0x15FD7237, 0x1602FC7B, 0x1608720C, 0x16252D65, 0x162CD07A, 0x162D4B31, 0x162E9FB3, 0x1664A1D7,
+    0x1694D07D, 0x16AD051D, 0x16AD8B0F, 0x16BB5644, 0x16CD8D87, 0x16DC516F, 0x16E2675F, 0x16E702A5,
+    0x16F2FEC9, 0x17174A14, 0x1749C4E9, 0x17593875, 0x1768ED0C, 0x1796CDA1, 0x18118EDB, 0x1837C4DC,
+    0x1854871C, 0x185F6233, 0x1864C496, 0x186E0662, 0x188182BA, 0x1893110C, 0x18D28BAD, 0x18D765B8,
+    0x18EFFA6F, 0x18FC319F, 0x19038C49, 0x19080573, 0x190EB0A3, 0x192C8257, 0x192E6B36, 0x19326E17,
+    0x1935D23B, 0x194F2553, 0x1951FFE7, 0x1953FE44, 0x196C2DE7, 0x1990DB4F, 0x199A3A9B, 0x19A10AAA,
+    0x19C170C8, 0x19C39044, 0x19CBA181, 0x19CE1429, 0x19D12825, 0x19D34C51, 0x19E53B61, 0x1A0BE718,
+    0x1A14F98A, 0x1A1C50E2, 0x1A2221BF, 0x1A294968, 0x1A41A607, 0x1A551CAD, 0x1A6D082B, 0x1A6EC909,
+    0x1AB6DB76, 0x1AC46590, 0x1AC95855, 0x1AD23096, 0x1ADB8C0E, 0x1AE1C473, 0x1AE36319, 0x1AF5CF4B,
+    0x1B23DC2E, 0x1B349306, 0x1B3C035E, 0x1B440C1A, 0x1B4DFD65, 0x1B51C85E, 0x1B54FA81, 0x1B78C38E,
+    0x1B904DC6, 0x1BBC7A2D, 0x1C020A22, 0x1C3D7DC7, 0x1C43AEA5, 0x1C52B3A0, 0x1C574536, 0x1C5CFB46,
+    0x1C600454, 0x1C8598C2, 0x1C9BF689, 0x1CCC20B5, 0x1CFC54F8, 0x1D08BC58, 0x1D3FC733, 0x1D42E803,
+    0x1D53082C, 0x1D7E80AA, 0x1D85B530, 0x1DD48EAD, 0x1DD8162B, 0x1DE829FE, 0x1E70D0FE, 0x1E75913C,
+    0x1E7E041F, 0x1E9ED55D, 0x1ECCC15C, 0x1ED65D32, 0x1EDAB7AB, 0x1EDBE379, 0x1EDD6A69, 0x1F068B0A,
+    0x1F3EDBCD, 0x1F470035, 0x1F5514CF, 0x1F672D20, 0x1F77D04A, 0x1F7AE876, 0x1FB2B131, 0x1FC3D16F,
+    0x1FC47C4D, 0x1FC8D54E, 0x1FF614DA, 0x20089DA9, 0x2015E5BB, 0x201A9A1A, 0x20229C21, 0x202B037E,
+    0x203B1F92, 0x206BA1B1, 0x20855BED, 0x20ACA1DA, 0x20B2C2C0, 0x20BB1A62, 0x20C309F7, 0x20F0763F,
+    0x212BD17D, 0x2131F831, 0x2145E302, 0x21481D9E, 0x21490EFE, 0x21641626, 0x2166ACA5, 0x219FB559,
+    0x21AB860B, 0x21B5F720, 0x21C20E39, 0x21D1CD2D, 0x21D75FAA, 0x21D84684, 0x21E602BB, 0x222D9F1C,
+    0x223F3762, 0x22556FEE, 0x22752CF2, 0x227D183D, 0x2286ABC0, 0x22988D34, 0x22A3319E, 0x23020C63,
+    0x2313EE2E, 0x2317D34A, 0x23183064, 0x23349783, 0x236481E8, 0x237F4A1E, 0x23A23CAD, 0x23D5217D,
+    0x23D5D588, 0x24120CEC, 0x24194EF0, 0x2426FD0C, 0x24CE1A79, 0x24D4D199, 0x24F07D50, 0x250D710B,
+    0x2526093D, 0x2526FA92, 0x252CCEA2, 0x254CA935, 0x2553498A, 0x259BD573, 0x25AA2238, 0x25C20E9B,
+    0x25E0A52A, 0x25E42004, 0x25ECA74E, 0x26178717, 0x261C4A14, 0x262204FC, 0x26342F21, 0x2653BCA7,
+    0x26811641, 0x2684B993, 0x2693775A, 0x26C17F75, 0x270A057C, 0x27105531, 0x27174F17, 0x2779C85E,
+    0x278296EC, 0x27A13A2C, 0x27A85CF7, 0x27B5B0CE, 0x27C9B4B1, 0x28070B17, 0x280AB8C6, 0x2810D29F,
+    0x284B332A, 0x28540A6F, 0x28555418, 0x286063F6, 0x28619455, 0x2868B4CB, 0x287F702C, 0x287FB4F2,
+    0x289F5C6A, 0x28E2B94D, 0x28E98D80, 0x28FE20AB, 0x290B35AF, 0x292C9FEE, 0x292E8763, 0x29303C77,
+    0x2950B573, 0x295F8D75, 0x29687E98, 0x29730A7E, 0x2975C43A, 0x29B625DB, 0x29F801EA, 0x2A092609,
+    0x2A569966, 0x2A5983EE, 0x2A678EF9, 0x2A77EF40, 0x2A90675C, 0x2A91C7D1, 0x2A983E27, 0x2AE2C72A,
+    0x2AE41DFC, 0x2B69961C, 0x2BA34E29, 0x2BA91A1E, 0x2BB78522, 0x2BB7AA96, 0x2BCD7901, 0x2BFBB372,
+    0x2C113C5C, 0x2C2A452D, 0x2C5AF776, 0x2C7F54E7, 0x2CA28493, 0x2CA43A28, 0x2CAC6228, 0x2CD3DB65,
+    0x2CD8CF8C, 0x2CDD0923, 0x2D4CE24C, 0x2D7C8607, 0x2D8FF31B, 0x2E0E071D, 0x2E1D6989, 0x2E551899,
+    0x2E5EA9B9, 0x2E970520, 0x2EC7DD2F, 0x2F0EC5BC, 0x2F1EF3CD, 0x2FE69263, 0x2FF9980A, 0x30024013,
+    0x30205305, 0x30713C4B, 0x30911BA0, 0x30C143A1, 0x3100EDD2, 0x31261A2E, 0x3144D95D, 0x318EB7DF,
+    0x31D78CB0, 0x31E115EB, 0x321DD9F5, 0x32249558, 0x32414128, 0x327FE9E8, 0x329CACB0, 0x32C289BE,
+    0x32D91C46, 0x3323B44E, 0x333C9787, 0x336A3A49, 0x33899B7F, 0x338A14B8, 0x33AA94B1, 0x33B62043,
+    0x33CC4795, 0x33DDB262, 0x33E3389A, 0x33E3ADF8, 0x33F87207, 0x33FDABCA, 0x34131E5B, 0x3451F2EC,
+    0x3470CB1A, 0x3488F38A, 0x348BE706, 0x349B4FB7, 0x34B10813, 0x3501A1E5, 0x3545165C, 0x355F69EE,
+    0x3577302F, 0x35B30DCA, 0x35FA8C55, 0x3602D0B7, 0x3623E393, 0x365A71CF, 0x368410EF, 0x36A0034E,
+    0x36BDAF17, 0x370AABC2, 0x371A66E4, 0x373D9581, 0x378D704C, 0x37AC107E, 0x37C98EBE, 0x37F16F98,
+    0x3822E378, 0x385C9FB9, 0x3863FB79, 0x387BEFAC, 0x3891A6AA, 0x38DAE6A9, 0x3901DBA3, 0x39A7C2B0,
+    0x3A1B4DFB, 0x3A399273, 0x3A39AC44, 0x3A6A8ED1, 0x3A8690C5, 0x3AF6E157, 0x3B043A88, 0x3B241016,
+    0x3B334C6F, 0x3BA89C34, 0x3C08457C, 0x3C39AAFB, 0x3CBE1F0C, 0x3CDC5805, 0x3DAC9104, 0x3DAED603,
+    0x3DD47859, 0x3EB7BB4A, 0x3ED7D37B, 0x3ED8970B, 0x3EF9C405, 0x3FC13BD0, 0x3FE34B22, 0x3FF42FB9,
+    0x400F962E, 0x40539E7A, 0x40A10BF5, 0x416EB719, 0x427C0A07, 0x42C8573B, 0x42FF8B65, 0x4381FDB6,
+    0x43FC2810, 0x43FE18B4, 0x4417AFD0, 0x446648DF, 0x446BEB56, 0x4475412C, 0x44E642D5, 0x4515E14E,
+    0x45A7F93B, 0x45BF057D, 0x45C195EA, 0x45C65437, 0x461598CB, 0x462F0C79, 0x46326F4F, 0x4657A83E,
+    0x466A4F9E, 0x46CE5FBC, 0x46FE4E74, 0x4720EB30, 0x47519C8B, 0x4773D0EC, 0x47A538F2, 0x47E8090B,
+    0x488BAC0E, 0x48DBB9E3, 0x4946F945, 0x4B42EE32, 0x4B9079CA, 0x4BE80B87, 0x4C388A05, 0x4D1D809F,
+    0x4D24D17F, 0x4D6F4F53, 0x4D91BE1C, 0x4DCC360F, 0x4E84C384, 0x4EE0E897, 0x5018BEC8, 0x503ABBEB,
+    0x50FD4665, 0x5204DCB0, 0x533B7DA6, 0x53A0095B, 0x53A58059, 0x53CB6061, 0x53D90195, 0x5466EE7F,
+    0x556976C7, 0x556A1809, 0x55E17C8C, 0x56BE6F01, 0x573631EA, 0x573BF6C6, 0x577CF540, 0x57E8705C,
+    0x58857753, 0x590157A1, 0x59B08D42, 0x59B72974, 0x5A1F9256, 0x5CB34DFF, 0x5D8E81E9, 0x5E3C5C53,
+    0x5E40CE9F, 0x5EEB50F3, 0x5FB4EC90, 0x615B21D3, 0x619A9377, 0x61E75F28, 0x64EBAEF3, 0x657C9DEA,
+    0x6659CD5E, 0x672CB05A, 0x67A42EB4, 0x69387FEF, 0x697D8EFE, 0x69BE376A, 0x6A80AA26, 0x6B4C5FD7,
+    0x6D3E3B60, 0x6DF92375, 0x6ED27C22, 0x6F4189E9, 0x7071C3B6, 0x70D2F7F2, 0x7172762B, 0x7301E7B8,
+    0x73BE5A4D, 0x7A810B49, 0x7D021E26, 0x8297BE4A, 0x874AD75E, 0x8B6ED7D3
+};
+
+const uint8_t book_moves[] =
+{
+    43, 30, 44, 20, 30, 26, 60, 53, 19, 17, 45, 42, 29, 60, 43, 19, 40, 19, 43, 51,
+    13, 52, 29, 11, 43, 51, 33, 5, 59, 18, 46, 26, 21, 18, 52, 46, 30, 17, 11, 33,
+    29, 21, 26, 20, 25, 25, 10, 22, 43, 12, 51, 29, 30, 45, 26, 29, 37, 12, 52, 25,
+    29, 42, 31, 22, 45, 38, 22, 52, 20, 18, 10, 20, 12, 20, 30, 32, 40, 30, 26, 20,
+    20, 51, 26, 30, 19, 2, 19, 41, 45, 18, 34, 37, 17, 4, 52, 20, 43, 10, 34, 18,
+    18, 51, 47, 22, 23, 29, 18, 18, 41, 10, 10, 41, 43, 3, 43, 44, 12, 21, 18, 19,
+    29, 37, 30, 53, 26, 12, 34, 18, 29, 44, 21, 11, 21, 22, 11, 34, 19, 45, 41, 21,
+    39, 38, 53, 18, 45, 42, 38, 44, 37, 20, 38, 44, 45, 38, 16, 20, 20, 53, 37, 11,
+    45, 12, 11, 25, 11, 44, 34, 53, 34, 38, 19, 18, 43, 26, 18, 20, 21, 45, 41, 33,
+    22, 42, 44, 34, 18, 29, 19, 29, 46, 19, 26, 21, 34, 26, 44, 34, 18, 22, 42, 51,
+    53, 18, 50, 19, 18, 5, 12, 25, 44, 29, 44, 42, 45, 43, 29, 43, 51, 44, 42, 34,
+    16, 12, 44, 38, 51, 37, 45, 50, 31, 41, 30, 30, 11, 11, 29, 11, 42, 45, 45, 18,
+    20, 30, 29, 17, 44, 21, 22, 41, 42, 37, 26, 52, 33, 19, 25, 33, 43, 25, 41, 42,
+    20, 44, 23, 25, 42, 38, 26, 37, 38, 42, 61, 29, 51, 38, 19, 42, 26, 17, 38, 45,
+    20, 12, 43, 58, 18, 25, 3, 45, 20, 11, 25, 51, 29, 52, 53, 41, 45, 34, 18, 42,
+    25, 44, 26, 60, 21, 37, 42, 10, 26, 26, 16, 41, 33, 20, 26, 20, 34, 33, 46, 58,
+    18, 60, 44, 11, 52, 26, 21, 25, 52, 25, 26, 26, 45, 19, 52, 42, 44, 43, 21, 18,
+    21, 26, 13, 46, 47, 26, 18, 30, 11, 34, 44, 37, 22, 51, 51, 42, 12, 20, 45, 39,
+    25, 51, 29, 30, 38, 12, 43, 37, 42, 33, 29, 37, 41, 12, 44, 21, 38, 20, 51, 46,
+    43, 45, 22, 4, 42, 53, 19, 17, 60, 21, 45, 52, 42, 38, 4, 29, 34, 20, 26, 25,
+    25, 43, 41, 25, 21, 37, 43, 46, 25, 44, 18, 38, 51, 33, 38, 41, 11, 29, 42, 38,
+    20, 12, 45, 17, 11, 17, 40, 23, 17, 26, 44, 44, 19, 33, 51, 33, 53, 22, 23, 45,
+    17, 3, 18, 45, 51, 32, 30, 42, 34, 12, 42, 45, 18, 34, 45, 25, 21, 20, 18, 37,
+    47, 21, 43, 18, 19, 39, 5, 52, 17, 38, 5, 10, 20, 33, 29, 52, 37, 25, 29, 19,
+    34, 29, 21, 30, 13, 53, 37, 44, 44, 41, 11, 37, 61, 29, 26, 19, 38, 46, 30, 19,
+    21, 13, 19, 42, 19, 17, 51, 2, 42, 38, 38, 11, 20, 37, 29, 34, 12, 26, 34, 45,
+    13, 52, 53, 29, 21, 34, 12, 43, 19, 44, 26, 20, 25, 20, 26, 34, 45, 43, 19, 38,
+    42, 33, 21, 34, 33, 37, 51, 20, 19, 41, 34, 52, 38, 29, 51, 11, 34, 19, 45, 45,
+    51, 31, 26, 30, 42, 61, 44, 51, 20, 29, 41, 30, 58, 22, 19, 30, 25, 3, 32, 25,
+    33, 34, 43, 46, 50, 21, 46, 45, 10, 10, 19, 21, 18, 16, 34, 18, 18, 22, 34, 53,
+    13, 29, 38, 16, 58, 34, 60, 38, 26, 17, 18, 11, 43, 33, 20, 44, 19, 34, 17, 19,
+    42, 29, 13, 20, 44, 41, 18, 31, 34, 18, 30, 37, 46, 21, 29, 26, 53, 44, 13, 20,
+    29, 33, 16, 53, 41, 19, 12, 52, 61, 26, 22, 37, 26, 30, 33, 42, 12, 2, 11, 34,
+    38, 44, 20, 19, 38, 34, 37, 21, 34, 26, 11, 25, 29, 30, 38, 44, 43, 17, 43, 42,
+    17, 37, 21, 20, 43, 44, 37, 21, 34, 25, 2, 46, 18, 42, 42, 29, 50, 21, 45, 37,
+    47, 45, 20, 19, 52, 59, 20, 13, 21, 52, 53, 43, 43, 60, 44, 30, 13, 34, 42, 29,
+    41, 42, 50, 30, 46, 41, 37, 38, 52, 5, 18, 20, 42, 17, 21, 16, 52, 18, 38, 25,
+    13, 38, 19, 20, 44, 21, 34, 18, 21, 11, 43, 45, 50, 26, 21, 37, 34, 43, 3, 26,
+    46, 45, 51, 45, 26, 52, 38, 52, 21, 38, 18, 21, 21, 41, 42, 60, 21, 29, 11, 25,
+    43, 26, 29, 51, 29, 52, 21, 29, 33, 42, 29, 47, 52, 31, 21, 13, 11, 21, 29, 41,
+    51, 60, 37, 25, 12, 34, 25, 26, 39, 44, 18, 42, 26, 50, 43, 45, 37, 42, 22, 26,
+    37, 29, 18, 21, 44, 50, 44, 61, 21, 19, 30, 33, 18, 45, 41, 33, 10, 21, 47, 52,
+    37, 23, 46, 33, 23, 33, 29, 31, 51, 51, 29, 13, 10, 61, 26, 37, 21, 38, 13, 19,
+    46, 42, 45, 25, 44, 29, 59, 26, 25, 25, 26, 37, 51, 13, 18, 43, 26, 26, 29, 19,
+    33, 33, 52, 53, 18, 51, 21, 44, 61, 42, 50, 37, 12, 44, 33, 43, 33, 12, 53, 42,
+    21, 12, 51, 29, 16, 13, 45, 34, 52, 10, 51, 10, 38, 44, 30, 37, 19, 44, 21, 23,
+    38, 33, 18, 22, 44, 34, 41, 41, 44, 37, 60, 20, 26, 52, 18, 53, 12, 42, 12, 18,
+    11, 44
+};
@@ -0,0 +1,656 @@
+// mcts.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "bitboard.h"
+#include "ai.h"
+#include "mcts.h"
+
+#if AI_MCTS
+
+#if AI_SMP
+#include <pthread.h>
+#endif
+
+#define MCTS_NONE          0     // ノードなし. プールの0番は使わない.
+#define MCTS_PASS          64    // パスの手. マス番号（BB_SQUARES 未満）の外.
+#define MCTS_EXPAND_VISITS 2     // 葉をこの回数訪れたら展開する
+#define MCTS_UCT_C         0.7f  // UCTの探索項の係数. 勝率は0〜1.
+#define MCTS_TIME_CHECK    16    // 時間切れを確認するプレイアウト間隔. 2のべき乗.
+#define MCTS_MAX_PATH      128   // 根から葉までの最大ノード数（着手60 + パス）
+
+// プレイアウトの手の選び方
+// 1なら角が取れれば角を取り, 空いている角の斜め隣（Xマス）には他に手がなければ打たない. 0なら一様にランダム.
+#ifndef MCTS_PLAYOUT_BIAS
+#define MCTS_PLAYOUT_BIAS 1
+#endif
+
+// ノードの状態
+#define MCTS_EXPANDED 0x01 // 子を作った. 子がなければ終局.
+#define MCTS_MARK     0x02 // 木の詰め直しで残すノード
+#define MCTS_FIRST    0x04 // 木の詰め直しで, child に親の新しい位置を入れてある
+
+// 木のノード. 兄弟は連続して並び, 子は必ず親より後ろにある.
+struct MctsNode{
+    uint32_t visits;       // 訪問回数
+    uint32_t wins;         // この手を打った側の得点の合計. 勝ち2, 引き分け1, 負け0.
+    uint32_t child;        // 最初の子のインデックス
+    uint8_t  num_children; // 子の数
+    uint8_t  move;         // この手のマス番号. MCTS_PASS ならパス.
+    uint8_t  flags;        // MCTS_EXPANDED など
+    uint8_t  reserved;
+};
+
+// 探索の段階
+enum mcts_stage{
+    mcts_idle,    // 探索していない
+    mcts_running, // 探索中
+    mcts_done     // 手が決まった
+};
+
+#if AI_SMP
+// ヘルパースレッドの引数と結果
+struct MctsSmpArg{
+    struct Board     brd;                       // ルート局面
+    enum stone_color sc;                        // 手番
+    uint32_t         visits[MCTS_PASS + 1];     // 根の手ごとの訪問回数 [マス]
+    uint32_t         wins[MCTS_PASS + 1];       // 根の手ごとの得点 [マス]
+    unsigned long    playouts;                  // プレイアウト数
+};
+#endif
+
+/************************************************** MCTS用グローバル変数 **************************************************/
+// スレッドごとの変数. ホストの並列探索ではスレッドごとに木を持つ.
+#if AI_SMP
+#define MCTS_LOCAL __thread
+#else
+#define MCTS_LOCAL
+#endif
+
+static MCTS_LOCAL struct MctsNode   mcts_pool[MCTS_POOL_SIZE]; // ノードプール
+static MCTS_LOCAL uint32_t          mcts_used;                 // 使用中のノード数（0番を含む）
+static MCTS_LOCAL uint32_t          mcts_root;                 // 根. MCTS_NONE なら木がない.
+static MCTS_LOCAL struct Board      mcts_root_brd;             // 根の局面
+static MCTS_LOCAL enum stone_color  mcts_root_sc;              // 根の手番
+static MCTS_LOCAL uint32_t          mcts_rand = 2463534242UL;  // プレイアウトの乱数（xorshift32）
+
+// 1手分の探索
+static MCTS_LOCAL enum mcts_stage   mcts_stage;                // 探索の段階
+static MCTS_LOCAL unsigned long     mcts_start_ms;             // 探索開始時刻
+static MCTS_LOCAL unsigned long     mcts_time_ms;              // 思考時間. 0ならプレイアウト数で止める.
+static MCTS_LOCAL unsigned long     mcts_max_playouts;         // プレイアウト数の上限（time_ms が0のとき）
+static MCTS_LOCAL unsigned long     mcts_playouts;             // プレイアウト数
+static MCTS_LOCAL int               mcts_best_x, mcts_best_y;  // 最善手
+static MCTS_LOCAL int               mcts_win_rate;             // 最善手の勝率 [1/1000]
+static MCTS_LOCAL int               mcts_has_move;             // 置ける場所があったか
+
+// 並列探索
+#if AI_SMP
+static int               mcts_threads = 1;                     // 探索スレッド数
+static volatile int      mcts_smp_stop;                        // ヘルパースレッドを止める
+static unsigned long     mcts_smp_playouts;                    // ヘルパースレッドのプレイアウト数の合計
+static pthread_t         mcts_smp_tid[AI_SMP_MAX_THREADS];     // ヘルパースレッド
+static struct MctsSmpArg mcts_smp_arg[AI_SMP_MAX_THREADS];     // ヘルパースレッドの引数
+#endif
+/***************************************************************************************************************************/
+
+// 乱数（xorshift32）. RX210は32bit CPUなので64bit演算を避ける.
+static uint32_t next_random(void)
+{
+    mcts_rand ^= mcts_rand << 13;
+    mcts_rand ^= mcts_rand >> 17;
+    mcts_rand ^= mcts_rand << 5;
+
+    return mcts_rand;
+}
+
+// マスクから1マスをランダムに選ぶ
+static int random_square(uint64_t moves)
+{
+    int k = (int)(next_random() % (uint32_t)bb_count(moves));
+
+    while(k--) moves &= moves - 1;
+
+    return bb_first(moves);
+}
+
+// プレイアウトの手を選ぶ. 手番側p, 相手側o.
+static int playout_move(uint64_t p, uint64_t o, uint64_t moves)
+{
+#if MCTS_PLAYOUT_BIAS
+    uint64_t empty = ~(p | o);
+    uint64_t danger;
+
+    if(moves & BB_CORNERS) return random_square(moves & BB_CORNERS);
+
+    // 空いている角の斜め隣
+    danger = ((empty & BB_BIT(BB_SQ(0, 0)))                          << (BB_STRIDE + 1))
+           | ((empty & BB_BIT(BB_SQ(MAT_WIDTH - 1, 0)))              << (BB_STRIDE - 1))
+           | ((empty & BB_BIT(BB_SQ(0, MAT_HEIGHT - 1)))             >> (BB_STRIDE - 1))
+           | ((empty & BB_BIT(BB_SQ(MAT_WIDTH - 1, MAT_HEIGHT - 1))) >> (BB_STRIDE + 1));
+    if(moves & ~danger) moves &= ~danger;
+#else
+    (void)p;
+    (void)o;
+#endif
+
+    return random_square(moves);
+}
+
+// 手番側p, 相手側oから終局までランダムに打ち合い, 手番側から見た最終石差を返す
+static int playout(uint64_t p, uint64_t o)
+{
+    uint64_t moves, flips, t;
+    int sq, swapped = 0, diff;
+
+    while(1)
+    {
+        moves = bb_moves(p, o);
+
+        if(!moves)
+        {
+            // 両者とも置けなければ終局
+            if(!bb_moves(o, p)) break;
+        }
+        else
+        {
+            sq    = playout_move(p, o, moves);
+            flips = bb_flips(p, o, sq);
+            p    |= flips | BB_BIT(sq);
+            o    &= ~flips;
+        }
+
+        t = p;
+        p = o;
+        o = t;
+        swapped ^= 1;
+    }
+
+    diff = bb_count(p) - bb_count(o);
+
+    return swapped ? -diff : diff;
+}
+
+// ノードを1つ確保する. プールが一杯なら MCTS_NONE.
+static uint32_t alloc_node(int move)
+{
+    struct MctsNode *nd;
+
+    if(mcts_used >= MCTS_POOL_SIZE) return MCTS_NONE;
+
+    nd = &mcts_pool[mcts_used];
+    nd->visits       = 0;
+    nd->wins         = 0;
+    nd->child        = MCTS_NONE;
+    nd->num_children = 0;
+    nd->move         = (uint8_t)move;
+    nd->flags        = 0;
+
+    return mcts_used++;
+}
+
+// 葉を展開する. 手番側p, 相手側o. プールが足りなければ0を返す.
+static int expand(uint32_t idx, uint64_t p, uint64_t o)
+{
+    struct MctsNode *nd = &mcts_pool[idx];
+    uint64_t moves = bb_moves(p, o);
+    uint32_t n;
+
+    if(moves)
+    {
+        n = (uint32_t)bb_count(moves);
+    }
+    else
+    {
+        // パスなら子は1つ, 終局なら子なし
+        n = bb_moves(o, p) ? 1 : 0;
+    }
+
+    if(mcts_used + n > MCTS_POOL_SIZE) return 0;
+
+    nd->child        = mcts_used;
+    nd->num_children = (uint8_t)n;
+    nd->flags       |= MCTS_EXPANDED;
+
+    if(!moves)
+    {
+        if(n) alloc_node(MCTS_PASS);
+        return 1;
+    }
+
+    while(moves)
+    {
+        alloc_node(bb_first(moves));
+        moves &= moves - 1;
+    }
+
+    return 1;
+}
+
+// UCTで降りる子を選ぶ. 訪れていない子があれば先に選ぶ.
+static uint32_t select_child(const struct MctsNode *nd)
+{
+    const struct MctsNode *c = &mcts_pool[nd->child];
+    float log_n = logf((float)nd->visits);
+    float value, best_value = -1.0f;
+    uint32_t i, best = 0;
+
+    for(i = 0; i < nd->num_children; i++)
+    {
+        if(c[i].visits == 0) return nd->child + i;
+
+        value = (float)c[i].wins / (2.0f * (float)c[i].visits) + MCTS_UCT_C * sqrtf(log_n / (float)c[i].visits);
+
+        if(value > best_value)
+        {
+            best_value = value;
+            best       = i;
+        }
+    }
+
+    return nd->child + best;
+}
+
+// 手番側p, 相手側oでマスmoveに打つ（MCTS_PASS ならパス）. 手番を入れ替える.
+static void apply_move(uint64_t *p, uint64_t *o, int move)
+{
+    uint64_t flips, t;
+
+    if(move != MCTS_PASS)
+    {
+        flips = bb_flips(*p, *o, move);
+        *p   |= flips | BB_BIT(move);
+        *o   &= ~flips;
+    }
+
+    t  = *p;
+    *p = *o;
+    *o = t;
+}
+
+// 根から葉まで降りて1回プレイアウトし, 結果を根まで戻す
+static void iterate(void)
+{
+    uint32_t path[MCTS_MAX_PATH];
+    uint64_t p = mcts_root_brd.stones[mcts_root_sc];
+    uint64_t o = mcts_root_brd.stones[OPPONENT(mcts_root_sc)];
+    uint32_t idx = mcts_root;
+    struct MctsNode *nd = &mcts_pool[idx];
+    int n = 0, diff, reward;
+
+    path[n++] = idx;
+
+    // 選択
+    while((nd->flags & MCTS_EXPANDED) && nd->num_children > 0)
+    {
+        idx = select_child(nd);
+        nd  = &mcts_pool[idx];
+        apply_move(&p, &o, nd->move);
+        path[n++] = idx;
+    }
+
+    // 展開. 子を1つ選んでそこからプレイアウトする.
+    if(!(nd->flags & MCTS_EXPANDED) && nd->visits + 1 >= MCTS_EXPAND_VISITS
+    && expand(idx, p, o) && nd->num_children > 0)
+    {
+        idx = nd->child + next_random() % nd->num_children;
+        nd  = &mcts_pool[idx];
+        apply_move(&p, &o, nd->move);
+        path[n++] = idx;
+    }
+
+    // 終局していれば石差, そうでなければプレイアウト. 葉の手番側から見た値.
+    if(nd->flags & MCTS_EXPANDED)
+    {
+        diff = bb_count(p) - bb_count(o);
+    }
+    else
+    {
+        diff = playout(p, o);
+    }
+
+    // 葉に入る手を打ったのは葉の手番の相手
+    reward = (diff < 0) ? 2 : (diff == 0) ? 1 : 0;
+
+    while(n > 0)
+    {
+        nd = &mcts_pool[path[--n]];
+        nd->visits++;
+        nd->wins += (uint32_t)reward;
+        reward = 2 - reward;
+    }
+
+    mcts_playouts++;
+}
+
+// 新しい根 new_root の部分木だけを残し, プールの先頭（1番から）に詰め直す.
+// 子は親より後ろにあるので, 前から順に印を付け, 前から順に詰めれば移動先は移動元より前になる.
+// 子の列の移動先を親に知らせるため, 親を移したときに子の列の先頭の child に親の新しい位置を入れ,
+// 子の列の先頭の本来の child は親の child に預けておく.
+static void compact(uint32_t new_root)
+{
+    struct MctsNode nd;
+    uint32_t i, j, k, parent, first, tmp;
+
+    // 印を付ける
+    mcts_pool[new_root].flags |= MCTS_MARK;
+
+    for(i = new_root; i < mcts_used; i++)
+    {
+        if(!(mcts_pool[i].flags & MCTS_MARK) || !(mcts_pool[i].flags & MCTS_EXPANDED)) continue;
+
+        for(k = 0; k < mcts_pool[i].num_children; k++)
+        {
+            mcts_pool[mcts_pool[i].child + k].flags |= MCTS_MARK;
+        }
+    }
+
+    // 詰める
+    j = 1;
+
+    for(i = new_root; i < mcts_used; i++)
+    {
+        if(!(mcts_pool[i].flags & MCTS_MARK)) continue;
+
+        nd = mcts_pool[i];
+        nd.flags &= ~MCTS_MARK;
+
+        // 子の列の先頭. 親の child を自分の新しい位置にし, 預けていた child を戻す.
+        if(nd.flags & MCTS_FIRST)
+        {
+            parent   = nd.child;
+            nd.child = mcts_pool[parent].child;
+            mcts_pool[parent].child = j;
+            nd.flags &= ~MCTS_FIRST;
+        }
+
+        // 子の列の先頭に自分の新しい位置を知らせる
+        if((nd.flags & MCTS_EXPANDED) && nd.num_children > 0)
+        {
+            first = nd.child;
+            tmp   = mcts_pool[first].child;
+            mcts_pool[first].child  = j;
+            mcts_pool[first].flags |= MCTS_FIRST;
+            nd.child = tmp;
+        }
+
+        mcts_pool[j++] = nd;
+    }
+
+    mcts_used = j;
+    mcts_root = 1;
+}
+
+// 木を捨てて, brd を根にした新しい木を作る
+static void reset_tree(void)
+{
+    mcts_used = 1;
+    mcts_root = alloc_node(MCTS_PASS);
+}
+
+// 前の木の根から2手以内に brd, sc の局面があれば, そのノードを返す
+static uint32_t find_node(const struct Board *brd, enum stone_color sc)
+{
+    const struct MctsNode *c1, *c2;
+    uint64_t p = mcts_root_brd.stones[mcts_root_sc];
+    uint64_t o = mcts_root_brd.stones[OPPONENT(mcts_root_sc)];
+    uint64_t p1, o1, p2, o2;
+    uint64_t target_p = brd->stones[sc];
+    uint64_t target_o = brd->stones[OPPONENT(sc)];
+    uint32_t i, k;
+
+    if(p == target_p && o == target_o) return mcts_root;
+    if(!(mcts_pool[mcts_root].flags & MCTS_EXPANDED)) return MCTS_NONE;
+
+    c1 = &mcts_pool[mcts_pool[mcts_root].child];
+
+    for(i = 0; i < mcts_pool[mcts_root].num_children; i++)
+    {
+        p1 = p;
+        o1 = o;
+        apply_move(&p1, &o1, c1[i].move);
+        if(p1 == target_p && o1 == target_o) return mcts_pool[mcts_root].child + i;
+        if(!(c1[i].flags & MCTS_EXPANDED)) continue;
+
+        c2 = &mcts_pool[c1[i].child];
+        for(k = 0; k < c1[i].num_children; k++)
+        {
+            p2 = p1;
+            o2 = o1;
+            apply_move(&p2, &o2, c2[k].move);
+            if(p2 == target_p && o2 == target_o) return c1[i].child + k;
+        }
+    }
+
+    return MCTS_NONE;
+}
+
+// 根の子で訪問回数の最も多い手を選ぶ. extra_visits, extra_wins はヘルパースレッドの分 [マス].
+static void choose_move(const uint32_t *extra_visits, const uint32_t *extra_wins)
+{
+    const struct MctsNode *root = &mcts_pool[mcts_root];
+    const struct MctsNode *c = &mcts_pool[root->child];
+    uint32_t i, visits, wins, best_visits = 0, best_wins = 0;
+    int best = -1;
+
+    for(i = 0; i < root->num_children; i++)
+    {
+        visits = c[i].visits;
+        wins   = c[i].wins;
+        if(extra_visits != NULL)
+        {
+            visits += extra_visits[c[i].move];
+            wins   += extra_wins[c[i].move];
+        }
+
+        if(best < 0 || visits > best_visits)
+        {
+            best        = (int)i;
+            best_visits = visits;
+            best_wins   = wins;
+        }
+    }
+
+    mcts_best_x   = BB_SQ_X(c[best].move);
+    mcts_best_y   = BB_SQ_Y(c[best].move);
+    mcts_win_rate = best_visits ? (int)((best_wins * 500.0) / best_visits) : 500;
+    mcts_stage    = mcts_done;
+}
+
+// 新しい対局を始める
+void mcts_new_game(void)
+{
+    mcts_stage = mcts_idle;
+    mcts_root  = MCTS_NONE;
+}
+
+// 探索を始める
+void mcts_search_start(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms)
+{
+    uint32_t node = (mcts_root != MCTS_NONE) ? find_node(brd, sc) : MCTS_NONE;
+    struct MctsNode *root;
+
+    // 前の木を引き継ぐ. 見つからなければ作り直す.
+    if(node != MCTS_NONE)
+    {
+        compact(node);
+    }
+    else
+    {
+        reset_tree();
+    }
+
+    mcts_root_brd     = *brd;
+    mcts_root_sc      = sc;
+    mcts_start_ms     = ai_port_get_ms();
+    mcts_time_ms      = time_ms;
+    mcts_max_playouts = time_ms ? 0 : (unsigned long)max_depth * MCTS_PLAYOUTS_PER_DEPTH;
+    mcts_playouts     = 0;
+    mcts_has_move     = 0;
+    mcts_win_rate     = 500;
+    mcts_stage        = mcts_running;
+#if AI_SMP
+    mcts_smp_playouts = 0;
+#endif
+
+    // 根は必ず展開しておく
+    root = &mcts_pool[mcts_root];
+    if(!(root->flags & MCTS_EXPANDED))
+    {
+        expand(mcts_root, brd->stones[sc], brd->stones[OPPONENT(sc)]);
+    }
+
+    // 置ける場所がない. 置ける手が1つならすぐに決める.
+    if(!get_placeable_mask(brd, sc))
+    {
+        mcts_stage = mcts_done;
+        return;
+    }
+
+    mcts_has_move = 1;
+    if(root->num_children == 1) choose_move(NULL, NULL);
+}
+
+// 探索を続けるか. 思考時間かプレイアウト数の上限に達したら0.
+static int keep_searching(void)
+{
+    if(mcts_max_playouts) return mcts_playouts < mcts_max_playouts;
+
+    if(mcts_playouts & (MCTS_TIME_CHECK - 1)) return 1;
+
+    return ai_port_get_ms() - mcts_start_ms < mcts_time_ms;
+}
+
+#if AI_SMP
+// ヘルパースレッド. 自分の木で止められるまで探索し, 根の手ごとの結果を返す.
+static void *smp_helper(void *arg)
+{
+    struct MctsSmpArg *a = (struct MctsSmpArg *)arg;
+    const struct MctsNode *root, *c;
+    uint32_t i;
+
+    mcts_rand = 2463534242UL ^ (uint32_t)(a - mcts_smp_arg) * 0x9E3779B9UL;
+    mcts_root = MCTS_NONE;
+    mcts_search_start(&a->brd, a->sc, 1, 0);
+
+    while(!mcts_smp_stop) iterate();
+
+    root = &mcts_pool[mcts_root];
+    c    = &mcts_pool[root->child];
+    memset(a->visits, 0, sizeof(a->visits));
+    memset(a->wins, 0, sizeof(a->wins));
+    for(i = 0; i < root->num_children; i++)
+    {
+        a->visits[c[i].move] = c[i].visits;
+        a->wins[c[i].move]   = c[i].wins;
+    }
+    a->playouts = mcts_playouts;
+
+    return NULL;
+}
+
+// 全スレッドで最後まで探索して手を選ぶ
+static void smp_search(void)
+{
+    uint32_t visits[MCTS_PASS + 1], wins[MCTS_PASS + 1];
+    int i, k;
+
+    mcts_smp_stop = 0;
+
+    for(i = 1; i < mcts_threads; i++)
+    {
+        mcts_smp_arg[i].brd = mcts_root_brd;
+        mcts_smp_arg[i].sc  = mcts_root_sc;
+        pthread_create(&mcts_smp_tid[i], NULL, smp_helper, &mcts_smp_arg[i]);
+    }
+
+    while(keep_searching()) iterate();
+
+    mcts_smp_stop = 1;
+    memset(visits, 0, sizeof(visits));
+    memset(wins, 0, sizeof(wins));
+
+    for(i = 1; i < mcts_threads; i++)
+    {
+        pthread_join(mcts_smp_tid[i], NULL);
+        mcts_smp_playouts += mcts_smp_arg[i].playouts;
+
+        for(k = 0; k <= MCTS_PASS; k++)
+        {
+            visits[k] += mcts_smp_arg[i].visits[k];
+            wins[k]   += mcts_smp_arg[i].wins[k];
+        }
+    }
+
+    choose_move(visits, wins);
+}
+
+// 探索スレッド数を決める
+void mcts_set_threads(int n)
+{
+    if(n < 1) n = 1;
+    if(n > AI_SMP_MAX_THREADS) n = AI_SMP_MAX_THREADS;
+
+    mcts_threads = n;
+}
+#endif
+
+// 探索を最大 playouts 回進める
+int mcts_search_step(unsigned long playouts, int *x, int *y)
+{
+    unsigned long n = 0;
+
+    if(mcts_stage == mcts_running)
+    {
+#if AI_SMP
+        if(playouts == 0 && mcts_threads > 1)
+        {
+            smp_search();
+        }
+        else
+#endif
+        {
+            while(keep_searching())
+            {
+                iterate();
+                if(playouts != 0 && ++n >= playouts) return ai_search_running;
+            }
+
+            choose_move(NULL, NULL);
+        }
+    }
+
+    if(mcts_stage != mcts_done || !mcts_has_move) return ai_search_no_move;
+
+    *x = mcts_best_x;
+    *y = mcts_best_y;
+
+    return ai_search_done;
+}
+
+// 探索を打ち切る
+void mcts_search_cancel(void)
+{
+    mcts_stage = mcts_idle;
+}
+
+// 直前の探索のプレイアウト数
+unsigned long mcts_get_playouts(void)
+{
+#if AI_SMP
+    return mcts_playouts + mcts_smp_playouts;
+#else
+    return mcts_playouts;
+#endif
+}
+
+// 直前の探索で選んだ手の勝率
+int mcts_get_win_rate(void)
+{
+    return mcts_win_rate;
+}
+
+#endif /* AI_MCTS */
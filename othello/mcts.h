@@ -0,0 +1,68 @@
+// mcts.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// モンテカルロ木探索（MCTS）
+// 評価関数を使わず, 終局までランダムに打ち合うプレイアウトの勝率で手を選ぶ.
+// 木の各ノードは手1つ分で, UCT（勝率 + 訪問回数の少ない手への加点）で降りる手を選び,
+// MCTS_EXPAND_VISITS 回訪れた葉を展開して, その先のプレイアウトの勝ち負けを根まで戻す.
+// 最後に訪問回数の最も多い手を打つ.
+//
+// ノードは固定長のプールから確保し, ヒープは使わない. プールが一杯になったら展開をやめて葉からのプレイアウトだけを続ける.
+// 次の手番では, 前の木のうち実際に打たれた手順の部分木を根にしてプールの先頭に詰め直し, 訪問結果を引き継ぐ.
+//
+// ai.h の AI_ENGINE が AI_ENGINE_MCTS のとき（または ai_set_engine で切り替えたとき）, ai_search_start などから呼ばれる.
+// ホストの並列探索（AI_SMP）では, 各スレッドが自分の木で同じ局面を探索し, 根の手ごとの訪問回数を足して手を選ぶ.
+
+#ifndef MCTS_H
+#define MCTS_H
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "ai.h"
+
+#if AI_MCTS
+
+// ノードプールの大きさ. 1ノード16バイト.
+#ifndef MCTS_POOL_SIZE
+#if defined(__RX)
+#define MCTS_POOL_SIZE 512UL       // 8KB
+#else
+#define MCTS_POOL_SIZE (1UL << 20) // 16MB（スレッドごと）
+#endif
+#endif
+
+// 思考時間を決めないとき（time_ms が0）のプレイアウト数. 探索深さ1あたり.
+#define MCTS_PLAYOUTS_PER_DEPTH 1000
+
+// プレイアウト1回を時分割探索の何ノード分と数えるか. 1回はおよそ終局までの手数分の着手.
+#define MCTS_PLAYOUT_NODES 32
+
+// 新しい対局を始める. 木を捨てる.
+void mcts_new_game(void);
+
+// 探索を始める. 引数は ai_search_start と同じ. 前の木に brd があればその部分木を引き継ぐ.
+// time_ms が0なら max_depth x MCTS_PLAYOUTS_PER_DEPTH 回プレイアウトする.
+void mcts_search_start(const struct Board *brd, enum stone_color sc, int max_depth, unsigned long time_ms);
+
+// 探索を最大 playouts 回進める. 0なら最後まで進める（AI_SMP では全スレッドで探索する）.
+// 戻り値は enum ai_search_state. 最善手が決まったら x, y に入れる.
+int mcts_search_step(unsigned long playouts, int *x, int *y);
+
+// 探索を打ち切る. 木は次の探索のために残す.
+void mcts_search_cancel(void);
+
+// 直前の探索のプレイアウト数. 並列探索では全スレッドの合計.
+unsigned long mcts_get_playouts(void);
+
+// 直前の探索で選んだ手の勝率 [1/1000]. 手番側から見た値. 引き分けは半分の勝ちと数える.
+int mcts_get_win_rate(void);
+
+#if AI_SMP
+// 探索スレッド数を決める（1〜AI_SMP_MAX_THREADS）
+void mcts_set_threads(int n);
+#endif
+
+#endif /* AI_MCTS */
+
+#endif /* MCTS_H */
@@ -0,0 +1,37 @@
+// mpc.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// Multi-ProbCut の回帰係数
+// 深さ d の探索値 v と, 同じ局面の浅い深さ d' の探索値 s には v ≒ a * s + b（誤差の標準偏差 sigma）の関係がある.
+// 探索中は深さ d のノードの前に深さ d' を調べ, v が窓 (α, β) の外になる確率が十分高ければ深い探索を省く.
+// 係数は進行度と深さごとにホストで自己対戦の局面から求め（tools/mpcgen.c）, mpc_data.c に書き出す.
+//
+// 値の単位 : b と sigma は評価値と同じ 1/PATTERN_SCALE 石. a は 1/MPC_A_SCALE.
+// ai.h の AI_MPC が0ならこの表は使わない.
+
+#ifndef MPC_H
+#define MPC_H
+
+#include <stdint.h>
+#include "pattern.h"
+
+// 枝刈りを試す深さの範囲. MPC_MAX_DEPTH より深いノードは MPC_MAX_DEPTH の係数を使い, 浅い探索も同じだけ深くする.
+#define MPC_MIN_DEPTH 3
+#define MPC_MAX_DEPTH 12
+
+// 係数 a の単位
+#define MPC_A_SCALE 1024
+
+// 1組の係数. shallow が0なら枝刈りしない.
+struct MpcParam{
+    int8_t  shallow; // 浅い探索の深さ d'
+    int16_t a;       // 傾き x MPC_A_SCALE
+    int16_t b;       // 切片
+    int16_t sigma;   // 誤差の標準偏差
+};
+
+// 回帰係数（mpc_data.c, tools/mpcgen.c が生成）[進行度][深さ]
+extern const struct MpcParam mpc_params[PATTERN_PHASES][MPC_MAX_DEPTH + 1];
+
+#endif /* MPC_H */
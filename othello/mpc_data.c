@@ -0,0 +1,73 @@
+// mpc_data.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// Multi-ProbCut の回帰係数. tools/mpcgen.c が生成する. 手で編集しない.
+// 局面数 1000. 各行は深さ d の { 浅い探索の深さ, a x 1024, b, sigma }.
+
+#include <stdint.h>
+#include "mpc.h"
+
+const struct MpcParam mpc_params[PATTERN_PHASES][MPC_MAX_DEPTH + 1] =
+{
+    {
+        { 0,    0,    0,    0 }, // 深さ 0
+        { 0,    0,    0,    0 }, // 深さ 1
+        { 0,    0,    0,    0 }, // 深さ 2
+        { 1,  994,   -3,   32 }, // 深さ 3
+        { 2, 1026,   -6,   27 }, // 深さ 4
+        { 2, 1003,   12,   33 }, // 深さ 5
+        { 3, 1014,  -13,   36 }, // 深さ 6
+        { 3, 1036,    4,   36 }, // 深さ 7
+        { 4, 1037,   -2,   27 }, // 深さ 8
+        { 4, 1062,   19,   29 }, // 深さ 9
+        { 5, 1079,  -21,   28 }, // 深さ 10
+        { 5, 1116,    3,   29 }, // 深さ 11
+        { 6, 1095,   -4,   25 }  // 深さ 12
+    },
+    {
+        { 0,    0,    0,    0 }, // 深さ 0
+        { 0,    0,    0,    0 }, // 深さ 1
+        { 0,    0,    0,    0 }, // 深さ 2
+        { 1, 1004,   -6,   48 }, // 深さ 3
+        { 2, 1016,   -7,   36 }, // 深さ 4
+        { 2, 1012,   23,   46 }, // 深さ 5
+        { 3, 1030,  -19,   43 }, // 深さ 6
+        { 3, 1049,   15,   46 }, // 深さ 7
+        { 4, 1042,    2,   41 }, // 深さ 8
+        { 4, 1068,   38,   49 }, // 深さ 9
+        { 5, 1070,  -30,   45 }, // 深さ 10
+        { 5, 1071,    8,   48 }, // 深さ 11
+        { 6, 1067,    1,   48 }  // 深さ 12
+    },
+    {
+        { 0,    0,    0,    0 }, // 深さ 0
+        { 0,    0,    0,    0 }, // 深さ 1
+        { 0,    0,    0,    0 }, // 深さ 2
+        { 1, 1040,   -2,   64 }, // 深さ 3
+        { 2, 1034,  -11,   53 }, // 深さ 4
+        { 2, 1048,   35,   61 }, // 深さ 5
+        { 3, 1044,  -27,   63 }, // 深さ 6
+        { 3, 1069,   12,   68 }, // 深さ 7
+        { 4, 1078,    3,   66 }, // 深さ 8
+        { 4, 1092,   48,   75 }, // 深さ 9
+        { 5, 1096,  -45,   68 }, // 深さ 10
+        { 5, 1110,    2,   75 }, // 深さ 11
+        { 6, 1115,    0,   76 }  // 深さ 12
+    },
+    {
+        { 0,    0,    0,    0 }, // 深さ 0
+        { 0,    0,    0,    0 }, // 深さ 1
+        { 0,    0,    0,    0 }, // 深さ 2
+        { 1, 1048,  -13,   68 }, // 深さ 3
+        { 2, 1036,   -5,   65 }, // 深さ 4
+        { 2, 1059,   36,   83 }, // 深さ 5
+        { 3, 1103,  -48,   82 }, // 深さ 6
+        { 3, 1128,   -6,   92 }, // 深さ 7
+        { 4, 1107,   10,   86 }, // 深さ 8
+        { 4, 1129,   48,   94 }, // 深さ 9
+        { 5, 1102,  -34,   92 }, // 深さ 10
+        { 5, 1128,   -9,  137 }, // 深さ 11
+        { 6, 1141,   -8,  149 }  // 深さ 12
+    }
+};
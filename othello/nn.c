@@ -0,0 +1,296 @@
+// nn.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "nn.h"
+
+// 計算の経路. 2:AVX2, 1:SSE2, 0:整数だけ（RX210）
+#ifndef NN_SIMD
+#if defined(__AVX2__)
+#define NN_SIMD 2
+#elif defined(__SSE2__)
+#define NN_SIMD 1
+#else
+#define NN_SIMD 0
+#endif
+#endif
+
+#if NN_SIMD == 2
+#include <immintrin.h>
+#elif NN_SIMD == 1
+#include <emmintrin.h>
+#endif
+
+// 評価値の上限. 出力が盤の石数を超えても勝ち負けの値（SCORE_WIN）と重ならないようにする.
+#define NN_EVAL_MAX (NN_OUT_STONES * PATTERN_SCALE)
+
+// 中間層1の入力和を1局面分作る. own は手番側, opp は相手側のコマ.
+static void acc_build(int16_t *h, uint64_t own, uint64_t opp)
+{
+    int i, sq;
+
+    for(i = 0; i < NN_HIDDEN1; i++) h[i] = nn_b1[i];
+
+    while(own)
+    {
+        sq = bb_first(own);
+        own &= own - 1;
+        for(i = 0; i < NN_HIDDEN1; i++) h[i] += nn_w1[0][sq][i];
+    }
+
+    while(opp)
+    {
+        sq = bb_first(opp);
+        opp &= opp - 1;
+        for(i = 0; i < NN_HIDDEN1; i++) h[i] += nn_w1[1][sq][i];
+    }
+}
+
+#if NN_SIMD == 2
+// 差分更新. to = from + w1[k][sq] + Σ(w1[k][f] - w1[k^1][f]).
+// k は置いた側が手番側なら0, 相手側なら1. 16個ずつ int8 を int16 に広げて足す.
+static void acc_update(const int16_t *from, int16_t *to, int k, int sq, uint64_t flips)
+{
+    __m256i v;
+    uint64_t f;
+    int i, fsq;
+
+    for(i = 0; i < NN_HIDDEN1; i += 16)
+    {
+        v = _mm256_loadu_si256((const __m256i *)(from + i));
+        v = _mm256_add_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(nn_w1[k][sq] + i))));
+
+        for(f = flips; f; f &= f - 1)
+        {
+            fsq = bb_first(f);
+            v = _mm256_add_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(nn_w1[k][fsq] + i))));
+            v = _mm256_sub_epi16(v, _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(nn_w1[k ^ 1][fsq] + i))));
+        }
+
+        _mm256_storeu_si256((__m256i *)(to + i), v);
+    }
+}
+
+// 8本の int32 x 8 をそれぞれ足し合わせて8個の和にする
+static __m256i hsum8(const __m256i s[8])
+{
+    __m256i t0 = _mm256_hadd_epi32(s[0], s[1]);
+    __m256i t1 = _mm256_hadd_epi32(s[2], s[3]);
+    __m256i t2 = _mm256_hadd_epi32(s[4], s[5]);
+    __m256i t3 = _mm256_hadd_epi32(s[6], s[7]);
+
+    t0 = _mm256_hadd_epi32(t0, t1); // [s0〜s3 の下半分の和 | s0〜s3 の上半分の和]
+    t2 = _mm256_hadd_epi32(t2, t3);
+
+    return _mm256_add_epi32(_mm256_permute2x128_si256(t0, t2, 0x20), _mm256_permute2x128_si256(t0, t2, 0x31));
+}
+
+// 中間層1の入力和から出力を求める
+// 中間層1の値を 0〜NN_ONE の uint8 に詰め, 32個ずつ int8 の重みと掛けて足す（積の和は int16 に収まる）.
+static int32_t forward(const int16_t *h)
+{
+    __m256i a[NN_HIDDEN1 / 32];
+    __m256i s[8], v, prod;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i one  = _mm256_set1_epi16(NN_ONE);
+    const __m256i ones = _mm256_set1_epi16(1);
+    int32_t a2[NN_HIDDEN2];
+    int32_t out = nn_b3;
+    int i, j, k;
+
+    for(i = 0; i < NN_HIDDEN1; i += 32)
+    {
+        __m256i lo = _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256((const __m256i *)(h + i)), zero), one);
+        __m256i hi = _mm256_min_epi16(_mm256_max_epi16(_mm256_loadu_si256((const __m256i *)(h + i + 16)), zero), one);
+
+        // packus は128ビットごとに詰めるので, 64ビット単位で並べ直す
+        a[i / 32] = _mm256_permute4x64_epi64(_mm256_packus_epi16(lo, hi), 0xD8);
+    }
+
+    for(j = 0; j < NN_HIDDEN2; j += 8)
+    {
+        for(k = 0; k < 8; k++)
+        {
+            s[k] = zero;
+            for(i = 0; i < NN_HIDDEN1; i += 32)
+            {
+                prod = _mm256_maddubs_epi16(a[i / 32], _mm256_loadu_si256((const __m256i *)(nn_w2[j + k] + i)));
+                s[k] = _mm256_add_epi32(s[k], _mm256_madd_epi16(prod, ones));
+            }
+        }
+
+        v = _mm256_add_epi32(hsum8(s), _mm256_loadu_si256((const __m256i *)(nn_b2 + j)));
+        v = _mm256_srai_epi32(v, NN_W_SHIFT);
+        v = _mm256_min_epi32(_mm256_max_epi32(v, zero), _mm256_set1_epi32(NN_ONE));
+        _mm256_storeu_si256((__m256i *)(a2 + j), v);
+    }
+
+    for(j = 0; j < NN_HIDDEN2; j++) out += a2[j] * nn_w3[j];
+
+    return out;
+}
+
+#elif NN_SIMD == 1
+// int8 を8個読んで int16 に広げる
+static __m128i load_w8(const int8_t *w)
+{
+    __m128i x = _mm_loadl_epi64((const __m128i *)w);
+
+    return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+}
+
+// 差分更新. to = from + w1[k][sq] + Σ(w1[k][f] - w1[k^1][f]).
+// k は置いた側が手番側なら0, 相手側なら1. 8個ずつ計算する.
+static void acc_update(const int16_t *from, int16_t *to, int k, int sq, uint64_t flips)
+{
+    __m128i v;
+    uint64_t f;
+    int i, fsq;
+
+    for(i = 0; i < NN_HIDDEN1; i += 8)
+    {
+        v = _mm_add_epi16(_mm_loadu_si128((const __m128i *)(from + i)), load_w8(nn_w1[k][sq] + i));
+
+        for(f = flips; f; f &= f - 1)
+        {
+            fsq = bb_first(f);
+            v = _mm_add_epi16(v, load_w8(nn_w1[k][fsq] + i));
+            v = _mm_sub_epi16(v, load_w8(nn_w1[k ^ 1][fsq] + i));
+        }
+
+        _mm_storeu_si128((__m128i *)(to + i), v);
+    }
+}
+
+// 中間層1の入力和から出力を求める. 中間層1の値を int16 のまま8個ずつ重みと掛けて足す.
+static int32_t forward(const int16_t *h)
+{
+    __m128i a[NN_HIDDEN1 / 8];
+    __m128i s;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one  = _mm_set1_epi16(NN_ONE);
+    int32_t out = nn_b3;
+    int32_t sum;
+    int i, j;
+
+    for(i = 0; i < NN_HIDDEN1; i += 8)
+    {
+        a[i / 8] = _mm_min_epi16(_mm_max_epi16(_mm_loadu_si128((const __m128i *)(h + i)), zero), one);
+    }
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        s = zero;
+        for(i = 0; i < NN_HIDDEN1; i += 8)
+        {
+            s = _mm_add_epi32(s, _mm_madd_epi16(a[i / 8], load_w8(nn_w2[j] + i)));
+        }
+
+        s   = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+        s   = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+        sum = (_mm_cvtsi128_si32(s) + nn_b2[j]) >> NN_W_SHIFT;
+
+        if(sum < 0)      sum = 0;
+        if(sum > NN_ONE) sum = NN_ONE;
+        out += sum * nn_w3[j];
+    }
+
+    return out;
+}
+
+#else
+// 差分更新. to = from + w1[k][sq] + Σ(w1[k][f] - w1[k^1][f]).
+// k は置いた側が手番側なら0, 相手側なら1.
+static void acc_update(const int16_t *from, int16_t *to, int k, int sq, uint64_t flips)
+{
+    const int8_t *w;
+    const int8_t *wo;
+    int i, fsq;
+
+    w = nn_w1[k][sq];
+    for(i = 0; i < NN_HIDDEN1; i++) to[i] = (int16_t)(from[i] + w[i]);
+
+    while(flips)
+    {
+        fsq = bb_first(flips);
+        flips &= flips - 1;
+
+        w  = nn_w1[k][fsq];
+        wo = nn_w1[k ^ 1][fsq];
+        for(i = 0; i < NN_HIDDEN1; i++) to[i] = (int16_t)(to[i] + w[i] - wo[i]);
+    }
+}
+
+// 中間層1の入力和から出力を求める
+static int32_t forward(const int16_t *h)
+{
+    int16_t a[NN_HIDDEN1];
+    int32_t out = nn_b3;
+    int32_t sum;
+    int i, j;
+
+    for(i = 0; i < NN_HIDDEN1; i++)
+    {
+        a[i] = (h[i] < 0) ? 0 : (h[i] > NN_ONE) ? NN_ONE : h[i];
+    }
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        sum = nn_b2[j];
+        for(i = 0; i < NN_HIDDEN1; i++) sum += a[i] * nn_w2[j][i];
+
+        // 負なら0にするので, 負の数の右シフトは使わない
+        sum = (sum < 0) ? 0 : (sum >> NN_W_SHIFT);
+        if(sum > NN_ONE) sum = NN_ONE;
+        out += sum * nn_w3[j];
+    }
+
+    return out;
+}
+#endif
+
+// 出力を評価値の単位（1/PATTERN_SCALE 石）にする
+static int to_score(int32_t out)
+{
+    long score = (long)out * (NN_OUT_STONES * PATTERN_SCALE) / ((long)NN_ONE << NN_W_SHIFT);
+
+    if(score > NN_EVAL_MAX)  score = NN_EVAL_MAX;
+    if(score < -NN_EVAL_MAX) score = -NN_EVAL_MAX;
+
+    return (int)score;
+}
+
+// 盤面からアキュムレータを作る
+void nn_acc_init(struct NnAcc *acc, const struct Board *brd)
+{
+    acc_build(acc->h[stone_red], brd->stones[stone_red], brd->stones[stone_green]);
+    acc_build(acc->h[stone_green], brd->stones[stone_green], brd->stones[stone_red]);
+}
+
+// sc が sq に置いて flips を返した局面のアキュムレータを作る
+// sc を手番側とみた値には置いたマスの手番側の重みを足し, 返したマスの重みを相手側から手番側に付け替える.
+// 相手を手番側とみた値は逆になる.
+void nn_acc_move(const struct NnAcc *from, struct NnAcc *to, enum stone_color sc, int sq, uint64_t flips)
+{
+    acc_update(from->h[sc], to->h[sc], 0, sq, flips);
+    acc_update(from->h[OPPONENT(sc)], to->h[OPPONENT(sc)], 1, sq, flips);
+}
+
+// アキュムレータから sc 側の評価値を求める
+int nn_acc_eval(const struct NnAcc *acc, enum stone_color sc)
+{
+    return to_score(forward(acc->h[sc]));
+}
+
+// 手番側p, 相手側oの評価値
+int nn_eval(uint64_t p, uint64_t o)
+{
+    int16_t h[NN_HIDDEN1];
+
+    acc_build(h, p, o);
+
+    return to_score(forward(h));
+}
@@ -0,0 +1,73 @@
+// nn.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// ニューラルネット評価（int8 に量子化した小さな多層パーセプトロン）
+// 入力は手番側・相手側ごとの各マスのコマの有無（2 x 64）, 中間層2つ, 出力は手番側から見た最終石差の予測.
+//   入力 128 -> 中間層1 NN_HIDDEN1 -> 中間層2 NN_HIDDEN2 -> 出力 1
+// 活性化関数は 0〜1 で切る ReLU. 重みはホストで自己対戦の局面から学習し（tools/nntrain.c）,
+// const 配列として nn_weights.c に書き出す（RX210ではROMに置かれる. 約5KB）.
+//
+// 差分更新 : 中間層1の入力和（アキュムレータ）は, 赤・緑それぞれを手番側とみた2通りを持つ.
+//            1手で変わるのは置いたマスと返したマスの入力だけなので, 親のアキュムレータにその重みを足し引きして子を作る.
+//            探索では深さごとに持つので, 手を取り消すときは何もしない.
+//            評価するときは中間層1の値を切り出して中間層2と出力だけを計算する.
+//            RAMは探索の深さごとにアキュムレータ1つ（NN_HIDDEN1 x 4バイト）.
+//
+// ホストでは AVX2 または SSE2 の命令で計算する（コンパイラが __AVX2__ / __SSE2__ を定義したとき. -march=native なら AVX2）.
+// それ以外（RX210）は整数だけの同じ式で計算する. どの経路でも値は一致する. -DNN_SIMD=0 で整数だけの経路に固定できる.
+//
+// 量子化 : 中間層の値は NN_ONE が 1.0. 中間層1の重みも NN_ONE が 1.0,
+//          中間層2と出力の重みは 1 << NN_W_SHIFT が 1.0. 出力の 1.0 は NN_OUT_STONES 石.
+//
+// ai.h の AI_EVAL が AI_EVAL_NN のときにパターン評価の代わりに使う.
+// パターン評価（Multi-ProbCut なし）と比べると, 同じ深さの探索の速さは AVX2 で 1.16 倍, SSE2 で 0.86 倍.
+// 1手20msの対局では約 100 Elo 弱い（200局）. 重みの数はパターン評価の 1/80 ほど.
+// nn_weights.c の重みは 8x8 の盤で学習したもの. 小さい盤（BOARD_SIZE）では同じ BOARD_SIZE で学習し直す.
+
+#ifndef NN_H
+#define NN_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+// 層の大きさ. SIMD で中間層1は32個, 中間層2は16個ずつ計算する.
+#define NN_INPUTS  (2 * BB_SQUARES) // [手番側か相手側か][マス]
+#define NN_HIDDEN1 32
+#define NN_HIDDEN2 16
+
+#if (NN_HIDDEN1 % 32) || (NN_HIDDEN2 % 16)
+#error "NN_HIDDEN1 must be a multiple of 32 and NN_HIDDEN2 a multiple of 16"
+#endif
+
+// 量子化の単位
+#define NN_ONE        127 // 中間層の値と中間層1の重みの 1.0
+#define NN_W_SHIFT    6   // 中間層2と出力の重みの 1.0 は 1 << NN_W_SHIFT
+#define NN_OUT_STONES 64  // 出力の 1.0 が何石か
+
+// 学習済みの重み（nn_weights.c, tools/nntrain.c が生成）
+extern const int8_t  nn_w1[2][BB_SQUARES][NN_HIDDEN1]; // 中間層1の重み [手番側0 / 相手側1][マス][中間層1]
+extern const int16_t nn_b1[NN_HIDDEN1];                // 中間層1のバイアス
+extern const int8_t  nn_w2[NN_HIDDEN2][NN_HIDDEN1];    // 中間層2の重み [中間層2][中間層1]
+extern const int32_t nn_b2[NN_HIDDEN2];                // 中間層2のバイアス. 単位 NN_ONE << NN_W_SHIFT.
+extern const int8_t  nn_w3[NN_HIDDEN2];                // 出力の重み
+extern const int32_t nn_b3;                            // 出力のバイアス. 単位 NN_ONE << NN_W_SHIFT.
+
+// アキュムレータ. 中間層1の入力和（バイアス込み）を, 赤・緑それぞれを手番側とみて持つ.
+struct NnAcc{
+    int16_t h[2][NN_HIDDEN1]; // [手番側の色][中間層1]
+};
+
+// 盤面からアキュムレータを作る. 探索のルートで1回だけ使う.
+void nn_acc_init(struct NnAcc *acc, const struct Board *brd);
+
+// from の局面で sc が sq に置いて flips を返した局面のアキュムレータを to に作る
+void nn_acc_move(const struct NnAcc *from, struct NnAcc *to, enum stone_color sc, int sq, uint64_t flips);
+
+// アキュムレータから sc 側の評価値を求める. 単位は 1/PATTERN_SCALE 石.
+int nn_acc_eval(const struct NnAcc *acc, enum stone_color sc);
+
+// 手番側p, 相手側oの評価値. アキュムレータを使わずに全部計算する.
+int nn_eval(uint64_t p, uint64_t o);
+
+#endif /* NN_H */
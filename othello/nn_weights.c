@@ -0,0 +1,183 @@
+// nn_weights.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// ニューラルネット評価の学習済みの重み. tools/nntrain.c が生成する. 手で編集しない.
+// 局面 1558418, λ 0.50, エポック 39/40, 検証誤差 10.496 石（二乗平均）
+
+#include <stdint.h>
+#include "nn.h"
+
+const int8_t nn_w1[2][BB_SQUARES][NN_HIDDEN1] =
+{
+    {
+        {1,-5,8,3,-10,4,-49,11,5,1,127,-7,-4,9,-5,10,8,-4,5,-2,-3,104,3,106,-103,1,-38,-9,8,55,-1,21},
+        {3,-9,-4,-3,2,-4,-34,-20,1,9,-26,0,-1,-1,2,27,-21,-1,-2,3,-4,108,5,90,10,0,14,3,-2,3,-2,-3},
+        {0,0,2,0,1,0,-2,0,-1,18,18,2,5,-2,1,23,-3,3,2,1,1,35,-1,38,-9,0,0,1,0,-6,0,-2},
+        {1,-3,-3,0,-3,-1,-1,0,0,32,6,3,6,2,2,40,-4,4,2,2,0,2,0,13,-2,0,3,3,1,-4,2,-2},
+        {-1,-2,-5,1,-13,0,2,2,1,33,7,3,5,1,2,41,7,0,1,-4,2,0,0,3,-2,0,4,8,1,-16,-1,-1},
+        {-2,0,3,0,-38,-1,-2,-4,-1,18,15,1,3,-2,1,26,6,-1,1,-6,2,-1,1,0,-12,1,2,43,-1,-6,0,-2},
+        {7,-6,-13,1,-93,-1,-38,45,5,3,-2,-3,-6,5,5,20,5,-5,-3,-10,0,0,2,1,0,1,-13,111,0,-12,-2,3},
+        {0,-6,20,8,-97,3,7,-127,4,3,85,-4,-6,3,-8,-4,2,-5,-3,5,6,-2,3,8,-91,3,0,100,2,-26,1,9},
+        {0,-1,-6,-3,3,14,-38,-4,3,1,-25,2,0,-3,0,-1,-23,0,-3,7,-3,108,-16,88,18,3,17,2,-5,7,2,6},
+        {-3,-6,3,-2,-3,-3,-40,8,-4,0,-30,-3,7,-3,-4,9,-41,7,4,0,2,89,-1,33,46,-4,-25,4,-5,21,5,-12},
+        {2,-6,4,2,0,2,-2,-2,4,2,-6,0,7,-2,4,4,-32,0,-4,1,-3,9,-1,-8,3,-2,-11,-1,1,-14,4,-3},
+        {5,-6,6,2,0,-2,-8,1,2,-7,0,0,1,-2,5,2,-15,-8,-3,-5,1,-5,1,-14,-2,0,-8,-2,1,-14,2,1},
+        {2,-5,4,3,12,-5,-7,-1,2,-7,0,0,3,-3,1,3,-5,-12,-1,-14,-2,3,4,0,0,0,-5,-12,-1,-12,1,1},
+        {1,-6,2,1,7,-3,-3,4,1,1,-2,0,6,-3,0,4,-2,-17,-1,-22,-4,-1,1,1,1,-2,5,2,2,-4,2,-3},
+        {0,3,1,-6,-40,3,-34,14,0,0,-22,0,5,-6,5,-1,4,-24,1,-23,0,5,-3,0,54,-3,10,100,-3,-24,-5,3},
+        {-14,-7,-11,1,-95,3,-48,51,2,0,-4,-1,-5,7,-8,-8,4,-1,-2,-12,1,0,-1,-1,-1,1,-5,113,-2,3,-3,0},
+        {0,0,2,-1,-1,17,-3,4,-1,-1,6,1,2,-1,1,1,-6,1,1,1,0,37,-21,36,-10,1,-4,1,0,-1,1,5},
+        {-2,2,3,1,5,-2,-4,1,4,1,-4,4,6,-2,-1,3,-36,3,1,5,-3,6,-4,-8,1,2,-14,-3,-3,-4,-1,-3},
+        {0,4,8,-3,10,4,2,-5,4,3,8,2,19,-2,1,0,-36,3,-7,-1,-8,-35,0,-48,-2,0,-5,1,-2,-7,5,4},
+        {8,-8,3,3,28,-6,-3,3,4,1,6,0,14,0,3,-6,-19,-5,-9,-8,-7,-33,1,-45,1,0,-4,-31,5,-16,8,2},
+        {2,-8,1,7,45,-3,-1,3,4,-1,4,-1,11,-2,-1,2,-13,-3,-7,-16,-9,-22,5,-35,2,-1,-5,-34,3,-6,9,5},
+        {1,-10,5,1,47,1,0,8,-2,5,1,0,6,2,-4,0,-1,-5,-5,-29,-3,1,-2,-3,0,-2,1,-36,0,-5,18,3},
+        {-2,-5,4,-1,6,1,-4,1,-3,0,-1,2,5,-3,2,2,1,-17,-2,-30,1,-2,-2,-4,0,2,5,6,-1,4,5,-3},
+        {-24,-2,-1,0,-36,-1,-5,-8,0,0,2,1,2,0,-16,1,0,-2,-1,-7,0,2,0,-1,-12,1,0,46,-2,3,0,-3},
+        {2,-4,-7,-3,0,27,-6,2,1,1,2,0,-5,3,2,1,-5,2,4,4,-2,6,-43,9,-2,1,0,0,0,4,1,4},
+        {0,7,6,2,2,-6,-6,-1,2,-1,0,4,0,-2,0,-1,-19,4,-1,6,1,-6,-5,-13,0,5,-10,-4,0,-4,-4,0},
+        {-3,12,5,1,12,0,-2,-7,5,-4,1,4,11,-3,0,-2,-22,9,-24,9,-5,-28,5,-39,1,8,-1,-8,21,-4,-4,3},
+        {6,11,-8,57,49,-5,9,-20,5,-5,2,2,-7,-9,3,1,-22,-12,-58,-7,-53,-43,-5,-61,12,6,0,-52,49,-6,-5,6},
+        {2,-2,-20,42,58,-1,8,-22,10,-7,6,0,-14,1,7,-4,-3,2,-64,1,-71,-48,6,-55,20,0,-11,-53,46,-3,-3,-5},
+        {2,-7,1,26,45,0,-3,13,-6,-1,-4,1,-9,0,0,-1,11,-1,-3,-19,-23,-7,-3,-8,2,3,0,-40,3,4,7,2},
+        {-2,-3,9,2,8,1,-6,2,-7,0,1,3,-3,0,7,-2,8,-10,0,-19,2,-2,0,-1,0,4,8,-12,0,-2,2,-1},
+        {-46,-5,-10,0,-9,-1,-5,-1,2,1,0,2,-6,4,-21,-1,4,-2,-2,-1,1,0,2,0,-3,1,1,9,-2,-3,-2,-2},
+        {1,3,-8,0,2,25,-7,4,2,0,6,-1,-5,1,1,-3,6,-1,10,3,-1,0,-42,2,-3,0,0,0,-7,2,-3,1},
+        {0,17,4,2,1,-7,-7,-2,2,-3,-2,2,2,-4,0,-5,-8,3,-12,5,-2,2,-4,1,2,2,-4,-2,10,-2,-11,2},
+        {-2,19,4,7,8,0,-2,-4,3,-3,5,1,10,-4,0,-2,-15,11,-51,10,-8,-20,0,-32,2,2,-3,-2,43,3,-1,9},
+        {-2,10,-9,40,59,-7,3,-18,9,-8,-7,13,-22,-2,0,-4,-6,-6,-56,-10,-55,-56,6,-51,7,6,-11,-58,49,-7,10,4},
+        {3,10,-3,45,50,-10,0,-15,-5,-10,-3,2,-20,2,7,1,-17,-12,-52,-14,-65,-58,0,-52,-1,3,-7,-44,55,-8,-6,-9},
+        {-1,-7,1,33,24,2,-5,10,-14,-3,-2,0,-15,4,6,-8,10,-6,-6,-11,-37,-5,-4,-4,1,1,1,-25,8,0,4,1},
+        {-4,-5,10,14,-3,1,-6,4,-17,-3,-1,-1,-7,2,6,-5,1,-4,-1,-8,-6,-3,-1,3,-2,1,4,2,2,5,2,-1},
+        {-43,-4,-10,-8,-1,-2,0,-2,-4,0,1,0,-4,-4,-25,-3,3,3,0,2,10,2,1,-2,-1,0,0,1,0,1,2,-1},
+        {0,7,3,-1,1,18,-4,4,0,-2,5,1,1,-2,2,-1,3,2,35,0,1,-1,-22,0,-10,-1,2,1,-41,-1,0,11},
+        {-3,22,2,2,2,-2,-3,0,0,-2,-2,-1,5,-3,0,-1,-4,6,-4,7,-3,-2,-4,1,3,-1,1,-2,-5,-1,-19,-6},
+        {-2,32,4,-1,6,6,0,-5,-3,2,3,-6,5,0,-1,2,-1,19,-43,8,-3,2,1,-4,1,0,-1,-2,49,-1,0,-7},
+        {4,19,5,33,2,-4,-2,2,-5,0,0,0,-11,-2,2,3,13,9,-46,6,-23,-9,0,-7,1,-6,2,-8,38,2,-2,11},
+        {-2,12,5,43,3,-4,-4,-2,-12,1,-2,4,-16,3,1,1,11,5,-21,6,-44,-5,8,-3,1,-6,3,-8,27,0,-5,3},
+        {1,2,13,44,0,1,3,3,-36,2,-1,-3,-3,7,-3,2,10,1,-3,-3,-43,-3,0,-2,-6,1,18,-1,-1,0,3,-1},
+        {-4,-6,8,-1,0,2,0,4,-30,-1,0,-3,-2,4,-1,-1,3,-1,-4,-2,-1,-1,-3,1,-2,1,14,3,-1,-1,2,-7},
+        {-23,0,2,-41,0,0,-3,-7,-4,0,2,-1,1,-1,-15,-1,-1,1,1,0,35,1,1,-1,-12,-1,3,1,0,2,2,-2},
+        {0,14,-9,1,2,10,-45,-3,5,-1,4,4,-4,0,-3,-2,6,-1,96,7,0,1,-15,1,3,6,-6,1,-111,2,-6,-37},
+        {-2,26,-1,-4,0,-3,-46,1,2,1,-1,5,5,-8,0,4,7,-9,35,-4,1,4,-2,-1,40,-2,8,3,-95,-3,-30,-19},
+        {1,22,3,1,3,1,-1,0,-4,1,-2,0,6,-2,3,4,4,4,-5,7,2,0,0,-3,4,-4,6,-1,-6,-2,-19,-4},
+        {3,17,9,3,-2,-2,-5,0,-7,1,-2,5,-5,0,2,0,8,3,-10,5,5,-3,2,0,1,-5,5,-3,9,-3,-10,1},
+        {1,7,10,13,0,-4,-5,2,-17,1,1,7,-9,2,-1,1,3,3,0,5,-6,-1,5,2,-1,-4,3,-3,-1,-1,-5,-1},
+        {1,0,7,1,3,-2,0,8,-31,1,-1,-1,-2,6,-3,3,4,0,0,6,-1,-1,1,0,-2,-3,12,1,-1,-5,-1,-4},
+        {-2,-7,5,-97,-1,0,-6,-2,-23,0,4,-5,4,-72,-5,5,-10,4,2,6,43,0,-2,2,35,0,-3,4,-5,-6,5,-1},
+        {-17,-6,-15,-117,2,-2,-21,-10,-11,-2,2,5,1,-27,-8,-5,4,-2,-4,1,85,4,1,-4,18,5,1,4,-4,4,-3,2},
+        {4,-5,17,7,4,6,-15,2,5,3,10,-3,-3,12,-2,-7,10,-3,99,5,4,-9,2,4,-82,5,-2,-1,-94,-1,1,127},
+        {2,12,-10,0,2,-5,-44,-3,3,1,5,-8,-6,2,-1,0,9,0,97,5,-1,0,5,0,0,-16,-6,1,-111,4,-7,-41},
+        {0,5,-1,-1,1,0,-4,2,1,-1,-3,-14,2,1,2,0,0,1,35,1,-1,1,-1,-1,-9,-25,1,2,-42,1,-1,11},
+        {1,1,-12,-1,2,1,-8,2,3,-1,1,-21,-5,3,2,-2,3,-1,12,5,0,-1,0,0,-3,-44,2,2,-6,4,-3,1},
+        {1,-4,-11,-9,0,-1,-1,2,-5,-1,1,-24,-3,-3,1,-3,5,3,3,3,8,2,1,-3,-2,-40,0,0,1,0,3,4},
+        {-2,-1,2,-40,0,-1,-4,-1,-4,0,-3,-15,2,-1,-1,-1,1,2,2,0,34,2,1,-2,-11,-20,2,2,0,1,2,5},
+        {6,-1,-16,-114,3,-2,-21,4,-12,-1,4,-9,1,-26,5,-2,4,-3,-3,6,88,4,3,-5,18,-17,1,6,-3,3,1,11},
+        {5,-7,10,-111,-4,7,35,-34,11,4,6,-8,-9,-113,-11,-12,14,-5,4,6,90,-4,6,-8,-73,6,-18,-8,10,21,-4,28}
+    },
+    {
+        {-2,7,11,0,7,-5,-94,2,-2,0,-127,3,3,-2,4,27,-42,4,-12,-4,-3,91,-5,117,-37,-1,3,11,-13,45,5,-7},
+        {3,-7,-6,1,1,-6,8,-2,2,10,9,1,2,1,3,-6,11,0,1,3,0,85,-1,110,-47,-2,-16,1,1,-61,1,3},
+        {1,0,-1,1,-1,0,-10,-2,0,21,-19,0,-1,3,0,20,-7,3,1,1,-1,21,1,52,-7,1,-3,0,0,5,0,2},
+        {0,-3,-3,1,-1,-2,-1,4,-2,39,-3,3,11,1,2,24,-1,6,1,2,2,3,-1,13,-13,1,0,4,0,-4,2,-2},
+        {-1,1,-1,1,-14,-2,-4,1,0,37,-2,3,10,1,3,21,0,-1,3,-3,1,1,0,1,-14,1,8,10,1,2,2,-4},
+        {0,-2,-2,1,-52,1,-10,2,1,19,-22,0,-4,4,1,17,7,-3,-1,-3,1,-3,1,0,-3,2,0,23,1,-18,-2,4},
+        {0,2,-3,-1,-107,-3,5,-8,0,10,19,1,1,-3,6,26,-2,-13,-1,-4,2,-2,2,0,-53,-1,-4,93,0,59,4,0},
+        {-7,0,19,-13,-110,-3,-62,-127,-4,0,-123,5,3,-20,6,-1,-7,19,-2,-16,-12,9,1,-1,11,1,12,87,1,-112,8,-1},
+        {-1,3,-8,-1,1,19,5,0,2,-4,25,3,5,-1,2,-5,14,3,-1,4,0,83,-5,112,-37,3,-16,0,-2,-31,1,-1},
+        {-2,-9,-7,0,-4,-1,44,0,-4,0,33,-5,-4,-2,-5,-3,-45,2,4,2,-2,35,4,90,-40,-4,-34,2,-2,17,1,5},
+        {2,-3,-4,4,3,0,1,-4,5,7,-2,-1,1,-2,2,2,-12,-4,-1,5,-2,-19,-1,17,-5,0,-24,-2,3,-3,2,3},
+        {4,-3,5,3,1,-2,-1,0,0,10,0,1,8,-1,5,-12,-4,-7,-1,-2,2,-7,-1,-12,-8,0,-14,-1,2,-8,5,2},
+        {1,-3,3,3,9,-6,-2,1,1,8,1,1,9,0,2,-11,-1,-20,-1,-5,-1,4,4,0,-7,1,-4,-15,0,-2,2,1},
+        {-1,-8,-5,4,-17,-3,0,1,1,6,0,-2,0,2,1,-3,5,-31,0,-9,-1,0,2,-2,-6,-1,-2,-29,4,-4,1,0},
+        {3,6,-3,-3,-86,2,33,-45,3,0,21,-2,-4,-1,-2,-7,5,-33,-2,-29,2,3,-1,4,-45,-1,5,46,-4,-4,-5,4},
+        {-5,-2,-6,0,-110,-1,1,-10,2,-5,22,3,3,-15,-16,4,-1,-10,0,-8,1,-2,-1,1,-34,1,4,91,-2,48,3,0},
+        {0,-1,-3,0,0,22,-15,-3,-1,1,-9,0,-4,2,-1,1,-7,-1,1,1,-1,24,-19,48,-7,1,-2,0,1,8,3,-2},
+        {0,-4,-4,3,3,6,2,-3,4,0,1,2,1,-2,-2,3,-14,2,-2,3,-2,-21,-1,16,-5,3,-27,-3,-1,-1,-2,1},
+        {1,4,3,-1,10,2,0,-3,7,1,2,0,18,-4,-2,-1,-6,3,-5,-2,-7,-53,-1,-35,-5,2,-27,1,0,-5,3,4},
+        {7,-6,5,4,28,-6,3,4,3,5,3,1,22,1,3,-10,-4,-7,-8,-7,-5,-36,1,-42,-4,0,-13,-30,6,-4,9,3},
+        {2,-7,2,7,41,-4,2,8,1,2,4,0,19,2,0,-4,-9,-15,-5,-3,-8,-23,5,-34,-3,-1,-7,-37,5,-1,11,5},
+        {0,-13,1,1,33,3,-1,8,-1,3,-4,-3,5,1,-3,2,0,-32,-4,-12,-2,0,0,-3,-1,0,1,-55,3,2,14,1},
+        {2,-6,-5,-1,-18,3,1,2,-1,0,2,1,-2,1,-7,4,0,-29,-1,-10,-3,-2,-1,-2,-5,2,3,-28,2,-1,2,0},
+        {-20,-1,-8,2,-48,0,-9,7,-1,1,-6,0,-4,-3,-18,-2,3,-4,-1,-1,0,1,1,-1,-3,2,-5,30,0,-9,-2,4},
+        {2,-6,-7,-1,1,37,-4,1,0,0,-2,1,1,1,2,0,3,3,1,3,0,5,-34,10,-7,1,-4,1,0,1,2,-2},
+        {0,5,5,2,1,5,1,-4,2,-2,0,5,9,-3,0,1,-3,6,-3,2,2,-8,14,-11,-6,5,-18,-2,-1,-3,-7,1},
+        {-4,7,7,2,11,5,5,-8,4,-4,-2,5,20,-1,0,-2,-6,12,-23,7,-3,-31,9,-37,-2,6,-12,-8,22,1,-8,2},
+        {7,10,-6,54,49,-4,13,-20,5,-5,-4,2,2,-12,1,1,-6,-12,-58,-7,-55,-42,-4,-63,12,7,-8,-52,50,-1,-5,6},
+        {3,-2,-18,44,59,1,9,-11,9,-6,6,-1,-7,3,6,-5,-2,-5,-65,12,-69,-49,6,-54,19,2,-11,-52,45,0,-4,-7},
+        {6,-5,2,26,42,0,3,21,-3,-1,-1,2,-2,3,-5,0,11,-14,0,-2,-21,-9,-4,-5,0,3,3,-45,7,0,8,4},
+        {16,-1,6,2,6,1,-1,2,-5,-1,1,4,5,2,-6,-1,6,-18,1,-7,0,-2,-1,-1,-6,4,11,-16,1,-3,3,0},
+        {-35,1,-14,-2,-10,-2,-3,0,4,0,-1,3,-1,-4,-30,0,3,-3,1,1,-2,1,2,-2,-8,1,1,6,1,4,1,-2},
+        {3,-3,-6,0,0,38,-7,3,1,0,0,1,0,2,2,-1,5,3,11,-1,-1,1,-35,-1,-6,-1,6,1,-6,5,-5,0},
+        {-1,5,4,2,1,4,-1,-4,0,-4,-1,3,9,-1,0,-4,-4,6,-10,4,-1,2,14,0,-6,1,-8,-2,14,-1,-19,1},
+        {-2,4,5,7,7,5,3,-6,2,-4,5,1,17,-1,0,-2,-11,15,-48,7,-6,-20,4,-31,-1,1,-7,-4,46,6,-14,3},
+        {-1,-4,-6,41,60,-5,6,-19,9,-8,-8,12,-14,-2,-2,-6,-3,-3,-57,-11,-54,-58,6,-49,7,6,-10,-56,49,-8,0,-2},
+        {3,8,3,45,48,-7,0,-7,4,-8,-1,-1,-14,1,4,1,-18,-10,-52,-12,-65,-57,1,-53,-2,3,-2,-47,56,-6,-5,-10},
+        {3,-5,4,37,23,2,0,15,-1,-3,1,-2,-10,1,-1,-6,8,-8,-5,-6,-33,-9,-4,-1,-1,1,7,-28,9,-1,6,3},
+        {14,-3,7,17,-1,1,0,4,-10,-4,0,-1,0,3,-8,-5,-1,-7,1,-5,-4,-3,-1,2,-7,-1,8,1,2,4,5,0},
+        {-31,-4,-11,-8,2,-2,1,4,-2,1,-3,2,1,-1,-33,-3,-2,4,-1,5,10,2,1,0,-6,-1,6,2,-2,-2,2,-1},
+        {1,5,-4,0,1,22,-16,-2,0,0,-3,-1,-4,1,-1,-3,2,-1,48,1,-1,0,-18,-1,-3,1,2,0,-26,2,-2,-5},
+        {-1,9,-6,5,2,6,-2,-2,0,-2,-4,0,-2,2,-1,-3,2,3,20,7,-1,-1,0,-2,-4,-2,-4,-4,25,1,-33,-2},
+        {0,15,-1,1,5,3,-4,-3,-1,4,1,-5,3,0,-3,1,1,15,-28,12,-3,0,-1,-3,0,-1,-2,-4,66,1,-36,-8},
+        {4,6,6,33,1,-3,2,1,-3,0,5,-6,-4,-1,2,5,11,13,-43,3,-22,-10,-1,-5,-2,-1,5,-9,42,4,-15,4},
+        {-3,8,8,47,1,-3,1,1,1,0,4,-4,-11,0,-1,2,8,8,-20,5,-38,-9,7,-1,-2,-3,8,-10,28,1,-8,3},
+        {-2,5,12,62,-2,3,-3,5,-6,3,-4,-5,-9,9,-5,-1,13,1,-1,-5,-26,-5,1,-2,-6,-3,16,-3,1,2,2,0},
+        {0,-4,1,30,4,3,3,2,-18,-1,-1,-5,-9,7,-10,-2,2,-2,-1,2,23,-2,-2,1,-5,0,11,3,2,5,1,-1},
+        {-19,1,-6,-24,1,1,-10,0,-4,0,-1,-1,-5,-14,-19,-4,2,3,0,-1,47,0,1,-2,-4,2,-2,-1,0,3,-1,4},
+        {-2,-7,-1,1,-1,20,17,-2,2,-3,-8,6,0,-2,2,1,-2,6,113,4,2,-1,-8,0,-32,-3,2,0,-90,12,-12,20},
+        {-1,31,-5,-1,2,0,33,3,5,1,-5,2,-5,1,-1,0,10,-9,81,-1,3,0,1,1,-29,0,3,3,-44,-6,-36,58},
+        {1,9,-5,1,2,0,-1,-1,-2,2,-1,-7,-1,2,2,2,1,2,18,9,-1,-2,-1,0,-4,0,2,-3,25,-1,-33,-1},
+        {3,6,7,3,-2,-2,1,-1,-6,1,-1,-6,4,1,3,0,7,4,-8,2,2,-4,1,0,-4,14,8,-3,13,-4,-18,0},
+        {0,4,8,16,-2,-4,1,2,-9,0,0,-8,-1,2,-1,2,0,5,-1,2,-4,-2,4,3,-7,11,6,-4,-1,3,-7,0},
+        {0,-5,1,32,1,-2,4,3,-19,2,-1,-11,-8,8,-4,1,4,0,-4,5,24,-1,1,0,-4,-1,10,-2,0,-3,-2,-1},
+        {2,-7,3,-49,-4,2,40,-8,-23,3,-4,-8,-5,16,-8,5,-11,2,4,8,88,2,-3,-1,-47,4,-3,3,-2,3,2,5},
+        {-11,-5,-3,-95,-1,-2,0,4,-3,-3,-3,4,1,39,-19,-2,3,3,0,3,106,2,-3,0,-45,-2,8,1,-2,-22,2,-4},
+        {-2,54,20,-12,4,-8,-80,2,-8,-5,-6,11,7,-21,9,5,-10,14,117,-6,-12,9,-5,-15,-5,-7,15,-1,-80,-13,22,127},
+        {1,-9,-6,1,-1,-7,24,-5,2,-2,-5,-16,0,-12,3,2,5,5,114,4,0,-2,-3,1,-28,-9,2,-2,-90,1,-11,21},
+        {1,3,-9,1,2,0,-14,-1,-1,0,1,-17,-4,-5,0,-2,1,-2,49,1,-2,0,1,-1,-5,-20,-4,1,-25,2,-3,-3},
+        {1,-3,-13,-3,-1,0,-7,1,3,-1,-2,-29,1,-5,3,-5,3,2,13,-1,-3,0,-1,-3,-7,-33,0,0,-5,3,-5,1},
+        {-1,-5,-12,-9,2,-1,-2,0,-1,-1,-3,-31,3,-2,2,-3,-3,2,2,3,8,1,0,-1,-7,-30,4,1,0,0,4,-3},
+        {1,-1,-7,-24,1,1,-10,-2,-4,0,2,-20,-3,-13,-1,-4,4,-2,0,0,45,1,2,-3,-4,-19,-2,0,2,-3,4,1},
+        {-2,3,-5,-94,1,-4,-8,-1,-3,-2,-4,-17,3,36,5,6,2,3,0,2,109,1,1,0,-47,-6,7,4,-3,0,4,-5},
+        {-4,6,11,-98,13,-3,-75,-7,-11,-4,4,5,4,-127,7,-5,-2,2,-13,-4,107,-6,3,-5,-10,-5,-1,9,-9,-6,1,0}
+    }
+};
+
+const int16_t nn_b1[NN_HIDDEN1] =
+{
+    66, 76, 50, 131, 140, 63, 69, 48, 67, 53, 62, 70, 51, 62, 71, 66,
+    52, 59, -17, 55, -17, 1, 67, -16, 72, 67, 55, -4, 131, 55, 60, 62
+};
+
+const int8_t nn_w2[NN_HIDDEN2][NN_HIDDEN1] =
+{
+    {-9,0,-70,1,-10,-20,-18,-1,-8,-11,-16,41,15,-9,38,5,-7,24,13,1,21,6,-10,10,-20,-10,36,8,2,-11,28,2},
+    {-6,10,8,23,-6,-14,54,15,-4,-18,-18,16,-3,1,19,4,-7,4,-8,-10,-9,-20,-11,9,-3,-10,6,-19,19,-8,1,-24},
+    {-13,17,9,15,-12,-6,-17,14,-17,-9,-20,13,13,-16,13,15,-12,11,20,-7,27,98,-9,29,20,-12,15,-3,15,-5,11,-15},
+    {-19,9,18,17,-17,-7,7,4,-17,-19,-19,13,23,-31,12,20,-1,13,17,-8,22,11,-17,21,-60,-18,6,10,10,-19,1,-9},
+    {8,13,-31,-22,-8,6,7,-30,-15,4,0,-14,15,11,-11,3,-10,-8,71,-14,92,41,8,92,-127,10,-17,43,-28,21,-7,32},
+    {-5,5,-9,-7,-29,5,-2,-14,-25,1,6,-15,33,13,-16,1,-13,5,19,-10,17,6,-6,9,-22,-4,-8,5,-6,4,6,22},
+    {14,-3,-10,-9,10,7,12,-10,15,7,2,-7,-12,17,-8,-17,10,-2,-11,0,-8,18,18,-8,-14,14,-8,19,-20,5,-6,10},
+    {-14,10,7,18,-12,-9,-7,7,1,-10,-5,6,1,-10,4,13,0,5,17,-20,21,-28,-18,23,22,-16,-5,-3,10,-13,4,-4},
+    {-1,-58,3,-11,-1,1,-5,3,11,3,10,-1,15,11,-2,0,34,8,-2,63,13,15,1,18,-5,2,11,-8,-19,10,8,1},
+    {0,4,2,2,-3,9,23,-6,-11,34,-11,8,35,19,1,-29,14,-39,-14,4,-14,2,3,17,-3,-5,-41,1,5,11,1,19},
+    {-6,-15,8,-23,2,9,-10,5,20,19,-8,-8,-38,-28,-8,16,14,-23,2,11,-5,19,-6,0,-1,-8,-17,11,-10,-13,-28,2},
+    {-3,4,-37,6,-8,-17,-24,19,-4,-14,-17,27,10,-15,25,5,-3,18,9,1,17,5,-6,14,-26,-5,21,-6,10,-8,24,-6},
+    {18,-4,42,3,7,11,9,19,29,13,-1,-33,-47,7,-30,-4,-3,-5,-3,6,-6,-15,9,-1,-25,15,-6,-15,10,3,3,-12},
+    {15,-7,-17,-8,12,15,12,-8,3,16,8,-16,-15,5,-12,-11,11,-11,-22,3,-17,13,10,-16,-10,15,-14,17,-14,3,-9,9},
+    {-7,2,16,13,-7,-18,-10,11,2,-17,5,18,-5,-10,19,6,0,4,13,-3,10,-12,-8,12,10,-8,1,-17,14,0,7,-18},
+    {11,-10,-6,-23,-2,-5,-6,3,47,-3,11,-11,13,-4,-9,-1,-13,9,10,6,1,33,-2,-3,-9,14,13,52,-24,-6,7,-1}
+};
+
+const int32_t nn_b2[NN_HIDDEN2] =
+{
+    2200, 3770, 5060, 4072, 4246, 1432, 4393, 3546, 3781, 4677, 5287, 3252, 5559, 4646, 3325, 3464
+};
+
+const int8_t nn_w3[NN_HIDDEN2] =
+{
+    -16, -9, -9, -7, 4, -18, 21, -16, 14, 8, 15, -14, 10, 13, -19, 11
+};
+
+const int32_t nn_b3 = 69;
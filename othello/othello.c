@@ -31,6 +31,7 @@
 //_SINT ios_base::Init::init_cnt;       // Remove the comment when you use ios
 #endif
 
+#include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 #include <machine.h>
@@ -38,6 +39,9 @@
 #include "vect.h"
 #include "lcd_lib4.h"
 #include "onkai.h"
+#include "bitboard.h"
+#include "ai.h"
+#include "book.h"
 
 /************************************ マクロ *************************************************/
 // ゲーム初期設定オプションマスク
@@ -60,6 +64,9 @@
 #define LINE_UP_RESULT_PERIOD_MS     200  // 結果表示でコマを並べる周期
 #define SHOW_RESULT_WAIT_MS          3000 // 結果表示の時間
 
+// AIの探索を1回のメインループで進めるノード数. メインループの1周の長さがこれで決まる.
+#define AI_SLICE_NODES 256
+
 // ロータリーエンコーダー
 #define PULSE_DIFF_PER_CLICK 4 // 1クリックの位相計数
 
@@ -72,49 +79,17 @@
 // マトリックスLED
 #define COL_EN PORTE.PODR.BYTE  // 点灯列許可ビット選択
 
-// 盤面
-#define MAT_WIDTH  8 // 横のコマ数
-#define MAT_HEIGHT 8 // 縦のコマ数
-
 // リセットボタン オン
 #define RESET_BTN_ON (PORTH.PIDR.BIT.B0 == 0)
 
 // 移動オプション
 #define MOVE_TYPE_UP_DOWN (PORTH.PIDR.BIT.B3 == 0) // 上下方向移動モード
-
-// AIの先読みの回数
-#define AI_DEPTH 3
-
-// 評価関数の重み係数定義. どの要素をどれくらい重要視するか.
-#define POS_WEIGHT      10  // 位置評価の重み係数
-#define MOBILITY_WEIGHT 2   // 配置可能数評価の重み係数
-#define STABLE_WEIGHT   50  // 確定石数（４つ角）評価の重み係数
-
-// 無限大の代わりに使用する大きな値
-#define INF 100000
 /********************************************************************************************/
 
 
 /********************************************* 定数 *************************************************/
-// 置き判定の時の8方向の移動量
-//                        　　　　上       下       左       右      左上      左下     右上     右下
-static const int DXDY[8][2] = {{0, 1}, {0, -1}, {-1, 0}, {1, 0}, {-1, 1}, {-1, -1}, {1, 1}, {1, -1}};
-
 // KEY = C majスケール
-static const unsigned int C_SCALE[MAT_HEIGHT] = {DO1, RE1, MI1, FA1, SO1, RA1, SI1, DO2};
-
-// 盤面のスコア定義
-static const int POSITION_WEIGHTS[MAT_HEIGHT][MAT_WIDTH] =
-{
-    {120, -40,  20,  10,  10,  20, -40, 120},
-    {-40, -50,  -5,  -5,  -5,  -5, -50, -40},
-    { 20,  -5,  15,  10,  10,  15,  -5,  20},
-    { 10,  -5,  10,   5,   5,  10,  -5,  10},
-    { 10,  -5,  10,   5,   5,  10,  -5,  10},
-    { 20,  -5,  15,  10,  10,  15,  -5,  20},
-    {-40, -50,  -5,  -5,  -5,  -5, -50, -40},
-    {120, -40,  20,  10,  10,  20, -40, 120}
-};
+static const unsigned int C_SCALE[8] = {DO1, RE1, MI1, FA1, SO1, RA1, SI1, DO2};
 /*******************************************************************************************/
 
 
@@ -135,6 +110,7 @@ enum State {
 
     // AI思考フェーズ
     AI_THINK,
+    AI_SEARCH,
 
     // 入力フェーズ
     INPUT_WAIT,
@@ -176,13 +152,6 @@ enum Direction{
     DOWN
 };
 
-// コマの色
-enum stone_color{
-    stone_red,  // 赤コマ
-    stone_green,// 緑コマ
-    stone_black // 何も置かれていない
-};
-
 // ゲーム情報
 struct Game{
 	unsigned char is_reset         :1; // リセットフラグ
@@ -215,13 +184,6 @@ struct Cursor{
     int dest_y;             // 目的地のy座標
     enum stone_color color; // カーソルの色
 };
-
-// 手の情報を保持する. AI推論用
-struct Move{
-    int x;     // x座標
-    int y;     // y座標
-    int score; // 手のスコア
-};
 /****************************************************************************************/
 
 
@@ -239,15 +201,6 @@ static volatile struct Cursor    cursor;                        // グローバ
 /************************************************************************************************************/
 
 
-/************************************************** AI推論用グローバル変数 **************************************************/
-// グローバル静的バッファ
-static enum stone_color ai_buf[AI_DEPTH + 1][MAT_HEIGHT][MAT_WIDTH]; // 深さごとのシミュレーションバッファ
-static int              ai_entry_idx[MAT_HEIGHT * MAT_WIDTH];        // ソートに対応させるための座標配列のインデックス
-static int              ai_move_counts[AI_DEPTH];                    // 各深さでの候補手数
-static struct Move      ai_moves[AI_DEPTH][MAT_HEIGHT * MAT_WIDTH];  // 各深さでの候補手リスト
-/***************************************************************************************************************************/
-
-
 /************************************************** 関数定義 **************************************************/
 /********************************************** ハードウェア初期化 *********************************************/
 // ポート初期化関数
@@ -767,6 +720,34 @@ void lcd_show_state_err(void)
 	lcd_puts("Undefine state");
 	flush_lcd();
 }
+
+#if AI_STATS_LCD
+// AIの探索の統計を表示. 例 "D8 N120k 1500ms"（深さ, ノード数, 思考時間）.
+// st が NULL なら定石の手.
+void lcd_show_ai_stats(const struct AiStats *st)
+{
+    lcd_xy(1, 2);
+    lcd_puts("                ");
+    flush_lcd();
+    lcd_xy(1, 2);
+
+    if(st == NULL)
+    {
+        lcd_puts("BOOK");
+        flush_lcd();
+        return;
+    }
+
+    lcd_puts("D");
+    lcd_dataout((unsigned long)st->depth);
+    lcd_puts(" N");
+    lcd_dataout(st->nodes / 1000);
+    lcd_puts("k ");
+    lcd_dataout(st->elapsed_ms);
+    lcd_puts("ms");
+    flush_lcd();
+}
+#endif
 /*************************************************************************************/
 
 
@@ -828,28 +809,18 @@ int is_rotary_turned_right(struct Rotary *r)
 
 
 /************************************** コマ/盤面 ********************************************* */
-// 何も置かれてないか, または何色が置かれているか
-enum stone_color read_stone_at(enum stone_color brd[][MAT_WIDTH], int x, int y)
-{
-   return brd[y][x];
-}
-
-// 指定した色のコマを置く
-void place(enum stone_color brd[][MAT_WIDTH], int x, int y, enum stone_color sc)
-{
-    brd[y][x] = sc;
-}
-
-// 指定した座標のコマを消す
-void delete(enum stone_color brd[][MAT_WIDTH], int x, int y)
-{
-    brd[y][x] = stone_black;
-}
-
 // ローカルボードの内容を割込み用表示ボードにコピー（フラッシュ）
-void flush_board(enum stone_color brd[][MAT_WIDTH])
+void flush_board(const struct Board *brd)
 {
-    memcpy(screen, brd, sizeof(screen));
+    int x, y;
+
+    for(y = 0; y < MAT_HEIGHT; y++)
+    {
+        for(x = 0; x < MAT_WIDTH; x++)
+        {
+            screen[y][x] = read_stone_at(brd, x, y);
+        }
+    }
 }
 /*****************************************************************************/
 
@@ -958,6 +929,12 @@ void wait_10ms(int period)
         nop();
 }
 
+// 現在時刻 [ms]. AIの思考時間管理に使う.
+unsigned long ai_port_get_ms(void)
+{
+    return tc_2ms * 2;
+}
+
 // AD変換値を取得. 乱数のシード値に利用.
 unsigned int get_AD0_val(void)
 {
@@ -968,148 +945,6 @@ unsigned int get_AD0_val(void)
     return (unsigned int)S12AD.ADDR0;
 }
 
-// 座標範囲外か
-int is_out_of_board(int x, int y)
-{
-    return ((x < 0) || (y < 0) || ( x > MAT_WIDTH  - 1) || (y > MAT_HEIGHT - 1));
-}
-
-// 8方向のひっくり返しフラグを作る
-//　       右下  右上  左下  左上  右   左   下   上
-// flag :  b7    b6    b5    b4  b3   b2   b1   b0
-// bit  :  0..その方角にひっくり返せない, 1..その方角にひっくり返せる
-unsigned char make_flip_dir_flag(enum stone_color brd[][MAT_WIDTH], int x, int y, enum stone_color sc)
-{
-    int dir, i;
-    int dx, dy;
-    unsigned char flag = 0x00;
-
-    enum stone_color search;
-
-    for(dir = 0; dir < 8; dir++)
-    {
-        dx = dy = 0;
-
-        for(i = 0; i < 8; i++)
-        {
-            dx += DXDY[dir][0];
-            dy += DXDY[dir][1];
-
-            // 範囲外ならbreak
-            if(is_out_of_board(x + dx, y + dy)) break;
-
-            // コマの色を調査
-            search = read_stone_at(brd, x + dx, y + dy);
-
-            // 何も置かれていなかったらbreak
-            if(search == stone_black) break;
-
-            // 自色のコマに遭遇
-            if(search == sc)
-            {
-                // i > 0 の時点で相手色を少なくとも1つは挟んでいる
-                if(i > 0)
-                {
-                    flag |= (1 << dir);
-                }
-
-                break;
-            }
-        }
-    }
-
-    return flag;
-}
-
-// その場所にその色は置けるか？
-int is_placeable(enum stone_color brd[][MAT_WIDTH], int x, int y, enum stone_color sc)
-{
-    unsigned char flag;
-
-    // 何かおいてあったらだめ
-    if(read_stone_at(brd, x, y) != stone_black) return 0;
-
-     // 8方向フラグ作成
-    flag = make_flip_dir_flag(brd, x, y, sc);
-
-    // flag != 0x00なら少なくとも1方向は挟める
-    return (flag != 0x00);
-}
-
-// 8方向フラグをつかって相手のコマをひっくり返す
-void flip_stones(unsigned char flag, enum stone_color brd[][MAT_WIDTH], int x, int y, enum stone_color sc)
-{
-    int dir, i;
-    int dx, dy;
-    enum stone_color search;
-
-    for(dir = 0; dir < 8; dir++)
-    {
-        dx = dy = 0;
-
-        if(flag & (1 << dir))
-        {
-            for(i = 0; i < 8; i++)
-            {
-                dx += DXDY[dir][0];
-                dy += DXDY[dir][1];
-
-                // コマの色をチェック
-                search = read_stone_at(brd, x + dx, y + dy);
-
-                // 置きチェック済みなので確認するのは自分の色が出たかのみ
-                if(search == sc)
-                {
-                    break;
-                }
-
-                // 新しくコマを置く
-                place(brd, x + dx, y + dy, (search == stone_red) ? stone_green : stone_red);
-            }
-        }
-    }
-}
-
-// ボード上の配置可能数を数える
-int count_placeable(enum stone_color brd[][MAT_WIDTH], enum stone_color sc)
-{
-    int x, y;
-    int count = 0;
-
-    for(x = 0; x < MAT_WIDTH; x++)
-    {
-        for(y = 0; y < MAT_HEIGHT; y++)
-        {
-            if(is_placeable(brd, x, y, sc))
-            {
-                count++;
-            }
-        }
-    }
-
-    return count;
-}
-
-// 指定した色のコマの数を数える
-int count_stones(enum stone_color brd[][MAT_WIDTH], enum stone_color sc)
-{
-    int x, y;
-    int count = 0;
-
-    for(x = 0; x < MAT_WIDTH; x++)
-    {
-        for(y = 0; y < MAT_HEIGHT; y++)
-        {
-            if(read_stone_at(brd, x, y) == sc)
-            {
-                count++;
-            }
-        }
-    }
-
-    return count;
-}
-
 // どっちも置けなかったらおわり
 int is_game_over(int stone1_placeable_count, int stone2_placeable_count)
 {
@@ -1117,7 +952,7 @@ int is_game_over(int stone1_placeable_count, int stone2_placeable_count)
 }
 
 // コマを並べて結果発表
-void line_up_result(enum stone_color brd[][MAT_WIDTH], int stone1_count, int stone2_count, int period_10ms)
+void line_up_result(struct Board *brd, int stone1_count, int stone2_count, int period_10ms)
 {
 	int x, y;
 
@@ -1164,393 +999,12 @@ void line_up_result(enum stone_color brd[][MAT_WIDTH], int stone1_count, int sto
 }
 
 /********************************************* AI ***********************************************/
-// 盤面の位置評価を計算
-int evaluate_position_weight(enum stone_color brd[][MAT_WIDTH], enum stone_color ai_color)
-{
-    int x, y;
-    int ai_score = 0;
-    int opp_score = 0;
-    enum stone_color opp_color = (ai_color == stone_red) ? stone_green : stone_red;
-
-    for(y = 0; y < MAT_HEIGHT; y++)
-    {
-        for(x = 0; x < MAT_WIDTH; x++)
-        {
-            if(read_stone_at(brd, x, y) == ai_color)
-            {
-                ai_score += POSITION_WEIGHTS[y][x];
-            }
-            else if(read_stone_at(brd, x, y) == opp_color)
-            {
-                opp_score += POSITION_WEIGHTS[y][x];
-            }
-        }
-    }
-
-    return ai_score - opp_score;
-}
-
-// コマの数の差を計算. 終盤用.
-int evaluate_stone_count(enum stone_color brd[][MAT_WIDTH], enum stone_color ai_color)
-{
-    int x, y;
-    int ai_count = 0;
-    int opp_count = 0;
-    enum stone_color opp_color = (ai_color == stone_red) ? stone_green : stone_red;
-
-    for(y = 0; y < MAT_HEIGHT; y++)
-    {
-        for(x = 0; x < MAT_WIDTH; x++)
-        {
-            if(read_stone_at(brd, x, y) == ai_color)
-            {
-                ai_count++;
-            }
-            else if(read_stone_at(brd, x, y) == opp_color)
-            {
-                opp_count++;
-            }
-        }
-    }
-
-    return ai_count - opp_count;
-}
-
-// 絶対に取られないコマの数を計算
-int count_stable_stones(enum stone_color brd[][MAT_WIDTH], enum stone_color sc)
-{
-    int stable_count = 0;
-
-    // 角のコマは確定石
-    if(read_stone_at(brd, 0,           0             ) == sc) stable_count++;
-    if(read_stone_at(brd, MAT_WIDTH-1, 0             ) == sc) stable_count++;
-    if(read_stone_at(brd, 0,           MAT_HEIGHT - 1) == sc) stable_count++;
-    if(read_stone_at(brd, MAT_WIDTH-1, MAT_HEIGHT - 1) == sc) stable_count++;
-
-    return stable_count;
-}
-
-// 盤面評価関数
-// AI視点でのスコアを計算
-int evaluate_board(enum stone_color brd[][MAT_WIDTH], enum stone_color ai_color)
-{
-    enum stone_color opp_color = (ai_color == stone_red) ? stone_green : stone_red;
-    int position_score, mobility_score, stable_score;
-    int ai_stable, opp_stable;
-    int ai_mobility, opp_mobility;
-
-    // 位置評価 各マスの価値
-    position_score = evaluate_position_weight(brd, ai_color);
-
-    // 配置可能数評価
-    // 自分の手数が多く、相手の手数が少ないほど有利
-    ai_mobility = count_placeable(brd, ai_color);
-    opp_mobility = count_placeable(brd, opp_color);
-    mobility_score = ai_mobility - opp_mobility;
-
-    // 確定石評価
-    // 角に配置されたコマは絶対に取られない
-    ai_stable = count_stable_stones(brd, ai_color);
-    opp_stable = count_stable_stones(brd, opp_color);
-    stable_score = (ai_stable - opp_stable) * STABLE_WEIGHT;
-
-    // 各要素に重み係数を掛けて総合スコアを算出
-    return position_score * POS_WEIGHT + mobility_score * MOBILITY_WEIGHT + stable_score;
-}
-
-// ミニマックス法 + αβ枝刈り
-// AIが最善の手を見つけるため、相手も最善手を打つと仮定して先読みする
-int minimax_alphabeta(enum stone_color brd[][MAT_WIDTH], enum stone_color ai_color, int max_depth)
-{
-    int depth, x, y, i, move_idx;
-    enum stone_color current_color;
-    int score, best_score;
-    int is_max_player;
-
-    // スタック用の変数
-    int stack_alpha[AI_DEPTH + 1];      // α値：MAXプレイヤーの最小値
-    int stack_beta[AI_DEPTH + 1];       // β値：MINプレイヤーの最大値
-    int stack_best_score[AI_DEPTH + 1]; // 各深さでの最良スコア
-    int stack_move_idx[AI_DEPTH + 1];   // 現在評価中の手のインデックス
-    int stack_is_max[AI_DEPTH + 1];     // MAXプレイヤーかどうかのフラグ
-
-    // 初期化
-	// 現在の盤面をシミュレーション用バッファにコピー
-    memcpy(ai_buf[0], brd, sizeof(enum stone_color) * MAT_HEIGHT * MAT_WIDTH);
-
-    // ルートノード（深さ0）の候補手を生成
-    ai_move_counts[0] = 0;
-    for(y = 0; y < MAT_HEIGHT; y++)
-    {
-        for(x = 0; x < MAT_WIDTH; x++)
-        {
-            // 配置可能な場所を全てリストアップ
-            if(is_placeable(ai_buf[0], x, y, ai_color))
-            {
-                ai_moves[0][ai_move_counts[0]].x = x;
-                ai_moves[0][ai_move_counts[0]].y = y;
-                ai_moves[0][ai_move_counts[0]].score = -INF;
-                ai_move_counts[0]++;
-            }
-        }
-    }
-
-    // 配置可能な場所がない場合
-    if(ai_move_counts[0] == 0) return -INF;
-
-    best_score = -INF;
-
-    // ルートノードの各候補手を順番に評価
-    for(i = 0; i < ai_move_counts[0]; i++)
-    {
-        x = ai_moves[0][i].x;
-        y = ai_moves[0][i].y;
-
-        // 手を打つ盤面をコピーしてコマを配置・反転
-        memcpy(ai_buf[1], ai_buf[0], sizeof(enum stone_color) * MAT_HEIGHT * MAT_WIDTH);
-        flip_stones(make_flip_dir_flag(ai_buf[1], x, y, ai_color), ai_buf[1], x, y, ai_color);
-
-        // 深さ1から探索開始（相手のターン）
-        depth = 1;
-        stack_alpha[1] = -INF;      // α値初期化
-        stack_beta[1] = INF;        // β値初期化
-        stack_move_idx[1] = 0;      // 最初の手から評価
-        stack_is_max[1] = 0;        // 次は相手のターン（MINプレイヤー）
-        score = -INF;
-
-        // 深さ優先探索をループで実装
-        while(depth > 0)
-        {
-            // 葉ノード到達
-            // 指定した深さまで探索完了
-            if(depth >= max_depth)
-            {
-                // 評価値を計算
-                score = evaluate_board(ai_buf[depth], ai_color);
-                depth--;  // 一つ上の階層に戻る
-
-                // 親ノードに評価値を伝播
-                if(depth > 0)
-                {
-                    if(stack_is_max[depth])  // MAXプレイヤー（AI）
-                    {
-                        // より良いスコアを選択
-                        if(score > stack_best_score[depth])
-						{
-							stack_best_score[depth] = score;
-						}
-
-                        // β枝刈り
-						// MINプレイヤーがこのルートを選ばないことが確定
-                        if(stack_best_score[depth] >= stack_beta[depth])
-                        {
-                            score = stack_best_score[depth];
-                            depth--;
-                            if(depth > 0)
-                            {
-                                stack_move_idx[depth]++;  // 次の手へ
-                            }
-                            continue;
-                        }
-
-                        // α値更新
-                        if(stack_best_score[depth] > stack_alpha[depth])
-						{
-							 stack_alpha[depth] = stack_best_score[depth];
-						}
-                           
-                    }
-                    else  // MINプレイヤー（相手）
-                    {
-                        // より悪いスコアを選択
-                        if(score < stack_best_score[depth])
-						{
-							stack_best_score[depth] = score;
-						}
-                            
-                        // α枝刈り
-						// MAXプレイヤーがこのルートを選ばないことが確定
-                        if(stack_best_score[depth] <= stack_alpha[depth])
-                        {
-                            score = stack_best_score[depth];
-                            depth--;
-                            if(depth > 0)
-                            {
-                                stack_move_idx[depth]++;  // 次の手へ
-                            }
-                            continue;
-                        }
-
-                        // β値更新
-                        if(stack_best_score[depth] < stack_beta[depth])
-						{
-							stack_beta[depth] = stack_best_score[depth];
-						}
-                            
-                    }
-                    stack_move_idx[depth]++;  // 次の手へ
-                }
-                continue;
-            }
-
-            // 中間ノード
-			// 現在のプレイヤーを判定
-            is_max_player = stack_is_max[depth];
-            // 奇数深さ=相手、偶数深さ=AI
-            current_color = (depth % 2 == 1) ? (ai_color == stone_red ? stone_green : stone_red) : ai_color;
-
-            // 初回訪問時
-			// このノードの候補手を生成
-            if(stack_move_idx[depth] == 0)
-            {
-                ai_move_counts[depth] = 0;
-                for(y = 0; y < MAT_HEIGHT; y++)
-                {
-                    for(x = 0; x < MAT_WIDTH; x++)
-                    {
-                        // 配置可能な場所をリストアップ
-                        if(is_placeable(ai_buf[depth], x, y, current_color))
-                        {
-                            ai_moves[depth][ai_move_counts[depth]].x = x;
-                            ai_moves[depth][ai_move_counts[depth]].y = y;
-                            ai_move_counts[depth]++;
-                        }
-                    }
-                }
-
-                // 手がない場合（パス）
-                if(ai_move_counts[depth] == 0)
-                {
-                    // パスの場合は現在の盤面を評価して返す
-                    score = evaluate_board(ai_buf[depth], ai_color);
-                    depth--;  // 親ノードに戻る
-
-                    // スコアを親ノードに反映
-                    if(depth > 0)
-                    {
-                        if(stack_is_max[depth])
-                        {
-                            if(score > stack_best_score[depth])
-							{
-								stack_best_score[depth] = score;
-							}
-                        }
-                        else
-                        {
-                            if(score < stack_best_score[depth])
-							{
-								stack_best_score[depth] = score;
-							}
-                        }
-
-                        stack_move_idx[depth]++;  // 次の手へ
-                    }
-                    continue;
-                }
-
-                // 最良スコア初期化（MAXは-∞、MINは+∞から開始）
-                stack_best_score[depth] = is_max_player ? -INF : INF;
-            }
-
-            // すべての候補手を評価済みの場合
-            if(stack_move_idx[depth] >= ai_move_counts[depth])
-            {
-                score = stack_best_score[depth];
-                depth--;  // 親ノードに戻る
-
-                // スコアを親ノードに伝播 + αβ枝刈りチェック
-                if(depth > 0)
-                {
-                    if(stack_is_max[depth])  // MAXプレイヤー
-                    {
-                        if(score > stack_best_score[depth])
-						{
-							stack_best_score[depth] = score;
-						}
-                            
-                        // β枝刈り
-                        if(stack_best_score[depth] >= stack_beta[depth])
-                        {
-                            score = stack_best_score[depth];
-                            depth--;
-                            if(depth > 0)
-                            {
-                                stack_move_idx[depth]++;
-                            }
-                            continue;
-                        }
-
-                        // α値更新
-                        if(stack_best_score[depth] > stack_alpha[depth])
-						{
-							stack_alpha[depth] = stack_best_score[depth];
-						}
-                    }
-                    else  // MINプレイヤー
-                    {
-                        if(score < stack_best_score[depth])
-						{
-							stack_best_score[depth] = score;
-						}
-                            
-                        // α枝刈り
-                        if(stack_best_score[depth] <= stack_alpha[depth])
-                        {
-                            score = stack_best_score[depth];
-                            depth--;
-                            if(depth > 0)
-                            {
-                                stack_move_idx[depth]++;
-                            }
-                            continue;
-                        }
-
-                        // β値更新
-                        if(stack_best_score[depth] < stack_beta[depth])
-						{
-							stack_beta[depth] = stack_best_score[depth];
-						}
-                    }
-
-                    stack_move_idx[depth]++;  // 次の手へ
-                }
-                continue;
-            }
-
-            // 次の手を試す
-            move_idx = stack_move_idx[depth];
-            x = ai_moves[depth][move_idx].x;
-            y = ai_moves[depth][move_idx].y;
-
-            // 手を打つ
-			// 盤面をコピーしてコマを配置・反転
-            memcpy(ai_buf[depth + 1], ai_buf[depth], sizeof(enum stone_color) * MAT_HEIGHT * MAT_WIDTH);
-            flip_stones(make_flip_dir_flag(ai_buf[depth + 1], x, y, current_color), ai_buf[depth + 1], x, y, current_color);
-
-            // 次の深さへ進む（子ノードへ）
-            depth++;
-            stack_alpha[depth] = stack_alpha[depth - 1];  // α値を引き継ぐ
-            stack_beta[depth] = stack_beta[depth - 1];    // β値を引き継ぐ
-            stack_move_idx[depth] = 0;                    // 最初の手から評価
-            stack_is_max[depth] = !is_max_player;         // プレイヤー切り替え
-        }
-
-        // ルートノードの各手のスコアを記録
-        ai_moves[0][i].score = score;
-        if(score > best_score)
-        {
-            best_score = score;
-        }
-    }
-
-    return best_score;
-}
-
 // AIの次の行き先を決定する関数
-void set_AI_cursor_dest(enum stone_color brd[][MAT_WIDTH], enum stone_color sc, int placeable_count, int depth)
+// 定石にある局面は探索せずに定石の手を使う. なければ探索を始める.
+// 行き先が決まったら1, 探索を始めたら0を返す. 探索の続きは step_AI_search で進める.
+int set_AI_cursor_dest(const struct Board *brd, enum stone_color sc, int placeable_count, int depth)
 {
-    int i, best_idx, best_count;
-    int best_score;
+    int x, y;
 
     // スキップ判定
 	// どこにも置けない場合は現在のカーソル位置を維持
@@ -1558,48 +1012,53 @@ void set_AI_cursor_dest(enum stone_color brd[][MAT_WIDTH], enum stone_color sc,
     {
         cursor.dest_x = cursor.x;
         cursor.dest_y = cursor.y;
-        return;
+        return 1;
     }
 
-    // ミニマックス + αβ枝刈りで全候補手を評価
-    minimax_alphabeta(brd, sc, depth);
-
-    // 最高評価のスコアを見つける
-    best_score = -INF;
-
-    for(i = 0; i < ai_move_counts[0]; i++)
+    // 定石の手
+    if(book_lookup(brd, sc, &x, &y))
     {
-        if(ai_moves[0][i].score > best_score)
-        {
-            best_score = ai_moves[0][i].score;
-        }
+#if AI_STATS_LCD
+        lcd_show_ai_stats(NULL);
+#endif
+        // カーソルの目標位置を設定
+        cursor.dest_x = x;
+        cursor.dest_y = y;
+        return 1;
     }
 
-    // 同じスコアの手が複数ある場合をカウント
-    best_count = 0;
+    // 探索は持ち時間から配った思考時間で打ち切られる
+    ai_search_start(brd, sc, depth, ai_time_budget(brd, sc));
 
-    for(i = 0; i < ai_move_counts[0]; i++)
-    {
-        if(ai_moves[0][i].score == best_score)
-        {
-            ai_entry_idx[best_count] = i;  // 同点の手のインデックスを記録
-            best_count++;
-        }
-    }
+    return 0;
+}
 
-    // 同点の場合はランダムに選択
-    if(best_count > 1)
-    {
-        best_idx = ai_entry_idx[rand() % best_count];
-    }
-    else
+// AIの探索を AI_SLICE_NODES ノード進める
+// 探索が終わったら行き先を設定して1を返す.
+int step_AI_search(void)
+{
+    int x, y;
+
+    switch(ai_search_step(AI_SLICE_NODES, &x, &y))
     {
-        best_idx = ai_entry_idx[0];
-    }
+        case ai_search_running:
+            return 0;
 
-    // カーソルの目標位置を設定
-    cursor.dest_x = ai_moves[0][best_idx].x;
-    cursor.dest_y = ai_moves[0][best_idx].y;
+        case ai_search_done:
+#if AI_STATS_LCD
+            lcd_show_ai_stats(ai_get_stats());
+#endif
+            // カーソルの目標位置を設定
+            cursor.dest_x = x;
+            cursor.dest_y = y;
+            return 1;
+
+        // 置ける場所がない場合は現在のカーソル位置を維持
+        default:
+            cursor.dest_x = cursor.x;
+            cursor.dest_y = cursor.y;
+            return 1;
+    }
 }
 /*************************************************************************************************/
 
@@ -1641,27 +1100,6 @@ void init_Player(struct Player *p1, struct Player *p2)
 	p2->result          = 0;
 }
 
-// 盤面初期化
-void init_board(enum stone_color brd[][MAT_WIDTH])
-{   
-	int x, y;
-
-    // コマ全撤去
-    for(x = 0;x < MAT_WIDTH; x++)
-    {
-        for(y = 0; y < MAT_HEIGHT; y++)
-        {
-            delete(brd, x, y);
-        }
-    }
-
-    // 真ん中に４つ置く
-    place(brd, 3, 3, stone_red);
-    place(brd, 4, 4, stone_red);
-    place(brd, 3, 4, stone_green);
-    place(brd, 4, 3, stone_green);
-}
-
 // カーソル初期化
 void init_Cursor(void)
 {
@@ -1700,11 +1138,11 @@ void Excep_CMT0_CMI0(void)
 }
 
 // CMT1 CMI1 2msタイマ割込みハンドラ
-// 8×8 マトリクスledのダイナミック点灯制御
+// MAT_WIDTH×MAT_HEIGHT マトリクスledのダイナミック点灯制御
 void Excep_CMT1_CMI1(void)
 {
     int x, y;
-    unsigned int rg_data = 0x0000;  // 赤(上位8ビット)・緑(下位8ビット)のLEDデータ
+    unsigned int rg_data = 0x0000;  // 赤(上位 MAT_HEIGHT ビット)・緑(下位 MAT_HEIGHT ビット)のLEDデータ
 
     // 2msタイムカウンタをインクリメント
     tc_2ms++;
@@ -1717,12 +1155,12 @@ void Excep_CMT1_CMI1(void)
     {
         if(screen[y][x] == stone_red)
         {
-            // 赤コマの場合上位8ビット（bit8〜15）に対応するビットをセット
-            rg_data |= (1 << (y + 8));
+            // 赤コマの場合上位ビット（8x8 では bit8〜15）に対応するビットをセット
+            rg_data |= (1 << (y + MAT_HEIGHT));
         }
         else if(screen[y][x] == stone_green)
         {
-            // 緑コマの場合下位8ビット（bit0〜7）に対応するビットをセット
+            // 緑コマの場合下位ビット（8x8 では bit0〜7）に対応するビットをセット
             rg_data |= (1 << y);
         }
     }
@@ -1740,13 +1178,13 @@ void Excep_CMT1_CMI1(void)
     if((tc_2ms / (CURSOR_BLINK_PERIOD_MS / 2)) % 2)
     {
         // 点灯期間：カーソルのLEDをON
-        rg_data |= (cursor.color == stone_red) ? (1 << (cursor.y + 8)) : (1 << cursor.y);
+        rg_data |= (cursor.color == stone_red) ? (1 << (cursor.y + MAT_HEIGHT)) : (1 << cursor.y);
     }
-    else if(rg_data & ((1 << (cursor.y + 8)) | (1 << cursor.y)))
+    else if(rg_data & ((1 << (cursor.y + MAT_HEIGHT)) | (1 << cursor.y)))
     {
         // 消灯期間：カーソル位置に既にコマがある場合はそれも消す
         // カーソル位置のビットをクリア
-        rg_data &= ~((1 << (cursor.y + 8)) | (1 << cursor.y));
+        rg_data &= ~((1 << (cursor.y + MAT_HEIGHT)) | (1 << cursor.y));
     }
 
     // マトリックスLEDに出力（指定列を点灯）
@@ -1837,7 +1275,7 @@ void main(void)
     enum State state = INIT_HW;
 
     // ボード色情報
-    enum stone_color board[MAT_HEIGHT][MAT_WIDTH];
+    struct Board board;
 
 	// ゲーム情報
     struct Game game;
@@ -1848,11 +1286,9 @@ void main(void)
     // ロータリーエンコーダ入力
     struct Rotary rotary;
 
-    // コマ反転用フラグ
-	//　       右下  右上   左下   左上  右   左   下   上
-	// flag :  b7    b6    b5    b4    b3   b2   b1   b0
-	// bit  :  0..その方角にひっくり返せない, 1..その方角にひっくり返せる
-    unsigned char flip_dir_flag;
+    // コマ反転用マスク
+	// bit  :  0..ひっくり返さない, 1..ひっくり返す
+    uint64_t flip_mask;
 
     // 初期化オプション
     unsigned char init_option = OPT_NORMAL;
@@ -1906,7 +1342,10 @@ void main(void)
 		        init_Player(&red, &green);
 
 		        // 盤面を初期状態に設定
-		        init_board(board);
+		        init_board(&board);
+
+		        // 前の対局のAI探索結果を消去
+		        ai_new_game();
 
 		        // カーソルを初期位置に配置
 		        init_Cursor();
@@ -1915,7 +1354,7 @@ void main(void)
 		        init_lcd_show(cursor.color);
 
 		        // 盤面をLEDマトリクスに出力
-		        flush_board(board);
+		        flush_board(&board);
 
 		        // 通常時:対戦モード選択待ち状態へ遷移
                 // AI vs AI時:ターン開始状態へ遷移
@@ -2006,6 +1445,9 @@ void main(void)
 		        }
 		        else
 		        {
+		            // AI対戦で人間のターンの場合、待ち時間にAIが先読みする
+		            if(game.is_man_vs_AI) ai_ponder_start(&board, cursor.color);
+
 		            // 人間のターンの場合、入力待ち状態へ
 		            state = INPUT_WAIT;
 		        }
@@ -2016,10 +1458,27 @@ void main(void)
 		    // AI思考状態
 		    case AI_THINK:
 		        // AIが次の手を決定
-		        // 現在の盤面、コマの色、配置可能数、探索深度を渡す
-		        set_AI_cursor_dest(board, cursor.color, (cursor.color == stone_red) ? red.placeable_count : green.placeable_count, AI_DEPTH);
-		        // AI移動状態へ遷移
-		        state = AI_MOVE;
+		        // 現在の盤面、コマの色、配置可能数、最大探索深度を渡す
+		        if(set_AI_cursor_dest(&board, cursor.color, (cursor.color == stone_red) ? red.placeable_count : green.placeable_count, AI_MAX_DEPTH))
+		        {
+		            // 行き先が決まればAI移動状態へ遷移
+		            state = AI_MOVE;
+		        }
+		        else
+		        {
+		            // 探索が必要ならAI探索中状態へ遷移
+		            state = AI_SEARCH;
+		        }
+		        break;
+
+		    // AI探索中状態
+		    // 1周ごとに探索を少しずつ進め, その間もリセットなどのメインループの処理を止めない
+		    case AI_SEARCH:
+		        if(step_AI_search())
+		        {
+		            // AI移動状態へ遷移
+		            state = AI_MOVE;
+		        }
 		        break;
 
 		    //********** プレイヤー入力フェーズ **********//
@@ -2071,6 +1530,11 @@ void main(void)
                     // 次回の比較用
 		            rotary.prev += get_rotary_delta(&rotary);
 		        }
+		        // 入力がない間はAIが先読みする. 1周で進めるのは AI_SLICE_NODES ノードまで.
+		        else if(game.is_man_vs_AI)
+		        {
+		            ai_ponder_step(AI_SLICE_NODES);
+		        }
 
 		        // 入力待ち状態へ戻る
 		        state = INPUT_WAIT;
@@ -2126,7 +1590,7 @@ void main(void)
 		            // スキップ（置ける場所がない）の場合は配置せずにターン終了
 		            state = TURN_SWITCH;
 		        }
-		        else if(is_placeable(board, cursor.x, cursor.y, cursor.color))
+		        else if(is_placeable(&board, cursor.x, cursor.y, cursor.color))
 		        {
 		            // 配置可能な場合
 		            state = PLACE_OK;
@@ -2144,10 +1608,10 @@ void main(void)
 		        beep(DO2, 100);
 
 		        // コマを配置
-		        place(board, cursor.x, cursor.y, cursor.color);
+		        place(&board, cursor.x, cursor.y, cursor.color);
 
 		        // 盤面をLEDマトリクスに出力
-		        flush_board(board);
+		        flush_board(&board);
 
 		        // 反転計算状態へ遷移
 		        state = FLIP_CALC;
@@ -2167,8 +1631,8 @@ void main(void)
 
 		    // 反転計算状態
 		    case FLIP_CALC:
-		        // どの方向のコマを反転させるかのフラグを作成
-		        flip_dir_flag = make_flip_dir_flag(board, cursor.x, cursor.y, cursor.color);
+		        // 反転させるコマのマスクを作成
+		        flip_mask = make_flip_mask(&board, cursor.x, cursor.y, cursor.color);
 
 		        // 反転実行状態へ遷移
 		        state = FLIP_RUN;
@@ -2177,10 +1641,10 @@ void main(void)
 		    // 反転実行状態
 		    case FLIP_RUN:
 		        // コマを反転
-		        flip_stones(flip_dir_flag, board, cursor.x, cursor.y, cursor.color);
+		        flip_stones(flip_mask, &board, cursor.color);
 
 		        // 盤面をLEDマトリクスに出力
-		        flush_board(board);
+		        flush_board(&board);
 
 		        // ターン切り替え状態へ遷移
 		        state = TURN_SWITCH;
@@ -2200,8 +1664,8 @@ void main(void)
 		    // ターンカウント状態
 		    case TURN_COUNT:
 		        // 各プレイヤーの配置可能な場所の数を計算
-		        red.placeable_count   = count_placeable(board, stone_red);
-		        green.placeable_count = count_placeable(board, stone_green);
+		        red.placeable_count   = count_placeable(&board, stone_red);
+		        green.placeable_count = count_placeable(&board, stone_green);
 
 		        // ターン判定状態へ遷移
 		        state = TURN_JUDGE;
@@ -2250,8 +1714,8 @@ void main(void)
 		    // 結果計算状態
 		    case END_CALC:
 		        // 赤・緑それぞれのコマの数を数える
-		        red.result   = count_stones(board, stone_red);
-		        green.result = count_stones(board, stone_green);
+		        red.result   = count_stones(&board, stone_red);
+		        green.result = count_stones(&board, stone_green);
 
 		        // 結果表示状態へ遷移
 		        state = END_SHOW;
@@ -2267,7 +1731,7 @@ void main(void)
 		        cursor.color = stone_black;
 
 		        // 盤面に結果を整列表示
-		        line_up_result(board, red.result, green.result, LINE_UP_RESULT_PERIOD_MS / 10);
+		        line_up_result(&board, red.result, green.result, LINE_UP_RESULT_PERIOD_MS / 10);
 
 		        // 勝者を表示
 		        lcd_show_winner(red.result, green.result);
@@ -0,0 +1,372 @@
+// pattern.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include "bitboard.h"
+#include "pattern.h"
+
+// 8ビットを3進数に変換する表. ビットiが立っていれば 3^i を足す.
+static const uint16_t TERNARY[256] =
+{
+       0,    1,    3,    4,    9,   10,   12,   13,   27,   28,   30,   31,   36,   37,   39,   40,
+      81,   82,   84,   85,   90,   91,   93,   94,  108,  109,  111,  112,  117,  118,  120,  121,
+     243,  244,  246,  247,  252,  253,  255,  256,  270,  271,  273,  274,  279,  280,  282,  283,
+     324,  325,  327,  328,  333,  334,  336,  337,  351,  352,  354,  355,  360,  361,  363,  364,
+     729,  730,  732,  733,  738,  739,  741,  742,  756,  757,  759,  760,  765,  766,  768,  769,
+     810,  811,  813,  814,  819,  820,  822,  823,  837,  838,  840,  841,  846,  847,  849,  850,
+     972,  973,  975,  976,  981,  982,  984,  985,  999, 1000, 1002, 1003, 1008, 1009, 1011, 1012,
+    1053, 1054, 1056, 1057, 1062, 1063, 1065, 1066, 1080, 1081, 1083, 1084, 1089, 1090, 1092, 1093,
+    2187, 2188, 2190, 2191, 2196, 2197, 2199, 2200, 2214, 2215, 2217, 2218, 2223, 2224, 2226, 2227,
+    2268, 2269, 2271, 2272, 2277, 2278, 2280, 2281, 2295, 2296, 2298, 2299, 2304, 2305, 2307, 2308,
+    2430, 2431, 2433, 2434, 2439, 2440, 2442, 2443, 2457, 2458, 2460, 2461, 2466, 2467, 2469, 2470,
+    2511, 2512, 2514, 2515, 2520, 2521, 2523, 2524, 2538, 2539, 2541, 2542, 2547, 2548, 2550, 2551,
+    2916, 2917, 2919, 2920, 2925, 2926, 2928, 2929, 2943, 2944, 2946, 2947, 2952, 2953, 2955, 2956,
+    2997, 2998, 3000, 3001, 3006, 3007, 3009, 3010, 3024, 3025, 3027, 3028, 3033, 3034, 3036, 3037,
+    3159, 3160, 3162, 3163, 3168, 3169, 3171, 3172, 3186, 3187, 3189, 3190, 3195, 3196, 3198, 3199,
+    3240, 3241, 3243, 3244, 3249, 3250, 3252, 3253, 3267, 3268, 3270, 3271, 3276, 3277, 3279, 3280
+};
+
+// 8ビットの並びを逆にする表
+static const uint8_t REVERSE[256] =
+{
+    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+    0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+    0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+    0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+    0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+    0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+    0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+    0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+    0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+    0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+    0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+    0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+    0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+    0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+    0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+    0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF
+};
+
+// 線の前半 h マスの並びの組の数 3^h x (3^h + 1) / 2
+static const uint32_t LINE_PAIRS[5] = {1, 6, 45, 378, 3321};
+
+// 形ごとの重み表の先頭位置
+const uint32_t pattern_shape_ofs[PATTERN_NUM_SHAPES + 1] =
+{
+    PATTERN_OFS_EDGE, PATTERN_OFS_C33, PATTERN_OFS_C24, PATTERN_OFS_D8,
+    PATTERN_OFS_D7, PATTERN_OFS_D6, PATTERN_OFS_D5, PATTERN_OFS_D4, PATTERN_SIZE
+};
+
+// 形ごとの特徴の数（pattern_features の並び順）
+static const uint8_t SHAPE_FEATURES[PATTERN_NUM_SHAPES] = {4, 4, 8, 2, 4, 4, 4, 4};
+
+// 左上から右下向きの斜めのマスク. DIAG_MASKS[s] は (s, 0) から始まる 8 - s マス.
+static const uint64_t DIAG_MASKS[5] =
+{
+    0x8040201008040201ULL,
+    0x0080402010080402ULL,
+    0x0000804020100804ULL,
+    0x0000008040201008ULL,
+    0x0000000080402010ULL
+};
+
+// 各形をどの対称形の盤面から取り出すか.
+// 対称形 0:そのまま 1:上下反転 2:左右反転 3:180度回転, 4〜7: 0〜3を対角線で折り返したもの
+static const uint8_t SYM_EDGE[4] = {0, 1, 4, 6};                // 上, 下, 左, 右の辺
+static const uint8_t SYM_CORNER[4] = {0, 1, 2, 3};              // 左上, 左下, 右上, 右下の隅
+static const uint8_t SYM_C24[8] = {0, 1, 2, 3, 4, 5, 6, 7};     // 隅の横長, 縦長
+static const uint8_t SYM_DIAG[4] = {0, 4, 1, 5};                // 斜めの4方向
+
+// 斜め8〜4マスの重み表の先頭位置
+static const uint32_t DIAG_OFS[5] =
+{
+    PATTERN_OFS_D8, PATTERN_OFS_D7, PATTERN_OFS_D6, PATTERN_OFS_D5, PATTERN_OFS_D4
+};
+
+// 全特徴のマスの数の合計（8x8）. 差分更新の表の大きさ.
+#define PATTERN_NUM_CELLS (4 * 8 + 4 * 9 + 8 * 8 + 2 * 8 + 4 * (7 + 6 + 5 + 4))
+
+// 差分更新の表. マス sq を含む部品は sq_part[sq_first[sq]] 〜 sq_part[sq_first[sq + 1] - 1],
+// その部品の中でのマスの桁の重み（3^k）は sq_pow の同じ位置. 盤の大きさで変わるので初めて使うときに作る.
+static uint16_t sq_first[BB_SQUARES + 1];
+static uint8_t  sq_part[PATTERN_NUM_CELLS];
+static uint8_t  sq_pow[PATTERN_NUM_CELLS];
+static int      sq_ready;
+
+// 3進インデックス. pビット, oビットは同じ並びの1行分.
+#define TRI(pb, ob) (TERNARY[pb] + 2 * TERNARY[ob])
+
+// 1マスの3進の桁. sq はビット番号.
+#define CELL(pb, ob, sq) ((unsigned int)(((pb) >> (sq)) & 1) + 2 * (unsigned int)(((ob) >> (sq)) & 1))
+
+// 並びの組 (u, l) の番号. u と l を入れ替えても同じ番号になる.
+// 大小は予測できないので, 分岐せずに大きい方と小さい方を選ぶ.
+static uint32_t pair_index(uint32_t u, uint32_t l)
+{
+    uint32_t hi = (u < l) ? l : u;
+    uint32_t lo = u ^ l ^ hi;
+
+    return hi * (hi + 1) / 2 + lo;
+}
+
+// n マスの線の部品. pb, ob はビット0〜n-1に並べた1列.
+// 前から読んだ前半, 後ろから読んだ後半, 奇数の長さなら中央のマス の順に pt に入れる.
+// 逆向きに読んだ線は前半と後半が入れ替わるだけなので, 組の番号で引けば同じ番号になる.
+static void line_parts(unsigned int pb, unsigned int ob, int n, uint8_t *pt)
+{
+    unsigned int h = (unsigned int)n / 2;
+    unsigned int mask = (1u << h) - 1;
+    unsigned int rp = (unsigned int)REVERSE[pb] >> (8 - n);
+    unsigned int ro = (unsigned int)REVERSE[ob] >> (8 - n);
+
+    pt[0] = (uint8_t)TRI(pb & mask, ob & mask);
+    pt[1] = (uint8_t)TRI(rp & mask, ro & mask);
+    if(n & 1) pt[2] = (uint8_t)CELL(pb, ob, h);
+}
+
+// 隅の3x3の部品. 対角線上の3マスと, 対角線の両側の3マスずつ.
+// 対角線で折り返した形は両側が入れ替わるだけなので, 組の番号で引けば同じ番号になる.
+static void c33_parts(uint64_t tp, uint64_t to, uint8_t *pt)
+{
+    pt[0] = (uint8_t)(CELL(tp, to, 0) + CELL(tp, to, 9) * 3 + CELL(tp, to, 18) * 9);  // (0,0) (1,1) (2,2)
+    pt[1] = (uint8_t)(CELL(tp, to, 1) + CELL(tp, to, 2) * 3 + CELL(tp, to, 10) * 9);  // (1,0) (2,0) (2,1)
+    pt[2] = (uint8_t)(CELL(tp, to, 8) + CELL(tp, to, 16) * 3 + CELL(tp, to, 17) * 9); // (0,1) (0,2) (1,2)
+}
+
+// 斜めのマスを1バイトに集める. 斜めのマスは列が全部違うので, 掛け算で最上位バイトに重ならずに集まる.
+static unsigned int diag_bits(uint64_t b, int s)
+{
+    return (unsigned int)(((b & DIAG_MASKS[s]) * 0x0101010101010101ULL) >> (56 + s));
+}
+
+// 手番側p, 相手側oの部品を求める. 部品は形のマスを3マス前後ずつに分けた3進の値で,
+// 各マスの桁（手番側1, 相手側2）に 3^k を掛けて足したもの. マスの変化ごとに足し引きで更新できる.
+static void pattern_parts(uint64_t p, uint64_t o, uint8_t pt[PATTERN_NUM_PARTS])
+{
+    uint64_t bp[8], bo[8];
+    uint64_t tp, to;
+    int i, s;
+
+    // 8通りの対称形を作る. どの形も左上の隅・上の辺・左上からの斜めとして取り出せる.
+    bp[0] = p;
+    bo[0] = o;
+    bp[1] = bb_flip_vertical(p);
+    bo[1] = bb_flip_vertical(o);
+    bp[2] = bb_mirror_horizontal(p);
+    bo[2] = bb_mirror_horizontal(o);
+    bp[3] = bb_flip_vertical(bp[2]);
+    bo[3] = bb_flip_vertical(bo[2]);
+
+    for(i = 0; i < 4; i++)
+    {
+        bp[i + 4] = bb_flip_diagonal(bp[i]);
+        bo[i + 4] = bb_flip_diagonal(bo[i]);
+    }
+
+    // 辺
+    for(i = 0; i < 4; i++, pt += 2)
+    {
+        tp = bp[SYM_EDGE[i]];
+        to = bo[SYM_EDGE[i]];
+        line_parts((unsigned int)(tp & 0xFF), (unsigned int)(to & 0xFF), 8, pt);
+    }
+
+    // 隅の3x3
+    for(i = 0; i < 4; i++, pt += 3)
+    {
+        c33_parts(bp[SYM_CORNER[i]], bo[SYM_CORNER[i]], pt);
+    }
+
+    // 隅の2x4. 1行目と2行目の4マスずつ.
+    for(i = 0; i < 8; i++, pt += 2)
+    {
+        tp = bp[SYM_C24[i]];
+        to = bo[SYM_C24[i]];
+        pt[0] = (uint8_t)TRI(tp & 0x0F, to & 0x0F);
+        pt[1] = (uint8_t)TRI((tp >> 8) & 0x0F, (to >> 8) & 0x0F);
+    }
+
+    // 斜め8マス. 左上-右下と左下-右上.
+    for(i = 0; i < 2; i++, pt += 2)
+    {
+        line_parts(diag_bits(bp[i], 0), diag_bits(bo[i], 0), 8, pt);
+    }
+
+    // 斜め7〜4マス. 奇数の長さは中央のマスの部品がある.
+    for(s = 1; s <= 4; s++)
+    {
+        for(i = 0; i < 4; i++, pt += 2 + (s & 1))
+        {
+            tp = bp[SYM_DIAG[i]];
+            to = bo[SYM_DIAG[i]];
+            line_parts(diag_bits(tp, s), diag_bits(to, s), 8 - s, pt);
+        }
+    }
+}
+
+// 部品から特徴（重み表の中の位置）を求める
+static void parts_index(const uint8_t *pt, uint32_t idx[PATTERN_NUM_FEATURES])
+{
+    int i, s, n = 0;
+
+    // 辺
+    for(i = 0; i < 4; i++, pt += 2)
+    {
+        idx[n++] = PATTERN_OFS_EDGE + pair_index(pt[0], pt[1]);
+    }
+
+    // 隅の3x3
+    for(i = 0; i < 4; i++, pt += 3)
+    {
+        idx[n++] = PATTERN_OFS_C33 + pt[0] * LINE_PAIRS[3] + pair_index(pt[1], pt[2]);
+    }
+
+    // 隅の2x4
+    for(i = 0; i < 8; i++, pt += 2)
+    {
+        idx[n++] = PATTERN_OFS_C24 + pt[0] + pt[1] * 81u;
+    }
+
+    // 斜め8マス
+    for(i = 0; i < 2; i++, pt += 2)
+    {
+        idx[n++] = DIAG_OFS[0] + pair_index(pt[0], pt[1]);
+    }
+
+    // 斜め7〜4マス
+    for(s = 1; s <= 4; s++)
+    {
+        for(i = 0; i < 4; i++, pt += 2 + (s & 1))
+        {
+            idx[n] = DIAG_OFS[s] + pair_index(pt[0], pt[1]);
+            if(s & 1) idx[n] += pt[2] * LINE_PAIRS[(8 - s) / 2];
+            n++;
+        }
+    }
+}
+
+// 部品から形の重みの合計を求める
+// 形ごとに int8 の重みを足してから, その形の倍率を掛ける.
+static int parts_eval(const uint8_t *pt, int phase)
+{
+    const int8_t *w = pattern_weights[phase];
+    uint32_t idx[PATTERN_NUM_FEATURES];
+    int i, k, sum, n = 0, score = pattern_bias[phase];
+
+    parts_index(pt, idx);
+
+    for(i = 0; i < PATTERN_NUM_SHAPES; i++)
+    {
+        sum = 0;
+        for(k = 0; k < SHAPE_FEATURES[i]; k++)
+        {
+            sum += w[idx[n++]];
+        }
+
+        score += sum * (1 << pattern_shift[phase][i]);
+    }
+
+    return score;
+}
+
+// 差分更新の表を作る. マスを1つだけ置いた盤面の部品を見れば, そのマスを含む部品と桁の重みが分かる.
+static void build_sq_table(void)
+{
+    uint8_t pt[PATTERN_NUM_PARTS];
+    int sq, j, n = 0;
+
+    for(sq = 0; sq < BB_SQUARES; sq++)
+    {
+        sq_first[sq] = (uint16_t)n;
+
+        if(!(BB_BIT(sq) & BB_BOARD)) continue;
+
+        pattern_parts(BB_BIT(sq), 0, pt);
+
+        for(j = 0; j < PATTERN_NUM_PARTS; j++)
+        {
+            if(pt[j] == 0) continue;
+
+            sq_part[n] = (uint8_t)j;
+            sq_pow[n]  = pt[j];
+            n++;
+        }
+    }
+
+    sq_first[BB_SQUARES] = (uint16_t)n;
+    sq_ready = 1;
+}
+
+// 空きマス数から進行度の段階を求める
+int pattern_phase(int empties)
+{
+    int played = MAT_WIDTH * MAT_HEIGHT - 4 - empties; // 打った手の数. 8x8 では 0〜60.
+
+    if(played < 0) played = 0;
+
+    return played * PATTERN_PHASES / (MAT_WIDTH * MAT_HEIGHT - 3);
+}
+
+// 手番側p, 相手側oの特徴を求める
+void pattern_features(uint64_t p, uint64_t o, uint32_t idx[PATTERN_NUM_FEATURES])
+{
+    uint8_t pt[PATTERN_NUM_PARTS];
+
+    pattern_parts(p, o, pt);
+    parts_index(pt, idx);
+}
+
+// 手番側p, 相手側oの形の重みの合計
+int pattern_eval(uint64_t p, uint64_t o, int phase)
+{
+    uint8_t pt[PATTERN_NUM_PARTS];
+
+    pattern_parts(p, o, pt);
+
+    return parts_eval(pt, phase);
+}
+
+// 盤面から差分更新の状態を作る. 最初の呼び出しで差分更新の表も作る.
+// 並列探索では, ヘルパースレッドを起動する前にメインスレッドの探索の開始でここを通る.
+void pattern_state_init(struct PatternState *ps, const struct Board *brd)
+{
+    if(!sq_ready) build_sq_table();
+
+    pattern_parts(brd->stones[stone_red], brd->stones[stone_green], ps->part[stone_red]);
+    pattern_parts(brd->stones[stone_green], brd->stones[stone_red], ps->part[stone_green]);
+}
+
+// sc が sq に置いて flips を返した分だけ部品を更新する
+// sc を手番側とみた部品では, 置いたマスの桁が 0→1, 返したマスの桁が 2→1 になる. 相手側とみた部品では 0→2, 1→2.
+// 途中で uint8_t の範囲を外れても, 最後の値は範囲に収まるので結果は正しい.
+void pattern_state_move(struct PatternState *ps, enum stone_color sc, int sq, uint64_t flips)
+{
+    uint8_t *own = ps->part[sc];
+    uint8_t *opp = ps->part[OPPONENT(sc)];
+    int i, end;
+
+    for(i = sq_first[sq], end = sq_first[sq + 1]; i < end; i++)
+    {
+        own[sq_part[i]] += sq_pow[i];
+        opp[sq_part[i]] += (uint8_t)(2 * sq_pow[i]);
+    }
+
+    while(flips)
+    {
+        sq = bb_first(flips);
+        flips &= flips - 1;
+
+        for(i = sq_first[sq], end = sq_first[sq + 1]; i < end; i++)
+        {
+            own[sq_part[i]] -= sq_pow[i];
+            opp[sq_part[i]] += sq_pow[i];
+        }
+    }
+}
+
+// 差分更新の状態から sc 側の形の重みの合計を求める. pattern_eval(sc のコマ, 相手のコマ, phase) と同じ値.
+int pattern_state_eval(const struct PatternState *ps, enum stone_color sc, int phase)
+{
+    return parts_eval(ps->part[sc], phase);
+}
@@ -0,0 +1,119 @@
+// pattern.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// パターン評価
+// 盤面の決まった形（辺, 隅の3x3と2x4, 斜め）のコマの並びを3進数のインデックスにして,
+// 並びごとの重みを足し合わせる. 重みは自己対戦の棋譜からホストで学習し（tools/patgen.c）,
+// 進行度ごとの const 配列として pattern_weights.c に書き出す（RX210ではROMに置かれる）.
+//
+// ROMの予算 : 重み表は 128KB 以内. 今は 4段階 x 25101 バイト = 約98KB.
+// 定石（book_data.c, 約5KB）とプログラムを合わせて ROM 256KB の RX210 に収める.
+// 形を増やすときはこの予算に収まるかを確かめる.
+//
+// 重みは int8 で, 進行度と形ごとに 2^pattern_shift 倍して使う. 学習した値の大きさに合わせて
+// 形ごとに倍率を選ぶので, 値の大きい形（隅など）も int8 で飽和しない.
+//
+// 8x8 より小さい盤（BOARD_SIZE）でも同じ形を取り出す. 盤の外のマスは空きとして数える.
+// pattern_weights.c の重みは 8x8 の盤で学習したもの. 小さい盤で使うなら同じ BOARD_SIZE でビルドした
+// selfplay / tune で学習し直す.
+//
+// インデックス : 各マスの 空き=0, 手番側=1, 相手側=2 を3進数の各桁とする.
+// 重みの単位   : 1/PATTERN_SCALE 石. 手番側から見た最終石差の予測.
+//
+// 回転・反転で重なる形は同じ重み表を共有する.
+//   辺(8マス)       x4
+//   隅の3x3         x4
+//   隅の2x4         x8（隅ごとに横長と縦長）
+//   斜め8マス       x2
+//   斜め7〜4マス    各x4
+// さらに形そのものが左右対称（辺と斜めは逆向きに読んでも同じ形, 隅の3x3は対角線で折り返しても同じ形）
+// なので, 折り返すと一致する並びは重み表の1つの要素にまとめる. 線の形は前半と後半の並び
+// （と奇数の長さなら中央のマス）, 隅の3x3は対角線上の3マスと, 対角線の両側の3マスずつの組で引く.
+//
+// 差分更新 : この組の1つ1つ（部品）は各マスの桁に 3^k を掛けて足した値なので, 置いたマスと返したマスの
+//            分だけ足し引きすれば更新できる. 探索では部品を赤・緑それぞれを手番側とみた2通り持ち,
+//            深さごとに親の部品を写して更新する（struct PatternState）. 評価するときは部品から
+//            重み表の位置を求めて足すだけなので, 8通りの対称形を作り直さなくてよい.
+//            RAMは探索の深さごとに 2 x PATTERN_NUM_PARTS バイトと, マスごとの更新表（約0.5KB）.
+
+#ifndef PATTERN_H
+#define PATTERN_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+// 進行度の段階数. 空きマス数で分ける.
+#define PATTERN_PHASES 4
+
+// 重みの単位. 重み PATTERN_SCALE が1石.
+#define PATTERN_SCALE 16
+
+// 1局面あたりの特徴の数
+#define PATTERN_NUM_FEATURES 34
+
+// 形の種類の数
+#define PATTERN_NUM_SHAPES 8
+
+// 1局面あたりの部品の数. 辺・斜め8マス・斜め6, 4マスは2つ, 斜め7, 5マスと隅の3x3は3つ, 隅の2x4は2つ（1行ずつ）.
+#define PATTERN_NUM_PARTS (4 * 2 + 4 * 3 + 8 * 2 + 2 * 2 + 4 * (3 + 2 + 3 + 2))
+
+// 形ごとの重み表の大きさ. 左右対称な形は折り返しで重なる並びを1つにまとめた数.
+// 線の前半 n 桁の並びの組は 3^n x (3^n + 1) / 2 通り.
+#define PATTERN_SIZE_EDGE 3321  // 辺 8マス  (81 x 82 / 2)
+#define PATTERN_SIZE_C33  10206 // 隅の3x3 9マス  (対角線 27 x 27 x 28 / 2)
+#define PATTERN_SIZE_C24  6561  // 隅の2x4 8マス  (3^8)
+#define PATTERN_SIZE_D8   3321  // 斜め8マス  (81 x 82 / 2)
+#define PATTERN_SIZE_D7   1134  // 斜め7マス  (中央 3 x 27 x 28 / 2)
+#define PATTERN_SIZE_D6   378   // 斜め6マス  (27 x 28 / 2)
+#define PATTERN_SIZE_D5   135   // 斜め5マス  (中央 3 x 9 x 10 / 2)
+#define PATTERN_SIZE_D4   45    // 斜め4マス  (9 x 10 / 2)
+
+// 重み表の中での各形の先頭位置
+#define PATTERN_OFS_EDGE 0
+#define PATTERN_OFS_C33  (PATTERN_OFS_EDGE + PATTERN_SIZE_EDGE)
+#define PATTERN_OFS_C24  (PATTERN_OFS_C33  + PATTERN_SIZE_C33)
+#define PATTERN_OFS_D8   (PATTERN_OFS_C24  + PATTERN_SIZE_C24)
+#define PATTERN_OFS_D7   (PATTERN_OFS_D8   + PATTERN_SIZE_D8)
+#define PATTERN_OFS_D6   (PATTERN_OFS_D7   + PATTERN_SIZE_D7)
+#define PATTERN_OFS_D5   (PATTERN_OFS_D6   + PATTERN_SIZE_D6)
+#define PATTERN_OFS_D4   (PATTERN_OFS_D5   + PATTERN_SIZE_D5)
+#define PATTERN_SIZE     (PATTERN_OFS_D4   + PATTERN_SIZE_D4) // 1段階あたりの重みの数
+
+// 重みの倍率の上限. 重みは最大 127 << PATTERN_MAX_SHIFT.
+#define PATTERN_MAX_SHIFT 3
+
+// 形ごとの重み表の先頭位置. pattern_shape_ofs[PATTERN_NUM_SHAPES] は PATTERN_SIZE.
+// pattern_features は形の順（辺, 隅の3x3, 隅の2x4, 斜め8〜4マス）に特徴を並べる.
+extern const uint32_t pattern_shape_ofs[PATTERN_NUM_SHAPES + 1];
+
+// 学習済みの重み（pattern_weights.c, tools/patgen.c が生成）
+extern const int8_t  pattern_weights[PATTERN_PHASES][PATTERN_SIZE];     // 形の重み. 2^pattern_shift 倍して使う.
+extern const uint8_t pattern_shift[PATTERN_PHASES][PATTERN_NUM_SHAPES]; // 形ごとの重みの倍率（左シフト量）
+extern const int16_t pattern_mobility[PATTERN_PHASES];                 // 着手可能数の差1つあたりの重み
+extern const int16_t pattern_bias[PATTERN_PHASES];                     // 手番の有利さ
+
+// 空きマス数から進行度の段階を求める
+int pattern_phase(int empties);
+
+// 手番側p, 相手側oの特徴を求める. idx には重み表の中の位置が入る.
+void pattern_features(uint64_t p, uint64_t o, uint32_t idx[PATTERN_NUM_FEATURES]);
+
+// 手番側p, 相手側oの形の重みの合計（着手可能数の項は含まない）
+int pattern_eval(uint64_t p, uint64_t o, int phase);
+
+// 差分更新の状態. 部品を赤・緑それぞれを手番側とみて持つ.
+struct PatternState{
+    uint8_t part[2][PATTERN_NUM_PARTS]; // [手番側の色][部品]
+};
+
+// 盤面から差分更新の状態を作る. 探索のルートで1回だけ使う.
+void pattern_state_init(struct PatternState *ps, const struct Board *brd);
+
+// sc が sq に置いて flips を返した局面の状態に更新する
+void pattern_state_move(struct PatternState *ps, enum stone_color sc, int sq, uint64_t flips);
+
+// 状態から sc 側の形の重みの合計を求める. pattern_eval と同じ値.
+int pattern_state_eval(const struct PatternState *ps, enum stone_color sc, int phase);
+
+#endif /* PATTERN_H */
@@ -0,0 +1,5063 @@
+// pattern_weights.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// パターン評価の学習済みの重み. tools/patgen.c が生成する. 手で編集しない.
+// 自己対戦 40000 局（探索深さ 2）, 学習局面 2076130（対称形込みで x8）, 検証誤差 18.82 石
+
+#include <stdint.h>
+#include "pattern.h"
+
+const int16_t pattern_mobility[PATTERN_PHASES] =
+{
+    8, 8, 7, 11
+};
+
+const int16_t pattern_bias[PATTERN_PHASES] =
+{
+    0, 0, 0, 1
+};
+
+const uint8_t pattern_shift[PATTERN_PHASES][PATTERN_NUM_SHAPES] =
+{
+    {2, 2, 2, 2, 2, 2, 1, 1},
+    {2, 3, 2, 2, 2, 2, 0, 0},
+    {2, 2, 2, 1, 1, 1, 0, 0},
+    {1, 2, 1, 1, 2, 1, 0, 0}
+};
+
+const int8_t pattern_weights[PATTERN_PHASES][PATTERN_SIZE] =
+{
+    {
+        0,8,0,-8,-8,0,-10,-15,31,60,17,0,0,0,0,-18,86,0,0,0,
+        0,10,-30,-5,-1,0,-29,-55,17,0,-101,44,0,0,0,0,-20,0,0,6,
+        0,0,0,0,0,-2,28,1,-11,0,-24,22,-47,4,-3,7,0,0,0,0,
+        0,0,0,0,0,0,-19,0,0,15,0,0,0,0,0,2,0,0,-18,0,
+        0,0,0,0,0,0,0,0,0,0,0,15,0,0,16,0,0,0,0,0,
+        32,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        20,-5,0,1,0,0,0,0,0,53,0,0,0,0,0,0,14,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-23,0,44,0,0,0,0,
+        0,0,-33,0,0,0,0,0,0,0,0,1,-1,-30,-17,-2,46,14,10,0,
+        3,-13,0,0,36,0,19,0,0,-1,18,0,0,0,0,0,-10,0,0,0,
+        0,0,0,0,0,0,0,0,-12,0,-6,0,0,0,0,0,0,0,0,-15,
+        0,0,0,0,0,0,0,0,0,0,0,-2,0,-8,0,0,0,0,0,0,
+        -12,0,0,0,0,0,0,0,0,11,0,0,0,17,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-20,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        14,0,0,0,0,0,-63,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-16,0,15,0,0,0,-7,0,0,
+        0,0,0,0,0,0,1,0,0,-12,0,0,0,0,0,0,0,0,-3,20,
+        -34,7,-1,-21,11,29,-62,-26,-69,0,-35,27,0,21,0,0,-7,3,-24,6,
+        0,0,20,0,-19,9,11,0,0,0,0,0,0,0,0,-32,0,0,0,0,
+        0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-22,0,0,0,0,0,0,0,0,-42,0,0,0,0,0,
+        0,0,0,-5,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,14,0,-51,0,0,0,49,0,0,10,0,0,0,0,0,0,0,0,2,
+        0,0,0,0,0,0,0,27,-10,0,0,0,0,0,0,25,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-51,0,0,0,0,0,0,0,0,16,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-8,-68,-8,13,0,0,0,0,0,-8,0,0,0,0,
+        0,-28,0,0,-9,0,0,0,0,0,31,0,0,6,-17,-3,-24,0,-66,10,
+        13,0,5,-30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,
+        0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-25,0,0,0,0,0,-38,0,0,10,0,0,
+        0,1,-28,-48,0,46,59,0,0,-25,0,0,0,-23,0,23,0,0,1,0,
+        0,37,0,0,74,0,0,25,0,0,-30,0,0,0,0,0,0,0,0,18,
+        23,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,52,0,
+        0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,11,0,0,0,
+        0,-42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,-57,0,0,
+        0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,40,
+        0,0,-20,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-39,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-24,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,11,-50,37,0,
+        0,16,-4,0,-24,0,0,0,-15,0,31,0,0,-22,0,0,30,0,0,0,
+        31,0,13,-12,0,-13,0,0,0,0,0,9,67,0,17,0,0,51,0,0,
+        0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-9,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,
+        0,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,-27,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-34,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,67,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-41,0,0,0,0,0,0,0,0,
+        -20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,3,25,-6,-11,38,-3,-7,26,-4,10,31,-8,-23,27,0,
+        -10,0,0,23,28,65,-36,0,0,37,0,14,5,31,-7,-50,0,0,-12,34,
+        0,29,0,-26,20,-16,0,0,0,0,-6,0,6,0,0,0,0,0,0,-9,
+        -1,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,58,0,0,38,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-10,0,0,-32,
+        0,0,-70,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,
+        0,0,0,-28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-25,0,0,-17,57,0,-34,0,0,0,
+        0,0,-11,0,0,0,-17,0,0,0,0,-17,0,7,0,0,0,0,0,0,
+        31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-36,0,
+        0,0,0,0,0,0,0,8,0,0,0,41,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,28,
+        0,0,-6,0,0,0,0,0,52,0,0,0,0,0,0,0,0,48,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-27,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,
+        21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,29,10,-23,
+        0,-14,-24,0,0,52,0,0,0,0,-27,0,0,0,18,0,34,0,0,0,
+        0,0,-14,-4,0,0,-41,0,0,31,0,0,-3,0,0,-55,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,19,0,18,0,0,0,-7,0,0,0,
+        26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-28,0,0,0,0,0,
+        0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,
+        0,0,0,0,0,0,0,0,0,0,0,2,0,0,43,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,41,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,11,3,-5,0,0,0,-13,0,0,7,0,0,
+        0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,-7,0,0,-31,0,
+        0,0,0,0,6,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-8,3,-4,0,0,-35,30,47,0,13,-6,0,0,0,0,0,0,0,
+        -17,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,52,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,-27,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,-72,0,
+        0,0,0,0,0,0,0,0,0,0,5,0,0,-53,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-65,0,0,0,0,0,0,
+        0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-17,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,30,-7,-60,0,0,4,0,0,12,0,0,-57,0,0,0,0,0,36,
+        0,0,-51,0,0,0,0,4,58,0,0,0,0,0,0,0,0,-8,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-25,0,8,0,0,
+        0,33,0,0,44,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,-28,
+        26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,
+        -27,0,0,0,0,0,0,0,0,-51,0,0,0,0,0,0,0,0,-45,0,
+        0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-33,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,1,0,0,-8,3,0,0,0,0,0,0,0,0,
+        0,0,-1,0,0,0,0,0,17,0,0,0,0,0,0,0,0,-2,0,0,
+        0,0,0,0,0,0,-4,0,0,-5,-53,0,-14,0,-20,-9,-12,0,0,19,
+        0,0,58,0,0,-17,-27,0,0,0,0,0,0,0,0,0,-3,53,-22,0,
+        0,0,0,0,0,0,0,0,37,0,0,0,5,0,0,0,0,0,0,0,
+        0,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-3,0,0,0,44,0,0,0,0,-4,-40,0,0,0,0,0,-29,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,
+        0,0,0,-46,0,0,0,0,0,0,0,0,4,0,0,34,0,0,8,0,
+        34,1,2,0,39,-13,0,-20,0,0,9,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-3,27,11,0,0,-19,0,0,-18,0,0,
+        -2,5,0,-1,0,0,27,0,0,22,-62,14,-5,0,0,0,0,0,0,0,
+        0,-3,-23,0,0,0,0,0,0,0,10,0,-2,0,8,0,0,0,0,0,
+        0,0,0,39,0,0,0,0,0,0,0,0,43,0,0,0,0,16,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,
+        0,2,0,0,0,0,0,0,0,0,-40,30,0,0,0,0,-65,0,0,-15,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,
+        0,38,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,-33,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,57,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -20,21,0,0,0,0,0,0,0,-22,0,-39,0,0,0,0,0,0,0,-7,
+        0,-28,0,0,0,0,0,0,0,0,-32,35,0,-28,0,0,0,0,0,0,
+        0,0,94,0,0,0,-43,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-21,0,0,0,0,
+        0,0,0,0,-74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-47,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-18,7,10,0,0,
+        0,0,-45,0,33,0,0,0,0,0,0,0,0,0,65,0,-40,0,0,0,
+        0,0,0,5,0,14,56,0,-70,0,0,0,0,0,-52,17,0,0,0,0,
+        0,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,64,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-33,-4,0,0,0,0,0,64,0,0,29,0,0,0,0,0,0,
+        0,0,0,0,-84,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        -3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-39,0,
+        0,0,0,0,0,-75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        21,0,-24,0,0,0,0,0,0,-2,44,-18,0,-59,41,0,0,0,19,9,
+        0,0,0,0,0,17,0,0,-18,0,42,0,0,0,0,0,0,22,0,0,
+        0,30,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,-12,-32,0,
+        22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,
+        0,0,85,0,0,0,0,23,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-103,0,0,0,0,0,0,-35,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        13,0,0,0,0,0,-37,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-23,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-1,0,0,0,0,0,-5,0,0,0,20,0,0,0,0,0,0,
+        0,0,0,0,2,0,0,20,0,0,-11,0,0,0,0,0,0,0,0,-10,
+        0,0,0,0,0,0,0,0,-4,0,0,-12,0,0,-17,0,-5,-10,-3,0,
+        0,8,0,0,-65,0,0,-4,-31,0,0,0,0,0,0,0,0,0,-6,0,
+        0,-3,0,0,-2,0,0,-13,0,1,2,-42,-20,-9,11,0,0,0,0,0,
+        -20,0,0,-4,0,0,42,0,7,0,0,0,0,0,-56,0,0,24,0,0,
+        0,0,0,-6,0,0,-63,0,0,-31,0,0,9,41,0,23,0,0,0,-52,
+        0,0,0,0,0,0,0,0,0,-28,0,0,0,0,0,0,1,0,0,-69,
+        0,0,0,0,0,14,0,0,-10,-17,0,0,0,0,4,0,0,2,0,0,
+        9,0,0,-1,-4,0,0,-10,0,-4,5,16,13,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-27,0,12,0,0,55,0,0,0,
+        0,0,22,51,0,30,0,0,0,0,0,39,0,-3,5,0,0,0,0,0,
+        0,0,0,-10,0,0,9,0,0,0,0,0,22,71,62,63,-29,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-28,0,0,0,0,23,
+        0,0,-34,0,0,29,0,0,66,0,0,37,0,0,0,0,0,7,0,28,
+        -78,0,0,-2,0,0,8,0,0,23,0,0,-6,34,0,16,38,0,5,0,
+        -11,-20,60,32,22,0,30,14,-24,0,0,0,0,0,0,0,0,62,0,0,
+        0,0,0,0,0,0,-19,0,0,0,0,0,0,0,1,0,0,-63,0,0,
+        0,0,0,15,-31,0,-14,0,0,0,0,0,12,0,-9,16,0,0,33,28,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,
+        0,-42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,
+        29,0,0,25,0,0,0,0,0,0,0,0,14,0,30,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,
+        0,-10,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,0,0,0,-30,
+        -8,0,-24,0,0,0,0,-9,-45,0,3,0,0,0,0,0,0,-17,0,0,
+        0,0,0,19,0,0,68,0,0,0,0,0,0,0,0,0,0,0,-15,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+        0,0,-19,-30,0,-29,-38,0,-16,0,0,-20,-15,-11,0,0,0,0,0,0,
+        0,-8,0,-38,-44,0,0,0,0,0,0,0,0,0,0,-22,-21,0,-42,0,
+        52,0,0,-61,-27,-30,0,-53,30,0,0,0,0,0,0,0,0,-19,0,0,
+        0,0,20,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,-31,-18,0,
+        0,0,0,-18,0,0,-22,0,0,-2,0,0,0,-19,0,0,0,0,0,0,
+        0,0,-70,0,0,0,0,0,0,0,-23,0,0,0,0,0,0,0,0,-11,
+        0,0,0,0,0,0,0,0,-16,0,0,-40,0,0,61,0,0,-24,-4,0,
+        -31,30,0,3,0,0,-18,0,0,0,0,0,0,0,0,0,-37,0,-74,-12,
+        0,0,0,0,0,-47,0,-17,-30,0,0,0,0,0,0,0,-32,-56,0,0,
+        0,0,0,0,0,-2,0,0,-20,0,0,-31,0,-6,0,0,82,-18,0,0,
+        -2,0,0,0,0,0,-60,0,0,0,-34,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,-1,-29,0,
+        -19,0,0,34,0,0,-6,0,0,-8,0,0,0,0,0,-1,0,0,0,0,
+        0,-7,-58,0,0,0,0,0,0,0,0,-12,0,20,0,0,0,0,0,0,
+        13,0,0,0,0,0,0,0,-40,-6,0,0,0,0,0,0,0,-50,0,0,
+        -24,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,5,0,0,0,0,
+        0,-7,0,0,0,-35,0,0,0,0,0,0,0,0,0,0,34,0,0,0,
+        0,0,31,0,0,0,0,0,0,0,0,-35,0,0,0,0,0,0,0,0,
+        3,0,-35,38,0,0,-13,0,-39,11,17,0,13,0,0,0,0,0,0,-31,
+        0,0,0,0,0,0,0,0,0,0,0,10,0,1,0,-30,0,-33,0,0,
+        0,0,0,0,63,0,35,0,3,0,0,0,22,0,0,16,0,0,-9,0,
+        0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,-101,0,0,0,0,
+        0,0,0,0,27,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+        38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,
+        0,0,0,0,0,0,16,0,12,25,25,0,69,0,-6,16,-33,54,0,3,
+        0,0,0,-11,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,4,0,18,0,0,0,-12,0,0,31,0,0,51,-15,0,
+        0,0,0,12,0,0,-13,0,20,0,-1,0,0,0,43,13,0,0,0,0,
+        0,0,0,0,0,0,0,0,1,0,0,47,0,0,0,0,0,-6,0,0,
+        0,0,0,8,0,0,35,0,0,31,33,47,0,2,0,27,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,27,0,38,
+        0,-15,25,0,-1,0,0,0,35,0,23,0,0,-35,0,38,0,0,0,10,
+        19,0,26,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,22,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,
+        0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-39,
+        0,0,0,0,0,0,-48,0,0,0,0,0,0,0,0,0,0,40,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-33,0,9,0,0,0,0,-34,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-59,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-50,0,0,-2,0,0,0,0,0,0,-50,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-14,0,0,0,0,11,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-41,0,0,0,-24,0,0,0,0,0,0,0,0,
+        0,0,-43,0,0,0,0,0,0,0,0,12,0,0,0,0,0,-2,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,-1,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,6,
+        0,0,-55,0,-13,11,40,0,28,0,0,0,0,0,0,-25,0,0,0,0,
+        0,0,0,0,0,0,25,17,0,9,0,-15,0,0,0,-23,0,44,2,0,
+        18,-47,-8,0,0,0,0,0,0,0,0,-11,0,-34,0,0,0,0,4,0,
+        0,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,17,0,0,
+        24,0,0,-29,0,0,-15,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,52,0,-12,0,0,0,0,0,0,22,0,0,0,0,0,0,
+        0,0,17,0,24,29,0,40,16,0,17,17,18,35,30,15,6,0,0,0,
+        34,49,0,11,0,0,0,0,0,0,0,0,-75,0,0,0,0,0,0,0,
+        0,3,0,14,33,0,0,0,0,0,25,31,23,-6,-11,0,23,0,0,32,
+        0,64,-18,0,68,0,0,-45,0,0,33,34,0,0,0,0,1,0,0,0,
+        -1,0,42,0,-17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,17,0,0,0,
+        0,0,0,0,0,21,0,0,-13,0,0,-13,0,34,33,0,26,9,15,0,
+        16,-14,-21,32,0,-22,50,0,76,45,0,42,0,0,0,16,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,22,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,
+        7,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,36,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-14,0,9,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,42,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,
+        0,12,0,0,0,0,0,0,0,0,0,0,2,7,0,0,0,46,8,23,
+        0,0,-2,0,0,-24,0,0,0,0,0,42,0,0,0,0,0,0,0,0,
+        0,0,0,0,31,0,0,0,0,0,0,0,0,31,0,0,16,0,0,0,
+        19,0,25,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,40,0,0,0,0,0,0,0,20,0,9,0,-10,0,39,0,0,
+        0,0,0,0,17,0,0,0,0,24,0,0,0,61,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,
+        1,0,0,0,3,36,0,-20,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-20,5,0,0,1,0,38,0,
+        3,3,0,0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,
+        0,0,2,0,0,-15,0,0,-14,0,0,16,0,-8,31,0,0,-57,0,0,
+        0,0,0,0,0,0,0,-25,0,0,0,0,28,0,0,0,0,0,29,0,
+        -47,-6,0,0,0,0,0,-15,-59,0,0,0,0,0,0,32,14,-6,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        41,0,0,0,0,0,-37,0,0,-22,0,0,0,0,0,0,0,0,0,0,
+        0,-33,0,0,-24,0,-12,-19,0,-35,-25,0,0,0,0,43,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-39,11,0,
+        0,0,0,0,0,0,-35,0,0,13,22,0,0,0,0,0,0,0,-33,-20,
+        0,28,0,0,0,0,11,0,0,0,0,0,0,0,0,0,-55,-45,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-51,0,0,-7,0,0,0,0,-28,0,0,0,-17,0,0,0,0,
+        0,0,0,0,0,0,0,25,-19,0,13,0,0,0,0,-9,53,0,0,1,
+        0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,
+        0,6,0,0,0,0,0,-28,0,0,-4,0,0,0,0,0,-20,-39,0,-5,
+        0,0,0,0,0,1,0,0,0,0,0,-2,0,0,10,4,0,0,0,0,
+        0,0,0,0,0,0,4,0,0,-11,0,0,-19,0,0,0,0,0,0,0,
+        0,-19,0,0,0,0,0,0,0,0,-3,0,0,-18,0,0,-2,0,0,-14,
+        -12,0,0,-10,0,0,-57,0,0,-33,9,0,0,0,0,0,0,0,0,0,
+        56,0,0,-1,0,0,-26,0,0,-12,0,0,23,-21,0,0,0,0,0,0,
+        0,0,62,0,0,-20,8,0,14,0,29,0,0,0,0,0,0,0,0,0,
+        8,0,0,0,0,2,0,0,0,0,0,0,0,0,-16,-18,-61,0,-56,0,
+        -61,2,0,0,0,0,0,0,0,0,-4,0,0,0,0,0,62,0,30,0,
+        0,0,0,0,0,0,0,42,0,0,0,-17,0,0,0,0,4,0,0,-1,
+        43,0,14,0,19,1,-21,0,6,-13,4,-25,-32,8,7,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,5,0,0,47,0,
+        0,3,0,0,7,-41,0,-17,28,20,0,0,0,6,0,14,-5,0,0,0,
+        0,0,18,0,0,8,0,0,12,0,0,0,0,0,-1,0,-76,56,1,0,
+        0,0,0,0,78,0,0,-24,0,0,-1,0,0,0,0,0,-13,0,0,0,
+        0,49,0,0,0,0,0,0,0,0,-1,0,0,0,-28,0,0,0,0,8,
+        0,0,0,0,0,1,0,0,27,0,0,1,0,0,-2,-33,19,-8,16,32,
+        21,29,-47,-3,1,5,-27,-12,-43,18,-5,0,0,-21,0,0,19,0,0,-10,
+        -1,0,-17,0,0,0,0,0,-24,0,0,0,0,0,16,0,-9,0,0,18,
+        0,0,0,0,0,5,0,0,-21,0,0,0,0,0,-6,0,0,-51,17,0,
+        -85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,
+        0,0,0,57,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,
+        0,0,0,0,0,32,0,0,28,0,0,0,0,0,7,0,-50,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,
+        0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-18,0,0,-17,0,0,
+        0,0,0,-3,-39,0,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-38,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,49,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,10,0,-1,0,0,0,0,0,0,-10,
+        0,0,0,0,0,-33,0,0,4,0,0,0,0,0,0,0,0,0,0,0,
+        -1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-19,-24,0,-26,-22,0,-25,-35,0,-30,5,-17,0,0,0,0,
+        0,0,0,-35,0,-30,-34,0,0,0,0,0,0,0,0,0,0,-25,-25,0,
+        -25,0,24,-54,0,-31,-33,0,0,0,13,-26,0,0,0,0,0,0,0,-6,
+        -21,0,0,0,-24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,
+        -50,0,0,0,0,0,13,0,2,-22,0,0,0,0,0,-3,0,0,0,0,
+        0,0,0,0,-27,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-15,0,0,0,0,0,-9,0,0,-20,
+        -36,0,-29,-44,0,-30,-17,0,-10,0,0,0,0,0,0,0,0,0,-32,-26,
+        66,-41,0,0,0,0,0,-2,0,-31,-37,0,0,0,0,0,0,0,-38,0,
+        0,0,0,0,0,0,0,19,15,0,-15,0,0,-7,0,0,0,0,0,-53,
+        -25,0,-19,0,0,0,0,0,-14,0,0,0,-44,-4,0,0,0,0,0,0,
+        0,0,0,0,-61,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-8,
+        7,0,0,-59,0,0,0,0,-30,-4,0,-57,0,0,-2,0,0,-7,-13,0,
+        0,0,0,46,-38,12,0,0,0,0,0,0,0,-15,0,0,29,0,0,0,
+        0,0,-45,0,0,0,0,0,0,0,-1,-14,0,0,0,0,0,0,0,8,
+        0,0,0,0,0,0,0,0,-10,70,0,0,0,0,0,0,0,-5,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-9,0,0,14,0,0,15,0,0,-8,21,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,21,0,19,
+        0,-42,0,0,0,0,0,0,-28,0,0,0,0,0,0,0,0,-12,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-13,0,0,0,0,71,0,46,0,13,0,0,6,0,10,0,0,0,12,
+        0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,15,0,6,-17,-3,0,51,0,-1,21,35,3,
+        -40,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,34,0,
+        0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,10,0,-3,
+        19,0,0,0,0,13,0,0,9,0,54,0,-40,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,3,0,5,0,-33,0,0,0,0,0,0,0,0,-19,
+        32,0,-38,0,0,0,0,0,24,0,11,0,0,0,0,0,0,0,0,0,
+        0,0,-36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,27,
+        -18,25,0,1,0,0,12,-17,41,8,17,0,-43,24,0,1,0,0,0,45,
+        0,46,-48,0,54,-27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        10,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,
+        26,0,0,0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,3,0,0,0,0,0,-27,-19,0,0,-19,0,0,0,0,0,0,0,-49,
+        -1,0,-50,0,0,0,0,0,0,0,0,0,0,0,-13,0,25,0,0,0,
+        0,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,
+        0,0,22,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-25,-34,0,0,0,0,0,0,0,-43,-31,0,
+        0,-10,-43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-26,0,0,0,0,0,
+        -35,0,0,0,0,0,11,0,0,0,0,0,0,-17,0,0,0,0,-12,0,
+        0,0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,-24,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,
+        0,0,0,-35,-10,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-15,0,0,
+        0,0,0,0,0,0,0,-33,0,0,0,0,0,-26,0,11,-23,-19,0,0,
+        -5,0,0,0,0,-8,0,0,0,0,0,0,0,17,0,0,0,0,0,12,
+        0,0,0,-16,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,
+        -28,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,16,0,
+        0,-8,0,0,37,0,0,15,15,0,26,0,0,0,0,0,0,-27,0,0,
+        0,0,0,0,0,0,0,0,42,0,0,1,0,27,-29,0,0,12,0,0,
+        2,0,53,50,35,0,0,0,0,0,0,0,0,7,0,0,0,0,48,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,39,
+        -53,0,38,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,52,0,
+        0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,19,0,27,10,0,0,26,0,31,23,38,43,9,41,12,78,
+        0,0,25,33,0,67,0,0,0,0,0,0,51,0,68,0,0,-24,0,0,
+        0,0,0,12,0,24,0,0,0,0,0,0,41,49,0,-4,0,0,0,0,
+        0,17,0,0,25,0,29,15,0,0,0,0,0,16,0,0,2,0,0,0,
+        0,0,-10,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,12,0,0,44,0,13,0,0,0,0,0,0,0,0,-32,0,
+        0,0,0,0,0,0,0,72,0,0,0,0,0,22,0,23,37,-8,0,37,
+        54,0,25,0,14,13,0,29,36,0,0,26,0,23,-3,0,0,61,23,0,
+        31,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,35,0,58,0,
+        0,0,7,0,-44,0,17,0,0,0,0,0,0,-29,0,0,0,-55,0,0,
+        0,0,20,0,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-3,0,0,-34,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+        0,0,-6,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,16,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,48,0,-20,-36,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,
+        0,23,0,0,59,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,46,0,0,0,0,21,0,0,0,-20,0,0,-50,0,0,0,
+        0,0,43,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,44,0,-16,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        31,-6,0,0,0,0,10,0,0,-5,0,0,0,0,0,-43,0,0,-36,0,
+        0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,42,0,0,0,0,0,0,0,0,-12,-12,0,-47,-8,0,
+        -25,0,-18,-39,-5,-37,0,0,0,0,0,0,0,-31,0,-31,0,0,0,0,
+        0,0,0,0,0,0,0,-10,-21,0,-25,0,-29,-21,0,-41,-22,-16,0,-33,
+        0,0,0,0,0,0,0,0,0,16,-9,0,0,0,3,-35,0,0,0,0,
+        0,0,-27,0,-35,0,0,0,0,-1,-38,0,0,-47,0,15,0,1,-2,-25,
+        0,0,0,0,0,-56,5,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,3,-7,0,0,0,0,-50,0,0,-55,0,0,0,0,0,0,0,0,
+        -2,-1,0,9,21,0,-20,0,-2,-18,6,-29,-3,-48,-12,-23,0,11,-9,0,
+        0,0,0,0,0,0,0,0,-36,0,-36,-32,0,0,0,0,0,-34,0,-16,
+        -15,0,-57,0,0,0,0,-25,-18,-51,0,25,0,-5,0,0,0,11,-5,0,
+        27,0,0,8,0,0,0,0,0,0,0,0,2,0,-22,0,0,-15,-33,0,
+        0,0,-39,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,
+        -18,0,0,0,0,7,-7,0,0,0,0,0,0,-31,0,0,0,-19,0,0,
+        0,0,0,-61,0,0,-16,0,0,3,5,0,17,-57,0,0,0,11,22,3,
+        0,-22,-44,34,0,0,-31,-58,-32,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-27,0,0,-36,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+        -22,-7,0,-12,0,0,0,0,2,1,0,0,-42,0,0,-39,0,-40,-27,-42,
+        -33,0,0,0,-18,-5,-7,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,
+        0,0,0,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,
+        0,0,0,0,0,-3,0,0,-8,14,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,7,0,-14,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,45,0,-41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-17,4,0,-23,0,-22,0,6,0,-30,
+        0,5,0,20,0,34,0,0,0,13,0,13,0,0,0,0,-56,12,0,0,
+        -47,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-11,-45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-42,52,0,0,0,0,-6,22,0,-18,0,0,-36,0,12,0,25,0,
+        0,0,0,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-12,14,0,-29,0,-20,0,14,
+        0,48,0,3,0,42,0,0,0,0,0,0,0,0,0,-24,0,0,-17,56,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,-4,0,0,-7,22,
+        25,0,0,0,-12,0,41,0,-45,0,-29,38,-8,0,7,0,0,0,16,-14,
+        8,0,50,0,0,0,0,0,0,44,0,-38,-8,0,-37,0,0,0,0,0,
+        0,0,0,0,0,0,0,-4,0,10,0,0,0,33,0,0,0,0,0,0,
+        0,0,0,0,0,65,0,0,0,0,0,33,0,-19,12,-6,-19,0,0,-24,
+        33,43,0,0,0,0,0,0,0,23,34,0,0,0,0,0,0,0,0,0,
+        -27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-60,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,-6,0,0,
+        -22,43,-13,0,0,0,-18,0,0,0,0,0,0,-37,0,-37,0,0,0,0,
+        0,-30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-29,-4,0,0,-11,
+        0,0,0,0,0,1,0,0,0,15,0,29,0,0,0,0,0,18,0,0,
+        0,0,-10,8,0,0,-15,0,0,-7,0,0,-8,0,0,15,7,0,-49,0,
+        0,-20,0,0,0,0,0,0,0,0,-1,0,0,-23,0,0,0,0,0,45,
+        0,0,0,0,0,0,0,0,-25,0,0,0,0,0,-4,0,-24,-12,27,0,
+        -49,0,0,0,0,0,-17,0,0,0,2,0,8,0,0,0,0,0,0,0,
+        0,0,0,-19,2,-26,0,0,0,0,0,0,0,0,0,0,8,0,0,0,
+        0,0,-36,0,0,0,0,0,0,0,0,0,0,0,-25,0,0,0,0,0,
+        -1,0,0,0,0,0,0,0,0,-9,0,0,0,0,0,-25,0,0,18,0,
+        -23,13,0,-39,0,0,0,-9,0,5,0,0,0,20,0,0,0,0,0,0,
+        0,0,0,0,1,-27,0,-31,0,0,0,-22,0,0,0,0,0,-37,44,0,
+        0,0,0,-65,0,0,0,0,0,0,0,0,0,0,0,0,0,-8,0,0,
+        0,0,0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,-12,-23,
+        3,0,-13,7,40,0,0,0,-31,-11,7,4,21,0,0,0,0,0,0,0,
+        -27,12,0,0,0,-12,-25,-18,0,-6,0,0,0,0,0,0,0,0,0,7,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-28,14,0,41,54,0,0,
+        0,0,-23,0,0,0,-18,0,0,0,0,-2,23,0,0,0,0,-8,-63,0,
+        -26,12,-54,-29,32,-1,0,10,0,-37,-30,-25,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-34,17,-12,0,0,0,0,0,0,0,0,0,0,-21,
+        0,0,0,0,0,-22,0,0,0,0,0,0,0,0,-5,0,0,0,7,0,
+        0,0,0,20,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,
+        -10,-36,21,-48,-33,13,-20,0,0,0,-17,0,-52,0,3,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-57,-36,0,0,10,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,
+        0,0,0,0,0,43,0,0,0,0,0,0,0,28,0,0,0,0,0,0,
+        0,-43,15,0,-3,12,0,-10,27,42,0,1,0,-9,0,0,1,45,0,-12,
+        0,47,0,20,51,0,0,0,-26,-10,0,-2,0,0,-10,78,0,0,22,0,
+        0,14,0,0,-22,0,0,38,0,0,0,0,0,0,0,0,41,0,0,0,
+        0,42,0,0,0,0,0,0,0,0,0,-11,0,0,-5,0,0,0,0,0,
+        23,0,0,-8,0,-12,0,0,-34,19,15,0,0,-50,-18,0,0,0,0,0,
+        -11,0,0,0,0,0,0,0,0,0,29,-20,12,0,0,0,0,0,0,0,
+        0,0,0,0,-9,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,
+        0,0,0,-7,7,0,-19,44,0,-35,41,0,0,4,0,-30,-55,0,0,4,
+        7,-24,0,0,0,0,0,0,0,0,0,5,0,3,17,0,0,-2,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+        0,0,0,0,0,4,0,0,0,0,0,10,0,0,0,0,0,0,12,0,
+        12,0,0,-1,0,0,-5,0,0,0,0,-15,3,0,0,0,0,0,19,0,
+        0,23,0,0,1,11,0,24,0,0,-18,0,0,0,0,0,0,0,0,-7,
+        0,0,-6,0,0,14,0,0,31,0,0,0,0,0,0,0,0,8,0,0,
+        18,0,0,-6,0,-6,-14,20,0,0,0,0,-10,35,0,0,0,0,0,0,
+        0,-28,0,0,13,-19,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,
+        -23,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,
+        20,15,0,27,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,34,0,0,13,0,-30,0,0,0,57,0,3,0,0,0,0,
+        -50,0,28,0,0,2,0,9,0,0,0,0,0,-7,0,0,0,0,0,0,
+        -7,0,0,-22,0,0,17,0,0,0,0,0,-27,0,0,0,0,0,0,0,
+        0,-8,0,9,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,4,
+        0,0,28,0,0,-9,0,0,-16,-1,0,-30,0,-46,-22,14,0,2,0,-27,
+        0,25,0,57,0,11,-3,11,0,-48,22,0,0,-4,0,-27,0,0,0,0,
+        0,0,13,0,-35,0,0,-25,0,0,0,0,0,0,-9,0,20,0,0,0,
+        49,0,-8,3,0,-81,0,0,0,0,0,12,0,0,0,31,0,0,0,0,
+        -34,10,0,32,0,0,-20,21,-41,-9,27,0,-43,0,0,-39,26,0,0,0,
+        0,0,32,0,0,27,-10,-4,35,0,0,7,0,91,0,-45,0,0,0,0,
+        0,0,0,0,-12,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-8,-22,0,0,0,0,-36,0,0,0,0,-14,0,33,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,45,13,0,1,0,-8,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,40,48,0,20,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,2,0,0,11,0,0,0,0,0,41,0,0,0,
+        0,0,0,0,-35,49,18,0,0,0,0,0,0,0,4,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,24,0,-3,0,0,-19,13,-56,-7,
+        0,0,0,0,23,0,12,0,-14,29,-2,19,22,0,0,1,14,-29,28,0,
+        -31,0,0,0,-27,0,-55,-24,0,-30,5,0,11,40,0,3,25,0,22,0,
+        0,0,-21,-36,25,28,0,6,0,0,-50,24,0,0,9,0,-26,0,0,0,
+        0,0,0,-59,29,0,0,0,0,-11,0,-22,38,41,-12,0,0,0,16,8,
+        -23,0,0,0,0,0,0,0,0,0,53,45,-6,0,0,0,-55,44,-25,0,
+        0,0,0,0,0,-22,0,0,0,0,0,0,0,0,0,0,0,0,0,-44,
+        0,0,0,0,0,0,12,10,-51,0,0,0,0,0,-5,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,23,29,-18,0,0,-35,30,
+        38,-37,0,0,-16,0,0,0,0,0,-45,35,23,2,34,0,-5,0,1,-39,
+        6,0,0,0,0,0,0,0,-5,1,0,-15,0,0,0,0,0,0,-20,0,
+        0,0,0,0,0,0,0,5,24,-11,0,0,0,0,0,0,29,0,0,0,
+        0,0,0,0,0,0,0,0,0,4,0,26,0,0,-4,0,0,0,0,0,
+        0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-6,0,0,0,0,0,0,0,0,-3,0,0,9,0,0,0,0,0,1,
+        0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,-10,2,0,0,0,
+        0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -35,0,0,0,0,0,0,0,0,-28,5,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-79,0,0,0,0,0,0,0,0,5,0,-12,0,
+        0,0,0,0,0,-9,0,24,0,0,0,0,0,0,13,0,0,0,0,0,
+        0,0,0,1,0,28,0,0,0,0,0,0,-27,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-35,0,31,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-21,12,0,
+        -32,0,-34,0,25,0,-25,-3,-30,-36,9,0,0,0,0,-36,12,0,0,0,
+        0,0,0,-37,-22,4,0,-16,0,-17,0,-22,0,-6,7,-24,-39,-10,0,24,
+        0,0,36,0,0,0,0,0,0,0,0,-14,-6,0,82,0,0,0,0,0,
+        55,0,0,0,0,0,0,0,0,-17,-56,0,0,0,22,1,0,-47,-22,40,
+        0,-21,0,-19,0,0,0,0,-27,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-24,
+        0,-34,-50,0,-45,0,0,0,-70,0,-32,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-86,0,0,89,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        15,0,-8,0,0,-38,17,-42,0,17,0,-14,0,-18,-15,49,-36,0,-5,31,
+        0,0,0,0,0,0,18,13,0,4,0,0,-31,36,2,0,-12,0,-9,0,
+        32,3,0,41,0,21,-9,-2,0,0,0,0,0,-81,10,0,-10,0,0,-35,
+        27,0,0,33,0,24,0,0,0,0,0,0,9,13,3,0,0,0,49,0,
+        -20,21,0,-47,0,0,0,-5,0,0,0,0,0,0,0,0,0,1,0,0,
+        0,0,0,0,0,0,0,0,-16,32,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,6,0,-17,0,0,-20,-25,0,0,33,0,-24,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-41,0,0,0,0,0,11,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-6,0,0,-13,0,0,0,0,0,-1,0,0,-32,-24,0,-8,0,
+        0,-7,0,0,-40,0,0,0,0,-26,-6,0,0,-62,0,0,1,0,0,0,
+        0,0,-9,0,0,0,0,0,-9,0,0,0,0,0,0,0,-27,1,0,0,
+        -41,0,0,0,0,0,10,0,0,0,0,0,-3,0,0,-28,0,0,0,0,
+        0,15,0,2,-28,0,0,-26,0,0,0,0,0,-34,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-20,0,0,0,0,0,0,0,0,-41,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,
+        0,0,0,0,0,9,0,0,7,0,0,0,0,0,12,0,-21,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,19,0,72,0,0,0,-22,0,
+        0,-13,0,0,28,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,26,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-23,17,0,-10,-35,-28,-43,0,0,-26,-59,9,-46,8,
+        0,20,0,-10,-17,1,0,0,0,0,0,0,0,-7,38,0,-37,-5,0,-16,
+        79,0,57,0,0,-20,43,0,0,0,0,-37,0,0,0,0,0,0,0,18,
+        0,35,0,1,0,0,16,0,0,-26,-14,0,-64,14,0,20,0,0,-44,0,
+        0,0,0,0,-20,0,0,-31,-26,0,-36,0,0,-49,0,-18,-1,0,0,0,
+        0,0,0,29,0,-23,0,-45,0,0,0,0,0,-37,-43,0,0,-20,0,0,
+        19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-25,0,31,0,0,0,0,0,0,-55,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-24,-5,-27,0,0,0,0,0,-19,0,0,2,
+        0,19,-7,0,0,-36,0,0,0,0,0,0,0,0,0,-19,0,0,0,0,
+        0,0,0,0,0,0,0,0,-15,-12,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,14,0,-23,20,0,-20,16,0,-49,12,0,
+        -26,-35,-6,0,62,0,19,22,9,-12,0,0,0,0,0,-14,12,0,-15,-4,
+        0,-48,2,0,-8,-9,0,-64,16,0,-48,0,0,0,-15,0,25,0,0,0,
+        0,0,-23,1,0,6,0,0,-18,0,0,0,-14,0,-21,0,0,-11,0,0,
+        0,12,0,21,0,0,0,94,0,0,35,0,-13,0,0,0,0,0,-54,0,
+        0,0,0,0,0,-24,0,-63,-53,0,-47,0,0,0,0,0,0,62,0,-54,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-36,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-19,0,0,0,0,0,0,46,0,-23,0,0,-48,0,0,0,
+        14,1,-27,0,37,22,0,0,-47,0,16,1,0,0,0,0,0,-40,18,0,
+        58,0,0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-52,0,0,0,0,0,0,1,0,0,0,0,0,3,0,
+        0,-1,0,0,0,7,0,15,0,0,-2,0,0,-33,0,0,-23,0,-2,-2,
+        0,0,0,0,0,16,0,0,13,0,0,-10,19,0,57,0,0,2,0,0,
+        -22,0,0,-22,0,-4,4,0,0,36,0,0,-11,0,0,5,0,0,13,0,
+        0,78,0,0,-7,0,0,41,0,0,-12,0,-58,-1,-5,0,0,0,0,-18,
+        0,0,-23,0,0,0,0,0,0,0,0,3,0,0,-1,0,0,0,0,0,
+        -10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,-35,0,0,0,
+        -16,0,-1,-93,0,0,0,0,0,0,0,0,-29,0,0,0,0,0,0,0,
+        0,-1,0,31,0,0,0,-123,0,0,62,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,77,0,0,-62,0,0,0,0,0,-2,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-15,1,0,-9,0,
+        0,-15,25,0,-50,61,0,0,-3,0,-9,-36,0,-9,1,0,-23,0,0,-34,
+        0,0,-3,42,0,0,0,0,-67,43,0,-8,34,0,-44,-36,0,0,47,0,
+        -18,10,0,48,0,0,-21,0,0,-2,43,0,0,0,0,-20,0,0,28,-3,
+        0,0,0,-14,0,0,0,-3,28,0,-70,0,0,-49,-35,0,0,18,0,0,
+        0,0,-4,4,35,-25,0,0,0,0,0,0,0,0,66,22,-10,0,0,0,
+        -14,0,-28,0,0,0,0,0,0,-23,-60,-19,0,-40,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,-76,0,35,0,
+        0,0,0,0,0,0,0,0,0,0,16,0,0,0,-12,0,0,0,25,0,
+        0,0,0,0,18,0,0,22,0,0,0,0,0,2,0,0,39,0,0,0,
+        -15,0,0,0,0,0,0,0,0,0,0,0,-17,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,
+        -7,0,0,-70,14,24,-21,25,0,13,0,0,0,24,0,-39,18,-1,25,33,
+        0,0,-23,-3,49,3,0,-2,0,0,0,28,46,-26,12,0,-4,30,-7,-20,
+        0,40,-39,-1,0,-34,-34,0,0,-30,0,-14,32,0,-10,0,0,-1,45,0,
+        21,-40,0,-31,0,55,0,3,0,0,26,53,-20,0,0,0,-57,0,-36,67,
+        30,0,0,0,0,31,54,19,0,0,0,0,0,0,0,0,0,0,0,-3,
+        0,0,0,0,0,0,-24,0,0,0,0,0,0,9,0,0,0,0,0,0,
+        0,0,0,-7,0,0,0,0,0,0,0,0,0,0,-20,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-33,
+        20,16,-36,-24,37,-39,44,19,0,-8,24,-7,0,20,0,0,0,0,45,24,
+        -31,0,0,0,0,0,0,0,46,9,0,0,0,-12,8,0,0,0,0,0,
+        43,0,0,-10,-7,4,0,8,0,0,0,0,0,0,-8,0,0,0,0,0,
+        0,0,0,44,0,0,0,0,0,0,0,0,12,0,0,0,0,0,17,0,
+        0,4,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,1,
+        0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,-3,0,0,
+        3,0,0,0,0,0,2,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,0,0,0,1,0,0,0,0,0,0,0,0,5,0,0,0,0,0,-3,
+        0,0,-4,-1,0,0,0,0,0,0,0,-21,0,0,0,0,0,0,0,0,
+        4,29,0,0,0,0,0,0,0,-31,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-19,-36,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,
+        0,0,0,11,0,-2,0,0,0,0,0,0,18,0,0,0,0,0,0,0,
+        0,-10,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,55,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,23,
+        0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-14,11,0,-16,0,33,0,39,0,-28,0,-24,27,-10,0,0,
+        0,0,-17,9,0,-35,25,0,0,22,29,-14,-1,0,-22,0,0,0,36,0,
+        -46,4,-24,-45,21,0,0,0,0,-38,54,0,0,0,0,0,0,-47,-13,-2,
+        0,-46,0,0,0,30,0,-27,12,-27,0,61,0,0,0,0,9,4,0,0,
+        0,-27,0,-54,-9,-9,12,0,7,0,0,0,-6,0,0,0,0,0,0,0,
+        0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-31,36,0,-16,0,-34,0,2,0,0,0,0,0,0,
+        0,0,0,0,0,-12,0,0,0,6,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -10,0,-43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,20,0,-10,0,0,-27,31,31,0,19,0,-11,0,
+        0,0,0,0,0,26,12,7,0,0,0,12,0,-19,11,0,1,0,0,-56,
+        -75,0,0,1,0,71,-16,22,-34,0,-17,0,-3,0,31,0,0,0,0,0,
+        0,17,0,-1,0,0,-14,18,3,0,8,0,-18,0,0,0,0,0,0,14,
+        44,-8,0,0,0,21,50,6,27,29,0,0,0,0,33,38,0,0,0,0,
+        0,0,0,0,0,0,61,39,0,0,0,0,0,0,0,84,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,27,0,-11,0,0,10,5,22,0,0,0,
+        0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,-31,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,75,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-50,0,0,0,0,0,0,-2,0,0,-4,0,0,0,0,0,0,
+        0,0,57,14,0,22,0,0,1,0,0,-11,0,0,0,0,-9,1,0,0,
+        -10,0,0,12,0,0,11,0,0,15,72,0,0,0,0,9,0,0,-78,0,
+        0,0,0,0,2,0,0,-17,0,0,0,0,0,6,0,0,58,7,0,32,
+        0,0,-14,0,0,-35,0,0,7,0,-46,-7,52,0,4,2,0,0,0,0,
+        45,28,0,0,0,0,0,0,0,33,0,0,-28,0,0,0,0,-32,-54,0,
+        0,0,0,0,53,0,0,-12,0,0,0,0,0,0,0,0,44,0,0,0,
+        0,0,0,0,0,14,-15,0,49,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-34,0,0,0,0,0,0,0,0,6,0,-5,-17,0,0,0,0,
+        0,10,0,1,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-14,7,0,-12,17,0,0,
+        43,0,-23,-15,-1,0,-30,0,-5,0,0,-26,-42,0,-39,-9,0,0,0,-25,
+        -36,19,0,-10,0,0,0,0,0,-16,0,0,48,45,0,0,0,0,13,47,
+        0,2,0,0,0,-11,-43,-7,3,0,-31,0,-37,15,0,0,1,25,0,18,
+        32,0,11,0,0,-13,-16,0,-45,32,0,-28,72,-2,-20,28,-31,-43,0,-13,
+        20,0,-35,0,0,0,0,0,0,0,0,0,-38,0,-8,0,0,0,0,0,
+        0,-15,0,0,0,0,0,0,34,0,0,0,0,-26,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,11,0,42,48,0,0,0,0,0,4,-9,0,
+        0,0,0,0,0,0,0,0,1,0,0,12,0,0,-48,-45,0,-19,0,0,
+        -49,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,46,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,0,-5,0,
+        0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,15,0,-5,14,
+        0,-18,15,0,0,7,0,-24,27,0,0,0,0,0,39,-3,-13,0,0,0,
+        0,0,5,2,0,-34,15,0,0,16,0,0,-3,0,0,44,0,0,0,0,
+        0,-39,0,26,-75,0,0,0,0,3,8,0,-39,50,0,-19,0,0,0,23,
+        0,5,0,0,0,-33,0,0,8,0,-16,0,0,-56,75,0,26,0,0,-44,
+        0,0,0,0,0,0,0,0,-35,0,0,0,0,16,0,0,0,-11,0,0,
+        5,0,10,0,0,0,0,0,0,0,0,0,0,0,0,-8,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-46,0,0,0,0,0,0,-6,0,
+        0,12,-34,-16,0,0,0,-64,5,-34,0,5,0,0,0,0,23,0,0,0,
+        0,0,0,0,0,-19,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,10,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,-12,0,0,4,
+        0,0,0,0,0,13,0,0,-5,0,0,0,14,0,56,0,0,1,0,0,
+        -8,0,0,29,0,28,-13,0,0,0,0,0,16,0,0,15,0,0,3,17,
+        0,-34,0,0,-5,0,0,6,0,0,24,0,-5,4,0,0,8,0,0,60,
+        0,0,8,0,0,36,17,0,0,0,0,-1,0,0,-8,0,0,1,0,-29,
+        -19,26,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,-9,20,
+        0,0,0,0,0,0,0,-59,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,-28,0,27,0,0,
+        0,-19,0,0,0,0,0,0,0,0,0,0,-23,0,0,0,0,0,-31,0,
+        0,32,0,-21,0,0,0,19,0,0,0,0,0,0,30,0,0,0,0,34,
+        0,0,0,0,0,0,0,0,38,0,0,0,0,0,54,0,0,-69,0,0,
+        0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,5,0,0,0,0,
+        0,0,0,0,-51,0,0,0,0,0,0,0,0,-18,0,0,0,0,0,0,
+        0,1,-14,29,0,-22,45,0,-16,17,0,-11,23,-14,0,7,0,0,0,0,
+        -14,16,0,-67,-27,0,29,-8,0,-6,5,0,0,0,0,0,0,0,-12,-13,
+        0,-79,-23,0,0,0,-35,13,0,0,0,0,0,0,3,0,-10,25,0,-7,
+        2,0,34,0,0,-10,-46,0,0,24,0,0,0,0,2,37,0,-59,0,0,
+        -10,79,-24,-37,22,0,0,0,0,-23,0,0,0,-1,0,0,33,0,0,0,
+        0,-17,37,-4,12,0,0,0,0,-26,0,0,0,0,0,0,0,0,0,0,
+        49,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,-44,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-18,0,0,0,0,
+        0,0,0,11,-10,-3,0,0,34,0,0,0,0,56,43,0,0,0,0,0,
+        0,0,0,17,0,20,54,0,0,0,-19,0,0,0,0,0,0,0,0,0,
+        0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-58,56,
+        -43,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,8,0,0,
+        0,0,0,0,-5,23,0,-13,45,0,-40,8,49,1,16,0,-6,0,0,0,
+        14,0,0,29,3,44,12,10,0,45,31,-9,2,0,-29,-12,0,45,6,0,
+        0,37,0,0,28,-6,-57,0,0,0,26,0,20,-8,0,0,62,30,-20,9,
+        0,-11,-13,0,-39,22,0,1,16,0,0,0,-20,3,0,0,0,1,2,-68,
+        28,0,7,40,24,-44,24,19,-3,0,0,0,30,0,0,44,0,-20,0,0,
+        0,0,0,0,-71,4,-10,0,0,0,0,-1,-18,38,0,0,0,0,0,26,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -37,-21,0,0,0,0,0,0,0,0,0,-45,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,27,16,-5,31,26,0,33,17,0,32,25,0,23,
+        50,0,0,0,0,8,-5,10,40,40,-27,0,0,-7,26,-46,0,7,0,0,
+        0,7,0,17,6,0,0,0,0,0,-8,0,56,0,0,0,0,0,0,0,
+        0,35,-17,-39,-12,0,-36,26,0,0,37,25,0,0,5,0,0,0,0,0,
+        0,0,0,0,-36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-5,0,17,-5,0,0,2,0,0,-8,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-21,0,0,0,
+        0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-20,0,0,3,0,
+        0,5,0,0,-18,-17,0,-18,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,0,0,0,4,0,0,0,-45,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-24,0,0,0,
+        0,0,0,0,0,-33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,
+        0,0,0,0,0,0,0,14,0,0,-11,-16,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-13,0,0,0,0,0,0,0,0,-19,0,0,-20,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-4,0,4,-35,0,0,13,0,-19,-4,
+        15,-51,-10,8,-21,10,49,25,-1,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,
+        0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-24,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,
+        0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-17,0,0,-2,0,0,-3,0,0,
+        -23,0,0,-7,-7,0,-6,0,-44,-8,0,0,28,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        21,0,0,58,0,0,0,0,0,34,0,0,-43,0,0,0,0,0,36,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-34,0,0,0,0,0,0,0,0,-13,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,17,0,0,-14,0,0,0,0,0,17,0,0,2,1,0,0,0,0,17,
+        0,0,12,0,0,21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,
+        0,0,36,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-12,0,0,0,0,0,-46,0,0,-13,0,0,16,91,
+        0,0,0,0,-11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,6,-16,0,0,6,0,-11,2,6,-21,-15,11,-51,16,4,-14,3,5,
+        -12,-12,-7,-15,18,-6,-9,3,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-28,0,0,0,0,0,0,
+        0,0,-27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,
+        -37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-19,0,0,0,0,0,0,0,0,-38,0,0,
+        -30,57,0,0,0,0,-24,0,0,0,0,0,0,0,0,-4,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,16,0,0,0,0,0,0,0,0,23,0,0,-28,9,0,
+        18,0,0,6,0,0,-49,0,0,13,0,13,28,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,-23,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-4,0,31,-15,0,0,15,0,0,
+        -4,46,-25,-21,-6,-7,6,47,36,0,-13,30,-10,18,-9,18,-6,-13,3,22,
+        -12,-10,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,
+        0,0,19,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,12,0,
+        0,0,0,0,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-19,0,0,-15,0,0,-41,0,0,-22,0,0,-11,-15,
+        0,-36,0,0,-17,0,0,-27,0,0,-8,0,-27,-17,0,0,-54,0,0,11,
+        0,0,-18,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,-15,0,0,0,
+        0,0,8,35,0,-16,0,0,0,0,0,27,0,0,-5,0,0,0,0,0,
+        11,0,0,58,0,0,36,0,0,-1,32,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,11,0,0,0,0,0,0,0,0,3,0,0,-26,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,13,0,0,40,0,0,0,0,0,10,
+        0,0,-30,0,0,0,0,0,10,0,0,33,0,0,25,0,0,17,0,0,
+        0,0,0,21,0,0,11,0,0,-24,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,
+        -65,0,0,-12,0,0,0,0,0,-14,0,0,0,0,0,0,0,0,-18,0,
+        0,0,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-4,27,0,-32,24,0,37,0,0,-2,24,-22,-14,10,-31,18,15,
+        10,3,0,10,-12,40,0,20,-1,-5,3,-14,0,-10,0,0,16,0,0,3,
+        -11,-7,-18,9,-29,19,15,-35,6,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,
+        0,0,0,0,0,33,0,0,0,0,0,0,0,0,29,0,0,0,0,0,
+        0,0,0,23,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+        0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,0,0,0,-9,
+        0,0,0,0,0,0,0,0,-38,0,0,0,0,0,0,0,-38,-2,0,0,
+        0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,-39,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-17,0,0,-19,0,0,0,0,0,-18,0,0,-18,-31,0,
+        0,0,0,-14,0,0,0,0,0,36,0,0,-18,0,0,0,0,0,0,0,
+        0,-12,0,0,-8,-26,0,43,0,0,-10,0,0,-45,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,5,0,0,0,0,0,0,0,0,-8,0,0,-30,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,-2,0,0,
+        0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,
+        0,0,0,0,0,0,0,-25,0,0,0,0,0,0,0,0,-36,0,0,0,
+        0,0,0,0,0,-23,0,0,0,0,0,0,0,0,-43,0,0,0,0,0,
+        0,0,0,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,22,
+        0,0,22,0,0,16,0,0,3,-2,0,32,0,32,19,0,0,-10,11,0,
+        14,0,15,19,0,0,9,0,0,21,0,0,10,0,0,4,-14,0,7,0,
+        30,22,0,-3,28,50,0,9,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,21,0,0,0,0,
+        0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,33,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,
+        30,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,-29,0,
+        0,0,0,0,-14,0,0,-26,0,0,0,0,0,-1,0,0,0,0,0,13,
+        0,0,-3,0,0,0,0,0,-34,0,0,-14,0,0,3,0,0,4,0,0,
+        -3,0,-33,-3,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-5,-31,0,-4,0,0,-7,-5,30,19,-31,0,0,
+        -15,0,4,0,0,-18,0,0,1,0,0,12,0,0,1,-6,0,0,0,0,
+        0,0,0,3,0,0,0,0,0,13,0,0,-4,-38,42,-3,0,19,0,-34,
+        23,-4,-8,0,0,19,0,0,-41,0,0,-12,0,11,0,0,34,0,0,-16,
+        0,0,-6,0,0,-6,0,45,-11,0,0,0,0,0,-8,-14,27,-9,-7,0,
+        0,-19,0,0,5,0,0,-15,0,0,14,51,-2,0,0,0,0,0,0,0,
+        0,3,0,0,-15,0,0,-3,0,0,-5,0,0,5,0,0,-6,-24,0,-5,
+        -11,7,1,-12,0,0,46,0,0,-29,0,0,7,0,0,-27,-32,0,0,0,
+        -4,0,0,17,0,0,-18,0,0,-9,0,0,6,-11,0,-14,0,0,-1,-11,
+        48,-4,0,0,-3,32,-35,-2,-7,16,-1,-7,-2,5,0,0,2,-24,0,0,
+        -4,0,0,0,0,0,-13,0,0,-8,-34,0,0,0,0,-22,0,7,0,0,
+        6,0,0,-17,0,0,5,0,0,19,0,0,0,6,0,22,0,0,-6,0,
+        46,14,0,0,5,0,0,-4,-21,0,-4,-18,-19,-7,-71,-5,-1,10,0,-4,
+        -9,0,0,55,0,0,40,0,0,-13,0,0,11,44,0,-9,0,0,8,0,
+        0,-32,0,-3,0,0,0,0,0,0,0,0,-14,0,0,-40,0,0,10,0,
+        0,-3,0,0,0,0,0,-2,0,0,-7,0,0,8,0,0,0,-24,-16,-3,
+        -13,-57,3,0,5,8,0,-18,5,19,18,6,-4,0,0,0,0,0,-24,0,
+        0,-16,0,0,-8,36,0,0,0,0,-13,0,0,33,0,0,17,0,4,0,
+        0,10,0,0,-8,0,0,6,0,34,33,0,0,-9,0,-77,6,0,0,-22,
+        0,0,16,0,-60,4,-1,0,18,0,0,0,-2,0,-1,-8,0,0,-9,0,
+        12,0,0,0,0,0,6,0,2,-6,0,0,-23,5,0,0,0,0,0,8,
+        0,-1,0,0,0,0,0,0,0,0,1,-45,25,0,0,35,4,0,0,-2,
+        -10,0,0,-33,0,0,0,0,0,-26,0,14,0,0,0,0,0,15,0,0,
+        12,0,0,0,0,1,3,0,0,4,0,0,-6,5,26,-7,-4,0,0,11,
+        0,0,-10,0,0,-10,0,0,-19,-4,-1,0,0,22,0,0,0,0,0,3,
+        0,0,6,0,0,6,-49,0,-8,0,0,-3,0,0,-1,0,-5,1,4,4,
+        1,20,0,0,0,0,0,0,0,0,21,0,0,-35,0,0,-23,0,9,0,
+        0,-6,0,0,3,0,0,-21,0,0,-22,0,0,-49,0,0,2,-45,15,-3,
+        -11,38,5,-29,0,0,-17,18,-3,-7,6,3,1,13,3,-9,0,0,22,0,
+        0,-18,0,0,-17,0,0,19,-33,0,5,0,0,-5,0,13,0,0,44,0,
+        0,-8,0,0,17,0,0,-58,0,0,-11,0,0,13,0,0,2,0,0,-7,
+        0,0,-2,0,0,-5,14,0,-5,12,0,-3,0,-2,3,-14,45,-1,-4,0,
+        0,19,0,0,-10,0,0,-7,0,0,-5,89,0,-30,0,0,7,0,0,-5,
+        0,3,0,0,19,0,0,-51,0,0,5,-2,0,0,0,0,0,0,0,-13,
+        0,0,21,0,0,5,-47,0,4,0,0,4,0,0,1,-22,22,-2,-20,-8,
+        3,39,3,6,-10,16,6,4,23,8,1,0,0,41,0,0,1,0,0,9,
+        0,0,0,0,0,48,0,0,4,0,1,-1,0,0,-6,0,8,0,0,-40,
+        0,0,-25,0,0,8,-11,35,-5,0,0,14,0,8,12,0,0,10,0,-4,
+        3,0,-49,0,-5,31,7,0,-26,-3,-33,-20,-11,-5,0,0,0,0,7,0,
+        0,-19,0,0,3,14,34,0,33,32,10,-10,0,-9,-20,0,0,-21,0,1,
+        3,0,-45,0,0,37,0,0,-2,-1,4,-6,-8,3,0,0,-1,-4,7,0,
+        0,-46,0,0,-10,0,0,-7,0,-1,11,0,-24,0,0,12,0,0,-1,47,
+        0,-2,17,11,-14,36,0,6,14,76,-7,-2,-3,-9,1,0,25,-19,0,0,
+        10,0,51,0,0,-17,-15,0,-8,0,44,-46,0,0,-2,0,0,-13,0,0,
+        -19,11,0,0,-22,6,-3,-11,-19,6,0,0,0,14,18,-6,-13,-4,-9,0,
+        0,0,5,0,0,39,0,0,-1,5,0,-1,0,0,46,0,-6,27,0,-9,
+        0,0,23,17,0,7,19,0,-10,-18,0,10,0,65,2,-3,8,-1,6,-4,
+        5,-4,2,0,-4,7,-2,-2,7,1,7,7,2,3,0,-45,-6,0,0,16,
+        0,0,-8,-17,0,-19,0,0,3,0,-9,1,0,-7,0,23,1,-1,0,24,
+        0,0,2,0,0,5,-16,0,0,64,0,3,-46,0,-1,-3,15,-9,6,38,
+        3,9,32,-2,27,-2,-3,-12,56,-1,22,3,-1,-12,-18,5,3,0,-15,-13,
+        0,0,27,0,-23,-9,2,-23,-8,-96,0,4,0,0,-3,0,-18,-17,-65,4,
+        0,0,-51,0,0,-4,0,0,-10,0,0,44,0,0,-22,0,0,-4,0,0,
+        -1,0,0,1,-13,-17,-5,-85,-7,12,0,-6,2,-10,-3,-3,-8,-18,2,-3,
+        10,5,4,-8,4,-1,-14,8,7,0,0,-56,0,0,37,0,0,4,0,0,
+        14,0,62,10,0,0,9,0,0,4,0,-61,-2,0,-1,-38,0,-2,-42,0,
+        12,0,0,1,0,0,2,5,0,13,0,104,3,17,-3,7,-28,0,13,-16,
+        7,0,-2,-118,0,-3,97,-7,3,8,-28,3,0,7,53,0,5,0,0,-28,
+        0,65,7,1,3,-1,15,53,25,-4,18,0,-52,0,0,23,-72,-2,-7,0,
+        -28,0,0,-8,-44,0,-5,-16,0,-9,-5,10,-8,-28,20,-10,0,-51,81,-25,
+        -30,-6,93,82,16,-87,0,2,-3,19,-1,12,21,9,-7,-6,27,18,48,61,
+        12,0,-2,-25,-34,-3,-8,-41,10,0,-76,4,12,-8,14,-19,8,-2,-15,-4,
+        -9,2,19,12,-7,53,6,21,42,2,0,0,6,-8,8,1,5,-28,6,7,
+        -114,-95,-17,85,-73,-16,17,0,-74,3,-6,-7,-29,14,74,-21,0,-4,-9,4,
+        2,-8,-8,3,3,-11,-10,-37,57,6,16,0,29,-27,0,-16,105,7,-2,0,
+        0,1,-20,10,-1,27,-15,17,31,0,2,29,6,-44,18,4,-7,-51,-3,23,
+        -16
+    },
+    {
+        0,7,-4,-7,-4,8,-12,-12,-1,-26,10,14,-12,-15,0,-17,-10,-8,15,0,
+        0,12,-2,17,2,11,10,24,17,11,25,-18,-3,0,-44,0,-10,7,-14,-17,
+        -7,5,4,0,0,-4,3,-14,-21,-9,-18,6,1,-14,1,3,-19,17,-50,0,
+        0,74,0,0,32,0,-17,-18,7,9,-35,0,-39,0,-9,-13,0,0,-9,-5,
+        -11,-26,0,0,-26,0,0,-4,0,-17,-21,11,-26,-5,28,0,0,-8,0,0,
+        -5,37,6,0,0,-19,0,0,0,0,0,0,0,0,-19,0,-5,0,0,-11,
+        22,-16,26,-2,0,0,-11,-30,0,6,19,0,-9,-84,0,0,2,0,0,0,
+        0,0,0,0,0,5,0,0,0,-9,0,0,0,-21,0,58,3,0,0,-37,
+        0,0,-4,0,0,0,0,0,0,0,0,3,13,-7,-5,12,-7,24,27,8,
+        0,9,-22,-11,9,7,28,45,-3,-2,17,0,16,26,0,0,2,0,24,21,
+        0,0,0,0,0,0,0,0,12,0,-3,-7,8,-42,0,-12,41,0,0,-20,
+        0,0,0,0,0,0,0,0,-10,0,0,-6,3,0,0,0,31,-2,0,17,
+        -41,0,1,-35,-9,0,-8,0,-34,-16,0,-61,0,17,-41,-14,35,0,0,6,
+        0,0,-2,0,0,-37,0,0,0,0,0,20,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        10,8,5,28,0,0,27,0,5,14,0,0,0,22,0,7,0,37,4,7,
+        27,37,0,0,23,19,0,-14,0,0,0,0,0,0,-6,0,0,0,0,0,
+        0,0,0,23,0,0,0,0,0,0,6,-12,4,25,17,0,0,-20,0,11,
+        -9,0,0,1,5,0,0,0,0,2,-14,-6,58,0,0,0,0,0,-6,-2,
+        -13,1,7,-22,20,10,-16,-14,-37,-36,-64,-17,51,3,10,-41,-1,9,-7,31,
+        29,-18,5,17,-13,-4,2,-69,0,34,0,0,-37,0,-40,-26,0,0,0,9,
+        0,-22,0,0,18,-7,-51,42,0,0,42,0,-51,-1,0,-7,10,-21,-4,8,
+        -2,23,-14,-16,-16,-9,0,0,0,0,31,0,0,-17,18,0,17,0,0,-2,
+        0,56,-12,38,0,-19,0,-32,2,0,0,-27,0,0,-25,-113,-59,0,0,0,
+        0,0,0,-25,0,0,16,0,0,66,0,57,24,0,0,0,0,0,0,0,
+        0,0,0,0,0,-17,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,
+        0,0,0,2,0,0,0,0,-17,-2,0,0,0,0,0,0,-9,-22,0,0,
+        0,0,0,0,0,0,-17,0,0,0,0,0,0,0,0,-32,0,-52,0,0,
+        0,7,32,13,-8,-109,-2,59,0,0,-8,7,78,45,0,0,0,0,0,1,
+        -16,-2,-34,0,0,16,45,48,10,37,1,0,0,-8,0,21,0,0,-35,0,
+        0,0,0,0,-3,0,0,0,0,0,0,0,0,8,0,0,13,0,0,-9,
+        0,0,17,-4,0,0,0,0,0,0,-15,0,6,-43,-16,0,26,0,0,-38,
+        -12,0,78,9,0,21,0,0,-11,0,0,0,0,0,-24,0,0,-20,-17,-3,
+        0,0,0,0,0,0,-9,-10,-11,10,-14,-14,23,-14,-19,-20,-31,-19,-9,-27,
+        -8,18,2,0,-3,29,-18,25,29,52,19,38,-16,2,10,-15,-44,-7,-23,16,
+        25,-17,5,-7,0,0,47,0,0,-21,0,-12,9,0,0,0,0,0,0,0,
+        0,-1,0,0,0,0,0,40,0,0,-7,21,-38,0,7,0,11,0,0,10,
+        0,-15,0,0,-29,0,0,0,0,0,-21,0,0,0,15,0,24,0,0,-20,
+        0,-53,0,0,0,0,0,0,-9,-19,0,0,2,0,-102,0,0,-20,-2,0,
+        -6,1,-33,4,2,-40,-1,-37,-37,-24,0,-42,41,-20,0,-21,0,-31,-13,-10,
+        -41,21,27,-46,5,18,-19,-1,7,-22,-58,-15,-5,1,43,13,4,-14,-33,13,
+        14,-27,-9,5,0,0,-49,0,0,7,0,8,0,0,7,0,0,0,25,0,
+        -27,22,0,0,34,0,0,23,0,1,16,0,0,21,0,74,12,31,29,24,
+        3,-18,0,0,-66,0,0,-3,0,0,-14,0,0,0,0,0,0,0,0,-1,
+        0,0,0,0,0,0,0,0,-28,-67,8,0,0,0,36,0,0,-25,0,9,
+        -40,21,-8,11,-21,25,-9,0,0,8,0,0,18,0,33,0,0,0,34,0,
+        0,35,0,0,0,0,0,48,0,0,32,-2,9,5,0,0,48,0,27,31,
+        38,12,28,6,0,13,10,0,6,0,0,0,0,0,0,-69,0,0,0,0,
+        0,0,0,0,13,0,0,0,0,0,45,0,0,15,0,0,0,0,0,-11,
+        -29,0,0,-12,0,-53,2,0,0,0,-17,0,38,-18,0,0,0,0,0,-8,
+        0,0,0,0,0,0,0,0,-33,0,0,0,0,0,0,0,0,-11,0,0,
+        0,0,0,0,0,0,-24,0,0,-59,49,0,0,0,0,-2,-5,-18,14,10,
+        -18,8,4,-22,-7,-10,-44,-48,-15,16,8,61,-44,-1,11,-16,-6,19,0,3,
+        60,-16,3,22,-14,-17,35,-55,32,22,-10,6,0,-9,13,27,27,68,0,16,
+        11,15,0,0,84,0,0,18,0,0,23,0,0,0,0,0,0,0,0,33,
+        0,-18,0,0,0,0,0,0,0,37,0,-98,0,0,58,0,0,22,0,0,
+        35,1,0,38,0,0,9,0,0,-8,0,-27,0,0,8,26,0,-19,0,0,
+        0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,3,0,0,-19,0,
+        0,11,0,0,18,0,0,-40,0,0,0,0,0,5,0,0,-43,0,0,-50,
+        0,0,22,0,0,-12,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,
+        3,0,-12,-45,0,0,0,0,0,23,0,0,-37,0,-11,-47,-25,0,0,0,
+        0,-25,0,0,0,25,0,0,19,0,0,0,0,0,-31,0,0,-30,0,0,
+        0,0,0,0,0,0,-13,0,0,0,0,0,35,0,0,0,0,0,0,0,
+        0,-10,0,0,-31,-31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,20,0,29,0,0,0,-66,0,0,28,0,1,0,0,
+        0,0,0,0,29,-45,12,0,0,0,39,0,0,38,0,16,19,0,-28,0,
+        0,16,26,53,0,39,43,-1,0,0,7,60,0,2,7,0,0,0,13,0,
+        0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,-1,0,0,0,
+        0,0,0,0,0,10,0,0,-56,-30,0,0,0,0,19,0,0,-6,2,0,
+        0,0,0,-6,0,0,0,0,0,0,0,-20,0,-14,-33,2,0,0,0,-9,
+        -21,0,0,2,18,0,0,0,0,-32,-25,0,0,0,0,0,0,0,-16,-56,
+        0,0,0,0,-14,0,0,-28,-31,0,3,16,0,0,0,0,-26,0,0,0,
+        0,0,0,0,0,5,13,2,-20,19,-15,-1,24,-9,1,2,-8,-4,16,-6,
+        33,18,-23,12,38,35,-14,37,1,53,-24,15,0,6,-7,-27,-2,-19,16,39,
+        -13,3,1,-1,1,18,18,33,9,4,4,32,0,0,0,0,7,43,15,4,
+        6,16,2,-38,0,-20,-11,1,-12,20,0,-13,0,-48,0,-16,0,0,19,0,
+        19,0,0,0,51,0,0,8,0,-4,-67,0,77,-24,0,31,9,0,0,-68,
+        12,102,0,0,0,20,0,4,0,0,0,40,0,0,10,0,-2,1,65,25,
+        -4,0,-26,0,-6,-16,20,9,-36,51,0,42,0,0,13,0,0,20,0,0,
+        5,0,0,-9,0,26,-17,0,0,88,0,0,-14,-20,-21,-42,0,0,0,0,
+        0,-3,0,0,0,0,0,-18,0,30,-2,-22,8,-7,-21,-39,-66,-7,0,10,
+        0,89,-4,-4,15,-34,-55,0,9,0,0,1,-70,8,-52,0,0,-58,0,0,
+        -4,58,-59,0,0,0,16,0,0,-26,0,0,22,-63,0,0,0,0,-40,0,
+        0,0,0,0,54,0,0,-14,21,-48,0,14,-12,0,0,0,0,35,0,12,
+        11,0,0,0,0,0,0,0,0,21,0,0,-25,0,0,-71,0,-15,48,0,
+        0,0,0,0,0,0,0,46,0,0,23,0,0,0,0,0,55,0,0,0,
+        0,0,0,0,0,19,5,0,0,0,-25,0,0,0,0,0,8,0,0,1,
+        0,0,-8,0,0,8,0,0,15,0,0,0,0,0,0,0,0,-30,0,2,
+        -2,0,0,0,0,0,-18,0,0,0,0,0,21,0,0,0,0,0,0,0,
+        0,0,0,0,-19,0,0,0,0,0,23,31,59,8,14,0,39,0,0,24,
+        0,0,-47,-69,0,-20,0,0,23,42,93,-23,0,0,0,40,0,23,15,61,
+        0,0,0,13,-3,62,28,0,24,-34,28,0,1,0,0,0,22,0,0,0,
+        0,0,0,0,16,42,0,0,0,0,0,18,13,-20,0,4,0,0,0,0,
+        37,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,-1,16,0,
+        0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,3,0,0,0,
+        0,0,0,0,0,29,0,0,22,0,0,0,0,1,0,0,0,0,0,-12,
+        0,0,-34,0,0,0,0,0,0,0,0,13,0,0,0,0,0,34,0,0,
+        1,0,0,0,0,0,0,0,0,36,0,0,-34,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,3,18,0,-9,
+        16,-9,-1,24,-6,10,43,-17,0,12,-75,27,-31,-19,3,57,12,-4,35,-63,
+        0,-11,10,-9,-2,-26,0,-42,-11,35,14,-31,-6,-1,-50,-67,4,20,9,0,
+        0,0,0,0,0,0,0,0,0,0,-2,8,-23,18,17,-11,22,47,-26,-15,
+        -1,0,-14,0,0,-27,66,0,0,11,0,0,0,0,0,0,0,26,23,0,
+        0,7,0,0,0,0,0,-7,0,-10,0,0,0,11,0,0,-6,0,0,-79,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,12,0,0,
+        -76,0,0,30,0,-12,53,0,0,-6,0,-60,0,0,34,12,0,0,0,0,
+        0,0,0,-7,0,0,0,0,0,0,0,41,-49,0,0,-23,0,0,7,0,
+        0,-40,0,0,-37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,
+        0,-36,22,0,0,87,0,27,-13,0,0,3,0,0,13,-10,0,-34,0,0,
+        8,-30,21,0,0,0,0,0,0,-32,-6,0,0,0,0,0,0,0,-11,-9,
+        -53,0,0,0,-46,0,0,23,0,0,-59,-64,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-13,-31,-42,0,0,0,-52,0,0,-35,3,0,0,21,22,
+        0,0,4,0,41,0,-5,27,0,0,0,0,0,0,0,0,24,0,0,0,
+        0,0,4,0,-11,-16,-38,0,0,0,0,0,0,0,49,0,0,-58,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,17,0,57,33,0,0,0,0,
+        0,21,0,0,0,0,-15,0,0,0,0,0,0,0,0,4,0,0,0,0,
+        0,0,0,0,20,0,0,0,0,0,0,0,0,-31,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -10,0,0,0,0,0,0,0,0,4,0,0,0,0,0,46,0,0,0,0,
+        0,46,0,0,3,0,0,10,0,0,17,0,0,26,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,40,0,0,-16,0,0,27,0,0,22,0,
+        0,-9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-25,0,0,0,
+        0,0,11,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-40,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,8,12,1,-16,35,-10,-10,17,4,2,15,-18,
+        -19,21,-50,23,-47,-29,17,24,27,-29,20,0,1,-13,-14,-3,13,-8,-45,-31,
+        -34,34,15,-9,1,16,-32,-2,26,-62,47,-11,0,2,46,25,0,0,0,-10,
+        14,-35,-3,13,-12,-16,14,-22,47,28,6,3,-23,-25,1,26,-21,30,0,33,
+        -6,14,-33,0,0,0,0,29,0,0,16,56,0,0,0,0,0,0,0,8,
+        0,0,0,0,0,0,0,-15,15,20,3,-21,0,0,11,0,0,43,0,0,
+        10,-6,0,0,0,7,39,0,0,0,0,0,0,0,0,9,0,16,98,0,
+        0,17,0,0,9,0,0,0,0,0,0,0,0,18,0,5,-40,0,20,17,
+        0,-41,0,0,-2,0,0,-54,0,0,0,0,0,14,0,0,0,0,0,0,
+        0,0,-4,19,0,0,0,0,56,0,0,-21,0,0,0,20,0,32,0,0,
+        16,0,0,0,0,0,0,0,0,6,21,-15,-3,0,36,57,31,-10,-8,9,
+        2,0,43,0,0,0,0,-11,6,41,-10,0,0,-12,0,0,32,0,0,24,
+        0,0,43,0,-27,0,0,0,-23,-71,0,0,0,0,0,0,0,-33,-44,0,
+        -8,0,0,0,-20,0,-56,0,0,0,-25,8,0,0,0,-20,0,0,0,0,
+        0,0,0,0,-15,-45,-27,17,0,-5,-61,0,0,-79,0,-47,0,0,0,0,
+        0,0,-1,82,-7,-17,21,0,0,0,0,0,44,0,0,33,0,0,0,0,
+        0,24,0,0,6,0,0,0,0,0,0,0,0,-5,0,15,0,0,0,0,
+        0,0,-19,0,0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,
+        8,0,0,0,0,0,0,0,0,-16,0,0,-8,0,0,0,0,0,21,0,
+        -21,-29,0,-16,0,0,0,0,0,0,0,0,-15,0,0,-48,0,0,0,0,
+        0,56,0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,11,
+        0,0,-29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-15,0,0,
+        -3,0,0,0,0,0,-18,0,0,0,0,0,0,0,0,-1,0,12,0,0,
+        0,6,32,10,6,35,42,-5,39,-11,13,38,-4,-10,32,-12,-29,52,-17,31,
+        45,63,17,51,0,35,0,27,33,48,57,49,0,0,0,0,0,43,0,0,
+        65,42,0,0,0,0,66,46,46,0,0,0,38,4,64,-1,23,-11,-15,-11,
+        -32,59,18,33,28,39,37,0,-39,0,39,0,36,-5,32,21,70,60,71,-13,
+        19,0,0,0,0,0,39,0,0,6,0,0,0,0,0,0,0,0,22,0,
+        0,0,0,0,0,0,0,-17,0,-101,0,0,0,-7,0,0,-4,0,0,-58,
+        -34,0,-19,0,0,-26,0,0,0,0,0,0,0,0,26,-15,70,30,0,0,
+        0,0,0,-29,0,0,0,0,0,0,0,0,23,-20,65,-26,0,0,37,4,
+        -13,17,28,55,0,0,-19,0,0,-22,18,0,-30,0,0,-24,0,0,-1,-21,
+        0,-30,0,0,83,-5,0,-21,32,-18,-13,0,0,-14,0,0,-24,-23,-5,-52,
+        0,34,22,0,0,-9,0,0,0,0,0,44,0,0,-23,-21,-2,-25,-29,0,
+        1,0,0,-33,0,-7,-50,-15,-13,19,0,22,-14,-29,-11,-16,-51,2,-26,-39,
+        -2,0,0,0,0,0,0,-2,0,0,-24,-6,0,0,8,0,0,0,0,0,
+        0,0,1,0,0,0,0,0,23,0,0,0,0,0,0,0,0,5,0,0,
+        0,0,0,2,0,0,-2,0,0,-2,-6,0,-1,0,2,-2,-9,0,0,2,
+        -4,0,17,0,-10,-6,-20,0,0,0,0,0,0,0,0,0,-2,40,-10,-3,
+        0,0,5,25,0,-18,0,-2,2,0,0,13,-5,0,0,14,0,0,1,0,
+        0,2,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-1,0,0,-7,0,0,-16,0,27,3,-10,-1,10,-13,0,-13,-8,0,0,
+        0,0,0,-3,0,0,3,-14,0,0,0,0,0,0,-1,0,0,0,0,0,
+        0,0,0,-4,0,0,0,0,0,-7,0,0,2,0,0,2,-15,0,1,0,
+        3,0,-6,0,6,-4,0,-2,9,0,2,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,4,11,8,0,0,-21,10,0,-1,0,7,
+        6,0,0,-17,29,0,9,-17,6,7,-37,24,0,0,0,22,-35,0,-3,0,
+        0,0,-11,0,-1,0,0,9,0,0,-3,3,11,10,4,0,0,0,0,0,
+        0,0,0,14,-7,0,0,0,0,0,0,0,-1,0,0,0,0,7,0,0,
+        -33,0,0,0,0,0,13,0,0,8,0,0,0,0,0,4,6,10,4,0,
+        0,3,0,0,13,-3,0,3,0,-27,-3,18,0,5,0,0,3,0,0,-1,
+        0,0,0,0,0,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-10,0,0,0,0,0,0,0,6,0,0,-1,0,0,-16,0,
+        -25,1,0,0,0,0,0,0,0,0,-3,-9,-17,8,0,0,-2,0,0,0,
+        0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,6,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,
+        0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,-36,0,0,0,0,
+        0,19,0,0,0,12,0,0,0,0,-3,-2,2,0,-9,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,41,0,-11,-2,
+        -8,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-17,-2,-10,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -3,0,0,-10,0,0,-1,0,0,-8,0,-13,0,0,0,0,0,-17,0,-4,
+        -35,2,0,0,-25,0,0,0,0,0,-6,23,-5,-4,-23,0,-10,0,0,0,
+        0,0,2,-23,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-16,0,0,11,0,
+        0,0,0,0,-21,-17,30,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        63,0,0,0,0,0,0,0,-22,-1,0,0,0,0,0,-5,0,0,-23,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,-7,-13,-23,0,
+        0,6,-1,0,-13,0,0,0,0,0,0,0,0,0,13,0,-15,0,0,15,
+        0,0,-6,12,-9,-5,-5,0,-35,0,0,-1,0,0,6,-6,-4,30,0,0,
+        0,-2,0,-15,2,0,0,0,0,0,0,0,0,0,0,-2,-4,0,0,0,
+        0,23,0,0,14,0,0,47,0,0,0,0,0,0,0,0,0,-12,0,0,
+        0,0,0,0,0,0,0,-26,0,0,0,26,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,6,0,0,0,-3,0,0,0,0,-15,-21,0,0,0,
+        0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,2,0,0,0,0,0,0,0,0,0,-4,0,0,22,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-2,0,0,0,18,0,0,0,0,-18,0,0,0,16,
+        0,0,0,0,-18,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-25,0,0,0,0,0,0,0,-2,0,-4,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,
+        14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,23,1,0,-4,0,0,0,36,0,0,16,0,0,0,0,0,0,
+        0,0,0,0,-16,-10,14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -4,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,
+        0,0,0,0,-50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-3,0,0,0,0,25,0,0,0,0,0,23,
+        4,0,-14,-5,0,0,2,0,3,8,-3,-16,0,10,8,3,0,22,10,-7,
+        0,0,0,0,0,29,0,0,11,0,20,0,0,0,0,0,0,3,4,0,
+        0,10,0,0,0,0,0,18,8,3,-1,0,39,0,6,0,0,0,-22,37,
+        12,0,0,0,0,0,-12,0,0,4,0,0,0,0,0,-22,0,0,19,-36,
+        20,0,14,0,-1,-2,0,-6,0,0,4,18,0,6,0,0,0,0,0,0,
+        34,0,10,0,0,0,0,20,0,0,0,0,0,0,-6,0,0,0,0,0,
+        0,0,0,0,6,0,0,0,0,0,0,18,0,0,0,9,0,0,0,-34,
+        2,0,0,0,0,0,0,-5,0,17,0,0,0,0,-16,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-23,0,0,0,0,0,0,0,
+        6,0,0,0,0,0,-14,0,0,13,0,0,0,0,0,0,0,0,-34,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-17,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,23,0,6,0,0,0,0,3,0,10,0,0,0,0,0,0,-5,-4,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-11,0,
+        0,0,0,0,0,0,-19,0,0,-11,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,
+        0,0,0,0,0,0,0,3,0,0,0,0,0,-13,0,0,15,0,0,0,
+        0,0,-20,-1,0,0,0,0,0,-2,0,0,4,2,0,0,0,23,0,0,
+        0,0,0,0,0,0,0,0,-8,0,-2,0,0,0,0,0,0,0,0,-5,
+        0,0,-7,0,0,-18,0,-34,-2,0,0,-5,-1,0,-2,0,-3,-2,-5,0,
+        0,-6,-15,0,-5,0,2,-5,-22,0,0,0,0,0,0,0,0,0,0,-5,
+        1,-2,0,0,-3,6,0,-4,0,1,-2,-6,-3,-2,1,0,0,-5,-19,0,
+        -11,0,-11,-3,-7,0,-2,-3,12,0,0,-16,0,0,1,0,25,10,16,0,
+        21,27,-4,-1,0,0,-4,4,0,-2,0,5,-3,3,-13,-3,-4,2,-7,-12,
+        0,0,0,0,0,8,0,0,-12,0,0,-15,6,0,-14,0,1,0,0,10,
+        -15,0,3,0,4,8,-4,-2,2,2,0,0,0,6,0,0,0,1,-3,0,
+        1,0,7,0,3,0,0,2,8,0,-10,1,2,0,0,0,0,0,0,0,
+        0,0,0,0,0,1,6,0,0,0,0,5,0,5,0,0,-7,-10,0,5,
+        0,7,7,-6,5,5,11,4,6,0,-20,12,-15,14,2,0,0,13,0,0,
+        3,0,-3,4,-22,0,2,-6,0,11,0,3,5,1,8,1,-7,0,0,6,
+        0,0,25,0,0,-6,-6,0,-11,29,31,-12,0,0,3,0,12,-4,-13,12,
+        0,0,8,29,0,16,0,27,10,0,0,7,11,6,4,0,8,12,-1,6,
+        21,0,0,0,0,0,1,-10,0,1,0,-1,1,-4,11,0,1,17,-1,1,
+        -1,4,-5,10,2,2,21,5,-21,0,0,0,0,0,0,0,0,6,-1,0,
+        -39,0,12,0,0,0,-19,0,-22,0,-21,0,15,0,1,0,0,1,21,0,
+        -4,0,-2,0,-5,-27,-1,4,6,-2,33,-6,0,10,-5,2,7,9,-2,25,
+        10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,27,0,0,4,0,
+        0,4,9,0,-3,13,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,-11,25,0,
+        18,0,20,1,0,0,1,1,0,5,3,0,8,-6,22,10,-6,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,
+        0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-7,0,0,0,0,0,0,0,0,8,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,
+        0,0,-20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,-9,0,0,-28,0,
+        -3,-13,7,-2,-12,-9,-18,-7,-12,-3,0,0,0,0,0,0,0,0,-20,0,
+        0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-11,0,0,0,-8,0,0,0,0,-16,
+        -13,0,-15,16,-23,-14,13,-13,-10,28,4,-30,0,0,1,0,0,-7,0,0,
+        0,0,0,-3,0,0,0,-11,0,0,0,0,0,0,0,0,0,0,-6,0,
+        0,4,0,0,-17,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+        0,0,-9,-18,0,-7,-11,0,-10,-14,-9,-9,-10,-8,0,-6,-11,0,-5,0,
+        -8,-11,0,-17,-50,0,0,0,0,0,0,0,-16,-26,0,-9,0,0,-17,0,
+        0,-6,0,-38,-14,-8,-37,-22,0,-10,0,6,0,0,5,0,0,-10,1,-22,
+        -20,-7,30,14,0,0,0,0,0,0,0,15,0,0,4,0,0,-4,-6,0,
+        -35,5,0,-6,-2,9,-7,-8,-13,-9,1,0,3,-3,-18,0,0,0,0,0,
+        0,0,-17,0,0,-8,-4,0,-19,0,-4,4,0,-8,0,0,-2,0,0,-7,
+        -5,0,-2,-6,0,-2,-11,-15,-7,0,0,-14,0,0,-10,0,0,-8,-15,-17,
+        -12,-10,0,-6,-12,10,-7,0,0,0,0,0,0,0,0,0,-19,-28,-11,-12,
+        9,0,-5,-11,-24,0,12,0,3,0,1,0,0,-13,0,-8,-9,-8,-3,73,
+        0,0,-7,0,0,0,0,0,1,0,0,-31,0,0,0,0,0,-8,-6,0,
+        -8,4,0,34,0,-41,-13,6,-4,4,-8,0,0,19,0,0,0,0,0,-21,
+        -14,0,-15,0,0,0,0,0,-37,-9,0,0,0,5,0,0,0,0,0,0,
+        0,0,22,0,0,0,0,0,0,0,0,18,0,0,0,0,0,-5,-2,0,
+        -12,0,0,4,0,0,-3,3,-17,-10,-4,0,-4,8,-13,1,-2,37,-9,-12,
+        0,1,-10,0,0,0,0,0,0,0,0,-16,-16,0,-25,0,0,0,-1,0,
+        -3,-9,0,0,0,0,0,0,-6,-12,0,-10,-13,0,-6,0,-12,-4,-22,-17,
+        -12,-16,0,-11,0,-7,0,-19,0,0,0,0,-17,0,-8,3,0,0,0,0,
+        0,1,0,0,-3,-15,0,0,2,0,0,0,0,0,0,0,7,0,0,11,
+        -39,0,-6,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,
+        0,0,-22,-1,-27,0,-2,0,-2,1,8,0,14,10,4,0,10,0,11,-3,
+        12,-3,0,0,0,0,0,0,0,0,10,0,0,-2,0,-13,-7,-6,0,0,
+        0,4,-7,-12,-3,-20,1,-1,-6,7,8,1,6,22,7,3,2,24,-8,15,
+        0,0,0,0,21,0,0,0,0,-5,-23,0,0,-8,0,-3,0,6,6,1,
+        0,-21,-4,0,7,20,0,-4,-5,0,21,2,0,16,-7,17,0,24,0,0,
+        6,17,0,-3,21,25,-3,0,11,0,0,0,0,0,4,0,0,18,12,0,
+        -4,14,0,0,24,0,7,0,7,-2,2,0,14,0,4,3,8,12,1,10,
+        0,10,12,-1,8,14,0,0,0,0,0,0,0,0,28,0,35,44,-11,19,
+        0,0,-17,15,0,9,0,-10,3,12,0,5,0,16,4,0,0,-3,10,0,
+        17,0,0,9,3,0,-2,0,18,2,-3,0,-6,0,27,15,9,4,-2,24,
+        0,15,0,14,5,10,30,20,2,0,-9,-9,10,0,8,0,4,0,3,5,
+        -3,13,-9,5,16,7,8,17,21,6,3,8,0,-1,-12,18,0,5,0,0,
+        -3,0,0,1,12,-2,3,0,0,0,0,0,0,0,0,10,0,22,17,21,
+        0,18,10,-13,8,9,13,7,16,0,-8,6,0,12,1,10,27,1,0,20,
+        -7,0,23,0,20,0,0,0,0,-17,7,0,-8,9,5,7,0,0,9,0,
+        0,-6,0,0,9,0,5,0,0,-7,0,0,13,0,0,2,-27,0,8,18,
+        0,0,0,0,12,0,0,8,12,0,19,11,9,0,0,0,0,0,0,0,
+        0,0,-13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-8,
+        0,0,-10,0,0,-21,-27,0,0,-13,0,0,0,0,0,0,0,2,-20,0,
+        -30,0,0,0,0,0,0,0,0,-10,0,0,-30,0,1,0,0,0,-22,-13,
+        0,0,0,-6,0,0,0,0,0,0,0,0,0,2,-13,1,-4,0,0,0,
+        0,0,8,0,0,0,8,0,-2,0,0,-22,17,0,-32,0,0,-28,0,0,
+        0,-16,0,-8,0,0,-10,0,0,0,-4,0,0,0,0,0,0,0,16,-13,
+        0,-19,3,-12,-2,0,-10,3,0,-9,0,0,-1,-11,2,-9,-3,-6,-6,-3,
+        -1,-22,4,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -11,0,0,0,12,0,0,0,0,0,-4,11,0,-17,0,0,0,0,0,0,
+        -12,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,1,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -10,0,0,-10,0,0,0,-3,0,0,-9,0,-5,0,0,0,0,-9,0,0,
+        0,-11,0,4,0,0,-17,0,0,0,0,0,0,0,5,0,0,0,0,0,
+        0,0,0,-11,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,-14,-11,0,0,0,
+        0,0,7,0,-3,-21,0,2,0,0,0,0,1,-16,-8,-9,-3,-6,-7,6,
+        7,-8,2,-4,0,0,-39,1,0,1,-13,6,0,0,0,0,0,-1,0,0,
+        0,-3,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,-9,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,-4,
+        0,0,12,0,0,4,11,0,1,33,0,0,-8,0,-11,4,0,0,0,0,
+        0,0,0,0,0,0,7,0,0,3,0,-12,4,0,0,-12,0,0,-3,-16,
+        17,-12,14,0,0,5,0,0,13,0,0,8,0,17,11,0,-1,0,0,0,
+        0,0,5,0,-9,1,0,14,0,0,0,-1,0,0,0,0,0,-25,0,0,
+        8,0,-6,-2,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,28,0,0,0,0,0,25,22,0,14,2,0,1,0,0,-12,
+        0,0,11,0,13,7,0,12,2,0,5,10,13,10,6,15,0,28,0,32,
+        11,11,0,0,0,0,0,12,0,0,8,0,0,-4,16,12,0,0,0,0,
+        0,2,0,-6,-18,0,0,22,0,0,10,8,30,5,15,0,4,0,25,7,
+        21,-8,12,0,27,15,0,0,17,0,0,3,0,17,3,2,0,-12,0,-7,
+        1,0,-1,14,4,0,0,1,0,0,-13,0,-28,17,0,0,1,12,0,0,
+        0,0,22,0,7,-14,30,10,0,0,0,0,0,0,0,0,0,0,-6,-18,
+        2,0,12,0,0,9,0,18,9,13,0,18,0,17,12,0,0,-4,0,-34,
+        13,47,5,8,11,16,16,0,15,19,0,9,-2,6,4,6,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,21,0,16,-13,0,0,17,0,3,2,0,32,14,20,0,18,0,0,
+        22,0,12,-8,25,0,11,0,20,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,18,0,0,0,0,0,0,0,0,0,0,20,0,28,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        10,0,29,0,0,0,0,0,0,16,0,5,0,-1,0,0,0,0,0,0,
+        0,0,0,0,0,0,-8,17,0,0,0,0,0,0,0,4,0,0,0,0,
+        0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,8,0,12,0,0,0,-6,0,0,13,0,4,30,0,0,11,0,0,
+        0,5,0,0,0,0,0,0,0,0,0,0,7,1,0,0,0,0,0,0,
+        0,17,0,-13,7,0,0,10,0,8,19,0,12,8,0,0,0,9,8,11,
+        0,0,-25,0,0,-10,0,0,-16,0,0,0,0,0,0,0,0,0,0,0,
+        -1,0,1,0,-13,0,0,4,15,0,13,0,0,-1,0,6,8,0,7,16,
+        9,7,7,18,5,0,0,0,0,0,-15,0,0,0,0,0,0,0,18,-8,
+        0,0,0,2,-5,8,19,-3,-10,0,0,-13,0,-16,5,21,0,-8,0,0,
+        26,0,19,0,2,13,-8,0,0,-2,0,14,20,4,0,0,0,0,29,1,
+        0,0,37,0,0,0,0,4,0,0,11,0,0,0,-2,0,16,0,31,0,
+        0,0,0,0,0,0,19,0,17,0,0,-12,-17,4,-2,24,0,8,9,8,
+        8,3,5,4,12,2,-4,18,0,0,0,0,0,0,0,0,9,0,0,0,
+        0,0,0,0,0,0,0,0,-13,0,0,3,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,10,0,0,0,0,0,-5,-12,0,-19,-20,0,-3,0,
+        -21,-7,11,0,0,0,0,0,34,0,0,-20,0,0,0,0,0,0,0,0,
+        0,0,-5,-16,0,-22,-5,0,-15,0,0,10,0,-14,-1,-4,-25,0,3,0,
+        0,0,0,0,0,0,-21,0,0,0,22,0,10,-12,0,0,0,0,0,0,
+        -11,-5,0,4,0,0,-3,-21,-33,0,-6,-33,0,41,-6,-22,-4,-13,0,0,
+        0,-2,0,6,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        5,-16,0,0,0,0,11,0,-8,-7,-8,-12,-5,-5,-10,19,0,-12,-2,0,
+        0,-12,0,0,-12,0,-9,-6,0,0,-3,-9,-7,-10,0,-2,-5,0,0,0,
+        0,0,0,0,0,0,-20,0,-19,2,0,0,0,0,-25,-31,0,-3,-8,0,
+        -1,-8,0,-13,0,0,-7,-17,-6,-10,-20,-5,11,0,-5,-1,-6,-22,0,0,
+        0,1,0,0,0,0,1,-9,0,0,0,0,0,0,8,-5,-15,0,40,-11,
+        0,0,0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,8,-23,0,
+        -4,-4,0,-4,0,0,-3,0,2,-14,0,-10,-13,-1,0,-1,0,-7,0,0,
+        -12,-11,0,-4,-7,2,-23,1,-11,0,27,0,0,0,0,-8,6,-5,0,2,
+        -11,7,2,0,-3,-8,16,18,9,0,5,0,0,0,0,0,0,0,0,0,
+        0,0,0,3,0,0,0,0,0,-14,-1,0,11,6,0,-21,0,0,3,-14,
+        -2,-4,0,1,-1,0,-24,-9,-15,-9,-11,-10,-10,-32,0,-18,-7,-17,-10,10,
+        -11,-17,7,3,-15,1,0,0,0,0,0,0,0,0,5,6,0,0,4,38,
+        0,0,0,0,0,0,2,0,0,-3,4,0,-3,0,0,0,0,0,0,0,
+        0,-1,0,0,6,0,0,5,0,-30,0,0,0,-1,6,0,-2,0,9,-2,
+        -5,0,0,-6,5,0,5,0,-2,-12,-12,0,0,0,0,0,0,0,0,0,
+        -6,18,-6,0,0,0,-1,-1,0,0,0,7,-5,-10,-9,-5,-2,0,0,9,
+        9,0,0,0,-40,-1,5,-19,2,-11,27,0,0,0,0,0,0,0,15,21,
+        17,0,10,0,0,-3,0,0,-6,8,0,-8,0,0,-5,-13,-3,-2,-4,0,
+        -1,11,0,0,-1,0,0,0,0,0,-9,-9,-5,0,-19,0,0,0,1,0,
+        0,-34,4,0,11,0,0,-3,-14,0,-2,-5,0,-8,-10,8,2,0,0,2,
+        3,0,4,0,0,0,-7,0,-1,0,-5,-5,0,5,2,0,0,0,0,0,
+        0,0,0,0,0,-17,0,-11,25,0,0,0,31,0,1,4,0,0,5,-14,
+        0,6,0,13,-1,12,0,3,4,9,14,0,10,5,2,17,1,0,0,2,
+        0,0,3,0,5,-1,-8,0,0,1,0,-5,0,11,3,13,-6,7,0,0,
+        0,-5,12,0,-12,0,15,-2,-18,0,-4,-4,0,-9,0,0,-8,3,10,-1,
+        0,16,0,0,12,0,0,7,0,0,23,6,0,3,10,0,2,0,0,19,
+        0,11,19,19,0,2,0,0,5,-1,0,2,0,-7,0,-5,-1,0,1,16,
+        -3,-11,8,1,-1,6,3,-3,22,2,-5,0,0,-16,-30,0,21,0,21,-9,
+        -12,0,-15,24,-6,6,0,-22,-9,4,-5,-7,15,0,-6,-3,0,0,0,13,
+        3,0,5,0,11,-3,-11,5,-1,-5,0,4,10,-27,2,-14,4,4,-4,27,
+        1,-9,1,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,0,0,
+        0,0,-4,7,-6,0,-2,14,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,
+        0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,4,0,0,20,
+        7,0,8,0,0,8,16,0,1,12,0,15,3,-15,12,8,-6,14,4,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,
+        0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,20,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+        7,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,-15,-17,0,
+        9,0,-26,-9,-11,-4,-6,-4,0,-10,18,0,0,0,0,0,0,0,0,0,
+        -5,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,-4,-5,0,-9,0,
+        0,0,2,0,-12,21,-4,4,13,-6,-4,-17,-7,7,-4,-12,1,7,-13,-7,
+        0,0,0,0,0,-9,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+        1,0,0,3,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,0,0,0,-10,-13,0,-28,0,0,-9,0,0,-12,-3,0,0,-10,-16,0,
+        14,0,0,-7,0,-15,0,0,-14,0,0,0,0,-12,-7,-28,0,-14,-10,0,
+        13,15,0,-12,0,0,-19,-2,0,-4,-23,-12,0,0,0,0,15,0,0,5,
+        -11,0,-9,-18,13,0,0,0,0,0,0,0,0,22,0,0,0,0,0,-6,
+        0,0,0,0,0,-4,0,0,-2,6,0,5,1,0,-16,1,0,0,0,0,
+        0,0,0,0,-7,0,0,0,0,0,-18,0,-4,0,0,0,26,0,0,0,
+        0,-17,0,0,-7,-19,0,22,-18,-30,-6,0,0,-10,0,0,6,0,0,-11,
+        -9,-27,-16,-12,0,-4,-10,-10,-5,0,0,0,0,0,0,0,0,0,-8,-34,
+        -11,-6,-27,0,-24,-1,0,-10,0,-10,-9,0,11,0,0,-30,0,0,-19,-17,
+        0,-45,0,0,-3,0,0,-1,0,0,-2,0,0,27,0,0,0,0,0,-33,
+        -8,0,-18,-16,0,13,-12,0,-8,4,0,-6,-26,0,0,-25,0,0,0,0,
+        0,-28,0,0,-10,0,0,11,0,0,-12,0,0,9,-18,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,
+        10,0,10,0,0,-7,0,0,-6,-7,10,-8,-15,0,-7,6,-19,1,-13,25,
+        0,-7,0,4,-2,10,0,-9,11,0,0,0,0,-6,-35,-15,-14,0,0,0,
+        0,0,-4,-20,-5,0,0,0,0,0,-11,-3,0,-13,27,0,-2,0,41,-13,
+        -35,-17,-14,-21,0,-10,-2,-13,-10,-16,0,3,0,0,-12,0,0,-6,0,0,
+        0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,
+        0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,3,0,0,12,10,0,9,0,0,3,3,0,2,16,-15,0,-1,0,
+        9,-1,12,0,0,0,0,0,0,0,0,0,0,12,0,4,0,9,0,-10,
+        0,-24,0,0,3,-14,0,0,-4,6,15,-5,28,0,5,0,0,6,6,20,
+        -17,16,0,0,0,0,0,0,0,0,0,0,-12,0,0,2,0,0,0,0,
+        -4,1,0,-3,0,0,10,-41,0,-10,-10,-6,13,6,0,0,9,9,0,8,
+        -1,0,13,6,0,-5,18,18,13,0,0,0,0,0,0,0,0,0,0,20,
+        0,0,0,13,0,4,-1,0,5,0,14,3,16,0,16,0,19,7,6,18,
+        -8,9,0,11,19,0,6,-7,0,0,0,0,0,0,0,0,-27,7,-2,0,
+        7,-1,0,0,14,6,3,-1,0,18,-21,0,0,6,0,0,2,14,0,3,
+        19,0,0,0,22,16,17,-10,20,0,32,-19,17,0,5,0,31,8,24,0,
+        10,26,0,0,0,0,7,0,6,0,-5,0,15,-10,-17,0,-9,0,0,0,
+        3,34,-11,15,-11,1,10,5,6,10,9,1,15,0,0,1,0,0,0,-9,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,17,0,18,
+        -10,11,0,14,0,0,5,7,-6,7,14,24,8,8,16,5,20,11,0,7,
+        0,12,6,0,13,1,16,0,0,0,0,6,5,0,-3,10,0,0,17,0,
+        4,-6,13,-22,10,0,-2,9,14,0,0,0,18,0,-2,0,0,6,13,0,
+        5,5,0,2,0,0,9,22,15,19,4,0,-18,0,0,0,0,0,0,0,
+        0,0,0,0,-26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-18,0,0,0,0,-17,
+        0,-5,0,0,4,0,0,-1,-9,0,0,-29,0,0,0,0,0,0,9,-11,
+        -7,0,-7,0,0,0,0,0,0,0,0,0,0,0,-24,0,-25,0,0,0,
+        -11,19,0,11,0,-5,0,0,0,-8,0,0,0,0,0,-13,-23,-14,-10,19,
+        0,0,0,0,0,0,0,-9,-31,0,2,0,0,1,0,0,27,0,0,16,
+        0,0,10,-3,0,-9,0,0,9,0,0,0,0,0,0,0,0,0,7,0,
+        2,-4,0,-19,0,0,-23,10,-5,-3,0,-17,-23,0,0,8,0,-8,-11,0,
+        -14,-3,-15,-23,1,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,0,
+        0,0,0,0,0,0,-10,0,0,0,0,0,0,-13,0,-6,0,0,-6,0,
+        0,0,0,0,-11,0,0,0,0,-4,0,0,0,0,-1,0,0,0,-3,-31,
+        0,0,0,-26,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,0,
+        8,0,-12,0,0,-11,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-19,8,-19,0,0,-5,0,0,0,0,0,0,0,-12,0,0,0,
+        0,0,0,0,0,-12,0,0,18,0,0,0,15,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-30,-9,0,0,-4,0,0,13,-3,0,0,
+        0,0,0,0,4,0,-20,-21,0,-17,0,0,0,0,0,-8,-13,-5,-16,-5,
+        -5,-9,-14,-10,-14,-9,0,-23,-6,0,-2,-9,0,7,0,0,0,0,0,4,
+        0,0,6,0,0,0,0,0,0,0,0,0,0,0,7,0,0,8,0,0,
+        7,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,7,0,
+        0,9,11,0,13,0,0,7,2,0,22,13,11,0,4,0,6,16,0,0,
+        0,0,0,0,0,0,0,0,0,0,-9,4,0,3,-3,0,0,9,0,-9,
+        -3,-28,-1,0,7,0,9,7,3,0,6,0,12,-6,0,12,16,0,-3,0,
+        0,0,0,0,0,0,0,2,0,9,0,0,0,2,0,0,-6,0,0,29,
+        0,0,4,7,-9,7,-9,0,-11,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,8,0,0,0,0,0,-29,0,0,44,0,7,1,0,
+        0,0,0,0,9,0,14,8,6,0,6,0,9,8,8,18,3,4,22,8,
+        0,22,8,16,0,47,0,0,0,0,0,0,16,0,12,23,18,8,7,0,
+        0,16,2,10,0,12,17,6,0,6,0,15,13,14,28,-1,26,-4,5,0,
+        18,11,29,0,5,0,8,5,-15,-8,21,0,4,2,5,19,4,11,0,-20,
+        0,-27,6,10,5,1,5,0,-3,3,0,0,6,0,-22,-1,2,20,9,2,
+        15,46,0,0,6,17,2,5,12,6,0,0,0,0,0,16,0,10,6,0,
+        13,-7,1,2,0,0,0,19,17,17,17,17,0,10,0,20,7,37,0,17,
+        12,-15,10,-47,12,8,14,10,7,0,18,13,41,10,10,1,10,22,-20,0,
+        8,0,0,0,0,0,0,0,0,-11,0,0,0,-13,0,0,8,0,2,15,
+        0,0,8,0,5,0,4,2,0,0,0,0,0,7,3,-13,4,13,0,-2,
+        0,9,9,20,-19,-2,10,8,15,0,6,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,14,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-13,0,-7,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,0,
+        0,0,0,0,23,0,0,0,2,0,3,-9,0,4,0,12,0,0,0,0,
+        0,0,0,0,0,9,0,0,-6,1,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,8,0,-2,0,1,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,4,
+        0,0,0,0,6,0,21,17,0,0,17,0,0,22,0,14,0,0,0,20,
+        0,0,0,29,0,0,0,0,0,11,0,0,0,0,9,0,0,0,12,0,
+        0,0,0,14,0,0,0,0,0,0,0,16,0,25,20,5,0,0,0,7,
+        10,9,0,0,33,0,0,-3,0,0,30,0,0,0,0,0,0,0,0,0,
+        0,0,2,0,11,0,-10,-1,1,7,9,0,2,-4,7,21,-16,6,11,16,
+        16,6,10,7,10,14,6,0,0,3,0,0,0,0,0,0,0,0,0,0,
+        -10,0,0,0,0,-16,0,13,2,-4,0,0,0,31,0,14,18,1,0,0,
+        0,0,8,0,4,9,0,5,5,0,0,-3,0,9,14,3,0,0,-5,0,
+        -9,0,5,0,-6,0,0,9,0,8,0,0,-7,9,0,0,4,0,0,12,
+        -6,-1,0,0,-4,0,0,0,0,0,0,0,10,0,0,5,0,11,0,0,
+        1,-3,13,9,4,2,7,16,27,-3,0,0,0,0,0,-9,0,0,8,5,
+        0,0,0,0,0,0,0,0,0,0,-1,0,0,-23,0,0,0,0,0,0,
+        0,0,0,0,0,12,0,0,39,0,0,9,0,0,-7,-8,0,-13,-16,0,
+        2,0,-3,-7,-9,-8,0,-14,0,0,-3,0,-10,-8,4,-9,-14,0,0,0,
+        0,0,0,0,-17,-6,-1,-11,-16,0,-13,18,-6,-3,0,-23,-10,-10,0,-17,
+        -4,-5,0,-10,0,0,0,0,-2,-10,4,0,-10,-10,7,-25,0,0,0,0,
+        0,0,-17,-5,14,0,6,0,0,-4,-19,0,13,-18,0,13,0,6,-3,-8,
+        3,-10,-15,0,-1,-11,0,0,-10,0,0,16,0,-7,0,0,0,0,0,0,
+        0,0,-2,5,0,-24,-10,0,13,0,-7,-9,-22,-7,-3,-14,-1,5,0,-4,
+        0,19,0,2,2,0,0,0,19,-5,-5,-18,-9,-4,8,-11,-1,-1,-1,-2,
+        0,0,0,0,0,0,0,0,-14,-13,-20,-4,-25,0,-3,0,-5,-9,0,-7,
+        -12,0,-7,-4,0,-9,0,-5,-8,2,-16,-8,17,-19,-5,0,-5,2,-11,-10,
+        2,-6,0,27,0,3,0,0,0,-9,-16,0,0,0,6,-13,-2,-7,-8,-12,
+        -22,-18,-4,0,0,-16,0,-27,0,0,0,2,-17,0,-9,0,-14,-19,0,-10,
+        -20,0,-11,4,0,-3,-13,0,-35,0,0,8,0,-15,-2,0,4,-6,-15,-3,
+        0,0,-18,-7,-36,0,-2,-23,-16,3,10,0,5,-6,0,9,0,7,-2,2,
+        -43,-6,-2,0,-10,6,3,6,-6,11,0,7,2,1,0,0,0,0,0,0,
+        -7,0,-21,0,0,-5,0,0,-1,0,2,5,0,0,21,2,0,-20,12,5,
+        -3,4,-1,-6,3,-20,-8,-4,-7,-9,-12,-6,-15,-10,-10,-19,-9,-14,-5,-13,
+        -2,5,-9,-17,5,-16,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,
+        0,0,0,6,0,0,12,1,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-8,
+        0,0,0,0,0,-2,0,-3,-6,13,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-28,-7,0,0,0,
+        0,0,0,0,13,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        4,0,0,0,0,0,0,0,0,5,0,-14,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,-6,0,
+        0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,24,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-8,0,0,0,0,0,-22,0,0,-13,6,0,-25,0,-39,0,-3,0,26,
+        0,31,0,3,0,0,0,0,0,-2,0,0,0,0,0,0,-43,-11,21,0,
+        0,0,0,0,0,0,0,20,0,81,11,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-17,-7,0,-41,0,0,0,20,0,0,0,-23,0,33,0,0,
+        0,0,14,0,0,0,0,0,-70,-37,8,-11,2,0,-33,-35,-8,0,28,0,
+        0,-28,0,0,29,0,0,0,0,0,21,0,0,0,0,0,0,0,32,-52,
+        0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,61,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,42,0,0,0,0,0,0,0,0,-8,16,-31,-6,0,-22,0,37,
+        0,0,0,54,0,63,0,0,0,0,0,0,0,-10,0,0,0,0,-25,51,
+        46,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-52,-1,-92,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,-6,0,0,-3,23,
+        37,0,0,0,18,0,55,0,0,0,0,-27,-36,0,0,0,0,0,0,-5,
+        18,0,7,0,0,-18,38,0,0,-12,0,-50,69,-17,50,0,0,0,54,17,
+        0,0,0,0,0,0,-32,10,0,-17,0,0,-36,0,0,0,0,0,0,0,
+        0,0,0,0,0,-16,0,-19,0,0,0,-84,0,-18,5,18,-15,0,0,-45,
+        6,16,0,0,0,0,0,27,0,-13,18,0,0,-49,0,0,0,0,0,0,
+        -48,43,87,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-45,0,-50,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,14,0,0,0,0,0,9,0,0,13,0,-4,0,0,
+        -28,28,14,38,0,0,-17,0,0,0,0,0,0,-7,0,-4,0,0,0,0,
+        0,-28,0,0,-64,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-46,0,18,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-29,-4,0,0,-13,
+        0,0,0,0,0,-2,0,0,0,15,0,26,0,0,0,0,0,-7,0,0,
+        0,0,-19,-3,0,0,-53,0,0,12,0,0,4,0,0,-11,3,0,17,0,
+        0,-13,0,0,0,0,0,0,0,-11,-5,0,0,-26,0,0,0,0,0,5,
+        0,0,-30,-8,0,0,0,0,-19,0,0,-16,0,0,6,0,-21,-6,13,0,
+        -21,39,0,0,0,0,-9,-12,0,0,-12,0,-40,0,0,0,0,0,0,0,
+        0,0,0,16,-8,-36,0,-28,0,0,0,0,0,20,-11,0,-14,38,0,0,
+        0,0,-31,0,0,0,0,0,0,0,0,12,29,0,-9,0,0,0,0,0,
+        -25,0,0,0,7,0,0,0,0,-4,-20,0,0,0,0,-79,0,0,3,0,
+        -14,-18,0,-19,0,0,0,6,0,-11,0,17,0,9,0,0,0,0,0,21,
+        0,0,0,0,-20,10,0,-5,0,0,0,32,0,7,10,0,49,-4,-39,-14,
+        0,0,0,15,0,-15,0,0,0,0,0,0,-6,0,-1,24,0,-5,0,0,
+        0,23,0,41,0,0,20,0,0,0,13,0,-53,0,0,0,-9,0,0,-18,
+        2,0,-14,-10,5,0,18,0,-20,3,-10,-22,0,-21,1,0,0,0,0,0,
+        0,17,0,0,0,1,-14,-2,0,0,0,-19,-36,-6,0,-15,-9,-33,20,20,
+        -11,27,0,0,0,0,0,0,0,0,0,0,-45,-33,-3,0,3,7,-10,0,
+        -34,0,-45,15,39,0,2,0,0,0,0,38,24,0,7,8,0,-7,24,-23,
+        -17,2,-4,-43,5,-6,0,0,0,-17,-26,-4,-9,32,0,12,0,-44,0,34,
+        0,0,33,1,0,0,3,28,27,0,0,43,3,0,0,0,-24,-68,0,0,
+        30,-20,0,0,-29,0,0,0,0,0,0,0,0,0,17,-8,0,-62,16,27,
+        0,0,0,-61,20,0,0,15,0,0,0,0,-28,6,0,0,8,-2,-50,0,
+        17,-24,20,-21,-5,17,-13,0,0,0,-24,1,-45,-54,-11,16,0,0,-13,0,
+        0,0,0,0,-6,0,0,-19,6,-21,-29,-74,0,-18,0,0,-8,-26,11,0,
+        0,28,-37,0,0,-39,0,0,0,0,0,0,0,0,0,0,15,-27,16,-42,
+        -41,0,0,0,0,28,0,0,27,18,0,0,0,53,0,0,0,36,13,-44,
+        0,-2,12,0,-11,-41,0,-2,29,40,0,5,0,-9,0,23,-34,22,0,-1,
+        4,-3,0,0,-34,0,0,0,1,15,0,-16,-10,0,-32,-9,0,-7,8,0,
+        -11,33,33,-20,0,0,-36,-8,0,0,0,0,0,0,0,-20,11,0,-25,14,
+        0,-1,0,0,0,6,0,14,0,50,37,-20,0,0,51,0,0,0,0,3,
+        8,0,-30,39,15,-14,0,0,-11,24,9,0,40,-31,-4,0,20,0,0,0,
+        -35,0,0,-11,0,-3,0,0,0,9,0,-18,-30,0,0,0,-21,23,-12,0,
+        0,17,-64,9,-26,0,39,0,-11,0,0,0,0,0,0,0,-13,0,0,0,
+        0,14,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,44,-59,0,0,
+        0,4,48,-31,21,0,-20,21,0,-27,38,0,-18,5,0,-24,0,0,-12,0,
+        0,-19,0,42,0,0,0,0,0,0,-33,32,0,-10,0,0,-42,51,0,11,
+        31,0,-11,50,25,-29,0,0,-17,0,22,0,0,0,0,0,0,-36,34,0,
+        -25,-92,14,-16,0,0,0,27,0,-45,0,0,-14,0,0,0,-15,0,0,0,
+        0,0,0,0,-27,4,0,0,0,0,0,12,0,0,0,0,0,0,18,0,
+        24,0,0,1,0,0,-18,0,0,0,0,-13,5,0,0,0,0,0,25,0,
+        0,20,0,0,-7,21,0,23,0,0,-5,0,0,-6,0,0,21,0,0,5,
+        0,0,-17,0,0,45,0,0,14,0,0,0,17,0,0,0,0,-3,0,0,
+        -16,0,0,11,0,-8,-4,11,0,0,0,0,16,23,0,0,0,0,0,21,
+        0,21,0,0,-5,14,0,-20,0,0,0,0,-20,0,10,0,0,0,0,-34,
+        6,0,-21,47,0,24,9,0,0,0,0,-1,-12,0,0,0,0,10,-37,0,
+        -13,7,0,-1,-5,0,0,0,0,-35,15,0,0,2,0,0,0,0,-4,-63,
+        0,-20,1,0,10,0,35,7,0,-13,0,0,0,20,0,-41,0,0,0,0,
+        -23,0,3,0,-8,-1,0,9,9,0,0,0,0,0,-7,0,36,0,0,0,
+        11,0,15,37,0,0,75,-17,0,0,0,0,2,0,8,0,0,0,0,0,
+        -6,6,0,21,0,0,-14,31,0,0,9,0,0,0,0,0,0,0,0,-21,
+        0,-39,0,0,0,12,0,-33,-13,11,0,-31,0,0,-10,2,0,-18,0,4,
+        0,1,0,0,-1,37,-3,7,0,-20,13,0,0,39,-29,-15,25,0,0,0,
+        0,-12,14,0,-42,0,0,-12,40,0,0,-3,-32,-20,11,0,0,0,0,0,
+        -35,-51,-13,16,0,-38,-12,0,11,23,0,-1,0,0,-18,28,0,0,0,0,
+        -9,0,0,-26,22,0,-22,27,-30,-21,19,0,-32,20,0,-35,29,-7,0,0,
+        -51,0,34,0,0,62,15,-8,27,0,0,20,0,0,40,0,-70,25,0,0,
+        0,0,83,31,-37,13,2,0,0,27,0,0,0,0,-35,4,0,0,0,0,
+        0,19,-13,-28,9,0,-52,5,0,-10,26,0,18,36,0,0,35,0,0,0,
+        0,-32,22,0,0,22,0,-51,29,-25,-41,13,-14,13,0,-9,-6,0,-18,0,
+        -5,-53,0,14,0,0,0,6,-28,6,2,-9,41,0,0,31,1,0,0,0,
+        0,0,0,0,0,-12,0,48,-44,0,29,0,0,-11,0,37,0,0,0,0,
+        0,0,0,-17,35,39,9,-20,19,-17,0,0,0,-6,0,-21,0,14,0,0,
+        0,0,0,-6,-50,0,0,-40,0,0,-16,16,0,-2,0,0,-14,16,14,11,
+        0,0,0,0,4,0,-2,0,-10,24,5,-2,22,17,0,26,20,-9,17,0,
+        7,0,0,22,-10,8,-10,-14,0,-32,9,16,-14,27,0,-13,26,-58,-20,0,
+        0,0,58,0,-4,19,0,2,37,0,10,7,44,0,0,0,0,0,47,0,
+        0,0,0,34,25,11,10,53,0,3,26,-15,25,29,-23,0,0,-32,10,17,
+        -16,0,0,0,0,16,0,0,-3,-42,22,46,-2,0,0,0,62,7,31,0,
+        35,-18,0,0,0,-24,33,-27,-51,0,0,43,-1,0,0,37,0,0,11,0,
+        0,0,0,0,-8,-35,-8,23,-6,5,15,0,-1,27,0,-47,0,0,0,0,
+        0,0,0,0,37,0,-8,0,35,0,0,20,-37,19,5,-5,50,0,-39,35,
+        6,-9,0,0,-34,0,2,0,0,0,-22,14,20,0,28,43,-27,4,18,-28,
+        -23,0,20,0,0,0,60,-9,-13,38,0,-4,38,-18,0,0,13,-13,72,0,
+        -9,0,0,0,0,0,-7,-12,30,-22,40,0,-23,-16,34,-43,40,0,12,0,
+        25,0,0,0,0,16,0,44,0,21,-56,0,30,-28,-3,0,0,0,0,0,
+        0,0,0,-3,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,
+        0,-6,0,0,0,0,0,0,0,0,1,0,0,-3,7,0,0,0,0,-5,
+        0,0,0,0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-7,0,0,0,0,0,-1,0,-9,-6,-1,0,0,0,
+        0,0,0,0,-5,1,0,0,0,0,0,0,0,29,66,0,0,0,0,0,
+        0,0,-7,-4,0,0,0,0,0,0,0,1,0,0,4,28,0,0,0,0,
+        -3,0,0,0,0,0,0,0,0,-8,-10,0,0,0,0,0,0,0,17,0,
+        0,0,0,0,0,0,0,-11,-11,0,0,0,0,-5,0,0,4,0,-18,0,
+        0,0,0,0,0,0,0,-15,0,0,0,0,0,0,-12,0,-7,0,0,0,
+        0,0,0,7,0,-5,0,0,0,0,0,0,-3,0,32,-18,12,-37,0,0,
+        0,15,0,37,0,0,0,0,0,0,5,0,40,0,0,0,0,0,0,4,
+        0,22,0,0,0,0,0,0,-5,0,3,0,0,0,18,0,-37,-15,2,0,
+        -17,0,-11,0,19,0,-17,1,-30,0,-1,0,0,0,0,-28,-3,0,0,-33,
+        0,0,0,-22,-18,3,0,-4,0,-17,0,18,0,-22,2,-42,-4,1,-50,0,
+        0,0,-16,5,0,0,0,0,0,0,-12,-13,1,0,0,0,0,0,8,0,
+        -8,1,0,0,2,-19,0,0,0,-2,25,0,0,-14,12,2,13,-34,-44,1,
+        0,-20,-25,-39,0,18,0,-40,40,0,0,26,0,0,0,0,0,13,0,0,
+        0,0,0,0,22,-18,26,0,0,0,0,0,0,0,-33,-25,0,-41,23,0,
+        0,3,0,0,0,0,0,0,0,0,0,0,-1,-17,0,0,0,0,0,0,
+        0,0,18,0,0,-5,0,0,0,0,51,-41,0,0,29,0,0,21,0,-16,
+        2,-15,-18,0,-47,0,-34,0,-27,-9,-65,0,0,-5,0,0,0,0,-15,0,
+        0,0,-23,0,0,23,-20,9,14,0,0,-12,0,0,0,-23,-21,-25,0,18,
+        -4,0,0,0,63,0,0,0,0,0,0,0,-2,-99,-26,-6,81,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-18,-1,0,0,0,16,5,0,-33,
+        14,0,-8,0,0,-16,12,9,0,15,0,-22,0,-25,-20,0,0,-9,16,40,
+        -48,0,0,0,0,0,-35,8,0,-6,0,0,-18,71,5,0,-4,0,-4,10,
+        10,-15,6,25,9,31,15,22,0,0,0,0,-12,0,17,0,-25,0,0,-54,
+        32,0,0,21,0,8,0,0,0,0,0,0,33,20,-9,0,0,0,53,7,
+        -12,16,14,-35,0,0,-2,45,16,0,42,-1,-30,0,0,0,0,1,-54,-13,
+        65,0,0,0,0,0,5,-46,11,14,-13,0,0,-7,0,0,0,-16,-2,-10,
+        38,45,0,0,50,0,62,0,0,0,0,0,0,0,0,-15,-2,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,2,
+        6,24,21,0,-7,0,0,-15,-26,0,-23,31,0,-27,0,0,8,0,0,-24,
+        3,0,-12,0,0,0,-16,0,-25,-31,0,-11,0,0,-21,52,-3,-2,-4,0,
+        -11,19,0,-22,0,-16,4,-26,0,-7,0,0,0,0,0,-21,18,0,-36,0,
+        0,-33,0,0,0,-4,0,0,0,0,-37,0,0,0,12,0,-10,44,0,0,
+        21,19,-2,-5,0,0,-10,0,0,0,0,0,-5,0,0,-31,-11,0,10,0,
+        0,-7,0,0,-20,0,0,0,0,-12,-4,0,0,-40,0,0,-6,0,0,-2,
+        0,0,-1,22,0,34,0,0,2,0,0,-61,0,0,3,0,-11,-1,0,0,
+        -19,0,0,0,0,0,-1,0,0,-47,23,0,32,0,0,-6,0,0,32,0,
+        0,4,0,-11,-10,2,0,-36,55,0,0,0,0,-14,-2,0,-38,52,0,29,
+        0,0,15,25,0,0,-7,0,0,0,5,-10,22,0,-47,-42,0,-8,0,0,
+        6,7,0,-4,15,0,37,0,0,3,39,0,0,0,0,0,0,0,-9,0,
+        0,-5,0,0,0,0,0,6,1,0,0,0,0,0,0,0,-11,11,0,0,
+        0,0,-20,-31,-23,4,0,-22,-15,0,-38,0,0,0,0,0,-32,-31,6,-13,
+        34,0,-9,16,0,-26,0,0,26,0,0,-3,-2,0,-17,-12,0,-9,-36,0,
+        -9,-1,0,-20,-2,6,-23,5,0,-39,-3,0,-32,0,0,0,0,0,-10,31,
+        0,-3,5,0,1,0,0,0,4,0,-64,0,23,62,41,0,-15,-4,0,-45,
+        0,0,7,-3,0,-12,-19,2,0,-21,8,22,-32,12,0,-23,0,-18,-14,-3,
+        12,20,-65,0,-9,-15,0,0,29,-38,-49,29,-25,-21,2,0,-13,-7,-27,-33,
+        0,0,-26,-16,-15,-11,20,-21,47,30,0,3,26,0,-26,66,0,0,-4,-21,
+        -7,5,0,-21,-3,16,63,0,0,-9,-4,1,-19,13,-39,38,0,0,-12,30,
+        0,-22,7,-8,-12,6,-13,-23,-3,1,-14,31,-33,-50,44,-16,-21,-11,-34,-45,
+        8,-31,25,-26,-25,-7,-7,-47,0,-12,-11,0,63,-10,-25,7,-20,-48,2,-27,
+        -14,44,-52,-26,-30,-6,-44,31,-19,31,14,0,-35,23,4,-8,51,0,53,3,
+        -22,-40,19,-15,-49,33,0,2,0,-56,9,-28,-15,0,37,0,0,0,33,-20,
+        -26,-23,0,22,-8,9,25,-10,-19,-1,-18,-6,40,-8,-38,0,-15,-15,-5,30,
+        -7,21,-19,0,0,-15,-9,35,-29,0,0,-25,-70,0,-22,-11,-7,-23,-10,0,
+        -13,-13,0,-27,-20,-10,-56,-13,22,1,0,-4,-12,-24,0,27,0,0,0,0,
+        0,-13,-49,-13,-16,-22,15,-19,0,0,0,-14,15,-5,0,53,-16,0,0,-1,
+        -3,0,-39,-20,39,11,-28,0,-13,10,0,-13,13,0,-6,44,40,-33,7,0,
+        -20,-3,-14,-2,6,71,-13,-8,67,-11,0,34,34,0,0,7,9,0,-14,-15,
+        0,-21,7,16,-19,-2,0,-20,24,15,-15,28,2,-4,6,37,-9,0,29,0,
+        12,49,-25,4,0,-5,-14,0,-21,0,0,-34,7,0,-10,0,50,-3,-16,0,
+        41,46,11,-1,0,13,18,19,10,-2,1,-22,-24,23,0,24,61,0,-17,25,
+        -85,-14,-20,-17,-21,20,13,-16,0,33,-34,0,29,0,0,0,-21,3,18,-40,
+        0,0,-2,-6,0,-18,11,5,-10,20,12,-19,38,17,0,54,0,-10,0,0,
+        0,0,36,-20,-17,24,-11,-5,0,0,48,0,-53,4,0,15,0,22,0,0,
+        0,-37,4,0,-28,0,0,1,44,21,-5,14,0,-14,13,0,-15,56,0,1,
+        1,6,-25,49,-3,-37,-8,9,-22,-12,0,-46,0,0,-33,0,0,-35,18,19,
+        -18,0,0,-17,24,0,-31,4,-16,-21,46,13,-4,-3,-27,-6,9,0,-21,0,
+        0,0,0,0,-22,-2,0,-11,0,-8,-12,34,0,0,-14,0,23,0,47,-33,
+        0,0,0,11,14,13,0,0,-17,60,11,-18,-1,0,0,0,0,0,8,0,
+        0,0,0,0,0,3,0,18,0,0,-4,0,0,-16,0,0,0,0,-20,-4,
+        0,0,0,0,0,13,0,0,10,0,0,-7,17,0,34,0,0,-1,0,0,
+        -40,0,0,20,0,-34,-1,0,0,3,0,0,8,0,0,1,0,0,-18,39,
+        0,35,0,0,3,0,0,-17,0,0,-2,0,-11,-2,17,0,0,0,0,-15,
+        0,0,-5,-13,0,0,5,0,-1,20,0,5,4,0,40,0,0,-28,-7,1,
+        -11,28,0,0,0,0,6,26,0,14,5,0,2,20,0,25,4,0,4,-27,
+        0,7,0,0,43,1,0,5,38,0,0,0,0,49,-10,0,9,7,0,0,
+        0,0,0,0,0,-7,64,0,0,0,0,-11,6,-11,9,0,-17,0,0,0,
+        -4,0,15,6,0,-14,0,12,0,28,0,-21,-5,0,2,-11,0,0,-4,0,
+        -22,0,0,13,0,0,0,20,0,-9,9,0,32,-2,53,-8,29,0,7,5,
+        0,-17,-54,0,0,3,0,-20,2,0,-36,-8,0,0,0,0,0,-5,0,0,
+        11,0,0,0,0,0,13,0,27,0,0,15,-6,0,-20,-15,17,0,-9,36,
+        -27,-15,14,0,-11,14,1,0,16,0,0,12,-15,-23,16,0,8,43,0,-18,
+        24,-16,-13,-3,0,0,0,0,-48,19,0,-6,28,-54,-46,9,8,42,-2,-21,
+        -20,8,0,-9,3,0,45,16,4,-4,18,0,12,19,0,14,22,0,7,41,
+        0,-26,-11,5,35,0,0,0,0,0,20,28,-16,-11,9,-18,-14,23,0,0,
+        28,0,-10,41,-10,-3,-29,0,0,48,0,0,36,-18,29,20,0,0,0,0,
+        -28,9,-37,-3,-8,0,-15,0,0,-35,20,0,39,31,0,-65,15,0,0,-6,
+        0,-35,59,0,0,6,0,0,0,-32,-9,19,0,-17,8,0,5,60,-8,-17,
+        0,0,0,23,0,0,0,0,-35,21,-8,-39,50,0,-27,18,-20,0,33,0,
+        0,11,0,-8,59,-9,0,-5,13,0,71,0,0,-2,-21,-1,36,0,0,0,
+        -13,-38,0,-16,0,22,0,0,0,0,0,0,-29,0,56,0,0,21,-30,0,
+        2,-5,25,-30,0,0,0,0,0,0,-6,-42,-58,23,-19,71,-15,0,0,18,
+        0,36,0,0,0,0,0,0,0,-24,0,-13,0,0,-2,-30,0,-23,14,0,
+        -12,0,0,-12,14,39,-7,9,0,-13,51,17,-2,0,-3,-9,20,12,-4,27,
+        0,0,2,65,-22,6,0,-5,21,0,-27,21,6,-12,17,0,-8,17,22,-26,
+        17,7,-11,19,-3,0,-43,0,0,3,13,-8,29,0,-11,49,0,0,19,17,
+        18,-9,0,14,0,25,0,11,0,25,30,9,-5,29,0,-33,24,48,-11,-1,
+        14,-12,0,0,0,40,21,-14,35,24,1,0,24,0,34,-3,-48,-13,27,-37,
+        0,-9,0,0,31,-12,7,-4,-3,0,0,0,20,8,-23,40,36,-5,22,9,
+        -11,22,-10,-30,-4,6,7,0,0,0,0,69,-26,34,-7,-61,0,0,0,0,
+        50,2,0,0,28,0,0,0,0,0,-47,22,33,0,0,26,0,52,10,-43,
+        27,25,-15,28,0,-38,-6,25,-12,26,-38,5,40,10,-33,27,0,-26,33,18,
+        -6,28,-4,12,21,70,-24,11,2,11,41,17,0,0,-6,-14,-5,7,0,17,
+        5,-4,36,19,-30,12,37,-8,0,0,0,-9,21,-15,-36,-1,-15,26,0,5,
+        24,41,11,0,0,-22,0,-12,6,40,0,-76,31,23,-6,0,13,0,12,13,
+        -20,3,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,2,
+        0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,5,0,0,
+        -1,9,0,0,0,0,3,0,0,0,0,0,0,0,0,5,0,0,0,0,
+        0,0,0,0,5,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,5,
+        0,-12,-4,18,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,
+        1,15,0,0,0,0,0,0,0,-3,-40,0,0,0,0,0,0,0,7,-25,
+        0,-17,32,0,0,0,0,-9,0,0,0,0,0,0,0,0,-6,7,0,0,
+        0,0,0,0,0,-34,-30,0,0,0,0,0,0,0,-1,-29,0,0,0,0,
+        13,25,-42,6,0,-6,0,0,0,0,0,0,-6,0,-86,0,0,0,0,0,
+        0,8,0,2,0,0,0,0,0,0,10,0,12,0,0,0,0,0,0,23,
+        0,0,13,0,-9,0,0,0,11,0,0,0,0,0,0,0,0,7,0,-7,
+        0,0,0,0,0,0,-9,0,15,0,0,0,0,0,0,-4,0,11,0,0,
+        0,-2,0,-22,-13,9,0,-13,0,-24,0,29,0,-27,41,-47,0,20,0,0,
+        0,0,-16,23,0,-27,19,0,0,13,10,-17,24,0,-29,0,0,0,55,0,
+        -38,7,-25,-53,17,-2,0,0,0,-36,-8,0,0,0,0,0,0,0,-10,6,
+        0,-80,0,0,0,18,0,-28,-22,-3,0,4,19,0,0,0,0,4,0,-4,
+        -3,-25,-10,17,-22,-23,7,0,18,44,0,0,14,0,16,-18,0,22,23,0,
+        0,0,0,-38,20,0,-35,33,0,0,14,0,-21,-1,0,0,0,0,0,0,
+        0,-9,-8,0,0,7,0,0,0,0,-14,0,0,0,0,0,0,33,0,-10,
+        8,0,-51,10,0,0,9,0,0,18,-16,0,12,0,0,0,0,8,15,0,
+        0,-2,15,-17,11,3,-11,33,-15,-30,0,-44,0,1,0,-29,0,-67,0,53,
+        0,0,0,0,-41,42,0,0,0,-17,0,32,-37,22,0,-3,0,0,32,0,
+        0,0,-10,0,-35,19,-29,0,0,0,0,-13,-15,0,0,0,0,0,0,0,
+        -8,16,-14,0,0,-24,0,8,0,-43,46,0,0,0,0,0,0,0,5,6,
+        -2,0,0,-8,-11,0,-33,15,0,-3,0,0,-7,15,15,0,27,0,6,0,
+        36,0,0,0,33,20,31,-1,25,0,0,0,0,-1,15,0,-1,0,0,-1,
+        -25,50,0,4,0,-21,-5,30,-19,0,-39,1,1,0,-2,0,0,0,0,6,
+        2,19,0,-3,0,0,-40,12,14,0,15,0,-15,0,17,0,0,0,0,20,
+        39,0,0,0,-11,-15,54,1,16,17,-7,0,0,4,30,42,0,0,0,-34,
+        0,-19,0,0,7,0,22,58,4,0,0,0,-7,44,56,102,10,26,0,0,
+        0,-111,0,0,-11,0,-25,-35,36,0,0,-28,0,-1,0,-29,0,0,0,0,
+        0,0,11,-11,-5,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,
+        29,30,19,0,0,0,-44,8,-34,38,0,-4,0,0,-24,28,32,2,0,0,
+        -15,0,-27,35,0,0,0,51,44,-40,0,0,0,-3,33,-14,2,0,12,0,
+        0,13,0,0,0,-43,0,38,-3,0,0,0,0,-36,0,6,-12,0,0,0,
+        0,0,0,12,0,-23,0,0,-20,13,0,-19,0,0,9,0,0,0,0,0,
+        0,34,0,13,0,0,-7,46,0,-22,0,0,0,-8,0,0,0,0,0,2,
+        0,0,-2,9,0,40,0,0,-1,0,0,-5,0,0,0,0,-6,2,0,0,
+        -3,0,0,-6,0,0,-4,0,0,0,13,0,21,0,0,9,0,0,-45,0,
+        0,62,0,-35,4,0,0,-15,0,0,0,0,0,-1,0,0,-14,23,0,31,
+        0,0,-10,0,0,-44,0,0,5,0,-19,-8,17,0,6,-12,0,0,0,0,
+        2,5,0,19,32,0,48,0,0,-7,19,0,-28,17,0,0,0,-11,8,30,
+        0,-15,0,0,7,0,0,-12,0,0,1,16,0,0,-19,0,-9,0,0,0,
+        0,0,0,0,0,0,-15,0,-21,-3,0,0,0,0,-8,-23,0,11,25,0,
+        82,0,0,-6,-15,0,-29,0,0,1,12,-15,2,0,-14,20,0,-24,0,0,
+        0,-3,0,-1,8,13,0,-16,0,-35,1,0,25,12,0,0,0,0,-13,-1,
+        0,-23,-40,0,23,0,0,0,-3,0,-68,14,13,0,33,0,0,-27,0,-29,
+        0,0,0,0,0,0,7,0,-24,-15,0,-18,0,0,0,-6,0,-9,-46,0,
+        53,-19,0,0,-15,0,-10,-7,0,7,4,0,-20,-15,10,0,-11,7,-23,0,
+        6,0,-21,-4,-15,-6,23,0,0,0,0,-4,9,0,3,3,0,-34,2,-24,
+        -27,9,0,-13,-23,-52,-47,2,0,-33,-3,-24,-33,11,-49,0,0,0,-12,14,
+        0,-47,-2,0,0,0,1,-6,4,0,-25,18,3,14,40,0,-24,-4,-6,-8,
+        10,-13,54,0,0,-20,4,0,-17,19,-4,-18,33,-18,-30,16,-25,19,12,-32,
+        0,54,-31,-32,5,-29,-28,22,0,0,4,-4,-24,-5,32,-38,32,-2,-52,33,
+        -10,96,12,-1,-33,-9,-47,-23,-28,0,20,1,-9,-10,17,-20,0,0,-21,0,
+        0,0,0,68,0,-23,0,0,-30,-15,18,-9,15,0,-56,-7,-23,-25,3,-31,
+        4,17,-7,0,0,0,-10,4,-17,0,30,-22,-5,5,-9,0,9,-19,-45,14,
+        -6,-33,0,46,-18,23,-41,0,30,-59,0,0,10,-34,3,-23,-3,56,-10,0,
+        0,-15,54,-7,-28,0,0,-40,0,0,0,-51,-3,-39,-59,32,7,0,0,-22,
+        0,0,0,0,48,0,0,0,-6,-9,-1,12,-18,47,-24,0,0,0,-13,18,
+        39,0,30,-58,0,0,0,-14,7,-53,-36,11,7,-27,44,-12,15,0,-14,12,
+        0,-15,16,0,-40,23,0,-16,17,31,27,46,0,-15,14,0,-19,0,2,-10,
+        0,40,-16,0,0,-17,-6,0,-17,1,0,-20,4,0,-9,12,15,-17,-26,11,
+        -37,-5,0,-10,0,0,0,22,-7,4,12,0,-1,53,0,-7,0,0,0,12,
+        0,-17,-30,25,-17,13,0,28,6,32,-22,0,17,4,40,-12,-9,0,0,-16,
+        0,-2,-73,0,49,-23,13,-57,-39,27,17,0,16,-4,0,0,-4,-12,0,15,
+        -1,0,-15,-62,26,-22,22,0,-25,0,12,9,-69,11,13,0,22,27,-14,0,
+        2,0,41,0,-56,0,0,0,0,-3,0,-29,0,-16,0,34,0,0,0,0,
+        0,0,-11,0,6,0,0,0,0,13,29,-47,0,-15,2,0,14,-22,20,0,
+        -19,20,13,-28,0,4,-51,-1,0,-21,42,36,0,0,0,-4,11,27,12,0,
+        16,-47,0,0,-38,19,0,-20,-10,-36,-39,23,0,2,30,0,-10,21,31,-18,
+        27,15,-53,16,0,-39,0,0,0,0,0,-19,-2,0,-2,37,0,-18,17,0,
+        0,19,0,-38,0,33,0,0,0,-7,-19,-3,-30,0,0,3,47,10,-20,4,
+        0,0,0,0,0,10,0,0,5,0,0,0,18,0,22,0,0,5,0,0,
+        -10,0,0,29,0,9,-1,0,0,0,0,0,19,0,0,5,0,0,-5,10,
+        0,27,0,0,1,0,0,-38,0,0,45,0,-27,2,0,0,5,0,0,35,
+        0,0,2,0,0,-12,15,0,62,0,0,1,0,0,-17,0,0,0,0,-18,
+        -5,24,0,0,0,0,12,29,0,-20,23,0,0,-9,0,60,-23,0,-1,36,
+        0,-40,12,0,11,33,-21,-20,7,0,0,0,0,-1,5,0,-2,45,0,-3,
+        13,0,40,-10,0,-2,58,0,-34,16,0,55,-72,-24,0,13,0,25,8,0,
+        35,-6,0,7,42,0,-36,16,0,0,0,0,0,20,0,8,43,0,-1,30,
+        -1,7,0,-6,0,0,0,29,0,-34,-4,0,-23,0,-26,0,20,0,-14,13,
+        0,-1,4,0,0,34,0,-46,8,0,-12,0,0,0,12,0,-12,9,0,-5,
+        25,5,32,27,0,0,0,0,-19,-29,0,0,39,0,-3,6,0,-23,7,0,
+        0,39,0,23,2,0,-10,7,11,0,0,0,0,-6,0,-1,-14,0,0,6,
+        0,-14,-11,12,0,-64,36,0,-16,8,0,6,20,-29,0,-8,0,49,-29,-38,
+        -9,21,0,-18,9,-69,-2,0,-4,-9,4,0,-29,0,0,40,19,0,-39,-9,
+        -18,-22,-1,0,0,-12,0,-20,19,0,8,-35,0,50,15,-40,-11,14,0,-8,
+        16,0,36,21,0,-19,17,0,-34,21,-49,0,0,0,2,21,0,-27,3,10,
+        -22,16,-15,-23,15,0,-35,-3,0,-18,16,-19,6,49,-32,0,30,0,0,29,
+        0,-1,26,-6,-1,25,-13,-52,29,0,6,10,0,-57,20,0,50,11,-6,-16,
+        10,-6,-41,18,0,0,0,0,21,17,0,0,24,0,0,24,-42,-28,14,-22,
+        -17,27,0,-35,16,13,-12,36,-2,0,22,0,0,0,0,-12,19,15,-20,8,
+        14,-45,10,-15,0,25,-73,-62,23,0,-16,-7,0,0,47,-27,0,25,0,0,
+        3,-13,-30,15,96,-30,15,4,33,19,4,20,34,-14,-58,48,0,0,0,0,
+        -25,49,0,0,6,-26,0,0,0,-19,66,0,0,0,0,0,0,-7,-14,35,
+        -20,5,13,-28,0,-13,3,-32,20,0,0,14,-46,0,0,0,-18,45,4,0,
+        42,-9,-15,19,-13,19,0,-3,31,0,-23,19,5,-10,13,0,7,47,21,-19,
+        17,37,-29,24,16,3,22,0,65,18,1,2,7,0,-5,-51,0,-34,19,-16,
+        0,10,0,-23,10,13,-14,3,6,-12,10,0,-4,-47,0,0,8,1,-13,19,
+        0,-4,28,0,-2,16,17,2,3,0,-13,18,23,-13,25,0,-29,24,17,10,
+        -14,7,-20,9,18,-21,18,17,-3,31,13,-52,16,12,-31,12,36,-33,0,34,
+        0,0,13,-24,17,-14,4,0,9,0,26,15,-11,42,15,15,0,0,0,25,
+        22,23,0,36,8,29,13,-34,19,-7,-45,-5,1,-24,0,-4,0,0,20,-62,
+        11,24,6,20,17,0,0,12,0,-5,-32,-23,29,8,0,0,0,0,24,40,
+        9,0,11,12,13,1,-19,20,8,4,47,14,-36,19,22,-30,10,37,6,42,
+        10,-43,15,24,-40,23,30,8,-31,27,10,43,13,-10,41,17,-23,2,41,10,
+        39,-18,-26,11,17,25,-4,12,-19,25,8,-25,4,14,27,78,-13,0,-11,-57,
+        -33,26,18,-15,17,40,-28,47,29,12,2,17,-30,10,20,-9,8,0,-55,25,
+        24,20,0,6,-18,27,2,-33,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-28,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,-43,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-5,0,-7,-18,0,-2,5,0,-13,-7,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-17,0,0,0,
+        0,0,0,0,0,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-13,0,16,-40,0,
+        0,20,0,36,-15,3,-1,-14,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,54,0,0,4,0,0,-24,6,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,18,
+        0,0,0,0,37,-13,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,4,
+        0,0,0,0,0,0,0,10,0,0,-20,6,0,28,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,20,0,0,0,0,0,0,0,0,14,0,0,-34,15,0,6,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-19,0,0,0,0,0,0,0,0,-18,0,-21,-12,-9,-33,
+        -11,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-3,13,14,-1,-6,0,21,-19,-36,-2,
+        -1,-5,-13,8,-16,12,21,-12,3,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,
+        0,0,0,0,0,27,0,0,-4,0,0,0,0,0,23,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-23,0,34,32,0,0,0,0,0,-14,0,0,1,21,-23,-46,0,
+        -33,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-17,0,8,7,0,0,19,0,0,
+        -15,-64,-20,-10,-20,0,9,-51,0,-10,0,-9,-11,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        10,0,0,0,0,0,0,0,0,16,-8,0,-8,-6,0,15,0,0,11,-18,
+        0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-15,0,0,16,0,0,0,0,0,-15,
+        0,0,-22,0,0,-8,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,27,0,0,0,0,0,0,0,0,24,0,0,-20,2,0,12,0,33,16,
+        0,38,3,17,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,
+        0,0,24,0,0,37,-1,0,13,0,0,15,0,0,0,18,0,28,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-13,0,8,-24,0,0,-36,0,0,-10,0,-19,-5,-15,
+        -23,29,-4,-6,-4,0,-18,-5,1,0,27,0,-6,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,34,-38,-29,0,0,-6,0,-59,5,4,-12,-17,12,-20,15,14,-7,6,26,
+        -10,-6,16,-15,18,14,-10,5,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,
+        0,0,0,0,30,0,0,0,30,0,0,0,0,18,0,0,0,-48,0,0,
+        0,6,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-4,0,0,-1,0,0,0,0,0,
+        -7,0,0,0,0,0,-26,0,0,12,0,0,0,0,0,0,0,0,6,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,-3,0,0,
+        14,0,0,0,0,0,-2,0,0,0,64,0,-10,0,-17,-5,37,-8,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,15,0,0,0,0,0,0,0,-5,-10,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,39,0,0,0,0,0,0,0,0,15,-25,0,0,43,0,
+        0,0,-52,26,38,0,0,30,0,11,-6,-38,4,4,0,0,0,0,-47,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-74,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-6,-10,-11,-31,0,28,6,0,-28,
+        -3,5,-10,-16,3,-21,13,11,-13,0,19,-3,-16,9,-9,16,5,-6,3,-38,
+        -15,-17,42,0,1,36,-5,-3,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,
+        0,0,0,0,1,0,0,-23,8,0,12,0,0,6,0,0,-46,0,0,4,
+        0,5,24,0,0,0,0,0,-36,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -28,0,0,-34,0,0,0,0,0,-16,0,0,55,-15,0,0,0,-39,-25,0,
+        0,-35,0,0,-6,0,0,-21,0,0,0,0,0,0,0,0,-29,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-16,0,0,-6,0,0,0,0,0,-16,-2,8,-24,-25,
+        0,-6,-2,0,-16,32,-1,-41,15,-13,-1,8,21,-26,0,0,0,0,0,0,
+        0,0,-17,-31,-11,-19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,-7,0,0,0,19,
+        0,-4,6,0,0,-35,-7,0,-2,12,3,7,0,20,8,-30,0,-16,5,3,
+        11,0,-30,33,0,0,13,0,0,3,49,0,-35,-4,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-13,0,0,6,0,0,0,0,0,-22,0,0,-2,8,0,0,0,0,-2,
+        0,0,16,48,0,0,0,-13,-15,0,0,2,0,0,0,0,0,-15,0,0,
+        -38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,13,
+        0,0,-26,8,0,-9,-9,-8,15,35,33,-3,0,0,40,-15,-10,13,0,-8,
+        -7,0,0,0,0,0,10,-37,36,-2,13,0,11,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        3,0,0,0,0,0,0,0,0,22,0,0,19,23,0,0,0,0,7,0,
+        0,0,0,0,8,0,0,16,0,0,0,0,0,-12,0,0,8,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-16,0,54,0,0,0,-77,0,0,
+        -18,0,-11,-3,-20,-31,0,-46,-6,-9,0,0,-15,0,0,-35,-56,15,-7,0,
+        0,0,0,0,-12,0,0,-14,0,17,28,-5,-11,-16,0,-10,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-6,0,-34,-8,-9,-28,4,0,0,-1,8,-19,-16,6,-21,13,21,
+        -16,3,24,-10,-12,14,-21,16,20,-7,4,7,-56,-11,17,0,16,12,28,1,
+        15,-22,-23,9,-15,15,16,-15,5,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,
+        0,0,0,0,0,15,0,0,0,0,0,0,0,0,13,0,0,0,11,0,
+        -52,0,0,15,0,0,0,0,0,0,0,0,9,0,0,0,0,0,7,0,
+        0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-9,0,0,20,0,0,0,0,0,-14,
+        0,0,32,3,0,61,0,-34,-3,0,0,7,0,0,0,0,-46,-29,0,0,
+        0,0,0,0,0,0,-3,0,0,0,21,0,57,0,0,3,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-16,0,0,0,0,0,0,0,0,-13,-5,11,-21,-30,-31,
+        -10,20,-12,-14,0,-10,2,0,0,18,0,6,-11,29,-1,0,0,0,0,0,
+        0,-13,22,-21,-20,-30,-9,-5,18,-21,-12,9,40,-19,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,8,0,0,31,0,0,0,0,0,16,41,0,-11,-22,0,17,0,0,13,
+        0,0,0,-1,0,0,0,-6,16,0,0,55,0,0,0,0,0,13,-15,0,
+        -8,1,0,17,0,0,17,18,0,12,-9,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-20,0,
+        0,0,0,0,0,0,0,-24,0,0,29,0,0,-19,0,0,-15,0,0,5,
+        44,0,-1,0,-4,-18,0,0,0,0,0,0,0,0,-21,0,0,0,-23,0,
+        43,0,0,-14,0,0,-1,39,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,0,0,0,
+        0,0,-5,0,0,16,-35,2,1,12,15,19,-16,0,19,1,29,18,-2,-21,
+        25,0,22,12,-22,0,-22,-36,0,17,0,0,13,2,-1,3,2,-64,9,14,
+        4,15,-1,14,11,6,33,15,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,0,0,
+        0,0,0,0,21,0,0,13,-17,0,27,0,0,20,0,0,-23,16,0,27,
+        22,0,13,-30,0,0,-53,0,-19,0,0,18,31,0,-7,27,0,30,0,0,
+        13,23,0,0,40,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,29,-18,-37,0,
+        0,-54,0,0,-7,-9,0,-5,-2,-24,29,-11,10,-3,14,7,-18,14,-20,29,
+        -8,7,-10,0,0,-43,0,0,0,0,0,-9,-19,0,-13,10,2,23,0,12,
+        -4,0,11,-4,32,-3,21,-4,5,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-9,-26,0,-9,0,0,-14,3,-5,-16,-5,0,0,
+        0,0,-17,0,0,0,0,0,-6,0,-6,2,48,35,-7,15,0,0,0,0,
+        0,0,0,-15,0,0,0,0,0,0,0,0,-4,-27,-39,-11,1,-1,-4,-6,
+        -1,-6,2,0,0,46,0,0,-24,0,0,-3,0,15,0,0,-11,0,0,-24,
+        0,0,-1,0,22,-8,30,0,-10,0,3,-7,-18,9,-7,-13,-9,-9,-8,0,
+        -25,-6,0,-35,-10,0,0,-7,-17,1,-8,-15,-8,0,-9,8,0,0,-16,0,
+        -34,-6,24,6,-8,-10,-5,-5,0,-10,-7,0,-24,3,-36,0,-2,4,-1,-2,
+        -6,1,4,-7,0,-63,5,0,0,-2,0,0,2,12,0,-3,-18,-4,1,-24,
+        -5,0,-10,-13,0,0,-20,0,0,-7,5,0,-8,-2,10,8,-35,12,-2,-5,
+        -13,-4,42,-16,-1,22,-23,0,-1,7,1,2,1,6,12,2,5,-1,0,0,
+        -17,0,0,12,0,0,8,0,-22,5,-7,26,25,0,0,0,0,4,0,0,
+        22,0,0,28,0,0,-1,0,-7,1,32,0,10,0,-6,11,0,0,-8,0,
+        69,-8,0,-18,1,28,0,-6,-17,-20,-5,-10,-2,2,4,1,2,0,-1,-4,
+        -7,0,-25,8,0,0,-16,0,0,-4,5,4,-7,12,10,-4,42,-9,6,-13,
+        0,-6,-9,-6,39,0,35,0,0,14,0,0,-9,-2,41,-12,0,0,-14,9,
+        0,-3,0,7,10,0,0,-5,20,22,-11,13,-28,0,-47,7,-1,5,18,-1,
+        -4,-3,6,4,14,6,14,23,3,5,11,6,-3,0,0,33,0,0,-45,0,
+        0,0,0,0,-3,-7,8,3,0,-45,9,-11,51,1,31,0,7,0,-7,-13,
+        -53,-5,0,0,-12,0,0,-3,29,-8,0,-10,-33,7,31,-5,7,-48,22,5,
+        36,-42,7,13,2,9,2,0,29,0,0,2,-17,17,5,23,0,0,0,0,
+        -6,0,0,0,0,0,11,12,-5,-3,0,0,16,20,0,0,-39,0,0,0,
+        0,-2,0,0,-56,0,0,0,0,0,2,8,-6,2,42,-15,4,16,-27,-5,
+        -1,0,0,-22,0,0,-23,0,0,-18,0,6,0,0,-5,0,0,9,0,0,
+        0,0,0,3,-23,19,-2,19,38,10,40,-10,-6,-19,-17,-6,5,0,0,17,
+        0,0,4,0,0,-7,1,28,-6,-1,3,0,0,43,0,0,-6,0,0,-8,
+        -47,14,-5,-26,-6,8,-69,0,1,0,-14,5,33,0,-3,4,4,-2,-3,-4,
+        2,5,0,0,15,0,0,-18,0,0,0,-13,0,-5,36,0,-11,0,7,0,
+        0,14,0,0,-10,0,0,-6,0,2,-3,-24,-34,7,0,8,3,20,32,2,
+        -1,4,10,0,-2,-1,-6,-4,0,0,0,5,6,5,4,-13,0,0,10,0,
+        0,1,0,0,-16,0,18,-19,-10,-8,10,-40,-18,0,-25,-4,0,0,16,0,
+        0,-1,0,0,-4,0,0,-3,16,-15,10,5,2,5,0,0,4,34,41,-2,
+        0,28,4,65,0,-6,-5,-16,-7,-12,-3,-3,7,3,1,6,-1,-4,5,14,
+        0,16,0,0,9,0,0,-3,6,23,-13,15,42,-1,0,-5,6,0,-3,-10,
+        -20,10,50,0,15,0,0,-18,0,0,-12,0,0,0,-17,0,4,-25,-42,-2,
+        0,-23,-2,13,41,6,14,-34,5,25,31,9,-14,0,-3,-5,-6,-1,-1,3,
+        4,7,7,6,9,11,0,5,-1,7,6,39,-10,12,0,0,-15,0,0,-1,
+        15,-20,-3,4,0,-1,0,-21,4,8,-12,2,25,3,6,-30,7,16,0,6,
+        0,0,2,0,0,-4,-18,14,1,1,6,8,-18,-5,6,1,10,3,0,15,
+        10,2,2,0,-4,0,2,-35,49,-5,-8,-11,-8,-8,9,-63,1,2,-6,17,
+        35,-22,-8,20,4,15,5,1,4,15,7,6,0,41,-21,4,-5,19,-18,6,
+        17,31,-2,-7,-6,3,22,-4,-7,-7,-1,-10,-24,-2,1,-6,-1,-6,1,13,
+        -32,-3,24,0,-12,-34,-3,0,7,-6,-7,0,-6,-8,-77,-11,0,-24,-3,23,
+        -14,-6,2,-1,-12,-15,-17,0,3,3,-6,-4,-7,-8,-4,6,4,-12,-11,-13,
+        -6,5,-15,-6,-9,0,-8,-3,-5,-4,-16,-15,19,-13,3,22,-5,-5,-16,-7,
+        -6,-5,0,-1,-1,9,-2,2,-1,2,8,-2,-1,0,1,-2,-1,2,5,-5,
+        65,32,1,-16,-6,-1,71,-21,0,-12,8,-4,-1,1,6,4,-6,-11,15,-6,
+        -14,11,1,13,19,-1,-9,5,-1,-3,1,5,7,4,6,-1,6,-1,1,2,
+        10,4,22,0,4,4,-1,1,0,4,6,4,4,6,0,8,13,0,17,4,
+        31,25,-3,-15,4,-1,12,13,-1,18,16,3,0,-1,32,1,13,4,34,-5,
+        2,-5,-4,5,27,1,3,-1,4,-9,7,-1,-19,-13,1,-6,3,-3,1,-4,
+        0,-6,-2,-4,-6,0,-6,-5,-3,0,1,0,0,0,1,-6,5,-22,12,-3,
+        -9,0,3,-13,4,-4,-5,-10,-9,-5,-5,-1,-6,1,1,-8,5,-6,-4,5,
+        -32,-40,2,45,-46,2,-14,-9,-7,9,-20,-8,-9,15,-1,11,4,-1,6,0,
+        -8,-6,1,5,-3,0,0,-8,-3,10,20,14,0,-3,2,-1,0,2,6,7,
+        9,5,5,5,1,0,2,7,5,5,3,-7,8,-19,12,5,-43,-2,-8,-19,
+        -3,-3,0,4,-10,6,4,4,7,-3,-2,-1,5,-1,2,-9,-13,4,11,2,
+        8,11,-1,-2,-2,-8,-1,-2,1,5,7,6,4,-3,7,0,2,1,6,3,
+        3,-1,-20,87,18,3,-46,-17,-27,-19,-35,-23,-111,-84,-29,-69,3,-94,-42,-9,
+        -74,25,15,14,27,1,0,39,33,-7,26,68,-45,32,0,-1,-29,19,67,85,
+        3,20,-39,32,75,49,-17,-14,-3,-9,-34,-48,-20,-11,-15,-24,-15,-30,3,-29,
+        -27,-7,32,4,-20,-18,-3,7,-20,4,2,5,10,24,2,3,-1,-10,-12,-15,
+        27,15,-7,-18,0,-5,-11,-50,11,-7,32,13,9,50,13,52,3,-10,3,11,
+        -24,4,-22,15,-17,-31,-4,30,-15,-30,1,-32,16,17,11,-6,1,4,20,7,
+        12,-22,-9,27,8,15,-4,11,-11,21,-10,8,11,24,19,14,-1,-9,27,9,
+        1,6,-15,-12,-7,-22,-16,2,-3,-19,-1,1,0,-11,-15,-12,-26,14,5,13,
+        -1,-3,0,21,-4,10,-3,-1,26,-6,12,33,13,10,-8,-1,-3,-19,16,18,
+        -5
+    },
+    {
+        0,6,2,-6,0,-4,-13,-26,-14,-19,6,8,-10,-24,18,-11,-12,1,-9,0,
+        20,14,14,17,8,-22,-3,18,11,0,9,-2,-2,-5,10,-19,-5,8,-6,18,
+        1,3,12,0,-18,-4,3,-10,-25,-4,-15,15,13,-3,-1,1,10,2,-9,10,
+        27,10,-1,-5,-5,-19,-9,-1,-2,-32,-12,2,6,3,-17,-9,-9,-11,-17,-6,
+        2,-40,-8,-4,-3,30,5,-4,-23,-37,22,8,2,16,-5,1,39,-3,17,35,
+        3,10,-9,-10,-10,-17,4,8,7,14,-24,-14,-10,0,-13,15,12,-30,-24,-18,
+        13,16,4,0,1,13,-4,1,-7,24,4,2,28,-3,19,0,10,6,9,0,
+        10,6,2,0,12,8,-14,12,0,14,15,7,0,-11,-3,1,12,-24,0,-14,
+        -9,-2,-11,1,16,-41,2,-22,17,0,26,3,9,-4,-12,8,-7,23,15,2,
+        1,9,-13,-12,11,-21,17,11,-11,0,9,9,-1,3,24,8,27,-5,17,16,
+        -9,-1,26,8,-31,10,12,41,10,6,-4,0,-8,-5,25,1,6,-2,1,-11,
+        -3,7,-2,19,-3,2,13,12,2,10,18,-10,-17,-14,-15,7,-7,-10,-9,25,
+        -25,-26,-21,-5,-30,-3,-5,-9,-41,-17,15,-2,2,10,-5,3,33,18,18,-7,
+        -15,26,8,14,-27,-25,-10,0,0,-22,5,8,-20,-3,2,-36,-10,-12,-6,-6,
+        -1,-8,0,0,-7,-14,-17,0,-7,9,-3,23,0,3,-11,-10,7,-7,-19,0,
+        14,-2,0,14,2,21,26,16,18,14,8,-25,-8,4,-11,18,13,35,1,39,
+        23,-27,39,-18,-24,14,0,3,12,8,13,-7,18,0,15,0,2,7,4,12,
+        8,0,-2,12,10,-4,9,33,-15,20,11,-8,-13,-4,7,-7,-3,13,-38,3,
+        -12,-15,2,-6,6,-15,-12,-17,-6,-7,8,-9,11,-21,-15,0,14,4,-4,-2,
+        -10,-9,13,-16,17,4,-11,-13,-11,-16,-36,-7,-22,11,-19,-23,1,9,-2,8,
+        27,-13,3,19,-11,-9,3,-31,-10,3,7,-24,9,10,-8,-13,-18,-23,-24,-18,
+        0,-3,-16,-31,13,18,-3,22,11,9,11,-7,-16,3,-8,-8,-9,-7,2,-6,
+        -4,1,0,-6,-18,-15,-7,-37,-6,-10,-8,1,-28,-6,-4,18,6,0,37,3,
+        2,-4,-12,3,-1,-22,-38,-22,-41,0,0,42,29,-29,-30,-39,-26,-39,0,-10,
+        -13,0,-32,-14,-15,-20,0,0,-26,45,-14,44,-26,-10,0,0,-3,13,0,-32,
+        0,0,-38,32,0,-7,0,0,0,0,0,14,0,0,24,0,0,-5,0,0,
+        0,0,10,-11,-4,25,0,0,-15,-6,-7,-31,0,1,2,0,0,-20,0,-28,
+        0,-19,0,-6,-31,-24,-17,0,19,0,0,-4,-10,0,5,-27,0,-27,0,0,
+        0,8,17,16,-1,-29,-21,34,7,-11,6,2,-13,-43,23,-2,25,-6,-34,9,
+        -6,10,8,33,38,-1,22,5,13,28,5,12,24,0,11,16,11,-1,3,21,
+        0,0,3,0,3,4,25,0,-7,0,11,0,0,25,-9,13,-9,0,0,59,
+        -5,3,23,9,34,0,-7,0,13,0,-10,-19,-3,-12,11,0,-8,17,1,-16,
+        -44,33,62,31,0,-9,-22,0,-11,-38,41,0,-23,32,-19,-8,-5,-6,-1,-8,
+        0,0,0,6,0,-5,-8,-7,-10,-2,11,-14,9,4,-8,-19,-34,-16,4,-19,
+        -15,2,-20,-34,-2,6,-16,11,30,0,6,45,-16,-3,5,-12,-22,-5,-17,8,
+        22,-11,1,-10,-12,0,-13,-3,28,-4,-14,-27,-29,-21,-21,0,0,0,24,-39,
+        -21,2,-13,21,-13,0,48,11,15,23,-4,-3,-10,-37,-2,-28,10,13,-6,-5,
+        -9,-14,-25,9,-28,-1,11,22,27,-1,-18,0,0,0,37,0,15,0,0,-11,
+        -2,-6,6,0,0,-12,-5,-14,-11,0,-3,-18,9,-25,-10,29,-5,-14,-6,0,
+        -11,-11,-16,-4,5,-23,9,-4,-17,-36,-20,-33,-43,-23,-52,-11,-67,-46,-11,11,
+        -19,24,23,0,-4,27,-15,-8,3,-18,-21,-19,-24,-5,21,-19,-1,-14,-19,7,
+        8,-12,6,26,-4,-23,10,-9,0,-10,-1,-8,30,-18,22,12,-12,-1,18,4,
+        18,37,22,47,23,26,14,10,-3,7,-4,-10,2,20,3,16,13,6,19,11,
+        4,-17,-20,-9,-18,-16,18,-7,-20,11,-32,-19,-9,0,45,-13,5,0,0,-16,
+        1,-7,-12,-1,0,-35,-5,2,-17,-19,-7,0,-23,-1,9,25,5,-19,-20,4,
+        -28,17,27,11,10,24,4,32,-5,13,-4,31,5,-5,40,-5,-16,0,-8,12,
+        54,14,16,18,32,22,8,22,37,0,9,7,10,16,-13,0,22,13,-11,16,
+        14,25,20,9,29,31,3,-11,10,18,15,-5,15,-12,33,-26,-26,-16,0,-22,
+        0,-16,0,0,16,7,-19,-11,0,0,21,0,10,5,3,5,-12,-18,-18,25,
+        19,16,3,-27,-9,-34,4,19,21,0,-17,-27,-13,-26,-16,15,4,-1,-19,-28,
+        -18,0,0,2,0,-10,0,-15,-18,-7,2,-6,30,-9,-37,0,-50,-13,-6,0,
+        7,-25,0,-31,27,20,-19,-12,1,-25,16,37,21,16,30,1,-2,-11,7,15,
+        -13,14,17,-14,-10,-10,-21,-19,0,-28,12,-1,-25,5,11,0,-16,16,16,11,
+        14,-15,1,16,-5,-16,-4,-40,9,30,-17,4,1,-9,2,20,10,22,4,20,
+        4,18,10,21,38,4,0,-26,22,24,7,0,-17,0,13,0,0,0,0,21,
+        7,29,0,0,30,2,0,15,9,-2,9,-11,0,0,16,31,7,16,5,-2,
+        10,3,21,7,-6,18,11,17,-3,-19,4,-14,-35,-10,29,6,5,-17,-20,15,
+        2,-15,34,10,0,0,-7,23,0,4,0,0,16,43,-14,-4,-15,1,31,-16,
+        -19,1,34,20,-8,-14,15,-29,25,27,3,20,78,16,11,14,-23,-9,-24,-24,
+        0,-30,-28,31,-36,-29,-25,-32,-29,0,0,0,0,0,-7,16,33,-1,0,5,
+        -5,0,-34,-29,-20,-31,-20,0,0,1,0,0,-32,-47,16,-42,-12,-11,0,0,
+        0,-15,10,31,0,8,0,12,7,0,14,2,0,0,-18,0,0,0,0,0,
+        0,0,0,11,0,-6,-3,0,0,-17,0,-8,4,-21,26,-19,0,-30,6,0,
+        44,-13,-5,-7,-35,-16,-1,0,0,12,14,29,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,10,-3,13,36,-34,15,56,28,12,7,2,8,0,17,
+        0,10,-43,12,33,-14,23,12,0,24,52,19,26,18,19,26,2,45,0,15,
+        14,31,13,4,-22,13,21,33,31,32,27,33,0,40,0,-26,0,11,12,-1,
+        -3,-5,10,-13,-3,-15,-19,-18,-38,-59,-48,-9,0,-4,0,-50,8,0,-21,0,
+        0,0,-15,15,-42,0,-11,27,-16,0,-10,-4,18,-25,2,-28,-7,-27,-5,12,
+        2,-6,24,0,-7,16,-29,0,0,16,-7,-13,-16,-1,-10,-17,-18,-6,14,-18,
+        -21,-46,-7,-45,16,-24,4,0,0,-15,-17,-5,3,19,13,-6,0,24,-17,-37,
+        13,-32,16,-29,-2,3,5,-21,-13,2,-31,12,30,26,0,9,0,5,17,0,
+        0,0,19,-14,26,3,10,1,-15,11,-8,7,15,-14,0,4,-12,-3,15,-19,
+        12,8,-17,12,15,10,-14,18,19,36,26,6,1,11,-3,-13,-12,-23,14,22,
+        -1,5,2,-6,-4,15,-2,18,9,4,3,18,-1,0,0,0,28,1,-7,8,
+        7,8,5,7,5,-8,-4,2,7,9,-1,6,2,18,8,-10,-28,-7,18,9,
+        22,3,29,0,22,1,5,1,-4,2,-21,4,0,18,-28,-6,4,1,-11,-27,
+        -2,6,15,-2,22,10,18,0,0,0,0,26,4,5,12,-3,-5,10,22,0,
+        -3,-16,-3,18,-10,-12,5,-14,-13,7,10,54,4,-6,9,24,23,-5,35,9,
+        25,24,11,-12,-2,0,-12,-15,-24,-16,-6,23,-15,1,-5,-27,5,1,28,0,
+        13,-4,24,20,0,0,0,28,-11,26,-5,0,2,-8,-19,-16,-3,9,-37,0,
+        23,47,-11,-12,-2,0,-8,-4,12,-15,-6,-2,1,-7,-24,40,8,31,18,-17,
+        1,20,-15,11,0,0,-5,-15,18,7,27,-7,8,18,-3,11,-15,17,-5,10,
+        3,0,0,0,0,0,-20,-12,8,-32,-16,10,6,22,0,0,-23,17,-23,-9,
+        8,-45,59,16,0,5,40,-35,17,14,-35,36,13,0,16,-47,0,-31,16,-20,
+        1,0,19,0,-65,2,32,20,14,0,20,3,29,6,0,24,37,0,0,0,
+        0,0,-11,0,32,10,23,17,17,0,-14,0,-12,11,0,27,4,20,-13,-23,
+        -21,1,-28,0,0,4,0,0,4,5,0,-13,0,0,0,0,0,-7,0,-5,
+        -18,0,0,-1,0,0,-8,-3,0,-26,0,0,0,0,0,29,0,0,0,0,
+        0,0,8,0,-26,-39,5,0,0,0,21,25,31,40,22,-12,38,24,11,8,
+        -5,0,-23,-30,13,4,23,0,19,30,35,8,46,0,53,12,0,10,17,6,
+        0,-13,0,11,42,0,8,27,27,-27,16,20,7,0,48,-3,33,89,0,0,
+        0,28,0,21,26,51,14,-8,6,0,19,13,16,10,43,-13,0,21,-7,6,
+        16,-27,2,25,-13,0,0,-12,-8,23,25,29,-10,17,41,22,9,26,26,17,
+        23,0,0,-14,0,0,0,27,8,18,5,8,37,12,0,5,17,35,31,0,
+        0,0,20,-10,-3,26,21,22,2,0,0,0,63,0,9,-22,16,0,-34,17,
+        0,0,-19,-17,0,0,6,0,50,0,0,8,0,0,-21,0,0,0,0,-24,
+        3,12,-8,0,-4,0,0,0,-12,-1,13,0,-29,10,0,-20,0,25,35,0,
+        0,0,0,0,-3,0,0,14,-19,22,-8,0,0,18,0,0,1,15,-1,-16,
+        5,-20,8,8,-17,7,5,-8,14,25,-23,15,10,-10,5,13,3,-15,27,-2,
+        15,28,-3,-6,1,-15,6,-29,-21,11,15,-7,-4,-15,-12,-43,2,-1,8,0,
+        -15,0,0,0,0,0,0,0,0,0,1,1,-18,3,21,-18,12,32,-6,-8,
+        1,16,7,-34,-14,-34,17,25,29,14,12,-22,-7,16,0,0,-19,-22,15,-25,
+        19,-2,0,0,0,0,2,-1,-31,9,-55,0,-33,-20,-2,16,-18,0,-1,-55,
+        -17,-58,-28,0,0,0,0,0,0,0,0,0,0,0,0,-10,17,-8,14,-9,
+        -23,7,5,-16,5,-9,-13,-5,6,-12,-21,6,18,-15,-7,46,7,4,0,-51,
+        -3,-45,-14,3,30,30,13,0,0,52,13,4,-12,-6,-16,0,0,0,29,-1,
+        29,-15,-41,15,-19,-10,0,26,0,35,0,0,0,0,0,0,0,0,0,-6,
+        -14,1,4,14,-26,7,8,10,-9,-22,5,-1,9,-1,-49,-28,-24,1,-15,34,
+        8,-32,-3,30,30,0,0,-23,0,-14,-17,22,0,-17,40,0,39,-19,-34,-22,
+        -38,-36,-6,-18,-4,0,-16,-19,-21,-35,-31,-25,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-2,-45,-8,21,40,-8,0,30,-40,-39,-44,-6,-27,12,-2,
+        3,-1,33,-3,4,20,23,22,11,24,7,-7,-4,-7,10,-10,22,2,38,23,
+        34,6,46,22,1,5,-26,-5,0,24,-1,25,0,-2,-4,-38,-5,-35,-7,40,
+        7,0,44,0,0,0,0,0,0,0,0,0,15,-15,34,9,-2,23,27,17,
+        13,-2,15,23,-14,-39,-15,4,6,-2,4,14,1,20,0,-6,35,-3,9,0,
+        0,0,-1,14,19,57,42,4,47,0,40,0,7,-6,1,-2,0,0,0,15,
+        21,12,8,15,-1,-11,8,0,31,0,35,0,0,0,0,0,0,0,0,0,
+        -4,-30,7,6,48,0,27,15,24,-3,-10,6,-22,9,6,20,24,6,0,25,
+        -17,13,14,-1,10,0,-6,-4,32,0,0,0,0,16,19,23,30,27,0,23,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,26,7,-13,-11,0,0,19,59,6,8,-40,
+        8,26,0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,-15,7,-1,
+        0,0,-6,-15,0,-8,0,20,11,13,0,0,12,0,22,0,0,-7,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-12,-35,0,-18,0,0,12,30,0,-14,
+        0,-45,23,16,0,0,0,0,7,10,5,-13,5,-13,1,15,-14,2,19,-13,
+        -7,22,-42,29,5,-26,17,9,27,-4,28,19,4,26,17,-2,14,-6,-8,-4,
+        -27,7,26,2,1,8,-4,0,17,5,22,1,13,2,28,14,0,0,0,14,
+        -8,-1,2,11,-8,-10,12,-21,27,20,12,4,4,-8,-4,18,-4,29,0,10,
+        -2,15,27,23,-21,-16,-34,34,-23,-2,15,6,6,14,26,12,11,-4,23,19,
+        0,45,-28,0,0,7,0,5,14,11,14,-40,0,0,1,20,-28,6,-3,10,
+        11,-4,34,27,-7,25,17,0,8,0,0,0,18,-10,13,11,12,-2,14,12,
+        -42,16,17,0,11,-30,34,25,-7,9,-22,0,10,13,-7,6,13,12,-22,22,
+        -3,5,-24,-1,0,-51,-1,-16,-2,-18,2,-35,0,28,11,23,-6,30,0,0,
+        21,1,-5,1,-2,-14,-28,-6,-27,5,-11,-16,0,0,-33,18,35,45,21,18,
+        9,69,20,0,0,0,-15,-8,28,2,6,-1,-11,15,2,37,21,4,-7,11,
+        10,-16,11,19,42,0,15,2,9,14,-5,1,-9,-33,0,-11,1,-9,-39,11,
+        -11,0,23,23,-7,0,-18,-24,-13,-47,1,-1,51,0,0,-28,14,-25,-30,-23,
+        -8,0,0,-9,0,-8,-29,-41,-29,-33,-9,24,1,-13,32,-14,-34,29,0,0,
+        0,-21,-20,-26,-3,-18,-10,21,0,-15,-19,0,9,-29,-37,-17,-34,-30,-4,-14,
+        0,0,0,16,-19,-44,15,3,16,-7,4,0,18,0,16,22,-18,27,29,45,
+        0,19,-14,-19,25,23,30,30,16,0,25,0,26,-9,-8,-28,-57,-29,-6,-19,
+        0,-22,-16,-15,-23,-36,-17,-13,-40,-9,-6,9,-17,0,0,0,0,27,-40,-44,
+        12,-8,1,31,0,0,1,0,28,-25,-62,-20,-33,-7,-16,0,0,-25,17,-4,
+        12,-28,-36,-6,-16,1,-4,-37,1,-37,-2,-8,-19,8,-9,6,15,0,41,0,
+        0,17,5,26,7,0,0,0,31,35,-7,-16,-4,0,0,0,14,0,18,-3,
+        -36,15,-37,-3,0,5,0,0,0,0,0,0,0,0,0,0,0,-8,-8,-3,
+        -14,26,23,29,15,-14,-8,-17,13,-38,-25,-3,0,0,0,-5,16,20,-30,-22,
+        0,10,17,15,-7,19,-4,-1,21,-10,10,17,-12,3,16,-9,28,29,-13,42,
+        36,31,0,46,50,56,44,32,17,23,21,19,22,23,58,8,19,22,36,30,
+        21,22,39,27,34,42,37,7,40,0,0,0,32,23,32,7,19,-6,1,18,
+        -21,31,32,30,20,27,40,26,27,24,35,0,37,0,18,22,29,26,34,-7,
+        16,5,10,6,-8,9,20,-22,18,25,7,15,46,4,6,11,14,-8,29,7,
+        11,-13,22,0,9,23,-14,-1,-8,-11,-33,0,-27,-4,0,-14,-9,-40,-24,-48,
+        -21,-4,-36,0,8,-4,0,44,0,0,0,-2,0,-49,17,3,17,19,-1,25,
+        10,1,30,-15,-16,-21,-32,-32,-17,11,0,1,20,3,19,-36,-39,-20,29,-32,
+        -8,-5,4,-8,-5,-1,-23,19,0,-13,-15,-9,-23,-9,-30,-5,-37,-17,9,9,
+        3,-11,6,20,-15,-21,19,-16,-7,2,-13,2,-8,-5,48,-9,-19,-16,4,-24,
+        1,22,4,24,16,-5,10,26,0,0,0,19,-10,8,-10,-8,2,-15,-11,-4,
+        11,3,10,-23,-24,-5,-24,-13,2,9,0,12,-14,-16,-7,-16,-18,-8,-13,-18,
+        -4,0,0,0,0,0,0,0,0,0,-20,-2,0,0,12,0,0,0,0,0,
+        0,0,0,0,0,-1,-2,0,16,0,0,0,0,0,0,0,0,1,0,0,
+        1,6,0,-5,0,0,-2,0,0,-4,-2,0,-4,0,4,-8,2,0,0,10,
+        14,0,2,0,-20,-8,-77,0,0,0,0,0,0,0,0,0,49,-43,0,-2,
+        0,0,8,3,0,6,0,13,-3,-38,27,18,-9,0,0,9,-30,0,-10,0,
+        -38,-14,21,9,10,-30,0,0,0,0,0,0,0,0,0,35,0,0,0,0,
+        0,-2,0,0,-9,0,0,5,0,-7,-8,-34,0,3,-22,0,-5,-21,0,0,
+        3,-48,0,30,0,-20,-19,-14,0,0,0,0,-35,0,-2,0,0,0,0,0,
+        -52,0,0,-6,0,0,0,0,0,-28,0,0,4,0,0,3,-6,0,5,0,
+        9,1,-26,0,7,3,0,7,-36,11,8,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-35,0,0,0,0,1,18,0,2,0,-20,
+        19,29,45,4,40,25,6,-8,0,5,41,58,2,0,0,-11,-12,0,6,0,
+        5,-4,-7,0,10,22,0,-2,-50,11,9,0,33,3,1,0,0,40,0,0,
+        26,0,0,-15,37,0,0,31,0,-4,0,0,3,0,0,16,0,20,0,0,
+        -15,0,0,-7,0,15,29,19,0,-14,0,0,39,0,0,26,0,-26,37,0,
+        0,1,0,0,-4,-20,0,-4,0,4,-4,-6,0,-1,18,0,-18,0,0,3,
+        13,32,-8,41,0,-8,0,0,0,0,0,0,0,0,0,0,-44,0,0,0,
+        0,0,0,0,-33,0,0,0,0,0,0,0,9,0,0,3,37,0,-11,0,
+        26,0,-29,0,-11,11,0,17,0,-20,14,-1,-15,17,0,-20,-5,0,21,0,
+        0,0,0,0,0,0,0,0,0,-2,0,0,-4,0,0,0,0,0,0,0,
+        0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-22,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,14,
+        0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+        0,0,0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,14,0,0,0,0,0,0,0,0,20,0,0,-62,0,0,6,0,
+        0,32,3,0,-24,0,0,21,0,0,10,0,34,2,26,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,0,0,
+        0,0,0,-5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+        0,0,0,15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,0,-10,
+        0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-21,0,0,2,-18,0,26,0,-3,-17,
+        -26,0,-19,0,0,5,-7,0,0,0,0,0,0,0,0,0,16,0,0,0,
+        0,0,0,0,0,-18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,18,0,0,0,0,0,0,0,0,19,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,-22,0,
+        0,-6,0,-21,0,-9,-1,-44,0,10,0,0,-22,0,16,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -13,0,0,-14,25,0,29,0,0,-15,0,18,0,0,0,0,0,-6,0,-46,
+        -13,39,0,0,0,0,0,13,0,-45,0,33,-5,17,-72,0,4,-57,0,9,
+        0,10,-6,-2,0,38,-36,7,0,2,0,0,0,0,0,-14,0,13,0,0,
+        0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,-4,-2,0,21,-34,
+        0,0,0,0,-13,-25,-40,-6,-96,0,-46,0,2,0,0,0,0,0,0,0,
+        -7,-12,-12,0,0,0,0,0,-13,-12,0,0,-17,0,0,-14,0,-19,-8,0,
+        0,-25,0,0,0,0,0,0,0,0,0,0,0,0,0,-21,-9,0,-12,4,
+        0,-21,0,4,-18,0,0,0,0,0,0,0,0,0,-6,-23,-39,0,0,0,
+        27,0,7,20,0,-4,51,0,0,18,0,-54,0,0,-43,11,0,60,0,0,
+        47,0,0,30,0,0,0,0,0,-4,0,0,0,0,0,0,-13,0,-61,-22,
+        0,-15,0,0,9,0,0,48,0,0,0,0,0,0,0,0,0,-24,0,0,
+        0,0,0,-30,0,0,-27,0,0,0,0,18,7,0,1,0,0,27,0,0,
+        12,18,0,15,0,0,0,0,0,16,20,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,28,0,0,0,0,0,0,0,0,-28,0,0,13,0,0,0,
+        0,0,0,0,0,0,0,0,0,-16,0,0,0,0,0,0,0,0,0,2,
+        0,0,0,0,-3,0,-17,-1,0,-23,0,0,-22,22,0,-14,-43,0,53,0,
+        0,0,0,0,-4,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,8,0,0,0,0,0,-4,0,0,6,9,13,0,1,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,
+        0,0,0,0,0,0,-2,23,0,0,24,0,0,0,0,0,0,0,-1,1,
+        0,0,0,0,-24,-2,0,8,8,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-3,-4,0,0,-18,0,0,0,19,-13,-19,-16,0,0,0,-54,
+        0,-51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-13,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-11,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-13,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,2,-18,0,0,0,0,0,0,0,0,
+        11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-3,3,0,-56,71,0,0,0,0,0,-23,0,0,0,0,0,0,
+        0,0,0,0,-13,0,0,0,0,0,0,0,0,0,0,0,23,0,0,0,
+        13,0,0,31,0,0,20,0,-17,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,-8,24,0,2,0,
+        0,-4,0,0,-52,-4,0,-8,51,0,0,0,0,0,-18,0,0,0,0,0,
+        -9,0,0,0,0,0,0,0,-15,0,0,0,0,0,8,0,0,-3,0,0,
+        11,0,0,-16,0,0,14,0,-20,21,22,2,4,10,31,0,0,27,16,-5,
+        0,0,-8,55,0,0,0,0,0,0,23,0,0,10,0,0,45,0,6,0,
+        0,-17,0,0,3,0,0,0,15,-16,30,0,26,-2,22,-14,0,32,-22,28,
+        7,0,-3,4,0,-4,-17,0,38,10,-45,-29,0,0,0,46,0,29,13,46,
+        26,14,11,0,4,-4,0,8,-7,0,17,20,0,-5,0,0,0,0,0,0,
+        19,0,11,0,0,0,0,-5,0,0,0,0,0,0,31,0,0,0,0,0,
+        -16,0,0,6,22,13,31,0,-9,-24,0,32,-24,0,0,-3,0,42,-1,-65,
+        -12,17,-48,0,23,0,0,4,0,-30,8,0,0,-38,-42,0,0,0,0,0,
+        0,0,0,-36,0,0,0,0,0,0,0,54,-20,0,-48,0,0,0,0,0,
+        26,0,3,0,0,0,-2,0,0,-4,-6,0,0,0,0,18,0,0,0,-11,
+        10,74,36,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-3,0,0,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        9,0,5,0,8,-1,0,0,15,7,0,4,0,-13,2,9,0,0,20,14,
+        12,41,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-8,0,
+        -16,-15,0,0,-2,0,-38,14,0,0,0,0,0,-12,0,-19,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,0,
+        0,0,-11,0,0,-18,-33,-4,-38,0,0,-33,0,-7,-15,7,-10,0,3,-9,
+        -26,1,7,-2,0,0,0,0,0,-5,0,0,-1,-5,0,0,4,-8,0,0,
+        0,0,0,0,-1,0,0,2,-4,0,1,0,0,0,0,0,0,0,0,1,
+        0,0,11,-14,0,1,0,-6,-3,0,0,-5,-8,0,-2,0,-2,-3,-9,0,
+        0,-11,-9,0,-8,0,-8,-11,-11,0,0,0,0,0,0,0,0,0,-7,-33,
+        0,-5,0,0,-8,-12,0,-7,0,-10,-6,-11,-1,-5,-9,0,0,-18,18,0,
+        -6,0,12,-6,-15,5,-6,-9,17,0,0,-7,40,0,-7,0,0,13,31,14,
+        2,17,0,-2,0,0,-11,-1,0,-2,0,-44,-6,-7,-3,-5,-11,31,-7,-14,
+        0,0,-18,0,0,1,0,0,-15,-12,0,-16,-29,0,-11,0,1,0,0,1,
+        -7,0,-1,0,-12,1,-9,15,-3,-9,11,-4,-3,-1,1,0,0,-1,5,0,
+        5,0,-4,0,-7,0,-2,-1,23,-3,-25,3,4,0,0,0,0,0,0,0,
+        0,0,0,-20,0,5,-18,51,0,0,-36,4,0,6,0,0,14,42,0,2,
+        0,34,7,6,32,0,7,21,3,-89,6,11,27,21,1,0,0,-27,36,0,
+        -3,0,-17,2,-11,0,1,-1,15,1,10,10,4,2,-1,5,0,0,0,-14,
+        0,0,-7,0,18,-4,-23,-42,-4,-3,20,-18,-12,-7,-4,32,10,-6,-23,25,
+        0,0,7,30,0,37,0,26,34,61,15,6,19,5,26,0,24,21,32,3,
+        17,-7,12,-3,0,0,-6,-11,0,4,0,-4,1,-6,11,-1,-2,34,-6,3,
+        1,7,3,12,3,4,39,5,1,0,0,0,0,0,-28,0,0,-1,0,0,
+        3,12,0,0,0,0,-15,-13,0,-10,1,0,-25,0,1,0,0,-3,-6,0,
+        0,0,-6,-1,-2,-2,-4,2,14,-6,-27,1,2,-4,10,0,-7,16,1,4,
+        -2,0,0,0,0,0,0,0,0,0,0,19,0,0,-17,0,0,0,0,0,
+        0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-17,0,0,0,0,0,0,0,0,3,0,0,-10,19,0,-16,0,
+        12,2,-11,-2,-1,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,
+        0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,7,0,0,0,
+        0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,
+        0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,-29,0,0,0,
+        0,0,0,0,0,-24,0,0,0,0,0,0,0,0,13,0,0,-3,-6,0,
+        10,0,22,17,14,11,0,9,0,14,19,7,14,15,20,21,25,0,0,0,
+        0,15,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,1,
+        0,0,0,0,0,48,0,0,0,0,0,0,0,0,16,0,0,0,0,0,
+        0,0,0,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,20,
+        0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,-13,0,0,0,
+        0,0,0,0,0,8,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,-9,0,
+        0,-16,0,-19,0,0,0,0,0,0,0,0,-21,0,0,0,0,0,0,0,
+        0,0,-55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-6,0,0,0,0,0,0,0,0,-9,0,0,-17,-25,0,-16,0,
+        -10,-15,-24,-8,-13,-28,-24,-10,-11,-30,0,0,0,0,0,0,0,0,5,0,
+        0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,5,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-35,0,0,0,0,0,0,0,0,-6,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-19,0,0,3,0,0,-3,0,0,-8,
+        -3,0,-21,-2,-10,-2,-36,-21,-7,0,-4,4,-5,-21,-13,-11,-19,-10,0,0,
+        0,0,0,-24,0,0,-26,19,0,0,0,0,0,0,0,0,0,0,-2,0,
+        0,-4,0,0,-27,0,0,0,0,0,0,0,0,-4,0,0,-21,0,0,-18,
+        0,19,-9,-1,0,-14,-26,0,-9,-52,-24,-18,-16,-38,0,-30,-50,0,-12,0,
+        12,-22,-8,-3,0,0,13,-11,0,22,0,-27,-26,-27,0,-17,-10,0,-5,-35,
+        0,-14,4,-21,-15,-12,-11,-13,-14,-19,0,-9,20,0,-11,0,-18,-15,-25,-1,
+        -7,-14,48,0,0,0,0,0,0,0,0,34,0,0,5,53,0,-12,20,0,
+        -17,-10,0,-37,-29,13,-3,-3,-23,-11,-6,25,-5,-15,-30,0,-19,-37,0,0,
+        0,0,-7,-3,-12,-10,-15,0,6,-31,-4,-9,0,-6,-19,0,-2,0,-15,-10,
+        -11,-23,-5,-11,63,-3,-12,1,-21,0,0,14,-73,0,-4,0,-40,-22,-16,11,
+        -13,-14,0,3,-5,0,-7,0,0,0,0,0,0,0,0,0,-29,-19,-25,-30,
+        -5,19,-23,10,-15,-11,-5,-6,0,0,-1,-32,0,15,0,-19,-3,0,0,-8,
+        19,8,-7,-7,5,-35,0,0,-5,0,0,-38,0,0,-10,0,0,-17,-16,0,
+        -3,-6,54,-4,-7,-6,0,-3,-10,-6,22,0,0,-15,0,0,38,0,0,-37,
+        -29,-4,-12,-27,0,4,-16,-14,-16,-27,-27,24,0,20,0,0,0,0,0,0,
+        0,0,16,0,0,-15,36,3,-9,28,51,0,0,0,28,0,0,-3,0,0,
+        2,-14,0,-29,0,-8,-5,0,-22,-9,-2,34,-4,-4,-6,7,8,19,1,-9,
+        0,5,-28,0,0,7,-12,0,-26,0,0,-20,-2,0,-1,-16,0,36,0,4,
+        -25,-2,0,-1,0,0,0,0,-6,-5,0,-4,-27,0,-12,0,8,-14,-8,-56,
+        -16,-23,63,-8,-4,-25,-5,-11,35,-5,-20,0,-9,-15,-3,3,0,0,0,0,
+        0,-3,0,0,-35,8,0,0,0,0,0,0,0,0,0,0,11,0,0,31,
+        13,0,-39,0,0,0,0,0,0,0,0,12,0,0,15,0,0,0,0,0,
+        -2,0,0,0,-3,0,1,0,6,1,3,0,23,-8,-4,0,7,0,0,1,
+        8,-7,0,0,-14,0,0,13,0,0,25,9,0,-14,0,2,-51,-14,0,-17,
+        0,-49,-12,-17,0,0,4,3,21,8,6,22,2,20,13,8,11,24,-11,27,
+        53,0,0,0,0,0,0,0,0,-3,10,0,-29,13,0,0,0,0,4,2,
+        0,-21,-6,0,2,13,-25,4,-2,-12,11,19,0,0,-15,-22,0,-6,0,0,
+        5,4,0,-2,29,20,16,6,17,0,0,-12,-13,0,7,11,0,7,2,0,
+        -14,16,-16,-3,20,0,8,0,-13,-3,6,0,11,0,-14,10,7,3,-5,17,
+        14,2,1,10,14,-20,0,25,-2,7,0,12,0,0,0,11,-7,24,26,31,
+        0,0,22,16,43,12,0,3,13,-13,0,12,0,18,10,16,0,-1,30,0,
+        15,6,0,18,7,0,17,0,11,22,-9,0,13,0,18,15,32,0,11,39,
+        0,21,-27,55,8,37,21,14,11,0,23,-7,25,0,6,0,42,1,9,12,
+        -8,14,-2,0,16,10,12,18,9,2,7,-3,0,0,-9,12,0,-3,0,0,
+        0,2,0,-14,-4,11,-19,49,0,2,0,37,-43,-1,0,27,0,-34,19,10,
+        0,11,0,-19,14,20,2,5,34,0,13,28,22,21,21,26,9,6,0,24,
+        15,0,0,12,0,0,0,0,0,-16,2,28,-9,14,23,9,15,37,7,12,
+        -36,-21,10,0,4,29,2,0,8,-32,-14,0,8,-1,0,8,-3,7,-10,15,
+        -3,5,23,29,9,14,8,10,6,0,18,22,13,0,0,0,0,0,0,0,
+        0,0,-27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-15,0,0,-21,0,0,0,0,0,0,-26,
+        0,0,-21,0,0,-4,-3,0,0,-30,0,0,0,0,0,0,0,-20,-21,0,
+        9,0,0,-5,0,0,0,-8,0,-30,0,0,0,0,-18,-36,0,0,0,-19,
+        0,9,0,-6,0,2,0,-5,0,0,0,0,10,-7,-31,-21,-21,6,0,-3,
+        0,0,22,0,0,50,-12,0,-14,0,-13,0,1,0,-25,0,0,8,0,0,
+        14,-11,0,-18,0,0,-28,0,0,0,-2,0,0,0,0,0,0,0,-2,-22,
+        -2,-4,13,8,-22,-14,-13,-19,0,-17,-40,0,-14,-7,-33,-13,-17,-13,-22,-2,
+        -6,-19,7,-5,0,0,0,0,0,0,0,0,-2,0,0,0,0,16,0,0,
+        0,-10,0,0,0,0,0,0,0,0,0,0,2,-27,0,-31,-2,15,0,0,
+        -2,-14,0,0,12,0,0,6,0,0,0,-7,0,-16,0,0,-7,0,0,-4,
+        -7,0,4,0,0,0,0,0,0,0,0,0,-11,0,0,0,-4,-6,-8,0,
+        0,-17,0,22,0,-3,0,0,0,0,0,0,0,0,0,-30,-24,0,-11,0,
+        9,0,0,-6,-7,0,0,-12,0,0,0,0,-19,1,0,0,0,0,0,38,
+        0,-4,4,-9,0,33,-16,0,0,0,-54,-7,-19,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,17,0,0,0,5,0,9,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-20,0,0,-21,7,5,0,0,1,-3,0,0,0,
+        0,0,11,-2,-11,-23,0,1,0,0,0,0,-24,-15,-22,-9,-18,-10,-7,-27,
+        -7,-7,-6,-3,-5,-27,-13,-1,-24,-8,-13,8,0,0,0,0,0,-6,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,0,-35,0,10,0,
+        0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,5,0,0,-4,
+        0,0,12,0,-30,12,4,0,0,0,0,0,54,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,27,0,0,3,0,0,-28,0,0,-18,0,0,3,-52,
+        11,1,7,0,65,9,0,0,7,0,-1,20,0,25,17,34,6,0,14,0,
+        0,0,24,0,0,9,0,5,-17,0,0,10,0,0,-5,0,0,11,0,0,
+        12,0,-34,2,2,6,2,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,26,0,5,0,0,-62,0,0,13,0,11,39,0,27,13,45,25,-2,
+        0,31,16,0,14,5,35,-15,13,0,18,22,41,31,8,15,10,16,0,17,
+        18,-2,0,26,0,0,0,-14,0,0,0,0,0,14,47,5,0,0,63,3,
+        0,24,0,12,-22,41,0,16,0,28,24,0,16,3,24,18,6,0,36,17,
+        20,2,1,0,31,12,0,0,4,0,-18,18,-5,-13,-5,12,-10,22,0,18,
+        1,5,5,9,14,0,24,-3,0,0,12,0,25,40,21,37,-9,23,42,7,
+        0,49,19,0,14,-5,34,19,0,0,-1,27,4,0,0,35,13,0,16,-5,
+        18,36,7,0,10,22,43,12,-2,11,13,17,0,16,24,0,0,-10,0,14,
+        22,38,35,18,15,25,40,-3,21,8,31,11,17,8,8,22,11,0,16,0,
+        0,0,-21,0,0,0,0,17,-70,0,0,0,0,29,0,0,-14,0,0,37,
+        25,0,12,0,-7,-8,-45,-19,8,0,5,17,39,5,7,24,13,19,0,36,
+        13,4,21,1,23,15,4,3,26,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,18,0,0,0,0,0,-48,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        31,0,17,0,-5,16,16,0,-15,17,0,46,0,18,0,0,0,0,0,0,
+        0,0,0,12,0,6,0,10,14,0,0,0,0,0,0,-10,0,0,0,0,
+        0,0,45,14,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,35,0,
+        0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,-38,33,1,8,
+        0,0,14,0,25,-13,0,0,-9,0,0,22,0,14,10,0,0,26,0,0,
+        0,22,0,0,0,0,0,8,0,0,0,0,11,21,0,0,8,0,0,0,
+        0,8,0,5,6,0,0,21,0,-3,24,4,26,24,0,-20,24,12,14,20,
+        0,0,11,0,11,10,0,0,-7,0,0,17,0,46,25,0,0,11,0,0,
+        15,0,10,0,19,-34,27,34,15,0,20,8,24,20,-10,7,-3,-11,6,5,
+        10,19,14,31,1,0,0,18,0,0,-24,0,0,-1,0,18,11,0,8,-9,
+        0,12,-14,2,18,8,19,-5,-11,0,0,15,0,-3,-16,12,0,9,0,0,
+        42,0,27,4,12,40,13,0,0,26,0,24,19,12,0,0,16,0,0,44,
+        0,0,-43,0,0,14,0,9,11,0,6,13,0,0,13,0,8,-10,15,0,
+        0,0,7,0,4,0,18,0,1,22,8,21,-2,7,-6,1,8,-1,7,16,
+        10,18,4,-5,23,10,6,20,0,0,0,0,0,-30,0,0,53,0,0,0,
+        0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-17,0,0,0,0,0,0,0,0,-2,-3,0,-14,-28,0,-12,0,
+        -18,-12,-5,0,0,-24,0,0,0,0,0,-1,0,19,0,0,0,0,0,0,
+        0,0,-28,-32,-34,-36,19,0,0,0,0,-46,0,2,-11,-19,-5,-2,-68,0,
+        0,8,0,0,0,0,0,-28,0,-3,55,25,-15,0,0,-9,0,0,-5,0,
+        -12,-8,2,39,7,4,33,-5,-10,0,-17,0,0,-6,0,-46,-7,22,0,11,
+        -11,5,-22,26,0,0,0,0,0,0,0,0,0,0,0,-17,0,0,18,0,
+        3,0,0,46,0,0,2,0,-22,-13,-14,-28,0,-6,-4,28,7,-3,-15,0,
+        0,-4,-31,0,4,0,7,-12,-16,0,-17,-14,1,-3,-4,-5,-7,0,0,0,
+        3,0,0,0,0,0,0,0,-21,-21,0,-9,0,0,-17,-4,0,-3,12,0,
+        -21,0,0,24,0,-15,-4,-20,-49,-25,8,4,-25,0,0,-3,13,1,-10,0,
+        0,8,0,0,2,0,0,-17,5,0,29,16,10,5,32,13,-12,-13,51,-17,
+        0,0,0,8,0,0,0,0,0,-46,0,5,49,0,-16,16,0,-6,0,0,
+        24,-45,0,-27,0,0,0,0,-6,-39,0,-25,-21,5,-8,-14,11,-6,-21,1,
+        -6,-12,-2,-8,-21,-21,-28,22,0,0,26,0,0,13,0,-18,2,19,0,1,
+        8,20,-10,-22,18,7,32,16,24,8,3,-2,0,0,0,0,0,0,0,0,
+        0,0,0,-27,-5,-1,-4,0,0,-10,29,0,12,-2,0,-7,0,0,-6,-57,
+        -10,-25,-20,-21,6,0,-31,-13,-32,-27,-25,0,-9,-4,15,-10,-9,-31,-7,9,
+        -13,-19,14,-9,-19,2,0,0,0,0,0,1,0,0,-1,0,0,0,6,23,
+        0,0,0,0,0,0,4,0,0,-1,-11,0,-1,0,0,0,0,0,0,0,
+        0,4,0,0,7,15,0,-5,0,7,-1,0,0,-5,-4,0,0,0,-4,-4,
+        -5,0,0,3,-7,0,-11,0,-13,-11,-25,0,0,0,0,0,0,0,0,0,
+        -4,-24,0,2,0,0,-2,7,0,3,0,4,-9,-11,-2,-6,-3,0,0,2,
+        4,0,2,0,1,-3,-11,1,-2,-1,22,0,0,25,0,0,0,0,0,8,
+        0,13,13,9,0,-3,0,0,3,13,0,11,0,-11,-3,4,-1,-4,-1,19,
+        -5,-29,0,0,0,-40,0,4,0,0,5,5,0,-14,-4,0,0,0,2,0,
+        0,12,-6,0,1,0,0,3,-11,-23,-4,4,4,4,21,14,3,0,0,2,
+        0,0,4,0,8,0,-8,0,-2,0,11,-3,-15,3,2,0,0,0,0,0,
+        0,0,0,0,0,-28,0,-14,0,0,0,14,41,5,0,9,0,0,6,12,
+        0,11,0,12,6,-10,36,2,2,-2,3,-30,18,11,26,8,2,0,0,2,
+        42,0,11,0,-1,2,-1,0,6,6,0,-3,4,15,6,-2,6,6,-2,0,
+        0,1,8,0,-5,0,3,-6,-11,25,-3,-3,36,-9,-21,4,-2,-13,6,4,
+        2,14,0,0,6,-31,0,16,0,-9,31,12,-18,16,26,0,25,-6,-12,20,
+        0,32,26,36,27,4,0,0,8,9,0,6,0,8,2,1,-2,0,3,21,
+        -3,9,4,4,-5,10,5,1,32,5,-12,0,0,3,0,0,3,0,-43,-16,
+        -10,-51,-17,-6,32,-5,-28,-4,-6,-34,-5,-6,-12,19,-2,-31,8,0,0,6,
+        -11,0,15,0,-1,0,-9,0,0,-3,18,-1,-7,-1,5,-6,17,10,8,43,
+        3,-11,8,0,0,0,0,0,0,0,0,0,0,6,0,0,15,25,0,0,
+        0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,1,0,0,0,0,0,0,0,0,16,0,0,3,0,0,
+        -3,0,0,9,15,0,13,32,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,0,
+        0,0,0,1,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,
+        0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,
+        0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,-5,0,
+        0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,7,0,0,16,
+        3,0,13,0,21,20,12,0,1,30,0,5,20,11,13,6,22,5,21,0,
+        0,0,0,21,0,0,0,0,0,0,0,0,21,0,0,0,0,0,0,0,
+        0,10,0,0,0,0,0,16,0,0,0,0,0,0,0,0,19,0,0,0,
+        0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,3,0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,-8,0,
+        0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,23,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-22,0,0,
+        -38,0,0,13,0,-6,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+        0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-60,0,0,0,0,0,0,0,0,0,0,0,0,
+        14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-5,0,0,0,0,0,0,0,0,-12,0,0,-18,-8,0,
+        -2,0,4,-11,-9,-13,-20,-3,-3,-23,15,-10,0,0,0,0,0,0,0,0,
+        -6,0,0,0,0,0,0,0,0,-17,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-17,0,0,0,0,0,0,0,0,0,0,0,
+        -31,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,0,0,0,0,0,
+        0,0,-25,0,0,0,0,0,0,0,0,-19,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-11,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,1,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-4,0,0,23,-21,0,2,0,
+        -21,-6,-6,-32,-18,1,-14,5,16,-4,-4,-10,1,-4,1,10,-1,0,0,-8,
+        0,0,0,0,0,-16,0,0,1,5,0,0,0,0,0,0,0,0,0,0,
+        -1,0,0,-55,0,0,0,0,0,0,0,0,0,0,0,1,0,0,5,0,
+        0,0,0,7,-15,-23,0,23,-53,0,-10,0,-12,-18,-21,0,0,-13,-25,0,
+        25,2,-48,-21,3,5,-12,0,26,0,0,0,0,0,0,-11,-2,-15,0,0,
+        5,-22,0,-22,0,0,-5,-8,0,-27,-12,-5,0,-8,-5,0,-33,0,36,-11,
+        -25,-1,-5,-23,53,0,0,0,0,0,0,0,0,0,38,0,-34,48,0,-8,
+        0,0,-12,0,0,5,0,0,-1,-5,-10,-19,-4,0,-7,-16,0,0,14,-48,
+        0,0,0,-15,-24,33,-35,-10,-16,0,-7,0,-11,-20,0,-1,-17,0,9,0,
+        0,-17,-4,0,-5,-14,0,2,-8,-29,-8,0,0,-14,35,0,1,0,0,-21,
+        -21,0,-24,-12,0,-17,-11,-23,-13,0,0,0,0,0,0,0,0,0,-40,-36,
+        -32,-10,-11,0,-12,0,-39,-35,0,-6,0,0,-71,0,0,-15,-21,-22,-47,0,
+        0,-7,-27,0,-1,0,-16,0,0,0,-14,0,0,-8,0,0,6,0,0,-12,
+        -11,0,-23,-23,0,-21,-23,-18,-8,26,0,4,-39,0,0,-15,-11,0,59,0,
+        0,-20,-28,-72,-7,-28,0,-4,-10,-20,-39,-37,-40,-6,-35,-1,0,0,0,0,
+        0,0,0,0,0,0,0,-14,0,0,0,0,17,0,0,0,0,0,0,-4,
+        -13,0,-2,0,0,13,0,0,-12,-4,-18,-13,-13,7,10,-2,1,-3,-10,44,
+        -5,-12,0,-1,-14,-1,0,-6,-3,0,0,0,0,-17,-23,-12,-19,-12,0,3,
+        0,-21,-13,-12,35,-7,-35,0,5,18,-3,-79,0,-6,-22,0,-14,-9,10,-11,
+        -30,-41,-15,-23,0,-14,-3,-26,-22,-19,0,-8,-35,0,-19,0,-29,-13,0,0,
+        0,0,0,-9,0,0,0,8,0,0,0,0,0,0,0,0,0,0,22,0,
+        0,0,5,0,-54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,10,0,0,5,-8,0,4,0,31,2,5,0,-20,-13,9,0,17,0,
+        0,4,-5,0,0,0,0,0,0,-2,0,0,0,0,0,-23,0,0,-23,18,
+        0,12,0,0,-8,-11,0,-3,6,10,45,-8,35,0,21,35,12,7,8,27,
+        -16,17,0,0,0,0,0,0,0,0,0,-39,-21,0,0,5,0,24,0,0,
+        0,0,0,-6,0,0,6,-52,6,-21,-11,0,-1,29,0,0,42,15,0,9,
+        2,0,8,9,0,-6,18,1,20,22,0,0,0,0,0,0,0,8,0,-4,
+        -21,0,0,9,0,61,18,0,3,0,3,7,31,0,17,0,27,11,7,14,
+        -2,13,0,20,27,41,11,-22,0,0,0,0,0,0,0,0,32,49,27,0,
+        20,14,0,44,-14,19,32,6,0,-2,0,0,0,10,0,0,18,32,0,-14,
+        29,0,1,0,17,4,26,0,7,0,13,12,47,0,15,0,0,5,27,14,
+        4,6,0,4,19,-19,10,0,-8,-23,-3,0,0,-2,22,0,-48,0,0,5,
+        2,17,-21,9,4,-13,7,11,8,23,13,-27,2,-20,0,0,9,0,0,-68,
+        0,0,8,0,0,9,-6,0,-55,-9,0,-5,0,0,0,-8,0,33,0,-16,
+        23,10,0,6,0,0,17,16,7,-3,21,-5,-13,28,17,19,7,18,-6,3,
+        13,0,13,0,-24,6,16,0,13,0,0,-2,-1,-1,-22,11,5,-11,7,13,
+        12,17,11,-7,4,0,12,-25,7,0,0,0,41,0,-14,0,0,10,-10,-17,
+        -5,0,4,-10,-18,4,22,4,-10,13,7,0,5,-2,-20,0,0,0,0,0,
+        0,0,0,0,-17,0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-13,0,0,0,0,0,
+        0,-15,0,0,24,0,0,14,-17,0,0,-17,0,0,-19,0,0,-10,-22,-11,
+        -14,0,14,0,0,0,0,0,0,0,0,-17,0,0,6,0,0,-16,0,0,
+        15,-11,0,-22,0,-11,0,-8,0,-20,-11,0,0,-5,4,-6,-7,-13,-21,-3,
+        0,3,0,0,29,0,0,0,0,0,-14,0,11,-9,0,0,-6,0,0,9,
+        0,0,11,-12,0,-12,0,0,-19,0,0,0,12,0,0,-10,0,0,23,4,
+        -6,-10,-25,-19,11,13,-17,9,-11,-22,0,-16,-14,0,31,2,-19,-13,-14,-21,
+        -25,-2,-9,-29,3,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,-24,
+        0,0,0,-17,0,0,0,0,0,0,0,0,0,0,-19,2,0,-60,-9,-2,
+        -33,2,-26,-9,0,0,-10,0,0,17,0,0,11,-21,0,-9,0,0,-7,0,
+        0,-2,-7,0,8,0,0,0,0,11,0,0,0,0,0,0,0,0,-15,2,
+        0,0,0,19,0,0,0,-1,0,0,0,0,0,0,0,0,0,-26,-27,0,
+        -19,-37,-17,-7,0,-7,2,0,0,-24,0,0,0,0,-23,0,0,0,-2,21,
+        0,18,0,-30,-10,2,0,-28,-8,0,0,0,0,23,0,0,0,0,0,0,
+        0,0,0,0,0,-3,0,0,8,0,0,0,0,0,-19,0,0,4,0,0,
+        0,0,0,0,0,0,0,0,0,-8,-32,0,-1,0,-13,-19,9,1,-11,-20,
+        0,10,26,0,-10,1,-27,-17,0,-20,-10,0,0,2,18,-14,-24,-13,-28,-9,
+        -10,-39,-6,-8,-21,-19,-32,-40,-2,-33,-27,-10,-19,11,0,0,0,0,0,2,
+        0,0,14,10,0,0,26,-10,0,0,0,0,0,0,25,0,0,9,16,0,
+        21,0,0,0,0,0,0,0,0,-15,0,0,-36,0,0,-10,0,0,20,0,
+        0,9,34,0,-3,0,62,4,10,0,0,4,1,0,-4,0,32,-8,0,0,
+        0,0,0,0,0,0,0,0,36,0,6,4,0,0,8,4,0,0,0,19,
+        -7,-27,-11,-7,1,0,11,10,-5,0,6,0,29,10,-25,16,7,9,23,0,
+        0,1,0,0,2,0,23,17,-28,16,-3,-5,0,15,0,0,9,0,0,26,
+        -2,58,-3,20,-1,-3,2,-1,2,0,0,0,0,0,0,-19,0,0,0,0,
+        0,0,0,0,-24,0,8,0,0,-12,0,0,9,0,16,20,24,33,7,21,
+        14,-26,0,0,12,0,4,9,24,46,16,0,20,20,21,19,3,12,25,16,
+        12,32,18,3,0,0,-9,44,0,-5,0,26,-3,0,12,21,48,0,0,0,
+        28,24,0,17,0,41,12,0,0,18,0,45,22,6,18,0,12,1,17,0,
+        34,23,23,12,12,0,8,33,19,30,16,0,26,-2,9,23,3,11,12,8,
+        0,1,2,16,2,6,3,0,10,1,3,4,4,0,14,1,-2,5,4,22,
+        24,3,41,9,9,19,11,3,6,17,0,29,14,29,0,10,0,37,20,19,
+        -9,-1,10,4,18,0,10,12,25,2,-6,14,21,20,0,2,16,48,7,10,
+        0,28,9,5,23,8,15,19,5,17,11,15,11,18,11,5,13,12,-14,0,
+        -34,-20,0,19,24,0,0,25,-13,0,-24,-58,2,-5,0,13,15,0,2,7,
+        4,10,9,0,16,0,8,13,28,0,13,0,-17,12,2,6,0,22,11,6,
+        0,26,16,15,23,4,9,16,6,-24,12,0,0,0,0,0,0,0,0,0,
+        0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        28,0,0,0,0,0,0,0,-3,0,-1,0,0,0,-15,0,0,0,0,0,
+        0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,11,0,23,0,21,0,-2,0,24,3,33,-1,49,11,0,0,0,0,
+        0,0,0,0,0,13,0,0,0,11,0,0,0,0,0,10,0,0,0,0,
+        0,0,0,0,34,0,34,0,0,0,0,0,0,34,0,0,0,0,0,0,
+        -1,0,50,23,0,0,0,0,0,0,0,0,0,1,0,0,0,12,0,16,
+        7,0,0,0,20,0,6,5,0,0,23,0,0,-16,0,15,15,0,0,23,
+        0,0,0,-6,0,2,0,0,0,17,0,0,0,0,10,0,0,0,-9,0,
+        0,0,0,25,0,0,0,0,0,0,0,28,0,-17,21,7,0,-31,24,19,
+        26,22,0,0,29,0,16,-19,0,0,-17,0,0,0,0,28,0,0,0,0,
+        0,0,17,0,13,0,16,16,20,14,16,0,27,11,13,24,-3,7,-2,13,
+        20,2,11,15,16,19,4,0,0,-2,0,0,0,0,0,0,0,13,-4,0,
+        7,-29,0,37,0,2,2,18,20,-6,14,0,0,23,0,21,18,31,0,33,
+        0,0,43,0,18,29,7,20,11,0,0,3,0,21,1,1,0,0,4,0,
+        18,-64,0,0,-21,0,0,24,0,9,-12,5,7,5,0,0,13,0,6,-4,
+        12,2,0,0,32,0,20,0,2,0,-11,-15,2,-25,-5,8,-4,-1,0,0,
+        7,18,20,22,1,-14,18,4,1,-3,0,0,0,0,0,-13,0,0,25,1,
+        0,0,0,0,0,0,0,0,0,0,-1,0,0,-31,0,0,18,0,0,0,
+        0,0,0,0,0,-8,0,0,-8,0,0,-11,0,0,-10,-6,0,-10,17,0,
+        1,0,-10,-13,-10,-19,0,-22,0,0,-20,0,13,-16,12,20,-20,0,9,0,
+        0,-2,0,-12,-14,-7,-37,-23,17,0,-10,-26,0,-15,0,-12,-12,-9,-15,-20,
+        -8,13,0,-6,0,0,42,0,17,-11,-5,0,-1,-16,-10,26,0,1,0,0,
+        0,0,-10,-7,8,0,0,-21,-15,-10,-21,0,-2,-5,0,-16,0,-3,0,-2,
+        -8,-10,4,17,-11,6,0,0,-1,0,0,-6,0,-10,-5,-42,0,0,-10,8,
+        28,0,-4,-19,0,-7,-10,21,4,0,-15,-11,-11,-19,-2,-10,-13,9,3,-9,
+        1,0,0,-2,-22,0,0,0,0,-12,-13,-26,-13,-10,10,-14,-3,-5,-2,33,
+        0,0,-12,0,0,15,0,-19,3,8,-4,-25,-7,-21,-7,0,-12,-14,0,-3,
+        7,0,-9,27,0,3,0,-1,-9,-17,-7,-21,-2,11,-7,-18,-8,0,1,-5,
+        -2,0,0,13,0,4,-6,0,6,-3,-1,0,-15,-7,6,-18,26,2,-2,-2,
+        -12,-9,-15,0,0,-3,0,-4,12,0,7,-11,3,1,-19,-22,-27,-37,0,-14,
+        -11,-12,3,-1,-8,-18,0,0,11,0,0,1,0,28,-12,-8,-8,-22,-13,-16,
+        -5,0,-15,-6,-14,-3,-18,-23,-15,12,-5,0,12,45,0,42,0,14,3,1,
+        -25,-9,5,11,-14,11,8,10,10,17,-3,5,3,5,-49,0,0,0,0,0,
+        0,0,0,-5,-34,-32,11,3,-27,0,-3,-4,2,0,-5,10,6,-19,30,0,
+        -5,-19,-10,-3,-15,-17,-8,-25,-8,-17,-28,-25,-28,-14,-16,-36,-1,-16,-9,-22,
+        -12,1,-17,-30,8,-11,-31,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+        0,0,0,7,0,0,1,4,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,
+        0,0,0,0,0,-1,0,4,-6,7,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,8,0,0,0,
+        0,0,0,0,3,-47,0,-59,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-5,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -5,-36,0,0,0,0,-14,0,0,5,0,-9,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,-6,0,
+        0,0,0,0,0,2,0,46,15,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,4,0,-11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-4,0,10,0,0,0,57,0,0,-12,1,0,-28,0,-14,0,-10,0,17,
+        0,-3,0,10,0,0,0,0,0,0,0,0,20,0,0,0,-2,-10,4,0,
+        -13,0,0,0,0,0,10,-14,0,0,-10,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,4,-5,0,0,0,0,0,0,0,0,0,-9,0,0,0,0,
+        0,0,-19,27,0,0,0,0,-21,0,-7,-11,4,0,-5,-13,-30,0,25,0,
+        13,0,-16,0,16,33,0,0,0,0,24,0,0,13,0,0,0,-2,-5,47,
+        0,0,0,-27,0,0,0,-7,-22,5,0,11,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-23,0,0,0,50,0,0,0,0,0,0,-1,0,0,0,
+        0,0,0,9,-2,0,0,-15,0,0,11,18,-2,12,-24,7,0,-13,0,-10,
+        0,0,0,-16,0,9,7,0,0,0,0,3,0,-7,13,0,0,0,-21,-21,
+        10,-39,0,0,-9,0,0,0,-16,-16,0,-5,30,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-1,-14,30,19,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,15,1,0,0,0,28,0,0,12,12,0,-2,0,0,9,14,
+        24,0,0,0,-1,0,-6,0,-2,0,-24,-6,9,0,24,0,0,0,13,-16,
+        -2,0,4,0,0,-6,0,0,0,5,0,-32,26,1,0,-30,-25,0,0,4,
+        0,0,0,0,0,0,0,16,0,-7,0,0,0,9,17,0,0,0,0,0,
+        0,0,0,0,0,1,0,11,-2,0,0,-32,0,-20,3,16,-14,0,0,12,
+        3,16,0,0,0,2,0,18,0,8,0,-8,1,9,0,0,0,0,0,11,
+        0,-4,-13,6,0,0,12,-25,0,0,-11,0,-2,0,-23,0,0,0,-20,0,
+        0,0,0,0,0,0,0,0,12,38,7,0,0,0,0,9,0,0,0,0,
+        0,0,0,0,0,0,17,-24,-8,0,0,0,16,0,-32,13,0,-5,0,0,
+        -22,-3,24,16,0,0,-29,0,19,0,-7,0,-31,-5,20,0,0,0,0,0,
+        -16,-20,13,0,-2,0,0,0,0,-6,-27,-3,0,5,0,-18,-11,0,0,15,
+        0,0,0,0,0,0,0,0,0,9,0,-28,0,0,0,1,27,0,0,0,
+        0,0,0,0,0,0,0,9,0,24,0,0,0,0,0,-11,-3,0,0,-9,
+        0,0,0,0,0,-1,0,0,0,26,0,-9,0,0,0,0,0,-6,0,0,
+        0,0,-16,-5,0,0,-30,0,0,0,0,0,-1,0,0,-13,-17,0,13,0,
+        0,-8,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,5,
+        0,0,0,-28,0,-14,0,0,-16,0,0,-26,0,0,0,0,3,-10,11,0,
+        -36,9,0,0,0,0,1,17,0,0,-13,0,5,0,0,0,0,0,-51,-4,
+        0,0,0,-21,-3,18,0,0,0,0,7,-4,0,-1,52,0,22,24,0,5,
+        0,0,5,0,0,0,0,0,0,0,-39,-5,-11,0,-51,3,0,0,0,0,
+        -6,0,0,0,23,0,7,0,0,5,10,0,0,0,0,3,0,5,2,0,
+        -14,-26,0,-25,0,0,0,4,0,-22,0,42,0,0,0,-18,0,0,0,-4,
+        0,-9,0,0,-21,4,0,-18,-1,0,0,4,0,9,9,0,33,-6,-22,-49,
+        23,0,22,-2,0,-40,0,0,0,0,0,0,7,0,-12,-7,0,-36,0,0,
+        0,4,0,-15,-16,0,-48,-19,0,0,6,0,-20,0,0,-44,22,0,-20,-9,
+        -1,0,-15,-10,-5,0,52,0,-23,5,-13,-4,-11,-18,0,0,0,0,0,0,
+        -6,4,-13,0,0,1,-16,-7,0,0,-1,-2,9,0,0,-8,3,14,-23,3,
+        -8,34,0,0,12,0,0,0,0,0,0,0,18,15,-5,0,-13,17,-20,0,
+        0,0,-32,6,0,-7,18,-39,0,0,0,0,-29,0,-25,-12,14,-7,-12,-18,
+        -7,5,-12,-14,-1,-11,-17,35,0,-18,2,-10,1,16,-16,0,7,-31,0,10,
+        0,0,27,34,0,0,9,-22,13,-4,-3,21,-55,0,-9,0,2,6,24,0,
+        21,-19,0,0,-24,26,22,29,0,0,0,0,0,6,8,-1,0,-25,0,17,
+        0,0,0,12,-7,-13,0,25,0,0,0,0,-30,30,-54,1,32,16,-25,20,
+        -4,-9,10,-12,5,-5,-11,0,20,0,-16,1,-7,-17,0,-34,0,0,0,0,
+        0,0,-11,4,-18,0,0,-13,-1,0,-22,0,0,-28,0,0,-8,6,15,-10,
+        36,7,-1,0,0,6,-9,0,0,0,0,0,0,0,10,-14,22,4,6,-6,
+        -22,0,0,0,-8,0,-1,-24,0,-18,0,0,0,-6,0,0,0,0,-10,-20,
+        0,-34,12,0,-8,-24,0,9,23,27,0,5,0,-7,0,33,-25,-14,19,-27,
+        -14,34,0,-9,0,18,0,0,28,9,0,-11,-9,0,-14,-19,0,-20,9,0,
+        -6,18,26,-33,0,0,-17,-2,-13,-10,0,0,0,18,2,-20,7,0,8,-42,
+        0,25,0,0,0,20,0,-14,0,-13,39,41,0,0,-8,-4,17,-35,30,0,
+        18,0,2,27,12,-17,-9,29,26,19,29,10,21,-13,-6,0,5,0,2,18,
+        -18,10,62,0,0,4,0,0,4,-11,22,-2,-3,0,0,-17,25,29,0,11,
+        38,0,35,12,-9,0,1,-21,33,0,-16,0,0,0,0,9,-13,36,35,-29,
+        0,0,0,0,0,0,-48,0,0,0,0,-1,21,0,-16,6,62,0,0,0,
+        0,18,24,-17,12,0,-9,0,15,-13,9,18,-37,10,16,-25,0,5,-19,-12,
+        -35,-14,-23,0,13,0,23,-20,0,0,-30,6,8,-23,0,0,-28,11,0,-26,
+        -4,8,-2,21,-7,-64,0,-8,-45,-3,0,-32,0,0,0,0,0,-20,11,0,
+        -15,27,-11,-1,0,28,0,8,-4,-16,0,0,22,0,0,-5,-6,0,-5,0,
+        20,26,7,0,-31,3,0,0,0,0,0,8,0,0,0,0,0,0,19,0,
+        18,0,0,1,0,0,7,0,0,0,0,-20,6,0,0,0,0,0,5,0,
+        0,15,0,0,-4,-3,0,13,0,0,-4,0,0,-4,0,0,0,0,39,5,
+        0,0,1,0,0,28,0,0,16,0,0,0,28,0,0,0,0,1,0,0,
+        -14,0,0,11,0,18,-1,11,0,0,0,0,35,15,0,0,0,0,0,23,
+        0,26,18,0,-2,14,0,2,27,0,0,0,-25,-4,10,0,0,0,0,4,
+        25,0,-21,0,0,-28,13,0,47,28,0,4,10,0,-11,0,0,53,44,0,
+        -2,14,0,-9,13,0,51,23,0,15,21,0,0,3,0,0,0,0,0,-24,
+        0,0,3,0,8,47,23,8,0,-10,0,0,0,29,0,-6,0,0,0,0,
+        25,0,31,0,-2,-3,0,-14,-10,0,0,0,0,-10,7,0,-2,0,0,0,
+        52,0,-23,-20,0,-7,2,-13,7,0,0,22,1,0,0,-38,0,0,0,0,
+        -10,2,0,-11,-22,0,4,30,0,0,4,0,-3,0,43,0,0,0,0,3,
+        0,-38,4,0,0,-3,0,-31,-12,9,0,-19,0,0,59,-5,0,15,0,-36,
+        0,-41,0,21,-13,0,-4,7,0,2,11,-14,0,19,-19,-10,8,0,0,0,
+        0,35,51,0,6,-39,0,-18,22,0,0,-33,-26,-25,-12,0,0,2,0,0,
+        -37,-5,-6,13,0,17,47,0,0,29,0,-4,0,0,-16,41,0,0,0,0,
+        -8,2,0,-3,39,0,8,27,-27,-8,14,0,-4,12,-4,6,14,-18,22,-5,
+        0,0,26,0,0,24,-1,-10,25,-7,8,18,19,0,2,-8,-15,18,0,0,
+        0,0,0,22,-4,0,2,0,-6,26,0,0,0,0,-13,13,-2,0,2,0,
+        0,-41,-11,-14,22,13,-9,18,-50,0,22,0,0,29,0,0,26,0,0,0,
+        0,5,11,-8,0,39,2,-22,59,-3,-14,26,-18,-25,2,-11,22,0,-11,0,
+        0,-13,0,10,0,0,0,6,-18,22,-10,5,11,1,0,0,-1,0,34,-27,
+        0,0,0,0,0,-2,-23,0,-70,0,8,0,0,0,0,-24,17,0,-18,0,
+        0,0,4,-15,-1,9,6,-10,0,-17,0,5,0,-23,31,-36,-2,23,0,0,
+        0,0,3,-27,-39,-3,12,-21,-37,10,-17,13,0,0,0,0,-39,11,12,5,
+        0,0,31,0,-2,0,11,41,-9,15,8,-6,28,0,0,-1,20,5,-13,0,
+        3,0,0,0,5,9,-16,6,0,25,17,15,45,6,-10,2,31,0,-1,0,
+        0,0,37,54,-15,18,0,3,-18,0,-44,15,7,-3,10,0,4,0,-2,0,
+        0,0,0,21,7,1,-11,34,9,27,13,0,5,12,-12,0,0,-2,5,11,
+        14,0,0,0,0,15,0,10,23,-11,13,9,-2,-24,-13,0,16,29,-5,-21,
+        -11,-17,0,0,0,-7,17,3,-4,19,0,4,30,0,0,25,0,2,-2,-11,
+        0,0,0,13,14,-31,0,24,-7,0,14,-12,7,30,0,19,0,-2,0,0,
+        0,0,0,0,0,21,-10,0,15,0,-20,15,4,12,10,-8,8,0,-21,4,
+        12,-3,0,0,-6,0,-8,0,11,-7,-23,13,22,-1,23,26,-14,-3,6,-15,
+        -4,0,0,0,0,-10,3,-11,-5,26,59,1,24,11,0,6,10,-24,10,10,
+        4,25,22,0,-10,0,-25,18,10,-16,14,1,37,25,29,-14,4,1,-31,0,
+        31,0,0,0,0,25,2,2,0,8,-17,33,17,-22,-3,0,0,0,0,0,
+        0,0,0,-4,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,
+        0,-6,0,0,0,0,0,0,0,0,-2,0,0,-9,11,0,0,0,0,-2,
+        0,0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,-7,0,0,
+        0,0,0,0,0,0,-6,0,0,0,0,0,-4,0,-7,-8,4,0,0,0,
+        0,0,0,0,-8,7,0,0,0,0,0,0,0,-11,11,0,0,0,0,0,
+        0,0,-8,-4,0,0,0,0,0,0,0,-2,-3,0,-17,15,0,0,0,0,
+        -3,18,0,0,0,0,0,0,0,-5,-21,0,0,0,0,0,0,0,-18,-17,
+        0,0,0,0,0,0,0,-10,23,0,0,0,0,-9,30,-20,2,0,-17,0,
+        0,0,0,0,0,0,0,-17,0,0,0,0,0,0,-15,0,2,0,0,0,
+        0,0,0,-2,0,-6,0,0,0,0,0,0,3,0,-12,-7,11,-9,0,0,
+        0,6,0,-9,0,0,0,0,0,0,-3,0,-22,0,0,0,0,0,0,5,
+        0,-20,0,0,0,0,0,0,-7,0,-7,0,0,0,-6,0,-3,-11,-1,0,
+        18,0,-31,0,-43,0,-13,-7,-21,0,-24,-24,0,0,0,-21,-22,0,0,-29,
+        0,0,0,-24,-9,-2,0,0,0,-13,0,-28,0,-12,-1,-9,-8,2,-18,0,
+        0,0,-18,24,0,0,0,0,0,0,-31,-15,0,0,0,0,0,0,0,0,
+        7,1,-12,0,0,-53,0,0,0,-16,-3,0,0,-2,-10,-11,6,-18,-21,4,
+        0,0,10,-20,0,-13,0,-16,-5,-70,0,24,-16,0,22,0,-37,-14,0,0,
+        11,0,0,4,0,-17,3,0,-5,25,3,0,0,0,-24,11,8,-33,4,-32,
+        0,0,0,-22,21,0,0,0,0,0,0,0,-26,-2,0,0,-3,0,0,0,
+        0,27,-4,-12,0,19,0,0,0,0,9,-3,0,0,-3,0,0,11,-9,-7,
+        4,-13,-6,0,-20,0,20,0,-7,10,-16,7,-1,-7,0,0,0,-11,1,0,
+        1,-5,-10,0,0,15,-8,-3,-9,0,0,-16,0,0,0,11,2,-9,-22,-19,
+        -21,0,0,0,-14,23,0,0,0,0,0,0,0,-9,12,-48,0,0,-14,0,
+        0,0,-13,-39,-16,0,0,-19,0,0,0,-8,-6,-55,0,-4,-22,32,0,-28,
+        12,0,-5,0,0,-19,8,21,0,7,0,-8,0,8,-13,44,-5,7,0,-4,
+        7,0,0,0,0,29,-29,4,0,-9,0,0,-7,9,3,0,6,0,-4,20,
+        17,12,0,-17,0,14,23,7,0,0,0,5,1,-65,-9,0,3,0,0,0,
+        0,13,0,-2,0,-8,0,19,0,0,0,0,11,32,-14,0,0,0,21,-15,
+        -4,1,2,-18,0,0,-30,21,26,0,6,35,-9,0,8,0,19,14,3,13,
+        3,-2,0,0,0,41,-11,7,-5,14,-12,0,0,-4,30,10,0,-7,-5,-21,
+        22,27,0,0,9,11,9,14,0,0,0,0,0,1,0,-9,7,-4,0,0,
+        0,0,9,0,0,-52,-34,0,0,0,0,0,0,7,35,0,0,0,0,21,
+        12,12,22,0,-7,0,0,-12,-1,7,-18,26,0,-7,0,22,-9,4,26,-30,
+        -4,8,13,0,0,0,19,-19,-18,11,0,-5,0,0,-1,3,4,-10,2,0,
+        -7,4,-6,-5,-17,-30,34,19,8,-3,0,0,0,-4,0,-17,32,0,-10,0,
+        0,-73,-10,21,-25,8,0,-3,0,0,0,0,0,0,19,-4,0,0,0,0,
+        18,10,-29,-4,0,0,-11,0,0,0,0,0,-7,0,0,-16,-7,0,3,0,
+        0,-11,0,0,-10,0,0,0,0,-5,-5,0,0,-21,0,0,-7,0,0,-2,
+        0,0,-2,8,0,18,0,0,2,0,0,-46,0,0,18,0,-9,-1,0,0,
+        -7,0,0,0,0,0,-1,0,0,-23,10,0,27,0,0,-7,0,0,-8,0,
+        0,0,0,-10,-7,6,0,-13,6,0,0,0,0,-13,-2,0,-30,9,0,18,
+        0,0,-16,21,0,0,6,0,0,0,2,-9,1,0,-28,-10,0,-13,20,0,
+        -4,0,0,-6,8,0,18,-4,0,2,18,0,0,0,0,56,-10,8,-13,3,
+        0,-13,20,0,0,0,0,-5,15,0,-11,-10,0,39,0,0,-13,-3,0,-11,
+        8,0,-5,0,-14,0,0,-9,-5,0,-17,0,0,0,-2,0,-16,-13,3,-7,
+        10,0,-23,-18,0,-31,0,0,0,0,0,-17,-2,0,-16,-16,0,-4,2,0,
+        -13,-2,0,-15,2,5,-8,12,0,-20,4,0,-4,0,0,0,8,0,-13,4,
+        0,-20,-6,0,-8,0,0,0,3,0,-18,-41,32,11,15,0,-8,-4,0,-5,
+        -9,0,9,1,0,-14,-10,0,0,-16,2,-11,-13,3,0,-17,-4,-7,-16,-4,
+        -19,38,-17,-13,-15,-1,0,-4,19,-9,-22,11,-12,-11,2,0,-17,-10,-23,-19,
+        2,0,-12,-8,-9,-7,11,-9,15,-10,-5,2,30,0,-14,4,0,36,54,-6,
+        -11,1,0,-16,-1,-11,0,16,0,-4,4,-1,-2,4,-8,21,0,-14,-4,5,
+        0,-4,11,-6,-4,6,-13,-13,0,-8,-5,12,-9,-5,19,-11,-19,-8,-22,-35,
+        6,-11,0,2,-9,-15,-7,-18,-43,23,-4,35,30,-10,-20,11,-11,-34,-6,-19,
+        -19,0,-22,-11,-14,-17,-14,24,-1,78,11,-1,4,28,21,-35,19,0,37,17,
+        -2,-21,0,-1,-29,1,-12,-14,5,-25,2,-14,-18,-41,22,26,26,0,38,-2,
+        -8,-23,-5,23,0,-15,15,-1,-11,9,-11,-2,7,-10,-13,-11,-5,-16,-11,-17,
+        -21,-1,-23,0,0,-13,-9,3,-23,-11,29,-5,-6,0,-9,-16,5,-16,5,1,
+        -25,-35,14,-23,-5,-11,-28,-14,14,0,52,0,-4,-3,-5,22,-7,-31,0,0,
+        1,0,-21,-6,-8,-22,-9,-21,-42,0,-48,5,-5,-21,-2,24,16,54,0,10,
+        -1,-11,-26,-2,16,7,-7,29,-3,5,0,-6,12,0,-5,20,15,12,3,0,
+        -11,-4,13,0,16,16,-4,-3,0,-8,0,12,23,14,0,-12,2,0,-10,8,
+        0,-10,7,22,-21,-1,0,-14,18,19,-1,13,15,0,4,-17,-5,-10,33,0,
+        14,13,-2,0,0,2,7,0,-17,-46,0,5,4,0,-4,-10,19,18,14,0,
+        11,1,16,-7,11,33,4,11,21,3,7,11,-4,-18,19,-24,44,33,-15,6,
+        8,-12,-16,0,-13,13,5,-8,1,3,-11,0,21,0,0,1,-6,0,11,-17,
+        6,0,-10,17,39,-26,3,-11,-6,21,14,-4,24,5,-13,0,16,4,0,0,
+        0,5,11,-10,-7,12,-15,9,10,0,18,13,9,-6,9,18,0,16,-5,14,
+        0,-8,4,4,6,41,1,-38,32,9,-9,17,0,-10,37,-11,-16,32,16,-9,
+        5,44,-13,21,-2,-19,4,-7,-19,9,15,-9,0,28,-11,-31,-6,-15,9,4,
+        -16,-38,30,-19,10,21,-26,-2,-10,-14,24,12,-10,23,-4,-3,2,3,4,0,
+        -61,0,24,0,-7,16,0,-10,-4,-20,-25,0,0,-16,5,-13,11,0,24,-3,
+        35,0,5,5,12,7,0,-7,-3,31,6,-8,-2,0,0,0,0,0,6,0,
+        0,-1,0,0,0,10,0,18,0,0,-8,0,0,-4,0,0,-5,0,-21,-4,
+        0,0,0,0,0,3,0,0,7,0,0,-2,12,0,21,0,0,2,0,0,
+        -34,0,0,27,0,0,-2,0,0,-19,0,0,10,0,0,-2,0,0,-12,19,
+        0,43,0,0,3,0,0,-14,0,0,2,0,-4,-6,12,0,0,0,0,7,
+        31,0,-6,-1,0,0,13,0,24,11,0,-5,19,0,-12,-1,0,23,-20,-13,
+        -8,31,0,0,0,0,1,18,0,8,13,0,-5,26,0,24,6,0,11,15,
+        0,-44,0,0,38,11,13,0,2,0,-18,27,0,36,0,0,0,-16,0,-4,
+        -36,0,49,0,0,4,23,0,-11,0,0,-3,24,-1,2,0,-12,0,0,0,
+        25,0,-6,2,0,-14,0,12,0,19,0,-13,-11,0,-8,-17,0,0,-20,0,
+        -4,-4,0,-18,0,0,0,7,0,-19,8,0,-2,5,16,-17,22,0,10,6,
+        0,-2,-15,0,0,26,0,-5,1,0,-10,-9,0,-3,35,0,-6,0,0,-18,
+        -19,-6,0,-1,0,0,4,0,7,-22,0,-22,3,0,3,-11,5,0,-7,0,
+        -21,6,4,0,-19,14,4,-12,-1,0,18,-3,-10,-21,9,0,16,10,0,-15,
+        -1,-15,-7,9,0,0,-13,-32,-3,9,0,2,14,-19,-12,7,-16,16,-4,-30,
+        -3,19,0,16,-3,0,44,-7,-3,-5,7,0,14,2,0,2,19,0,-3,7,
+        40,1,11,-3,0,0,0,0,18,0,4,-5,10,-6,3,-15,-24,10,0,0,
+        21,-5,-5,13,-7,-31,16,0,0,19,-7,0,12,11,-11,9,-8,-14,31,-14,
+        -13,26,-21,-15,6,0,0,82,-6,6,37,-17,-7,14,-6,-38,15,-24,27,-9,
+        -16,-3,30,-8,0,6,0,59,-11,-4,-3,5,-16,-16,48,0,39,17,-1,-14,
+        19,22,0,18,0,0,0,18,4,24,7,-18,9,3,-15,7,-10,-34,21,-3,
+        -28,10,-7,-36,-11,-4,-23,18,-5,0,22,-96,29,0,14,18,-4,-23,35,-30,
+        3,-37,-8,-14,28,3,-17,-25,-53,0,38,0,-9,3,0,-37,-30,10,0,42,
+        0,-19,12,9,-28,0,24,0,0,0,-6,3,14,-12,16,4,-31,0,0,6,
+        9,15,-12,-36,0,14,0,0,-72,-6,26,-4,0,9,17,-25,27,-11,7,0,
+        -9,0,0,5,9,14,-2,7,0,-11,18,9,-33,8,8,-8,7,11,-13,36,
+        0,0,-1,35,-11,5,0,-5,14,0,19,3,24,-9,9,0,0,7,18,-4,
+        5,10,-7,5,12,-8,-5,-16,0,6,11,2,6,0,-6,9,0,-6,7,24,
+        -1,-3,0,15,-12,20,46,51,0,8,13,9,3,26,15,-25,7,11,-2,6,
+        25,-1,0,-4,0,30,21,-4,34,1,1,0,17,0,27,11,-15,13,17,-17,
+        0,23,0,36,19,-21,4,2,-6,0,30,0,4,30,-5,8,30,7,20,8,
+        -10,22,-5,-22,7,4,-7,0,-14,0,-1,-8,-16,9,14,8,-50,25,0,28,
+        30,6,1,0,13,22,12,0,13,0,0,11,25,-4,32,11,0,18,1,-15,
+        17,13,-8,0,12,-18,17,10,-11,20,19,-11,0,-3,-18,17,-1,-22,12,12,
+        -14,35,18,-15,6,19,-16,14,9,-2,31,-2,5,15,17,-8,5,20,-2,17,
+        10,0,14,-3,-17,-1,14,-6,-36,1,0,25,-3,-14,20,5,-8,33,30,-4,
+        44,12,9,-3,23,1,31,20,7,31,0,-17,7,21,19,54,25,-3,21,8,
+        -14,3,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,4,
+        0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,0,5,0,0,
+        3,4,0,0,0,0,9,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,0,0,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,0,9,
+        0,-9,-2,14,0,0,0,0,0,0,0,13,4,0,0,0,0,0,0,0,
+        -1,16,0,0,0,0,0,0,0,-1,17,0,0,0,0,0,0,0,12,-2,
+        0,8,-3,0,0,0,0,1,27,0,0,0,0,0,0,0,2,7,0,0,
+        0,0,0,0,0,-9,5,0,0,0,0,0,0,0,-4,6,0,0,0,0,
+        8,13,-14,7,0,-4,0,0,0,0,0,0,7,0,3,0,0,0,0,0,
+        0,9,0,-6,0,0,0,0,0,0,4,0,10,0,0,0,0,0,0,7,
+        0,-15,7,22,-38,0,0,0,14,0,6,0,0,0,0,0,0,9,0,3,
+        0,0,0,0,0,0,7,0,-28,0,0,0,0,0,0,4,0,-6,0,0,
+        0,16,0,-17,-10,7,0,-11,0,-10,0,17,0,-3,-8,-5,0,23,-14,0,
+        0,0,-6,9,0,-51,0,11,0,34,-6,11,1,0,0,0,-12,0,0,0,
+        -13,13,0,-16,8,16,0,0,0,-2,13,0,0,0,0,0,0,11,0,9,
+        0,0,0,-1,0,12,0,-11,5,-37,0,55,-6,0,0,0,-5,5,0,4,
+        0,18,-20,-6,-14,-19,6,0,-2,20,-5,0,23,0,6,-17,-5,-25,15,-4,
+        0,0,0,-36,8,0,-5,31,-43,0,29,-31,-33,22,0,0,18,0,0,75,
+        0,-25,-2,-8,-26,27,-27,0,0,0,-10,28,0,0,0,0,0,0,0,2,
+        5,0,-41,0,-5,0,-1,0,-19,3,-8,0,10,0,0,0,0,4,5,0,
+        0,3,24,-1,23,13,-6,10,-4,-18,0,-16,0,13,0,-8,9,5,-29,-6,
+        18,0,0,0,-6,3,-31,-21,18,-2,0,18,-13,14,-10,2,0,0,1,0,
+        0,0,-13,-22,-37,-24,0,18,0,0,0,0,-1,-3,0,0,0,0,0,0,
+        2,9,-21,-33,0,-13,0,0,0,-8,0,-29,0,46,5,0,0,0,6,12,
+        10,0,-6,26,-21,0,-21,8,0,0,0,0,15,12,17,0,25,0,12,0,
+        11,0,-7,-3,22,14,24,6,0,0,0,36,21,28,15,0,0,0,0,0,
+        0,-6,0,17,0,3,20,40,-13,0,16,4,-2,24,-1,0,0,0,0,48,
+        0,11,0,1,0,0,5,2,6,0,8,0,-23,0,17,0,0,0,0,10,
+        14,0,0,0,0,6,18,-3,7,15,-2,0,0,3,2,14,0,13,0,6,
+        0,-12,0,5,14,6,10,18,-10,0,0,0,-1,12,8,5,40,-18,0,0,
+        0,0,0,0,5,40,-22,-31,35,0,0,16,0,2,22,-8,0,0,0,0,
+        17,0,6,13,9,0,0,0,0,15,0,11,0,-12,0,17,0,0,0,0,
+        -6,9,14,0,0,0,17,22,18,19,0,-5,0,0,-11,16,19,-7,13,0,
+        8,0,0,-22,-6,0,2,17,38,1,0,0,-25,27,11,-17,19,0,-2,0,
+        0,0,0,0,-11,-9,0,-3,46,19,-8,0,0,-7,-29,0,3,0,0,0,
+        0,45,-29,15,0,-5,0,0,-8,19,-4,-18,31,0,-19,0,0,0,0,0,
+        0,20,3,-10,0,0,0,28,16,-4,2,0,0,-5,0,0,0,0,0,6,
+        0,0,4,21,0,23,0,0,0,0,0,-4,0,0,0,0,-7,2,0,0,
+        -1,0,0,18,0,0,-4,0,0,-3,2,0,18,0,0,7,0,0,-43,0,
+        0,30,0,-21,4,0,0,-4,0,0,0,0,0,-4,0,0,-19,-1,0,34,
+        0,0,-7,0,0,-12,0,0,1,0,-12,-2,12,0,-21,13,0,0,0,0,
+        8,12,0,24,-11,0,12,0,0,-5,11,0,-12,25,0,0,0,-13,-3,13,
+        0,-20,12,0,8,0,0,-7,-6,0,-6,2,0,21,6,0,2,30,0,-20,
+        0,0,0,0,-29,4,21,0,-9,13,0,0,0,0,-6,-2,0,-6,2,0,
+        36,0,0,-9,0,0,-5,-11,0,-4,16,-12,6,0,-10,-10,0,-19,0,0,
+        0,4,0,-14,-26,22,-6,1,0,-32,3,0,-13,-9,0,-6,0,0,-11,2,
+        0,1,-45,0,-26,17,0,-32,-5,0,-24,0,3,-16,8,0,0,6,0,3,
+        -40,0,0,13,0,-18,4,0,-30,-1,0,-15,0,0,0,-12,0,-17,-41,-2,
+        -17,52,0,0,-10,0,-19,-14,0,9,1,0,-18,-8,9,0,-5,4,-9,-13,
+        6,0,-10,12,-17,1,13,-21,0,0,0,-8,10,0,-9,10,-6,-23,42,-8,
+        -7,5,0,2,7,-41,-16,8,0,-15,-6,-12,-8,2,-9,1,26,-22,5,15,
+        0,0,-11,0,0,-31,-21,-5,4,0,-1,11,-32,6,-14,0,-8,5,-19,-7,
+        2,-12,7,0,0,-10,-2,0,-4,6,-12,-7,3,-18,-16,9,-9,-18,11,-9,
+        -8,18,-10,-6,8,-10,-8,21,15,0,16,-29,-17,11,-9,-12,23,7,0,15,
+        13,-18,8,-10,-35,-12,-20,7,32,-39,-8,-22,-22,-19,12,-3,0,-1,-15,-2,
+        65,45,-24,11,0,69,0,-22,-11,0,-14,-15,13,-22,-44,25,12,-4,-3,-15,
+        -18,14,0,0,0,-9,-9,-2,-24,-10,16,2,-18,2,-9,-19,12,-24,-14,9,
+        -19,0,-17,-24,-16,9,-16,-15,28,-7,0,0,-7,-15,-7,0,-35,22,-11,0,
+        0,-9,-9,-6,-16,-45,-17,-29,-2,0,-26,-13,-7,-30,-19,12,-2,0,0,-21,
+        -4,26,0,-8,0,0,0,0,-5,-4,1,-7,-17,17,-31,0,0,-39,-8,16,
+        -13,2,12,4,0,0,8,-9,-6,-33,-12,19,2,-25,4,-9,13,0,-4,0,
+        0,-4,-10,25,0,20,0,-7,18,28,-5,10,-14,6,20,2,-10,24,31,-1,
+        6,0,0,11,0,-5,26,0,-11,-17,0,-1,3,0,-15,2,13,-4,-7,-13,
+        14,-1,0,-1,-3,0,0,2,-1,0,6,0,-8,8,0,-5,0,31,9,7,
+        0,-14,-15,4,10,-26,0,6,-4,16,-13,2,24,2,14,16,-6,25,12,-5,
+        53,-4,12,28,9,-5,8,27,-24,30,16,6,-28,20,15,25,9,-30,0,-8,
+        -10,18,27,-14,6,9,-15,0,0,0,-18,16,-19,3,4,-5,20,9,-30,0,
+        -23,-12,-10,7,0,0,72,0,36,-14,-17,-20,35,-6,-22,0,0,24,18,20,
+        -3,26,7,-13,4,0,0,0,-33,-1,37,4,0,18,0,41,0,-12,17,0,
+        -9,0,-6,-14,8,-4,-35,18,7,-13,25,23,-2,11,26,-7,44,0,-12,0,
+        -1,-13,17,7,-17,10,20,-8,0,1,-38,16,0,-47,-5,-5,-12,15,9,-8,
+        35,8,-9,9,-2,4,0,-28,0,9,-22,-13,18,0,-12,-8,35,-28,0,5,
+        -66,-2,-11,4,58,5,7,19,0,-11,3,7,-4,-16,20,5,34,29,-16,3,
+        0,0,0,0,0,9,0,0,10,0,0,0,13,0,11,0,0,6,0,0,
+        -5,0,0,15,0,7,1,0,0,0,0,0,6,0,0,6,0,0,-1,8,
+        0,14,0,0,2,0,0,-29,0,0,34,0,-13,4,0,0,3,0,0,21,
+        0,0,-1,0,0,-4,9,0,36,0,0,2,0,0,-7,0,0,1,0,-8,
+        -2,6,0,0,0,0,3,16,0,13,29,0,0,15,0,17,-2,0,0,14,
+        0,-10,22,0,12,8,-1,-2,24,0,0,0,0,6,9,0,7,1,0,-3,
+        18,0,17,-1,0,3,14,0,-33,6,0,50,20,-20,1,17,0,-2,8,0,
+        16,5,0,-3,8,0,14,16,0,1,0,0,2,13,0,-10,16,0,-2,10,
+        -3,5,0,-9,0,0,0,13,0,-8,13,0,-6,0,-2,0,18,0,-11,12,
+        0,-1,-4,0,0,26,0,-9,9,0,-9,0,0,0,11,0,-30,13,0,-3,
+        2,12,-4,10,0,-15,4,0,-16,-41,0,0,19,0,6,7,0,-2,9,0,
+        -22,28,0,3,1,0,-8,-4,4,7,24,0,0,3,0,-1,-9,0,4,5,
+        0,-8,-8,5,0,-24,-9,-38,-18,5,0,4,9,-2,2,10,0,0,-17,3,
+        -5,10,0,-17,5,3,-1,13,-11,-7,0,0,0,-4,0,-10,17,0,-1,8,
+        -13,-10,-3,-25,-11,-6,-6,-5,9,0,-11,-11,0,5,-11,-19,-2,11,0,-6,
+        19,-4,-13,9,0,-5,11,-1,-14,-1,-9,-14,0,0,0,13,0,-13,1,-19,
+        -17,1,-20,-19,11,0,-33,9,-11,-35,15,5,-10,20,-3,22,16,7,30,16,
+        -2,-7,13,0,-10,19,5,-25,18,-2,-19,6,0,0,20,-7,-3,21,1,-7,
+        2,-6,-34,5,-16,26,1,2,-13,23,-4,-37,-5,0,0,2,-23,-7,14,-6,
+        -19,26,8,34,20,-8,-4,2,-10,-25,8,-3,0,0,50,-1,22,6,-20,5,
+        0,-26,9,-12,-9,2,-10,-47,12,-14,12,29,-16,-28,24,-5,0,5,15,3,
+        0,4,-10,18,-7,-23,15,-9,-2,-1,-5,5,12,-14,-31,5,0,3,0,-9,
+        -5,3,-5,-37,6,-11,0,37,7,4,12,-9,-21,25,0,11,-6,-19,-3,14,
+        -14,-21,27,-16,-14,15,-11,-4,14,-23,-23,10,-12,0,0,-2,-7,16,11,-1,
+        10,-6,-15,6,-15,9,0,0,9,0,-8,12,11,-4,14,0,1,21,12,-8,
+        14,8,-15,17,6,4,6,10,13,13,18,2,9,0,-2,10,0,-1,17,16,
+        -2,4,0,-6,4,12,-10,4,5,-16,1,-4,-7,6,15,0,-1,8,-7,10,
+        0,-3,18,0,-1,13,24,10,2,0,-7,2,9,-26,16,0,-1,11,9,6,
+        -4,9,10,5,12,-11,11,10,-11,32,5,-22,8,7,-9,10,24,0,12,9,
+        0,45,9,-17,15,16,5,30,11,0,16,20,-2,20,5,6,52,49,0,25,
+        19,8,2,23,2,11,2,-20,9,-9,-15,-6,20,7,-25,-3,0,16,-16,-19,
+        16,14,-7,31,25,12,9,24,-2,0,25,-6,34,2,6,5,0,37,4,27,
+        9,-23,3,-13,13,0,-13,12,9,-3,18,6,-20,12,9,-13,14,14,2,-29,
+        9,-15,33,4,-23,18,19,5,3,9,-7,24,7,-6,21,1,-1,14,48,-10,
+        32,18,-1,0,21,4,14,2,-16,4,-2,-23,-5,18,8,-37,-30,0,37,-18,
+        -22,20,11,-13,17,22,7,35,19,4,0,8,17,5,4,-16,33,0,-20,10,
+        19,13,5,6,-10,13,4,-26,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-27,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-57,0,0,-31,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-19,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,16,0,0,0,0,0,-19,0,8,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,8,12,-26,-22,84,-14,2,0,-46,-6,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,
+        0,15,0,0,42,0,0,18,28,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-43,0,6,-23,
+        0,0,-59,0,3,-31,-32,2,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-10,-1,-31,-36,-1,
+        0,-40,46,-8,-8,13,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,18,-43,-37,-42,54,
+        -30,-14,0,-15,12,19,-5,-7,11,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-42,0,-87,22,
+        0,6,-40,0,-25,-29,-9,-11,-24,-9,29,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,-13,
+        -22,40,0,-11,-24,0,-14,24,-2,-22,-5,12,18,-9,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,21,0,3,-17,0,0,-2,0,13,18,11,-27,-21,7,6,25,9,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-30,0,5,-18,0,-23,-27,0,9,-27,-9,-16,-23,1,14,
+        12,0,-14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-7,12,-58,-21,38,-78,40,-28,-28,-1,
+        14,-31,-14,15,-26,23,18,-14,7,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,-43,
+        0,0,0,0,0,41,2,-16,23,4,0,20,18,21,31,51,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-31,13,0,-32,49,0,0,0,-50,-13,-7,-17,-18,-10,29,-22,38,
+        -15,-3,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-33,0,41,-12,0,-59,-38,0,-22,
+        -27,-31,-18,-37,-13,-30,-2,-15,-47,-16,2,-37,-14,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        20,-15,24,63,0,-37,65,0,-13,13,-10,-8,-10,10,4,25,11,10,14,1,
+        5,-16,9,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-21,0,12,-39,0,0,-42,0,-39,-21,
+        -43,-24,-27,-22,-18,17,7,-1,-11,31,-20,-29,-22,-64,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,17,52,43,5,0,0,-61,0,-20,17,-9,13,-15,21,36,7,16,7,15,
+        16,9,-16,16,40,17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,25,15,15,-62,0,0,0,
+        0,-36,18,31,5,-13,10,-2,16,10,-7,22,-4,-5,-17,24,1,9,-10,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-38,0,47,-30,0,7,-34,0,-8,-21,-3,-25,-26,4,
+        -23,29,12,-14,-9,7,-47,-14,6,-25,19,-4,-12,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-26,-58,-36,0,-33,23,0,-19,10,30,-3,-13,34,-23,20,16,-15,15,12,
+        -32,-21,23,-17,35,20,-19,18,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,
+        0,0,0,0,-3,79,48,0,27,0,16,1,-6,39,0,-33,0,-58,-28,85,
+        -24,-60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,22,0,0,21,0,0,0,0,0,
+        -52,0,0,-22,108,0,-19,-56,0,-24,29,-102,-79,47,14,-4,-35,-31,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,-1,-80,0,
+        -16,46,-6,-33,23,-26,14,24,-83,-9,40,17,22,25,20,20,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,10,12,
+        29,21,-12,-12,25,14,44,0,-1,0,-13,29,12,-4,0,0,5,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,12,0,0,0,0,0,0,0,0,-3,0,0,23,0,17,
+        0,0,0,0,0,0,50,0,26,0,0,29,5,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,14,-14,0,0,0,0,0,0,0,14,59,0,32,13,61,
+        -7,-18,37,22,71,109,0,27,46,28,3,21,74,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,56,0,0,36,65,
+        -4,40,11,0,17,-4,0,0,-6,27,13,-24,-2,48,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,
+        -7,0,0,0,0,0,42,84,0,0,0,1,-6,0,0,-52,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-14,58,-39,-14,-48,-32,-14,0,-31,
+        -9,11,-26,-21,14,-9,23,12,-19,-1,27,-12,-26,11,-12,15,11,-10,9,63,
+        -23,-30,21,8,16,110,-27,-9,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,97,47,0,0,
+        0,55,0,40,12,0,-7,-31,5,-19,58,-7,-15,10,34,6,-5,13,-44,-12,
+        -13,-6,27,0,0,0,61,0,13,0,-67,1,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -13,-51,-31,-83,-61,17,-49,0,2,-28,-49,-29,-22,-14,-13,-19,4,-6,-25,10,
+        -32,-72,-61,19,23,-14,-31,-47,0,0,0,0,0,8,0,0,-33,-32,-60,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-35,-5,-62,-46,0,-56,-22,0,-5,-26,-46,-35,-32,-13,
+        -19,-22,-9,-15,-13,4,-2,-27,5,-26,4,30,-21,-7,0,-62,50,0,0,-20,
+        0,0,-15,-9,-32,-20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,19,30,78,-37,0,0,-30,
+        0,5,12,6,-24,-14,14,13,7,-1,-4,10,42,-1,-3,12,-9,9,1,-1,
+        39,-48,-51,21,-7,0,29,-14,0,8,65,-1,-31,14,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-22,20,16,-21,0,32,-19,0,7,-17,-17,14,-2,11,-3,17,3,-14,-13,
+        0,0,-15,-8,-14,-20,-2,-6,-16,0,-15,-17,20,37,61,0,0,-21,0,17,
+        -31,4,-46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,27,84,0,-10,0,0,-58,0,0,8,
+        8,-38,6,31,15,20,19,-2,24,63,-20,5,5,-27,27,-2,12,32,-23,0,
+        29,21,0,-1,27,0,20,32,-14,2,10,19,13,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        13,0,34,-43,0,-25,6,-46,0,17,41,-11,-27,-1,19,12,-8,37,9,-21,
+        -3,10,24,-7,18,20,14,22,-46,0,22,9,0,32,-2,0,13,20,-20,-3,
+        18,23,20,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-26,-24,69,-25,0,-3,-46,0,-3,
+        -17,41,-11,-7,-19,-54,-12,25,-31,-12,89,2,-5,12,-34,-12,24,-9,-23,-32,
+        9,-69,0,0,-60,9,0,-16,-23,11,-26,4,-30,11,-16,-15,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-11,36,-12,-8,-32,-57,2,-18,-61,-1,13,-26,-14,18,-27,12,19,
+        -13,8,29,-7,-9,14,-17,23,15,-12,-6,30,-22,-34,34,0,24,21,-101,-1,
+        16,-37,-9,18,-21,28,19,-12,5,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,-42,0,
+        0,0,0,0,0,24,-13,-13,-4,3,3,3,13,3,23,-2,12,31,9,10,
+        24,-23,36,40,-1,0,34,0,0,23,-9,0,27,25,21,21,19,10,24,12,
+        22,29,-26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-30,0,-88,-73,-81,6,50,0,-82,-12,
+        -15,13,-8,2,7,35,17,-32,-12,21,-11,-23,-21,-45,64,55,-6,-31,0,0,
+        -69,0,0,-31,0,0,-16,2,48,10,-1,-3,16,43,-1,-21,39,3,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-22,11,-20,3,0,-47,49,0,-24,-15,-46,-8,-8,-14,-24,
+        10,41,-23,-19,39,-34,-12,9,-19,2,-10,-11,6,43,27,0,22,0,-67,0,
+        0,-24,2,-19,9,-40,-25,-11,-45,-22,-12,20,5,11,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,18,21,16,-35,0,0,9,0,0,13,44,4,-15,22,17,29,3,-3,17,
+        26,18,-2,15,-16,12,17,-2,27,-9,0,11,-8,0,24,11,0,12,9,-38,
+        1,15,-1,38,-14,-1,23,-1,15,-3,22,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,34,
+        -1,-15,0,-10,-2,0,9,-23,-37,-15,-30,2,-28,-2,5,-4,-12,-24,-7,-28,
+        -23,4,1,-15,-4,-20,-14,0,-17,12,0,9,12,0,-19,-32,-30,-19,-14,-16,
+        0,8,-11,-20,6,-5,-28,-6,-17,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,26,5,1,
+        0,0,3,0,-28,19,15,-24,8,22,44,12,19,17,22,17,21,-14,9,25,
+        22,9,16,12,31,-11,32,15,0,16,30,-2,17,26,-16,28,24,17,45,27,
+        12,8,13,-6,11,22,22,3,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,23,-39,0,
+        0,-29,-24,18,27,-7,-4,-35,6,43,20,25,18,11,12,20,-10,42,12,14,
+        52,1,40,79,-16,9,11,0,13,-14,0,23,-18,-2,-15,18,-19,30,27,-5,
+        25,0,12,-12,9,-5,23,-20,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-34,-90,-23,-12,0,
+        -71,-49,0,-22,-20,-5,-8,-20,-3,-11,18,3,-17,-14,12,-15,-24,18,5,13,
+        -4,-10,-19,15,-15,-4,29,0,3,14,-39,-16,5,-12,-22,-5,-7,11,10,-13,
+        -13,18,-13,-24,-2,-8,7,0,-9,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-29,-29,0,-13,0,0,-41,0,0,26,123,0,0,
+        42,0,-34,0,0,-23,0,0,-18,0,0,38,0,-36,23,32,0,0,10,0,
+        -15,0,0,-47,0,0,0,0,0,0,3,0,-3,-9,5,-27,-16,-18,-25,12,
+        -52,-9,-21,0,0,34,0,0,33,0,0,-34,6,-1,0,-77,4,0,21,-82,
+        0,-55,-12,-77,42,-13,-59,12,-29,-55,-36,-21,29,-19,-15,8,-9,-13,1,105,
+        78,-5,-36,-81,-14,7,-23,-1,-8,-4,-8,-1,-15,15,23,-31,-5,-46,-22,56,
+        -66,-14,-26,-5,-11,-6,-4,-2,-54,-14,3,6,-22,-8,-4,-22,-3,-2,-14,-3,
+        2,-1,13,4,-22,54,-23,-19,-21,-17,0,-69,3,-24,5,-2,7,-1,9,1,
+        -19,-50,48,-14,0,24,-28,-6,-20,-11,-6,6,-8,5,-12,10,8,5,-5,-23,
+        60,-19,0,-30,1,-17,-79,-2,-6,-1,5,18,-7,12,14,8,9,-34,0,0,
+        82,0,0,0,0,0,-15,0,-24,12,10,-29,21,11,25,5,0,-20,0,0,
+        7,-10,0,28,0,0,7,7,-9,8,12,12,11,9,20,22,-10,94,-16,-55,
+        -18,-12,46,-3,-10,-4,-10,-13,-23,-23,-14,-4,-7,0,3,-1,1,4,3,-11,
+        -3,104,-110,-7,-17,-9,-18,12,31,-7,-13,-20,-10,-2,-17,6,5,-1,10,13,
+        10,-9,-13,-18,0,-66,-37,0,-41,6,32,-25,-13,-23,-17,-13,-10,-8,-9,12,
+        2,-6,28,-4,-9,-18,7,-16,-17,35,-15,39,7,-1,0,-47,-5,-16,4,-2,
+        10,-2,14,15,19,9,23,16,1,3,-3,10,-5,-10,40,-37,0,21,-55,0,
+        -67,8,16,-3,-1,1,-6,8,9,0,9,11,30,-1,-8,2,10,10,-23,4,
+        -71,-5,0,-9,-6,-58,-23,-15,-6,-30,-8,1,-3,9,11,11,4,3,16,-4,
+        -3,8,10,3,10,33,22,0,42,0,0,24,0,0,-21,61,0,3,0,0,
+        -16,0,0,0,0,0,29,0,7,-46,21,22,61,32,0,-7,0,0,5,38,
+        0,-63,0,0,-36,0,0,-34,0,0,3,12,-6,5,39,20,12,16,-23,-11,
+        44,0,0,0,0,0,27,0,0,-25,0,74,0,0,0,0,0,-76,0,0,
+        2,3,0,14,-47,21,0,49,0,14,12,-45,-10,-10,-25,-10,23,47,-5,-1,
+        21,49,1,5,-39,-6,-21,3,-12,-16,1,-40,29,58,74,0,29,0,0,-9,
+        -39,-15,-11,-6,-3,17,37,34,13,1,20,16,3,-22,-2,-3,-11,-3,2,0,
+        10,17,24,11,-11,36,72,26,14,-35,6,6,-12,0,-8,-3,9,-12,2,118,
+        -34,13,-24,0,9,-6,26,-9,-20,-16,-3,4,8,8,14,17,6,-24,21,15,
+        79,4,19,29,-20,2,-1,8,3,14,-9,13,12,7,6,-1,55,0,98,19,
+        0,-29,-21,0,-4,15,34,-28,25,6,28,25,16,10,-53,9,97,0,-21,0,
+        0,-42,66,0,6,-17,35,14,9,-17,15,14,28,28,69,-9,2,-26,38,5,
+        14,67,-3,-10,26,-13,-13,-19,-15,-11,-9,-1,7,-6,1,15,4,-15,21,33,
+        48,29,8,-7,5,-22,8,-9,-22,-20,-20,-14,0,1,-5,5,11,-9,1,-10,
+        -13,-1,-124,30,9,65,-18,34,45,16,-16,-12,-7,-16,-15,-10,-6,-12,-5,-3,
+        -10,22,-9,-7,-4,13,-11,34,15,15,-33,35,34,40,-7,-16,-10,-2,6,-3,
+        12,10,10,12,9,-6,-1,6,1,12,15,-26,16,21,66,-44,24,36,16,6,
+        -29,17,0,2,-5,6,6,15,12,3,26,-1,7,4,9,1,0,-69,-75,10,
+        14,-20,14,54,18,-18,-10,-9,-11,-3,-2,4,9,2,2,6,10,-5,-5,-5,
+        7,5,2,1,5,40,-7,17,-37,-9,10,3,-22,-13,24,81,-43,-50,7,-5,
+        -63,-20,-3,-12,8,-6,-11,-3,-19,17,28,-9,36,13,-19,-44,-52,1,-13,13,
+        -33,-13,14,-4,68,41,-1,34,-22,-43,-32,-11,-3,-7,14,-22,-9,2,-8,65,
+        -52,-25,30,47,-8,0,-50,-4,42,-31,-76,-23,-13,-24,-23,65,58,25,-15,21,
+        -6,-13,-22,-19,-22,-33,-24,7,4,-8,-11,-1,-10,-15,-4,-12,-31,-18,-2,-29,
+        4,-12,-16,-7,-7,-16,-12,-5,-7,11,-8,-3,-17,-50,5,19,-10,-8,0,-3,
+        -11,-7,1,-9,-20,16,5,-1,-22,8,-3,10,-1,9,0,-1,2,2,12,-7,
+        -9,0,-6,7,-34,-1,-8,-10,-6,-3,-13,-7,1,2,5,1,-18,-13,-1,-6,
+        -15,4,-1,-1,-3,-6,-7,-5,-6,-1,1,13,6,4,20,30,69,-8,18,-8,
+        12,8,5,1,-10,-3,0,6,1,7,3,4,2,32,11,18,-66,37,-62,14,
+        49,0,2,-8,11,6,15,7,23,8,17,14,-18,16,67,-4,-15,51,0,1,
+        -16,-26,2,-1,24,-6,9,3,-1,6,8,8,-1,-32,4,-24,27,-9,-21,24,
+        -5,6,-2,-10,1,-13,-14,-8,-2,-1,-7,-1,0,2,-13,-15,16,3,3,7,
+        -9,-24,5,-2,10,-6,-7,-8,-12,-5,-4,-1,-1,0,5,6,5,-15,-5,11,
+        -4,10,4,17,26,14,22,19,-4,-5,-12,-8,-6,4,6,0,0,6,15,2,
+        -7,-6,-2,11,4,27,-3,11,-7,18,19,25,0,7,-9,-1,5,7,13,7,
+        13,9,8,5,-2,4,5,14,7,10,-9,-6,-2,9,5,31,8,-1,0,-9,
+        -9,-1,0,4,-4,2,6,5,2,-4,-2,-3,7,-3,4,21,17,-6,14,0,
+        18,29,6,-7,-12,-12,-7,-1,1,9,4,5,5,14,6,-4,-1,-2,10,5,
+        4,0,-8,53,6,6,-36,-35,-21,-14,-37,-17,-28,-12,-31,-27,-18,-7,-18,-41,
+        -26,-11,32,10,28,-3,-1,19,35,17,28,10,-14,34,4,39,19,10,6,20,
+        -5,-4,-30,29,25,13,-10,-28,50,-14,-12,2,-24,-25,-19,-28,-20,-10,-20,-21,
+        -5,-1,-1,3,-19,-15,-8,14,-2,6,-1,7,9,25,-4,7,-5,-14,-6,-8,
+        10,-4,-4,-5,4,-11,-9,-3,10,-1,6,7,21,8,21,15,-8,-16,2,-4,
+        -25,5,3,6,-11,-10,6,6,-1,-10,-2,6,20,17,25,-3,8,14,25,-1,
+        -1,-3,-11,-1,4,15,3,12,20,14,-10,6,5,18,12,5,-1,-8,-10,8,
+        -1,9,-17,-22,-9,-27,-17,-13,-12,-21,-4,-3,-6,-5,-17,-18,-10,16,13,22,
+        -1,0,-4,27,2,9,3,3,10,-1,16,8,14,11,11,-3,-2,-12,18,19,
+        2
+    },
+    {
+        -1,7,6,-11,0,-10,-15,3,-27,-28,8,22,2,5,-5,-18,-8,-8,-23,0,
+        -3,21,28,0,16,3,-13,27,13,9,6,4,7,-3,14,-6,-6,2,-13,8,
+        -8,-4,-4,7,-3,3,9,-9,-35,2,-21,15,24,-3,1,1,7,0,15,-30,
+        -14,20,24,6,-10,-3,-9,0,-10,-9,-5,-13,6,12,-3,-10,-14,-5,-12,5,
+        -15,-13,19,-12,-2,14,-21,-8,-33,-19,48,11,16,3,1,7,-21,13,10,22,
+        19,15,15,19,10,-22,-17,-9,-40,-5,-26,-3,-13,2,-30,-27,-7,-34,-10,-2,
+        28,18,8,19,1,-14,36,18,-1,39,11,-4,37,16,-20,32,20,5,16,-6,
+        4,-21,23,7,21,11,3,-3,-16,3,-23,16,-11,-17,-11,-9,4,-20,-12,6,
+        -8,-1,-17,-17,-2,-24,2,-9,-1,-5,4,1,12,-13,-5,10,-15,29,19,5,
+        1,3,-12,-6,10,-32,16,13,-27,1,15,14,3,-1,5,-12,13,13,9,16,
+        9,10,2,-1,-14,14,3,-7,14,19,-8,-6,-9,-41,7,-23,8,12,8,-13,
+        -11,-6,-54,1,-18,17,-17,-18,4,22,4,-30,-9,-28,-37,-5,-11,-14,12,-10,
+        -24,4,-21,-22,-10,-30,43,-48,-21,-33,22,-15,-42,10,2,0,16,5,4,-14,
+        8,14,11,2,8,8,0,-4,10,5,-15,15,7,5,-4,-15,-21,-18,-16,-37,
+        -7,-9,-6,12,-2,-13,5,-1,-25,-9,-23,16,-12,-11,-19,0,-3,-25,-20,-20,
+        12,21,-15,-17,22,-18,14,28,-2,5,38,18,1,1,-6,-6,18,-18,7,11,
+        28,1,17,12,-23,19,9,5,3,12,8,40,19,9,17,-13,6,-4,3,-7,
+        18,6,3,23,3,18,-4,1,-2,34,-12,-13,-7,-17,-8,-4,-3,2,5,-1,
+        -12,-3,0,-9,-2,-16,-12,-9,-4,-23,-15,-13,-20,-13,-17,-23,-6,-12,-4,-1,
+        -13,-18,9,-26,12,10,-12,-21,-13,-24,-40,-8,-45,18,-16,-35,3,18,-10,-11,
+        25,-14,7,38,-13,-19,5,2,-3,-8,2,-24,30,13,-11,-16,17,-28,10,-1,
+        -25,0,-31,-42,21,-1,6,17,24,4,7,28,-5,3,-14,-14,-6,-7,-19,6,
+        -4,7,11,-14,-23,-19,-13,-24,-9,-18,0,-4,-31,-8,0,-11,-5,19,-5,3,
+        15,-2,-26,-9,-23,-10,48,-1,-49,36,-54,0,-26,-36,-7,18,-13,33,11,-65,
+        36,-6,-5,-2,-13,-12,-25,-12,-30,28,9,-16,-34,-44,-40,-34,-6,5,-12,-57,
+        0,-29,-7,19,-14,-1,19,5,5,-4,0,1,-5,5,-3,-1,4,-22,0,8,
+        42,10,-13,3,22,-18,31,0,-22,-24,-12,-42,9,-8,-14,-5,-32,-21,-12,-12,
+        0,0,-12,-13,-22,-10,-26,-20,-12,-42,-9,-23,-12,-17,0,-52,-18,-24,13,0,
+        -44,15,19,3,26,11,-35,2,17,5,10,-9,6,-8,9,-45,20,-11,-27,18,
+        30,4,-14,27,-2,29,42,-11,-4,28,-11,-1,19,-41,23,21,15,20,25,19,
+        -11,20,9,25,5,1,8,-8,3,-15,6,7,-33,28,11,15,4,3,-29,18,
+        10,-2,39,20,27,15,26,1,26,-10,-11,-6,-18,-23,10,5,-2,6,-5,-16,
+        -4,-11,8,8,-22,-14,-17,-28,-22,-16,-6,-15,6,-25,-28,13,-2,-6,1,-18,
+        -28,-24,-20,-21,-21,-6,-11,-8,-18,-20,10,-28,9,-4,-25,-38,-30,-46,14,-27,
+        -66,-5,-28,-39,-9,13,-24,9,49,-34,4,53,-21,-12,7,-26,-35,-17,-43,-1,
+        34,-15,-7,-18,-21,-20,-38,2,1,-10,-33,-24,-43,-32,-55,-39,-17,-70,-25,-32,
+        -40,-12,-2,-11,-14,44,11,-11,35,3,-14,2,-24,-10,-13,-26,12,18,-8,-7,
+        -21,-22,-16,-27,-19,-14,-12,-8,-5,-14,-42,-18,-26,-19,-26,-48,-18,-42,-29,-31,
+        -4,-13,-33,24,-36,-27,27,-17,-25,-9,-16,-15,-19,-27,-25,23,-16,-26,-15,-21,
+        -15,-21,-22,-13,3,-40,5,-5,-28,-45,-18,-44,2,-14,-74,-13,-44,-51,-10,11,
+        -23,7,34,-18,-5,42,-19,-23,4,-32,-29,-21,-55,-13,32,-28,-8,-20,-26,4,
+        12,8,4,9,2,3,8,-1,-5,-8,-1,-14,12,-3,-28,-3,-22,-14,19,5,
+        6,34,19,25,20,27,8,12,10,8,8,9,2,20,12,15,20,12,21,17,
+        9,-46,-42,-36,-42,-13,-27,-47,-35,-32,-56,-60,-46,-42,-44,-58,-46,-44,-50,-42,
+        -23,-28,-43,22,16,-48,12,-25,-52,-41,-34,-48,-35,-43,-21,-16,-23,-51,-38,-19,
+        -49,13,17,20,-5,15,26,5,-5,23,5,3,6,-11,-11,-23,-20,-53,1,-10,
+        -34,21,14,-4,-3,31,7,18,35,15,19,11,11,3,-5,-25,21,18,20,21,
+        19,11,14,9,14,2,-1,1,-3,-1,5,10,0,-27,-8,-28,-56,-43,-20,-38,
+        -40,-23,-39,-22,-1,4,-5,-33,19,17,-1,14,1,-2,-5,-11,-25,-47,-33,8,
+        7,7,-3,-24,8,-40,13,17,11,12,-36,-34,-27,-40,-20,-5,-35,-28,-20,-50,
+        -32,-21,-35,-38,-38,-34,-34,-36,-38,-36,-21,-21,11,21,-29,2,-21,-37,-27,-17,
+        -31,-30,-24,-33,7,-22,-41,-29,-10,-44,13,22,17,17,2,4,9,-5,-6,23,
+        -12,19,31,-12,-14,-5,-25,-30,-7,-55,8,-3,-38,12,25,1,2,24,-5,37,
+        33,-14,-7,18,-15,-33,-27,-51,16,36,-16,-3,3,-18,-28,22,-5,21,1,-5,
+        -5,26,10,18,22,5,18,20,2,7,14,-2,6,-30,-12,-19,5,9,-27,38,
+        15,11,-27,31,32,45,23,5,25,16,3,-28,-18,-19,24,5,15,24,14,1,
+        25,5,18,20,11,12,23,17,-20,-14,-6,-19,-6,-3,-2,11,3,-27,-36,-19,
+        -58,-17,-49,-8,-30,-45,-2,-4,6,-3,31,15,48,16,-8,-16,-22,-3,-12,-10,
+        -31,-14,1,11,-21,-13,-12,-48,19,25,15,24,25,8,41,27,-38,-19,-20,0,
+        -17,-34,12,-37,-36,-36,-3,8,0,-8,-12,-24,-25,-27,-18,-15,-8,-37,-6,42,
+        37,25,-14,-50,-19,-24,0,-11,-71,15,10,-6,-42,-41,-3,-44,3,-17,-34,0,
+        0,-18,-22,26,0,4,-17,-8,3,1,-53,17,-17,-15,5,-10,-49,0,13,1,
+        5,0,-58,18,0,10,0,0,31,-15,4,11,-8,-5,-1,-26,0,-14,6,-14,
+        28,-10,-27,7,-35,3,9,-7,0,11,-3,-10,3,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,30,14,18,1,24,15,15,18,29,20,14,5,-3,2,
+        -32,2,-6,-1,25,22,7,-24,15,32,36,29,17,24,23,12,3,-7,-44,33,
+        26,5,22,12,10,12,16,23,32,10,13,33,26,20,13,-8,0,29,11,19,
+        2,-10,6,-11,25,9,-2,-12,-9,-24,-43,-17,-55,-11,-34,-39,10,-12,-4,-9,
+        9,14,28,31,-7,-2,-2,-6,-24,-32,-24,5,1,-4,1,-19,3,-37,-1,7,
+        -3,-1,6,-1,7,19,-19,-5,0,5,-7,-25,-20,-18,-14,-11,-7,-25,-22,-16,
+        -35,-22,-23,-8,-17,-36,-29,-15,-23,-31,-14,-14,-15,8,23,-26,-6,-3,-33,-27,
+        -18,-61,-18,-29,-36,-1,-8,-39,-25,-11,-43,4,13,0,12,4,-13,7,15,-21,
+        -8,0,8,-6,9,3,14,-2,-13,8,-22,16,21,-16,-2,9,-21,-1,18,-39,
+        26,12,-25,19,24,8,-18,34,17,42,39,4,0,18,-7,-8,-1,-38,25,30,
+        3,0,2,-14,-26,20,-9,25,14,-1,14,37,16,0,0,0,38,16,-11,24,
+        16,13,2,-11,7,-18,17,7,-7,4,4,5,4,13,-16,26,8,-8,28,13,
+        16,-8,31,1,30,28,10,0,0,-4,-13,-21,-27,11,18,-9,9,-11,-11,-38,
+        7,-7,9,9,-13,24,23,17,0,0,0,34,-10,1,22,21,-11,0,-5,-38,
+        4,-20,0,15,-20,-22,-14,-11,-12,13,-21,24,-4,-8,13,20,-7,-9,31,27,
+        10,31,5,-24,-5,-5,-13,-18,-34,-5,16,-2,-21,-8,-14,-34,13,-6,33,-7,
+        10,-10,11,17,0,0,0,25,-9,-1,-7,5,-5,-13,2,-15,-18,-4,-25,-10,
+        18,-26,-22,-16,-45,-50,7,-32,-2,-1,-26,1,-8,13,-24,22,13,12,34,-15,
+        -6,14,-13,26,0,-42,40,31,7,2,1,-6,-16,26,-3,8,15,-11,-7,24,
+        16,0,0,0,31,-14,-15,6,5,-29,-16,12,8,5,6,-4,-8,15,3,-16,
+        16,-10,10,20,-8,-12,-3,-4,-7,15,17,3,-9,21,21,-31,12,-7,38,33,
+        18,49,16,0,27,21,6,27,22,4,39,7,16,31,1,10,42,31,17,0,
+        0,0,30,8,12,20,30,8,23,10,-21,-13,-21,-19,-24,-12,-17,19,-6,-30,
+        -16,-19,-27,-1,-28,-26,0,-9,-8,-17,-2,0,6,-5,10,12,-1,-24,-18,-24,
+        -37,13,-16,-9,0,-19,-22,-7,-7,-33,12,31,47,0,14,7,5,19,0,0,
+        0,41,24,28,-22,-19,-11,-3,22,-17,16,13,-11,4,28,38,48,42,-29,10,
+        -1,-5,-36,12,-21,30,13,11,13,10,0,-18,3,36,2,58,-7,-1,24,13,
+        34,12,-10,-12,17,-38,17,7,-19,-12,29,18,24,11,25,32,20,23,0,0,
+        0,20,42,31,44,49,28,-19,27,-28,41,19,11,17,20,32,0,42,11,-1,
+        19,7,0,-5,-6,21,21,-4,7,18,17,14,15,7,15,24,9,5,37,16,
+        32,-15,5,0,48,13,29,36,17,38,32,14,18,27,9,27,37,32,35,0,
+        0,0,33,17,30,52,29,23,41,28,2,58,36,0,7,13,12,3,1,45,
+        32,-9,0,-14,5,17,-6,-20,14,-36,-10,-8,9,2,-17,16,18,5,-2,-2,
+        -17,17,6,-29,-21,-11,1,-5,3,-14,-9,9,-36,21,25,-5,-1,34,10,26,
+        35,0,0,0,-2,15,31,16,5,7,-1,10,-26,0,6,0,-2,12,-18,-33,
+        5,-29,3,6,-28,4,0,-20,-7,41,-32,37,7,-17,10,15,0,6,43,-1,
+        20,51,-1,-14,2,-27,-31,-2,-28,8,19,-11,-6,-13,-11,-51,5,-11,13,0,
+        5,0,0,0,0,0,0,0,0,0,3,5,-21,-8,45,-31,20,48,7,0,
+        7,5,0,3,-11,-7,13,5,-1,9,-3,-13,-31,13,-38,9,-6,-16,26,5,
+        1,-6,47,12,57,39,5,-11,-27,-18,-33,-10,-9,-3,-14,1,-13,-31,-21,-44,
+        -12,-23,-8,0,1,0,0,0,0,0,0,0,0,0,13,1,8,16,8,-2,
+        21,32,-6,-9,-26,-23,-8,-11,-36,-12,-20,-5,5,-10,-20,-12,-17,-32,17,-8,
+        28,-17,-24,0,7,6,-3,30,4,47,45,5,-30,-6,-13,-3,-25,-15,4,5,
+        -8,-5,-23,-10,-36,2,7,9,0,12,0,0,0,0,0,0,0,0,0,-13,
+        2,-3,-32,13,1,23,15,10,-9,-26,-16,-14,11,-8,-30,-28,-29,-1,-24,-23,
+        9,-12,-14,-9,21,-29,7,-1,-3,-17,-35,-18,18,46,-12,-4,62,-2,-49,-25,
+        -28,-4,-23,-22,-29,-46,6,-33,-8,-9,-47,-17,-14,14,0,-15,0,0,0,0,
+        0,0,0,0,0,-16,-10,-26,8,31,-20,-14,50,-5,-26,-22,-25,-30,21,23,
+        15,10,6,8,11,2,10,33,21,31,33,16,37,21,17,27,35,19,16,36,
+        22,33,32,28,24,6,-7,-11,-33,-15,-32,14,-8,-1,-3,-29,-10,-33,-4,7,
+        8,0,5,0,0,0,0,0,0,0,0,0,27,13,23,37,22,31,49,21,
+        21,7,-14,5,-15,-9,-9,2,-10,-33,-4,-25,2,2,-15,-14,-3,-14,-39,50,
+        4,-10,4,23,20,15,12,-16,26,40,48,39,27,-15,-5,1,-46,0,-13,0,
+        3,16,-8,-18,8,-42,4,7,-7,0,11,0,0,0,0,0,0,0,0,0,
+        -4,-9,-6,-13,35,14,19,23,36,-5,-21,6,-11,0,-1,37,17,19,0,30,
+        22,36,21,-23,28,21,36,10,1,-6,41,-13,19,45,36,6,-17,14,17,0,
+        1,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,41,2,20,58,34,0,51,46,16,13,-37,
+        5,-22,15,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-6,27,8,4,
+        0,11,33,28,16,-30,-16,-7,20,25,39,6,2,5,3,50,0,-26,33,0,
+        47,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-2,-15,-5,-14,-1,24,23,33,38,-4,
+        -9,8,16,-2,-4,0,0,0,15,24,10,-2,19,-14,17,26,-15,11,18,-21,
+        2,31,-39,18,27,-20,35,33,29,3,45,25,46,62,25,1,18,-9,-21,0,
+        -39,20,36,0,1,10,-15,-21,24,-7,26,1,-1,2,24,15,0,0,0,32,
+        0,-3,14,23,-12,-2,16,-22,40,42,18,9,15,-1,-8,33,-13,41,0,-2,
+        8,28,28,24,10,17,-17,21,10,0,31,18,-14,22,20,-17,56,14,2,50,
+        22,29,15,20,40,28,35,27,28,17,16,28,-3,3,27,5,39,27,16,18,
+        21,11,17,26,15,14,28,26,29,0,0,0,18,10,24,28,18,8,15,15,
+        -3,10,22,14,27,21,13,5,15,14,38,0,16,26,12,15,17,24,6,16,
+        22,26,0,-11,15,26,-14,6,12,-6,13,16,11,41,50,41,18,38,56,52,
+        49,41,-9,-1,3,-30,-8,-25,14,7,10,-18,-5,-5,-41,16,22,32,24,25,
+        12,36,33,0,0,0,11,14,22,11,22,-3,-10,3,3,16,31,27,-11,-2,
+        1,-13,20,19,41,0,33,5,16,21,-11,-9,5,-18,-20,-14,-13,27,-13,0,
+        5,-2,22,33,-26,21,-3,0,-3,6,5,4,47,13,24,58,8,-27,-36,-17,
+        -35,-1,-42,-16,-29,-27,-34,-44,-24,-47,6,1,-8,-3,2,-18,-13,16,0,0,
+        0,-10,-1,-17,-9,-18,-13,1,31,-6,0,43,5,-24,-18,-12,-36,4,-2,-27,
+        0,-1,-2,31,-17,-9,28,30,30,20,8,25,35,6,15,40,21,37,36,25,
+        20,38,24,19,39,12,25,49,30,30,48,32,31,-3,-16,1,-41,-17,-35,-1,
+        1,4,-8,-26,-9,-34,-6,-9,-10,5,-4,-15,-17,-9,0,0,0,6,-16,-9,
+        28,11,19,40,21,13,24,17,31,-3,-26,-5,-21,-9,-13,-23,0,-15,36,20,
+        27,-14,-12,-6,4,-2,-26,-24,-1,7,-13,-13,-10,24,-12,-7,32,23,33,14,
+        30,21,34,40,13,25,43,27,41,36,-12,-2,-15,-53,5,15,-14,7,13,-15,
+        -32,2,-44,-11,-9,15,0,0,0,0,0,0,0,0,0,0,0,-5,-6,-6,
+        -12,17,15,28,24,43,-9,-31,1,-19,-15,-8,0,0,0,-8,18,26,-16,-22,
+        -20,20,22,21,-4,20,-7,10,36,-12,12,21,-18,5,22,-26,16,25,-18,43,
+        41,32,8,51,49,16,59,30,35,35,33,21,41,-2,49,39,44,36,40,28,
+        22,29,31,41,36,27,50,43,48,0,0,0,53,27,27,25,31,-9,10,26,
+        -4,32,51,33,43,45,35,28,37,32,50,0,33,9,23,27,37,40,40,1,
+        38,30,36,24,22,28,36,14,13,46,36,38,55,33,43,40,38,44,49,33,
+        48,52,38,45,48,40,38,4,-5,-9,-24,-10,8,-4,0,-3,-5,-27,-3,-39,
+        -12,-6,-9,-3,2,1,5,16,0,0,0,5,-13,-9,42,23,35,43,32,40,
+        41,35,39,-5,-25,-12,-32,-18,-17,-10,0,-13,46,28,35,-17,-29,-26,49,-25,
+        -12,2,-1,-17,0,-4,-17,-7,-4,-15,-5,-7,-19,9,-20,-10,2,-4,6,6,
+        9,4,18,30,18,30,19,-26,-18,-10,-26,-16,-21,-21,-3,3,-28,-19,-6,-35,
+        1,7,-7,9,4,-9,6,16,0,0,0,12,-7,5,-12,-11,-11,-20,-5,-4,
+        -4,7,4,-26,-21,-3,-23,-5,-2,-3,0,-4,-22,-17,-13,-15,-16,-16,-22,-17,
+        -7,1,0,0,0,0,0,3,0,0,-3,1,0,0,5,-2,0,0,0,0,
+        0,0,-4,0,0,-5,2,0,-3,0,0,0,0,0,0,0,0,2,0,0,
+        -6,2,0,-5,0,-10,-4,0,0,0,2,0,0,0,0,-12,-11,0,0,-4,
+        4,0,-7,0,11,-26,0,0,0,0,0,0,0,0,0,0,47,-32,0,4,
+        0,0,-3,-5,0,0,0,-4,-2,-14,0,3,-10,0,0,-4,-25,0,10,0,
+        -28,-16,31,0,-12,-22,0,0,0,0,0,0,0,0,0,6,0,0,0,0,
+        0,-5,0,0,-4,13,0,0,0,-12,-10,-15,0,5,-26,0,-14,-15,0,0,
+        -1,0,0,-26,0,0,7,-28,-38,-11,-6,0,-1,0,14,0,0,6,0,0,
+        -14,0,0,-6,0,0,-15,-11,0,-13,0,0,5,0,0,0,1,0,0,0,
+        0,-3,6,0,3,-11,0,-1,-25,9,14,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-27,0,5,0,0,4,-2,0,1,0,7,
+        9,-6,0,10,3,0,-3,0,8,19,11,0,7,0,0,-2,7,0,5,0,
+        -3,1,5,0,7,2,0,-5,-16,0,13,-4,8,16,-13,0,0,10,4,0,
+        -1,0,0,-14,-1,0,-13,-27,0,0,0,0,9,0,0,8,0,14,0,0,
+        27,0,0,23,0,19,44,0,0,20,29,0,23,0,0,4,23,35,8,0,
+        0,-4,0,0,-2,-2,0,2,0,7,0,-6,0,1,-9,0,5,0,-5,0,
+        3,14,-3,3,0,-2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-7,0,0,0,0,0,-8,0,9,0,0,-4,13,0,0,0,
+        16,10,1,-5,-8,1,0,5,-14,8,15,0,10,18,18,21,11,0,8,0,
+        0,0,0,0,0,0,0,0,0,-2,0,0,0,10,0,0,0,0,0,0,
+        0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,
+        0,0,0,0,0,0,0,0,11,0,0,0,0,0,0,0,0,0,38,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,3,0,0,0,0,0,0,0,0,5,0,0,17,14,0,19,0,26,13,
+        0,2,7,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,28,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,
+        0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-1,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,21,2,0,23,0,
+        18,22,5,0,-30,16,0,43,-8,0,13,19,3,14,14,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,22,0,0,0,0,0,0,0,0,-20,0,0,
+        0,0,0,6,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,
+        0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+        0,0,0,1,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,-26,18,0,7,
+        0,-3,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,
+        -8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,-11,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-10,0,0,-23,-20,0,-16,0,0,-12,
+        -14,-19,-12,-7,0,-17,14,-15,0,0,0,0,0,0,0,0,-12,0,0,0,
+        0,0,0,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-21,0,0,0,0,
+        0,0,0,0,-18,0,0,0,0,0,0,0,0,0,0,0,-38,0,0,0,
+        0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-2,0,0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,9,0,0,0,0,0,0,0,0,27,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,-12,0,0,-28,0,0,-24,0,-1,0,0,1,
+        8,1,0,0,0,-15,-8,-11,0,-8,-34,6,-9,0,8,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -1,31,0,-1,-2,0,2,0,0,-5,0,0,0,0,0,0,0,0,0,-7,
+        0,-16,0,0,0,0,0,5,0,-13,-5,-15,0,2,20,0,4,-14,0,7,
+        0,-15,-5,16,-4,3,-8,7,0,13,12,0,0,7,7,-17,9,9,18,10,
+        0,0,0,0,0,0,0,0,0,0,10,24,0,20,-5,-6,-3,0,-6,-11,
+        0,1,0,-32,-17,-23,-35,2,-17,0,6,0,-19,0,0,0,0,0,0,0,
+        -31,0,-5,0,-29,0,-37,-15,-7,-3,0,-28,-11,0,-5,-6,3,8,-15,0,
+        13,-17,10,-6,-2,0,0,0,0,0,0,0,0,0,0,0,-24,0,8,-7,
+        13,-9,-19,-24,0,0,0,0,0,0,0,0,0,0,0,0,0,10,10,10,
+        9,-6,-17,0,0,0,0,0,-16,0,0,-2,0,0,0,0,0,0,22,15,
+        0,0,-13,0,0,0,0,0,0,22,14,-5,0,0,1,-7,0,0,7,13,
+        12,15,0,-41,-8,7,0,4,0,0,0,4,0,0,0,0,12,0,0,0,
+        -9,14,6,0,0,-24,0,0,0,0,0,23,17,0,11,18,0,21,0,6,
+        40,29,0,16,27,1,0,10,0,0,0,0,12,25,9,0,0,0,0,0,
+        0,0,0,0,12,0,0,-4,0,0,0,0,0,-4,-9,0,6,-8,0,1,
+        0,0,0,0,0,0,0,0,0,-15,0,-19,0,0,0,0,0,0,0,-15,
+        -26,0,0,0,0,0,18,0,0,4,0,0,17,0,5,-13,2,0,17,15,
+        8,0,14,-6,-19,0,34,25,-9,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,14,16,0,18,7,0,25,11,15,17,5,23,42,10,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,14,0,0,0,0,0,0,0,-16,0,0,0,0,0,0,0,0,6,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,19,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,
+        0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,0,23,0,0,
+        0,0,0,0,0,0,18,13,0,0,6,0,3,0,-15,-4,22,0,4,15,
+        0,17,4,0,0,4,12,-16,18,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,22,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,-5,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-5,-12,0,-18,-21,0,0,-2,-15,-16,-22,-21,19,-11,0,2,
+        -6,-29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-7,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-11,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-12,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-12,0,0,-11,-4,-16,-32,0,13,0,-11,0,-11,
+        0,-9,0,0,0,0,0,0,-4,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-6,0,0,-1,0,0,8,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,
+        33,0,16,-16,0,0,0,0,-8,3,3,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,-1,5,0,1,0,0,0,0,0,4,0,-17,-2,-9,28,0,
+        0,-13,-26,0,-10,-20,0,0,-4,0,0,-9,-6,-17,0,0,0,0,0,0,
+        -16,0,0,0,0,0,-11,0,5,-2,0,0,0,0,0,6,10,-21,-22,0,
+        0,0,-23,-2,-7,0,19,0,-3,15,0,0,-7,8,19,-8,0,-1,-2,11,
+        0,0,12,0,0,-3,0,7,0,0,0,0,0,20,0,0,0,13,0,0,
+        0,4,0,0,0,0,0,0,28,6,0,5,8,7,-2,-20,0,8,12,0,
+        5,0,4,-5,13,10,8,0,8,14,0,2,-4,13,20,-7,0,-3,14,23,
+        16,-1,11,0,-2,3,-8,-4,21,0,-2,11,0,32,2,0,24,34,0,46,
+        7,0,14,2,24,0,0,20,0,0,35,0,0,0,17,0,16,0,0,0,
+        11,0,5,26,12,21,9,15,20,-13,0,-25,-11,0,-4,-8,0,-14,-20,-12,
+        -9,-3,-23,0,-14,-10,1,-8,-19,-16,-5,-9,15,-11,-35,0,0,0,0,0,
+        -33,0,0,0,-21,0,0,0,0,16,-2,-4,-29,-26,-19,-14,0,0,-17,-11,
+        6,0,-5,-1,-14,-8,-16,-24,-15,1,-12,-12,4,-9,0,18,-26,7,7,30,
+        -11,14,13,34,-11,-30,28,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,16,0,29,4,0,7,0,4,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,
+        0,0,3,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,
+        -3,0,11,0,5,5,16,0,15,12,0,0,0,19,0,8,0,12,15,17,
+        25,6,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,24,0,0,0,0,0,15,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
+        0,0,7,0,0,0,0,0,0,0,0,-15,0,0,0,0,0,0,0,0,
+        19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-13,0,
+        -16,-15,-2,0,0,0,-11,-1,-18,-5,-3,0,0,-5,0,-20,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-10,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,-5,0,0,0,0,0,0,
+        0,0,0,0,0,0,-4,0,0,0,0,0,0,0,0,18,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,-14,0,-15,-13,
+        -28,0,-11,0,5,-27,-7,-16,0,-36,0,-22,-23,-22,-17,-18,0,-35,7,11,
+        -31,2,-6,-4,0,0,0,0,0,-11,0,0,-18,-10,0,0,-7,-20,0,0,
+        0,0,0,0,-4,0,0,-7,-4,0,-2,0,0,0,0,0,0,0,0,-1,
+        0,0,-17,-4,0,-1,0,-16,0,0,0,-7,-7,0,0,0,-5,-3,-5,0,
+        0,-11,-9,0,-11,0,-9,-9,-12,0,0,0,0,0,0,0,0,0,-16,-20,
+        0,-7,0,0,-10,-12,0,-10,0,-11,-8,-10,-5,-7,-11,0,0,-17,-16,0,
+        -13,0,-16,-10,-22,-10,-11,-19,9,0,0,6,19,0,15,0,8,5,22,9,
+        2,2,11,-1,0,0,-10,-4,0,-7,0,-10,-6,-13,-8,-6,-15,9,-4,-12,
+        0,0,5,-11,0,-11,0,-26,-13,-23,-10,-12,-32,-6,-16,-14,-3,0,0,-3,
+        -5,0,-3,0,-13,-3,-13,-5,-8,-8,0,-11,-23,-8,-5,0,0,-12,-2,0,
+        -3,0,-6,-1,-6,0,-3,0,12,1,-22,2,3,0,0,0,0,0,0,0,
+        0,0,0,-11,0,3,7,25,0,3,-35,10,-7,8,0,0,-1,0,0,6,
+        0,5,7,5,-1,-2,-3,10,4,-6,-2,6,26,13,0,0,0,3,4,0,
+        -2,0,3,3,-3,0,-1,0,4,11,-15,8,1,0,0,-2,1,0,0,4,
+        10,0,-3,0,10,-7,12,0,-8,-7,9,10,-3,0,2,9,10,3,13,6,
+        0,0,-5,32,0,1,0,9,4,12,6,2,2,-1,7,-2,2,10,24,7,
+        7,0,4,-2,0,0,-11,-9,0,-1,0,-13,-1,1,8,0,-2,11,-6,-12,
+        -2,5,1,5,0,1,11,6,-8,0,0,-12,0,0,10,0,0,-18,-30,-13,
+        -9,-9,-9,0,0,-2,-26,-22,-10,-19,0,-2,-3,0,-4,0,0,-9,-2,0,
+        -5,0,-10,-1,1,-6,-3,-1,5,-2,-1,-1,2,5,3,1,-1,3,4,-9,
+        -1,0,0,0,0,0,0,0,0,0,0,-5,0,0,-8,9,0,0,0,0,
+        0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,
+        14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-9,0,0,0,0,0,0,0,0,-1,0,0,-10,3,0,1,0,
+        3,-5,8,15,-1,-11,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,
+        0,0,0,0,0,6,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+        0,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-2,0,
+        0,0,0,0,0,0,0,-11,0,0,0,0,0,0,0,0,6,0,0,0,
+        0,0,0,0,0,10,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,2,0,0,0,0,0,0,0,0,3,0,0,4,-1,0,
+        11,0,-7,6,4,-9,-4,0,0,1,-2,2,6,-3,-1,7,10,0,0,0,
+        0,1,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,5,
+        0,0,0,0,0,10,0,0,0,0,0,0,0,0,9,0,0,0,0,0,
+        0,0,0,8,0,0,0,0,0,0,-5,0,0,0,0,0,0,0,0,29,
+        0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,-14,0,0,0,
+        0,0,0,0,0,5,0,0,0,0,0,0,0,0,7,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,-10,-7,
+        0,-18,0,-12,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,0,0,
+        0,0,-17,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,0,-16,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-8,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-9,0,0,-14,-9,0,-8,0,
+        -15,-13,-15,-12,-9,-27,-16,-12,-19,-32,0,0,0,0,0,0,0,0,-4,0,
+        0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,-5,0,0,
+        0,0,0,0,0,0,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,-3,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-11,0,0,-23,-8,0,3,0,-17,-9,
+        -11,0,-10,-1,4,0,6,-1,-8,-13,-15,0,8,0,1,1,-1,-11,0,0,
+        0,0,0,-15,0,0,-23,-27,0,0,-17,0,0,0,0,0,0,0,-3,0,
+        0,-15,3,0,-5,0,0,0,0,0,0,0,0,-7,0,0,-4,0,0,-6,
+        0,9,-2,3,0,-3,-15,0,-7,0,9,-14,-11,0,0,0,-26,0,-20,0,
+        -14,-11,6,-16,0,0,-4,-37,0,3,0,0,-16,28,0,-5,4,0,-10,5,
+        0,-6,-17,-19,-7,-5,-8,-11,-5,10,0,-6,-1,0,-5,-15,0,-13,-5,-11,
+        -4,-8,-2,0,0,-12,9,0,-5,0,-2,11,22,4,-4,11,4,0,-8,0,
+        -2,-2,0,1,-9,1,-1,-6,-15,-9,-3,10,-6,-9,-16,0,-8,-24,0,-4,
+        0,0,-14,-10,-22,-5,-12,13,-1,-12,-3,-11,0,-7,-4,0,-6,3,-6,-7,
+        -6,-9,-3,-3,18,-2,-8,-3,-11,0,0,-15,-12,0,-8,0,-11,-8,-7,4,
+        -3,-2,26,5,-11,0,-2,0,0,0,0,0,0,0,0,0,-7,0,0,1,
+        0,35,0,-5,-4,1,0,11,0,0,-14,-10,0,-8,0,11,-5,-1,-9,-6,
+        -1,13,6,-3,-2,-18,0,0,9,0,0,-15,-4,0,-7,0,0,-16,-14,-21,
+        -2,1,2,3,4,1,-3,7,-15,-3,-6,0,0,-9,-11,-6,-10,0,15,-13,
+        1,-8,0,-8,15,-1,-7,-2,-12,-12,19,-4,-21,6,0,0,4,22,0,2,
+        0,-3,7,6,-7,-6,9,-2,-2,5,12,0,0,0,7,24,0,-8,0,0,
+        -4,-16,0,0,0,-1,1,-2,-9,-4,-1,17,2,-4,1,4,-1,5,-3,-5,
+        0,3,-8,0,0,-10,0,0,-4,0,0,-11,-20,-27,-11,-21,0,-2,-8,-15,
+        -13,-13,-12,-13,-16,0,-1,-30,-5,-14,0,-7,-10,0,-7,-5,-1,-6,-7,-19,
+        -7,-9,9,-2,-13,-8,0,-3,0,-2,-12,0,-9,-18,4,-4,0,0,0,0,
+        0,0,0,0,-17,-1,0,0,-6,19,0,0,0,0,0,0,-3,0,0,3,
+        -9,0,-21,0,0,0,0,0,0,0,0,2,0,0,0,21,0,0,0,0,
+        0,0,0,-6,-8,0,1,0,-2,-1,-5,0,0,-11,-2,0,8,0,-12,0,
+        -10,21,0,0,0,0,0,30,0,0,-7,10,0,-12,0,0,-29,0,0,-14,
+        0,-10,-15,-11,-8,1,-2,8,12,-2,2,6,3,8,8,1,6,12,-13,16,
+        0,0,0,-3,-14,0,6,0,0,0,2,19,-19,9,-24,4,0,0,-9,2,
+        0,0,-5,6,-2,2,0,0,-3,-7,11,-4,0,0,10,12,0,-15,-4,1,
+        3,-11,23,-7,15,12,2,10,10,0,0,-17,-17,0,-6,-11,0,2,-4,0,
+        -12,11,20,-5,9,2,2,0,5,-6,5,0,7,0,1,8,-4,10,-6,11,
+        8,10,6,2,3,-23,0,0,-4,14,0,0,0,8,0,-8,3,2,15,16,
+        4,13,7,9,0,9,0,0,5,-3,0,9,0,3,12,15,-17,-6,14,5,
+        7,8,13,16,19,27,6,0,0,12,-4,0,7,0,-14,11,1,-2,1,15,
+        0,5,-4,15,1,-5,-5,4,0,0,-2,-3,9,0,-3,-2,9,2,2,7,
+        -10,9,6,-10,7,9,4,7,7,-1,4,-9,0,0,-20,2,0,-4,0,0,
+        -7,-4,-26,-13,0,-4,-14,0,-14,12,-2,0,-7,0,-12,9,0,-1,1,0,
+        0,-3,0,-16,13,7,9,3,19,-12,5,10,15,10,3,-3,3,3,-1,5,
+        -3,0,6,-4,-9,0,-2,0,0,4,-11,-7,-4,10,8,-8,10,6,2,-9,
+        5,-9,2,-7,2,-6,-8,0,-7,-11,-14,0,-8,3,-17,1,-10,-3,-11,6,
+        0,-5,6,8,2,1,-1,3,1,1,4,1,1,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-23,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-6,0,0,-8,0,0,10,0,0,0,-7,
+        0,0,0,0,0,-17,-14,0,0,-28,0,0,0,0,0,0,-11,-19,-11,0,
+        0,0,0,-9,0,0,3,-15,0,-17,0,0,-13,0,-44,-3,0,0,0,-14,
+        0,-25,0,-6,0,-6,0,0,7,0,0,-1,3,-7,-11,-18,-8,12,0,-9,
+        0,9,0,0,0,3,-11,0,-12,0,-7,5,11,0,-11,0,0,-18,0,0,
+        -1,-4,0,-6,0,0,-6,0,0,0,0,0,0,0,0,0,0,0,-6,-8,
+        -11,-11,13,6,-10,5,-13,-18,0,-19,-29,0,-12,-13,-10,-9,-14,-14,-15,5,
+        -1,-10,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,
+        0,-5,0,0,0,0,0,0,0,0,0,0,-3,-15,0,-13,0,13,0,0,
+        -3,0,0,0,-10,0,0,-4,0,0,9,-21,0,-21,0,0,3,0,0,-2,
+        -1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-5,-2,-20,0,
+        0,1,0,0,0,-4,0,0,0,0,0,0,0,0,7,4,-36,1,-8,5,
+        3,-13,10,-1,14,-1,-2,18,10,0,-9,0,-2,-23,0,0,0,-2,0,11,
+        0,-11,0,-5,0,6,-8,0,-20,0,10,-2,-6,0,0,0,0,0,0,0,
+        0,-14,0,2,0,0,19,0,0,0,7,0,-1,0,0,2,0,0,0,0,
+        0,0,0,0,0,0,0,0,-3,0,-18,11,10,-11,6,4,-7,5,-1,-2,
+        7,-6,-3,-2,-9,-8,0,-24,-21,0,1,-20,-14,-7,-20,-14,-15,-2,-6,-7,
+        0,-4,-9,-7,-7,-4,-6,-9,-3,-4,-8,0,0,0,0,0,0,19,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,-15,35,0,20,0,
+        0,0,0,0,0,0,0,25,0,0,0,0,0,2,0,0,-6,0,0,-6,
+        0,0,-1,0,-18,12,-11,0,0,0,0,0,2,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,21,0,13,-1,0,0,-22,0,0,-4,0,15,-3,-16,
+        7,-5,7,0,10,24,22,1,1,0,10,26,0,11,9,14,11,0,-6,0,
+        0,0,17,0,0,12,11,4,-7,9,4,3,0,0,7,12,0,3,0,-22,
+        12,0,0,2,15,13,16,0,0,0,0,0,0,-28,0,0,0,0,0,0,
+        0,0,12,5,9,0,0,-2,0,0,1,11,0,17,3,15,5,12,18,8,
+        31,9,0,0,18,-17,-3,7,-2,0,-4,12,13,-9,4,9,12,12,0,9,
+        10,14,0,0,0,14,0,1,0,-1,19,0,15,10,11,15,0,0,11,16,
+        0,26,0,10,-11,19,19,-2,0,8,24,13,0,0,7,14,2,0,18,10,
+        14,12,-4,0,-8,-15,13,-29,-5,0,-16,-3,6,-4,-3,7,7,2,15,-5,
+        -1,10,1,9,2,0,-1,-2,6,-4,-1,0,7,14,3,3,7,12,7,10,
+        0,16,8,2,5,-1,6,5,0,5,1,-8,12,7,0,6,11,-13,4,-6,
+        10,6,2,0,8,11,12,7,-2,5,5,10,0,9,-3,7,4,-13,0,-7,
+        13,1,1,9,7,6,16,2,7,0,10,4,9,6,-1,13,-5,0,-11,4,
+        -1,-11,0,0,-12,0,0,-12,-5,0,0,4,4,19,0,2,-1,-10,-5,12,
+        2,-9,7,0,-3,-4,9,-8,-5,0,-11,15,5,-13,5,13,10,5,10,13,
+        8,2,5,-3,6,2,3,6,4,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,1,0,0,0,
+        0,0,0,0,0,0,0,0,0,9,0,20,0,0,0,0,0,0,8,0,
+        0,0,0,0,0,0,14,0,-5,-13,0,0,-4,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,-12,0,0,17,0,
+        32,0,12,2,3,-3,7,0,13,11,23,11,18,9,0,0,0,0,0,0,
+        0,0,0,5,0,5,-6,5,-9,0,0,0,0,-1,0,-3,0,4,0,0,
+        0,0,11,-6,14,0,0,0,0,18,0,-7,0,0,0,0,0,0,1,-9,
+        -2,-4,0,0,0,0,0,0,0,0,18,-2,-18,35,6,9,-6,7,0,16,
+        0,0,0,0,-1,9,0,0,1,0,0,2,0,5,3,0,0,4,0,0,
+        0,2,0,2,-3,0,0,-6,0,0,20,0,16,12,0,0,-17,0,0,0,
+        0,3,0,6,14,0,0,13,0,13,17,5,14,18,0,3,13,10,13,17,
+        0,0,-2,0,14,-3,0,0,-1,0,0,22,0,20,14,0,0,10,0,0,
+        -1,0,8,0,7,6,16,5,6,0,8,13,21,8,15,7,-2,29,16,2,
+        8,6,10,15,4,0,0,-5,0,0,-3,0,0,10,0,12,8,0,1,-16,
+        -14,0,-7,-2,5,8,10,-4,-11,0,0,8,0,10,2,6,0,0,0,0,
+        15,0,16,11,8,21,19,0,0,18,0,19,11,8,0,0,-4,0,10,-27,
+        -6,0,3,0,0,11,0,6,-8,0,22,3,0,0,2,0,1,-4,19,12,
+        0,0,0,0,-7,-12,1,0,-2,9,0,6,5,5,-3,11,14,4,0,6,
+        7,11,0,-5,13,2,1,0,0,0,0,0,0,-27,0,0,-18,-14,0,0,
+        0,0,0,0,0,0,0,0,-13,0,0,16,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-8,0,0,2,0,0,-6,0,0,-5,0,
+        7,-11,3,0,0,-25,0,0,0,0,0,-8,0,-14,0,0,0,0,0,0,
+        0,0,-5,-27,0,-19,0,0,-22,0,0,14,0,-33,0,-17,-21,5,0,6,
+        0,0,0,0,7,0,11,0,0,-1,9,8,-16,0,0,0,0,0,14,0,
+        -15,-3,-7,23,11,6,7,-15,0,0,-58,0,0,1,0,-10,6,0,0,2,
+        19,2,1,6,0,0,17,0,0,-6,0,-4,0,0,0,8,-13,5,0,0,
+        -6,-7,0,-8,0,0,-6,0,-9,-7,-11,-14,3,6,2,4,5,0,-1,0,
+        0,-15,0,0,-6,0,-1,-9,-27,-12,-5,-1,-4,-15,-1,-2,-5,0,0,0,
+        0,0,0,0,0,0,0,0,-20,-18,0,-11,23,0,-16,-12,0,-24,0,0,
+        -19,0,0,6,0,-5,1,-8,-9,-13,10,9,-6,16,0,-2,-9,7,4,0,
+        0,-18,0,-4,-20,0,-8,-21,10,0,13,17,1,-11,23,5,1,0,-3,9,
+        -4,0,0,4,0,7,-7,0,9,7,0,19,-4,1,2,14,-16,-3,-2,0,
+        3,20,-2,-24,0,0,6,0,5,-14,0,-13,-8,-11,6,-7,-2,-2,0,0,
+        -1,-8,-7,-5,-3,-1,-2,9,0,0,9,0,0,9,0,5,-4,15,-17,0,
+        12,11,1,11,11,8,16,17,2,17,11,2,0,0,0,0,0,0,0,0,
+        10,9,0,-26,21,7,4,0,0,0,0,0,-2,23,0,-8,22,0,-10,-13,
+        -11,-12,-20,-4,-6,4,-19,-12,-16,-23,-8,3,-4,-3,6,-4,-8,-9,-3,8,
+        -6,-9,11,-6,-11,4,0,0,0,0,0,3,0,0,-1,2,0,0,1,9,
+        0,0,0,0,0,0,11,0,0,5,10,0,15,0,0,0,0,0,0,0,
+        0,9,0,0,2,7,0,7,0,9,3,0,0,4,6,0,8,0,3,-4,
+        -6,0,0,-7,-12,0,-1,0,-17,-1,-10,0,0,0,0,0,0,0,0,0,
+        -12,-24,8,1,0,0,4,13,0,10,0,2,-5,-4,-8,-7,2,0,0,3,
+        12,0,8,0,-1,-6,-4,-7,-4,-2,-3,0,0,-10,9,0,4,0,0,13,
+        5,0,1,11,0,-1,0,0,0,-11,0,-1,0,-1,1,1,-1,0,0,21,
+        2,-10,0,0,-1,-19,0,-2,0,-15,-13,-4,-21,-9,-6,0,-9,-6,-6,0,
+        0,0,-16,0,3,0,21,-3,-8,-14,-2,0,3,-1,-5,-10,0,0,0,-1,
+        2,0,6,0,6,-2,-8,0,-1,-1,8,-4,-5,6,2,0,0,0,0,0,
+        0,0,0,0,0,0,0,-12,1,13,0,-9,0,11,-6,4,0,0,11,5,
+        0,10,0,6,3,-4,12,0,0,21,-2,-15,-8,6,12,11,1,0,0,8,
+        10,0,9,0,3,0,-2,0,3,2,-1,9,-6,6,5,5,8,2,1,0,
+        0,4,12,0,6,0,4,-5,-1,36,-1,-1,6,-10,-6,1,3,5,8,7,
+        9,17,0,0,11,25,0,16,0,25,22,25,6,6,4,13,15,-2,2,15,
+        18,14,12,28,24,6,0,0,10,10,0,10,0,10,1,0,-9,-3,3,7,
+        -3,-3,3,7,0,8,4,6,11,5,-12,0,0,-11,-11,0,-8,0,-1,-6,
+        -5,-22,-3,-4,10,0,-3,-6,-6,-1,-9,-4,1,18,2,-10,9,0,0,10,
+        15,0,14,0,13,-1,1,-10,0,-1,6,1,-7,5,9,6,15,11,8,37,
+        8,-1,15,0,0,0,0,0,0,0,0,0,0,6,0,0,17,12,0,0,
+        0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,18,0,0,0,0,0,0,0,0,-2,0,0,0,0,0,0,0,
+        0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,1,0,0,0,0,0,0,0,0,12,0,0,10,10,0,
+        18,0,-25,6,4,1,-4,6,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,4,0,0,0,0,0,3,0,0,0,0,0,0,0,0,-4,0,0,0,
+        0,0,0,15,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,5,0,
+        0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,24,0,0,
+        0,0,0,0,0,0,12,0,0,0,0,0,0,0,0,0,0,0,13,0,
+        0,0,0,0,0,0,0,-6,0,0,0,0,0,0,0,0,8,0,0,9,
+        9,0,14,0,2,8,6,0,0,17,0,9,8,9,10,5,9,9,18,0,
+        0,0,0,-16,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,
+        0,12,0,0,0,0,0,15,0,0,0,0,0,0,0,0,2,0,0,0,
+        0,0,0,0,0,5,0,0,0,0,0,0,7,0,0,0,0,0,0,0,
+        0,10,0,0,0,0,0,0,0,0,10,0,0,0,0,0,0,0,12,0,
+        0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,17,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,
+        -10,0,0,2,0,-2,0,0,0,0,0,0,0,0,-3,0,0,0,0,0,
+        0,0,0,0,-5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,0,
+        8,0,0,0,0,0,0,0,0,0,0,0,0,0,10,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-2,0,0,0,0,0,0,0,0,-7,0,0,-7,-10,0,
+        2,0,-9,-4,-3,-7,-9,4,1,-8,0,2,0,0,0,0,0,0,0,0,
+        -8,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,-7,
+        0,0,0,0,0,0,0,0,-7,0,0,0,0,0,0,0,0,0,0,0,
+        -10,0,0,0,0,0,0,0,0,-1,0,0,0,0,0,0,0,0,0,0,
+        0,0,-2,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-10,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,-1,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,-3,0,0,-2,1,0,6,0,
+        -7,-6,-6,-23,-10,2,-11,-3,7,5,3,-12,-12,-7,7,-4,0,3,6,11,
+        0,0,0,0,0,-16,0,0,1,-25,0,0,0,0,0,0,0,0,0,0,
+        -10,0,0,18,0,0,-21,0,0,0,0,0,0,0,0,-7,0,0,-32,0,
+        0,0,0,0,-4,0,0,8,14,0,6,17,0,1,-10,7,0,6,-9,0,
+        4,0,-43,-11,-17,-7,0,0,-10,5,0,8,0,5,-9,0,0,-6,-2,0,
+        4,20,0,4,0,-2,-3,-5,0,-15,-13,-2,0,3,2,0,0,6,8,-10,
+        -12,-1,-7,-8,0,17,0,0,12,0,0,2,0,37,11,9,2,16,0,9,
+        2,0,9,15,0,7,28,-4,-1,-3,-9,-9,0,3,-11,-16,-1,0,-2,0,
+        0,-8,-9,-5,-11,-6,-27,-2,-7,0,-1,-5,-2,1,0,-1,0,0,-6,6,
+        -3,-5,-3,2,-6,-13,14,2,-8,2,-4,0,0,-4,8,0,10,0,-8,-8,
+        -20,0,-3,-6,0,4,-13,-7,-5,0,0,0,0,0,0,0,0,0,-8,0,
+        0,5,3,0,1,0,-9,-2,2,6,0,0,-15,4,0,6,0,0,-5,-10,
+        0,9,-9,0,3,-4,-3,3,0,0,-1,0,0,-4,12,3,1,0,5,-11,
+        -8,0,-3,-6,1,2,-4,-2,-5,-8,0,-1,-11,0,0,1,21,0,4,0,
+        0,-8,-19,-16,0,-15,7,3,-13,-21,-14,-19,0,-7,-2,17,0,0,23,12,
+        0,0,0,0,0,14,0,-10,9,3,-6,8,11,0,0,0,14,0,5,6,
+        7,0,2,-7,0,16,0,-2,-7,-1,-4,-2,-7,9,2,0,-6,3,-1,13,
+        2,-6,1,9,-15,-3,0,-9,-2,0,0,0,0,-11,-21,-10,-5,-9,19,-4,
+        -12,-8,-10,-6,-5,-10,-18,0,0,4,-4,6,0,5,13,0,-3,1,-18,-8,
+        -8,-15,-6,-13,17,-7,-13,-11,-2,-3,12,-15,-16,0,-10,-12,-25,10,0,0,
+        0,0,0,8,0,0,0,-2,0,0,6,0,0,0,0,0,0,0,5,0,
+        0,-13,0,0,18,0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,
+        0,0,12,0,0,2,7,0,9,0,0,3,13,0,0,4,0,0,21,0,
+        8,0,-11,12,0,0,0,0,0,0,0,0,0,3,0,-19,0,0,-12,-9,
+        0,-9,0,0,-8,-14,-11,-3,12,8,12,5,25,0,14,11,26,5,3,6,
+        -13,8,0,0,0,0,0,0,6,0,0,-1,5,0,-29,6,0,31,0,0,
+        -3,2,0,-7,9,0,0,1,-8,-7,-11,-22,-13,31,0,0,13,32,0,-4,
+        -6,0,6,0,3,-13,8,8,0,5,14,0,0,0,-10,0,-2,16,0,-4,
+        -2,0,-16,5,0,-21,3,-1,5,0,0,7,0,0,4,0,0,5,-3,0,
+        1,11,4,24,11,3,5,1,0,0,0,0,0,0,0,0,0,12,17,16,
+        19,18,0,32,14,12,0,-5,0,0,-19,-3,0,25,0,0,17,6,0,-11,
+        18,0,-7,28,0,29,30,0,6,0,0,6,7,0,32,0,-4,13,5,-1,
+        2,8,0,4,-6,3,1,9,-16,9,2,12,2,-1,10,0,10,0,16,1,
+        0,14,-12,4,0,-7,2,4,4,12,8,6,0,-5,0,0,10,21,0,-13,
+        0,0,-2,-9,0,-10,-6,0,-7,-2,18,6,0,0,-15,-6,0,10,0,-2,
+        0,13,0,20,0,0,13,6,10,-2,10,3,-15,1,15,13,5,18,-1,2,
+        0,5,12,0,0,-9,14,0,0,0,0,5,-8,7,-14,5,-3,3,0,-1,
+        3,-3,9,-4,-1,-4,4,3,0,0,-7,0,0,0,-2,0,15,0,-6,3,
+        -10,-2,-8,-17,-1,1,6,2,-7,-2,-3,10,5,-3,-5,0,0,0,0,0,
+        0,0,0,0,-7,0,0,0,-67,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-22,0,0,-3,-16,0,0,0,-6,
+        0,3,0,0,3,0,0,-12,1,0,0,-3,0,0,1,0,0,-29,2,-10,
+        -19,0,-9,0,0,9,0,0,-5,19,0,-9,0,0,-3,0,1,-1,0,0,
+        0,-9,0,-17,0,-10,0,-1,0,6,9,0,0,19,4,-2,-7,-7,-16,0,
+        0,-10,0,10,11,0,0,29,1,0,1,0,-22,0,-13,0,0,0,0,-1,
+        0,0,5,-13,0,-2,0,0,-13,0,0,0,-3,0,0,0,0,0,9,-10,
+        1,-11,-4,-14,5,4,-11,7,-9,-8,0,-8,-2,0,-13,-1,-3,-9,-12,-8,
+        -22,0,-2,-17,2,-5,0,0,0,0,0,0,0,0,-3,0,0,0,0,-8,
+        0,0,0,-11,0,0,0,0,0,0,0,0,0,0,-2,-11,0,-21,-2,-2,
+        0,9,-5,-1,0,0,4,0,0,-7,0,0,-8,-2,0,-1,0,0,2,0,
+        0,-1,-10,0,0,0,0,0,0,6,11,0,0,0,0,0,0,0,-9,0,
+        0,0,11,-13,0,0,0,-24,0,0,0,0,0,0,0,0,0,-4,-13,17,
+        -24,0,2,-9,8,-2,1,1,8,-5,-14,0,-7,0,5,4,0,0,0,1,
+        0,-1,0,-19,-13,-30,0,-6,-15,0,-13,0,0,0,-1,0,-3,0,0,7,
+        0,0,0,0,0,-7,0,0,3,0,0,30,-3,0,-12,0,0,-7,0,0,
+        0,0,0,0,0,0,0,0,0,-3,-19,-9,-17,4,8,-21,15,1,-4,0,
+        0,-2,5,8,4,7,-26,-6,0,-14,-2,0,-3,1,-9,-6,-17,-15,-18,-6,
+        -6,-24,-3,-9,-11,-4,-18,-3,-9,-2,-10,-5,-11,10,0,0,0,0,0,3,
+        0,0,6,-3,0,0,-3,-25,0,0,0,0,0,0,10,0,0,8,-1,0,
+        15,0,0,0,0,0,0,0,0,12,0,0,-1,-8,0,12,0,-8,10,0,
+        0,-4,14,0,6,0,28,1,-10,0,0,4,-22,0,-6,0,0,-2,0,0,
+        0,0,0,0,0,0,0,0,-3,0,0,5,0,0,0,9,0,3,0,9,
+        -6,-3,-2,-9,5,0,4,9,2,7,10,0,9,0,8,4,2,4,18,0,
+        0,8,9,0,8,0,19,21,15,33,-6,13,15,1,0,0,11,3,0,11,
+        0,7,0,21,-14,-2,0,13,1,-4,0,0,-15,1,0,-3,0,-5,0,0,
+        0,0,0,0,-17,0,14,0,0,9,0,0,-6,6,18,1,-29,18,2,16,
+        17,4,-3,16,4,0,1,6,-11,6,6,0,12,9,1,-3,-3,6,7,7,
+        -9,18,14,10,0,0,-6,1,0,2,0,26,-6,-4,0,5,16,10,15,-10,
+        7,16,0,15,0,0,9,23,0,5,0,21,14,-6,0,2,6,15,11,0,
+        7,13,13,11,-2,0,8,-2,7,0,1,0,4,-6,-6,3,-6,1,-3,-1,
+        -5,-2,0,7,4,4,3,0,-3,7,5,2,7,0,4,-1,-2,-3,-2,10,
+        10,-1,-15,4,6,6,4,0,4,13,0,25,9,6,0,13,0,25,10,12,
+        8,-1,13,9,-2,-1,10,11,14,12,0,6,11,6,0,-1,6,18,18,7,
+        0,14,1,5,-6,4,5,15,3,1,1,5,7,7,8,2,6,9,-14,0,
+        7,4,-1,0,1,0,-6,-18,-7,-43,-9,-3,15,0,0,1,0,-6,-17,-6,
+        2,-4,1,0,5,0,-4,5,11,12,7,-13,21,3,0,1,0,11,18,1,
+        -2,10,12,9,11,1,5,8,3,-2,10,0,0,0,0,0,0,0,0,0,
+        0,17,0,0,4,-1,0,0,0,0,0,0,0,0,0,0,24,0,16,0,
+        0,0,0,0,0,0,0,0,0,0,0,-15,0,18,0,0,0,0,0,0,
+        4,0,0,0,0,0,0,0,0,0,19,-4,0,0,-4,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,
+        -5,0,5,0,11,9,18,11,17,0,9,6,11,12,13,5,0,0,0,0,
+        0,0,0,0,0,2,8,-5,7,2,1,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,7,9,-7,0,0,5,0,2,0,2,0,24,0,0,-5,0,
+        7,4,0,4,0,0,0,0,18,0,0,0,0,2,0,6,9,4,-14,5,
+        3,-16,0,0,4,0,10,11,0,0,-4,0,0,4,0,7,-9,0,0,-1,
+        0,0,0,6,0,2,-6,0,0,22,0,0,0,0,13,0,0,0,2,0,
+        0,0,0,15,0,12,0,0,0,0,0,35,0,1,17,23,0,-17,29,17,
+        15,15,0,0,8,0,12,-1,0,0,24,0,0,6,0,15,14,0,0,9,
+        0,0,5,0,11,0,11,5,15,11,11,0,17,-1,6,10,-5,3,-3,7,
+        5,0,6,11,13,10,-1,0,0,8,0,9,0,0,0,0,0,7,6,0,
+        -1,-11,0,5,-17,7,9,8,7,-4,-5,0,0,11,0,8,6,33,0,14,
+        0,0,14,0,12,17,1,9,6,0,0,21,0,11,9,2,0,0,2,0,
+        14,3,-7,0,17,0,0,-9,0,6,-9,12,10,-1,0,0,12,0,2,-6,
+        7,-6,0,0,1,0,2,5,-6,0,11,-3,-2,2,-6,3,-11,11,6,-5,
+        4,13,7,7,-5,-16,7,-3,-12,4,0,0,0,0,0,-2,0,0,-6,-1,
+        0,0,-1,7,0,0,0,0,0,0,2,0,0,-5,-11,0,-11,0,0,0,
+        0,0,0,0,0,-4,0,0,1,-22,0,-7,0,-18,0,-15,0,-3,3,0,
+        6,0,3,-8,-7,-21,0,-20,1,0,-1,0,-9,-10,-35,4,0,0,1,-14,
+        0,-3,0,-12,-13,-12,0,-9,-8,0,6,4,0,1,0,-3,-2,-2,-4,-9,
+        3,6,0,7,15,5,10,0,12,-7,0,3,1,-2,2,3,0,1,12,0,
+        3,0,6,-5,6,14,5,-1,7,1,14,0,9,18,0,4,0,7,4,2,
+        -3,-6,7,10,-4,12,0,0,0,2,0,8,0,7,-9,0,-1,0,0,7,
+        27,7,-2,5,0,-1,2,6,0,0,0,-6,-8,-10,1,-3,-3,8,0,-5,
+        0,0,0,-3,-5,0,-1,0,2,-9,-13,-12,-10,-3,-3,0,5,-3,-2,-31,
+        0,0,-21,0,0,0,0,0,10,11,-10,-1,15,13,-2,0,-5,2,-8,6,
+        0,0,-8,2,0,10,0,-5,5,-9,10,-13,9,10,4,10,0,0,-6,9,
+        -2,0,0,6,-8,-7,14,0,-5,-1,-9,-8,-9,3,6,-6,14,6,3,-2,
+        -2,-7,-8,-5,0,3,11,11,6,0,14,-7,-24,2,-3,-6,-6,1,16,-9,
+        -3,20,6,5,-1,6,12,0,29,7,7,-15,0,-3,-4,8,-6,-4,-4,-8,
+        1,-5,-6,-3,-19,8,-2,-10,-8,13,0,0,12,19,0,21,0,11,6,1,
+        -1,-7,8,5,-1,8,7,13,15,12,-1,9,5,0,-5,0,0,-8,0,0,
+        -2,0,12,-11,0,-19,14,1,-4,17,1,-7,1,-25,2,4,2,-11,16,15,
+        -3,-14,-14,-6,6,-7,-1,-5,0,-10,-14,-19,-13,-7,-11,-6,-1,-11,-5,-4,
+        -4,1,-12,-18,9,-10,-21,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,
+        0,0,0,1,0,0,16,-32,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+        0,0,0,0,0,-15,0,12,-9,13,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-4,33,0,0,0,
+        0,0,0,0,-18,9,0,15,38,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,-16,22,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -10,22,0,0,0,0,-37,15,0,11,0,-17,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,-8,0,
+        0,0,0,0,0,14,0,-24,40,15,-11,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-21,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,22,0,-5,0,0,0,-19,0,-27,-6,-6,0,-5,0,-21,0,0,0,8,
+        0,-14,0,57,0,0,0,0,0,5,0,0,-15,0,0,0,3,-6,15,0,
+        47,0,4,0,13,0,-8,-19,-17,-15,6,0,-1,0,0,0,0,0,0,0,
+        0,0,0,-45,-3,-5,0,10,0,-12,0,0,0,-29,0,0,0,-18,0,-12,
+        0,0,-10,27,0,0,0,6,-9,11,-45,-15,3,0,-22,15,0,0,18,0,
+        2,19,27,0,21,-9,0,0,0,0,-7,0,0,27,0,0,0,10,-5,30,
+        0,-17,16,0,0,0,0,-1,11,19,26,20,-7,0,0,0,0,0,0,0,
+        0,0,0,0,-24,-25,2,0,18,23,-15,0,-21,0,26,0,28,0,21,4,
+        0,0,0,-8,2,0,-11,-23,-40,15,-15,-5,2,-23,-22,3,0,-27,0,-7,
+        0,-24,0,-16,0,-35,-92,0,0,0,0,-15,0,18,8,0,0,0,-48,8,
+        3,-36,28,0,-29,0,0,0,-18,-8,-10,-11,16,-5,0,0,0,0,18,0,
+        0,0,0,0,0,0,-5,-6,-26,9,0,-26,0,-6,0,-25,0,-4,0,-5,
+        0,0,0,0,7,-29,18,4,-22,-39,-10,35,-35,-2,0,5,0,0,-35,1,
+        -3,0,0,0,-2,0,29,0,8,0,8,6,15,0,6,0,0,0,73,-37,
+        6,0,10,0,0,10,0,5,0,-10,0,-13,-7,39,8,0,9,-11,21,-2,
+        0,0,0,0,0,0,0,-10,0,-2,0,0,0,-33,60,0,0,0,-14,0,
+        2,0,0,0,0,3,15,21,0,0,0,-25,16,-11,-3,33,15,0,0,0,
+        2,24,0,0,0,4,0,28,0,2,11,7,11,16,0,0,-4,0,0,56,
+        14,14,-6,4,0,0,19,-6,30,0,-7,15,19,19,-6,-18,5,19,-4,0,
+        0,0,0,0,0,0,5,7,7,37,-16,0,0,21,0,36,0,0,0,24,
+        0,0,0,0,0,0,12,-4,-4,-12,0,0,16,3,-9,14,0,-9,0,0,
+        -12,8,-3,-32,0,0,-3,0,0,0,0,0,-16,0,3,-24,11,0,0,0,
+        15,-26,28,0,-17,0,0,-5,-25,14,-24,-4,0,-8,-2,-8,-8,-18,40,9,
+        -37,30,9,0,0,0,0,-31,-29,16,0,-26,0,0,-41,0,6,-10,0,0,
+        10,0,0,0,0,0,0,-5,-11,18,1,0,-39,4,-8,-31,3,0,0,-16,
+        0,0,0,0,0,-4,0,0,0,5,0,9,0,0,0,0,0,-37,0,0,
+        0,0,-25,-2,0,0,-13,0,0,-26,0,0,-10,0,0,-16,28,0,44,0,
+        0,-12,0,0,0,0,0,0,0,0,-5,0,0,-19,0,0,0,0,0,2,
+        0,0,-50,-42,0,0,0,0,-8,0,0,-17,0,0,9,0,-4,-13,15,0,
+        -31,7,0,0,0,0,-5,14,0,0,7,0,80,0,0,0,0,0,-39,8,
+        0,0,0,-31,-4,-13,0,2,0,0,9,-8,0,-13,45,0,-27,42,0,32,
+        19,0,8,24,0,0,0,0,0,0,0,-15,7,0,-46,1,0,0,0,0,
+        -14,17,0,0,-19,0,-8,0,0,-17,19,0,0,28,0,2,36,-33,13,0,
+        -21,8,0,-33,0,0,0,8,0,-14,0,-19,0,14,0,-36,0,0,0,-30,
+        0,-37,0,0,-29,7,0,-22,15,0,-7,23,0,-25,0,0,-44,6,16,-58,
+        48,0,-23,8,0,-27,0,0,0,0,0,-23,1,0,-23,-37,0,-55,0,0,
+        0,10,0,-10,-34,0,33,31,0,0,-19,0,-16,-45,0,-30,7,0,-30,-14,
+        2,0,-4,29,-44,0,0,0,-2,-1,-18,15,3,-57,0,0,0,0,0,0,
+        -18,-29,9,0,0,74,-9,-15,0,2,0,-4,9,-39,0,9,-15,0,-29,22,
+        -13,-31,0,-63,29,0,0,0,0,0,0,0,0,25,-7,0,-3,-2,-20,0,
+        0,0,-15,26,0,28,10,-9,0,0,0,-3,29,0,3,-24,-9,44,-17,-44,
+        -13,1,-31,12,6,-14,0,18,0,-11,6,39,4,23,8,-22,17,0,0,5,
+        0,-40,19,18,0,-2,21,-12,3,-15,-44,-2,-28,-22,24,0,-11,-20,21,-21,
+        22,11,44,26,15,-22,0,23,0,0,0,0,0,35,-4,-11,-12,-23,11,-37,
+        0,1,0,34,-12,-16,-15,31,-11,0,0,0,-17,26,0,3,28,-8,51,40,
+        10,-2,5,-33,-9,-32,-29,0,-22,0,-7,-2,-31,-9,-24,-37,30,0,2,0,
+        6,0,-14,10,-45,0,0,-41,-2,5,11,-7,-17,-31,0,0,0,-22,0,6,
+        -14,-19,-42,0,0,-38,2,0,19,0,0,0,0,0,-16,34,14,4,2,-16,
+        -27,0,0,0,3,1,-26,11,0,-46,0,0,0,-26,-38,-8,5,-23,-34,38,
+        -38,-34,5,0,6,-33,0,5,-45,9,0,14,0,8,0,6,10,10,-5,37,
+        63,6,0,-50,12,0,0,0,1,-5,0,-18,0,0,3,3,0,0,9,0,
+        20,-20,-5,-26,12,0,-26,-25,0,-12,-18,0,0,0,0,0,5,0,14,-8,
+        0,-24,0,2,0,39,0,8,0,-24,26,-2,0,0,0,0,3,8,0,-28,
+        16,50,-14,18,38,-24,-9,10,22,24,47,-30,29,63,3,0,8,3,22,4,
+        -4,-16,0,0,0,26,0,-48,0,11,4,10,-4,0,39,-6,16,6,-18,14,
+        -8,14,-1,12,-9,31,13,6,1,0,-35,0,0,0,18,0,-14,14,16,-6,
+        -7,81,-16,0,0,0,-13,39,-31,0,12,0,0,0,0,11,0,-15,0,-13,
+        0,33,18,0,16,0,-7,-60,42,-32,25,1,-33,15,20,-14,0,-20,-21,11,
+        -34,-32,-1,-24,0,-27,-36,-52,0,0,-35,10,0,-19,0,0,-28,-31,-34,-9,
+        3,40,-29,-7,-4,-30,35,3,-29,-5,24,-19,0,0,0,-25,-39,-26,16,0,
+        -18,27,-18,-22,-20,-10,0,5,-3,-2,0,13,-3,26,0,-6,-3,0,-30,-24,
+        23,-71,7,24,-33,-5,0,0,0,0,0,16,0,0,0,0,0,0,15,0,
+        33,0,0,-3,0,0,-13,0,0,0,0,0,6,0,0,0,0,0,12,0,
+        0,15,0,0,-2,17,0,16,0,0,-3,0,0,-2,0,0,36,0,32,-1,
+        0,0,7,0,0,27,0,0,13,0,0,0,29,0,0,0,0,13,0,0,
+        -36,0,0,7,0,-14,-7,16,0,0,0,0,-7,36,0,0,0,0,0,22,
+        0,36,24,0,-13,13,0,-17,-6,0,0,0,11,14,17,0,0,0,0,30,
+        53,0,3,3,0,18,31,0,62,47,0,4,21,0,-9,0,0,39,-42,3,
+        -10,26,0,0,17,0,-1,14,0,14,40,0,0,48,0,0,0,0,0,31,
+        0,-24,10,0,3,41,-62,8,0,-24,0,0,0,37,0,-13,0,0,0,0,
+        -4,0,21,0,-14,-7,0,-31,-22,0,0,0,0,-21,22,0,-15,0,0,0,
+        33,0,-11,20,0,-4,20,5,-53,12,0,-20,3,0,-51,18,0,0,-22,0,
+        4,1,0,-18,-11,0,-29,-22,0,-11,6,0,39,0,0,0,0,0,0,4,
+        0,-41,-31,0,-5,31,0,-43,-6,18,0,21,0,-5,8,15,0,-42,0,-14,
+        0,11,0,24,7,-21,-16,-4,0,-21,27,0,0,-46,-3,-5,-3,0,0,0,
+        0,-28,36,0,5,-12,0,-12,29,-3,42,12,12,-20,19,0,6,4,0,38,
+        -34,17,11,19,0,11,15,20,0,7,0,7,13,0,28,-3,0,0,0,0,
+        -3,-11,0,4,29,0,12,17,-7,-1,15,0,-21,40,-124,46,32,5,-20,0,
+        11,0,25,13,28,44,32,-15,17,-22,-4,21,22,0,38,21,-16,17,0,0,
+        8,5,-6,7,3,3,18,0,38,38,17,51,38,33,-24,13,-21,-16,14,0,
+        0,25,3,-2,25,0,3,17,64,-2,37,0,-11,9,0,0,27,37,0,0,
+        0,10,25,-27,-10,38,59,16,40,13,-13,-25,-35,-4,0,-65,-7,-20,-17,39,
+        0,0,38,-19,0,2,0,-19,-20,10,-65,29,-4,-14,0,-12,-17,-6,-10,-1,
+        0,0,0,2,0,-76,-1,-3,0,-25,6,-7,0,0,-15,16,-12,0,0,0,
+        0,8,0,-21,2,0,-9,-2,10,-10,0,-6,-9,3,23,-10,-18,16,0,0,
+        0,0,-13,-2,15,-11,16,-15,39,6,-5,10,0,3,0,0,0,10,23,-28,
+        0,0,0,0,-21,0,0,7,26,-2,-6,0,5,0,0,-5,47,-9,-18,0,
+        21,0,0,0,3,34,10,5,0,0,-19,20,11,5,5,24,4,0,-41,0,
+        0,0,-36,4,-21,26,0,18,2,0,14,5,21,11,-3,0,4,0,0,0,
+        0,0,0,-12,0,9,18,0,-37,29,30,-7,-2,36,2,0,0,-12,12,22,
+        18,0,0,21,0,28,0,20,31,-11,6,28,7,1,12,0,20,25,17,-3,
+        40,-17,0,0,22,6,18,4,25,14,19,-15,38,54,5,36,10,-17,15,12,
+        0,17,0,-15,35,21,-3,15,-4,0,-1,38,4,29,19,2,13,0,0,32,
+        0,0,0,0,16,9,-7,3,41,0,8,42,25,13,8,-7,29,0,-19,14,
+        3,-10,0,0,-7,0,-15,16,23,-14,-24,-8,-39,-30,-43,-38,-38,1,6,-21,
+        10,6,8,0,0,0,26,17,-18,26,29,-19,-18,-5,-24,10,27,-13,-8,-18,
+        -26,0,-8,0,2,23,-17,14,13,-10,21,-40,-13,40,-10,-8,23,8,-24,0,
+        -6,1,14,0,0,4,-23,7,-26,8,-32,33,16,-16,-7,0,0,0,0,0,
+        0,0,0,-10,0,0,0,0,0,0,0,0,-27,0,0,0,0,0,0,0,
+        0,-17,0,0,0,0,0,0,0,0,-9,0,0,-22,1,0,0,0,0,1,
+        0,0,0,0,0,0,0,0,-20,0,0,0,0,0,0,0,0,-18,0,0,
+        0,0,0,0,0,0,-15,0,0,0,0,0,-13,0,-24,-19,-1,0,0,0,
+        0,0,0,0,-26,1,0,0,0,0,0,0,0,-21,6,0,0,0,0,0,
+        0,0,-18,-11,0,0,0,0,0,0,0,-12,10,0,-35,8,0,0,0,0,
+        -10,44,0,0,0,0,0,0,0,-15,19,0,0,0,0,0,0,0,-22,-9,
+        0,0,0,0,0,0,0,-19,9,0,0,0,0,-18,-4,-28,0,0,-19,0,
+        0,0,0,0,0,-1,0,-26,0,0,0,0,0,0,-20,0,-44,0,0,0,
+        0,0,0,-8,0,-18,0,0,0,0,0,0,-7,0,-18,-5,-8,-30,0,0,
+        0,4,0,5,0,0,0,0,0,0,-12,0,-31,0,0,0,0,0,0,-9,
+        0,-29,0,0,0,0,0,0,-24,0,-25,0,0,0,-8,0,-27,1,-4,0,
+        25,0,-32,0,0,0,-19,-28,-29,-13,0,-16,-7,0,0,-7,-17,0,0,0,
+        -26,0,0,-14,-12,-20,0,-2,0,7,0,12,0,-17,-14,-4,-33,-14,-29,0,
+        0,0,-13,9,0,0,0,0,0,0,-32,-26,31,0,0,0,0,0,0,0,
+        4,2,-65,0,0,-24,0,0,0,-18,-11,0,0,0,-50,-30,-30,-34,-24,5,
+        0,-20,25,-33,0,31,0,-18,-16,-77,-6,16,-7,22,34,0,-62,-16,0,-24,
+        -4,0,0,0,-30,-24,-10,0,62,-3,7,0,29,0,-15,-4,-25,-37,-9,7,
+        0,-40,0,-20,21,0,0,0,0,0,0,16,-20,-11,0,0,35,0,0,0,
+        0,-11,-2,-5,2,23,25,-31,0,0,-17,-2,0,1,47,7,-22,5,1,-6,
+        -5,-29,7,0,-15,0,4,0,-15,-21,-31,-22,-16,-18,0,0,0,-13,-29,0,
+        -5,-7,-25,0,-30,-15,-18,-5,-40,-22,0,-20,0,-20,0,-16,-29,-47,-16,-36,
+        -19,0,0,0,1,6,-6,0,0,0,0,0,-51,-19,-23,-39,0,0,-22,0,
+        -26,0,-7,4,-26,39,17,-17,0,0,0,-28,-26,-46,-19,-25,-5,-9,-42,-28,
+        -1,0,-8,0,0,24,-5,19,0,2,0,-13,0,-12,5,-15,0,-27,-4,22,
+        -32,0,0,0,0,-7,-12,-3,0,-13,0,0,-14,-1,4,0,-3,0,3,0,
+        15,-14,-8,2,5,4,0,-5,0,0,0,5,-8,14,-14,0,-8,0,0,-33,
+        -45,5,0,-7,0,-9,0,0,0,0,0,0,-1,45,2,0,0,0,-1,-7,
+        -24,0,5,-18,0,0,-7,-3,47,0,-2,57,-25,0,-7,28,-14,-20,10,-24,
+        14,22,0,0,0,0,-15,14,8,5,-13,0,0,18,28,-1,0,-1,-3,-4,
+        -6,25,11,-13,14,12,5,15,-11,0,0,0,-22,26,15,9,17,-30,0,0,
+        41,0,4,0,-20,-11,-23,0,0,0,0,0,0,9,10,3,0,0,0,-2,
+        16,15,13,0,-9,0,0,-4,5,7,-38,17,0,-11,0,10,-3,12,-1,-9,
+        -8,-27,-8,0,0,0,-9,-8,-23,8,0,-13,0,0,-16,-16,-10,-18,5,0,
+        -11,13,-18,-3,-27,-29,-1,12,0,-5,0,0,0,-11,-36,-35,-11,0,-8,0,
+        0,3,-24,-9,-18,-26,0,-20,0,29,0,-9,0,-23,6,-9,-9,0,0,18,
+        -23,-24,-13,-2,0,0,-21,0,0,0,0,0,-12,0,0,-25,-3,0,7,0,
+        0,-30,0,0,-32,0,0,0,0,-18,-15,0,0,-30,0,0,-18,0,0,-11,
+        0,0,-8,0,0,14,0,0,2,0,0,-7,0,0,25,0,-14,-8,0,0,
+        -15,0,0,0,0,0,-2,0,0,-31,-4,0,16,0,0,-13,0,0,-8,0,
+        0,-9,0,-15,-15,8,0,-22,23,0,0,0,0,-17,0,0,-48,3,0,0,
+        0,0,-29,-6,0,-33,-7,0,0,0,-22,-24,-17,0,-47,11,0,-23,2,0,
+        -19,-7,0,-15,1,0,7,-23,0,-13,10,0,0,0,0,30,0,-34,-20,12,
+        0,-22,24,0,0,0,0,-13,21,0,-20,-5,0,3,0,0,-29,-4,0,-15,
+        27,0,-16,-6,-15,7,0,-11,-10,0,-21,0,0,0,-4,0,-21,-21,-1,-20,
+        9,0,-2,-22,0,-22,-26,0,-21,0,0,-33,-9,0,-29,-26,0,-9,-9,0,
+        -19,-5,0,-18,0,7,-11,6,0,-29,8,0,-13,-7,0,0,9,0,-2,-1,
+        0,-26,-11,0,-18,0,0,0,2,0,-11,-13,-4,-13,22,0,-30,-8,0,-25,
+        -13,0,4,-4,0,-14,-3,-2,0,-18,3,-13,-2,31,0,-18,-6,-10,-29,-8,
+        -19,10,27,-40,-20,-5,0,0,14,-18,-27,25,-27,-13,-6,0,-32,-26,-25,-30,
+        -3,0,-15,-8,-20,-8,8,-14,1,-17,-12,2,14,0,-14,2,0,15,-26,-16,
+        1,0,0,-29,-17,-26,-10,-5,0,-7,10,-20,-4,2,-13,9,0,-16,-10,0,
+        0,-7,3,-16,-6,6,-18,-14,-1,-11,-26,12,-9,-12,22,6,-27,-12,-24,-20,
+        1,-26,41,0,-14,-28,4,-25,-14,23,3,6,25,-7,-38,12,-7,-35,-23,-33,
+        -29,17,-41,-9,-29,-33,-11,27,12,24,13,5,-1,34,24,-32,14,0,52,13,
+        8,-23,2,6,-21,-19,-34,7,32,-18,8,-12,-20,-17,26,18,47,0,18,-2,
+        -15,-21,-13,28,15,-10,20,4,-1,-1,-24,-15,-5,-13,4,-3,4,-23,-20,-31,
+        -32,-14,-36,34,21,-27,-29,-14,-43,-13,14,-4,-45,19,-32,-24,2,-20,-30,-37,
+        -38,-25,-13,-44,-7,-26,-34,-7,18,5,22,-7,-1,8,40,18,-26,-1,0,33,
+        -46,-4,-3,-1,-2,-28,-20,-39,-27,37,-61,5,-7,-26,-25,14,6,44,0,9,
+        -2,-25,-24,-14,22,8,-8,18,-4,7,0,6,-5,0,0,-19,27,31,-4,0,
+        -5,-14,9,-8,22,-3,-9,-32,5,-9,-37,0,13,-31,29,-31,-9,0,-4,13,
+        0,-15,-3,19,-22,-3,0,-14,15,21,9,18,17,8,15,-8,2,0,20,0,
+        13,19,0,1,0,13,4,0,-15,24,12,16,7,0,-7,0,24,20,15,0,
+        13,7,15,-4,7,28,10,8,19,7,3,23,2,-24,-5,-13,1,3,3,-9,
+        -2,-12,-2,-13,-33,38,-20,-18,-12,-1,-12,-15,15,0,-5,9,-20,0,-3,-25,
+        -24,18,-32,0,28,-9,-1,-3,-1,18,16,2,23,3,1,3,35,7,-25,42,
+        0,25,7,0,-16,13,4,-28,25,0,17,0,17,4,4,19,-8,26,18,-5,
+        0,16,3,24,18,4,16,22,19,7,-7,20,0,-3,2,6,-16,8,-4,-5,
+        6,3,-19,-11,-4,-38,15,-28,-27,-2,-38,-25,-50,19,-12,-27,2,-40,10,3,
+        -22,-1,-3,-34,-13,37,-39,0,12,-4,26,12,-3,27,-12,-5,4,22,11,0,
+        -6,0,18,-19,-8,12,0,-8,-5,19,-44,-5,36,-5,13,-11,13,28,21,5,
+        39,0,4,13,31,13,11,28,7,27,10,-10,-3,0,0,0,0,0,7,0,
+        0,-10,0,0,0,9,0,8,0,0,-19,0,0,-11,0,0,-23,0,5,-7,
+        0,0,0,0,0,0,0,0,10,0,0,1,7,0,15,0,0,7,0,0,
+        -25,0,0,33,0,8,1,0,0,-9,0,0,14,0,0,-9,0,0,-21,8,
+        0,37,0,0,7,0,0,-10,0,0,6,0,-12,-15,8,0,0,0,0,-14,
+        34,0,-5,14,0,0,31,0,17,17,0,-16,15,0,-2,23,0,-12,7,7,
+        -16,25,0,0,0,0,-9,-5,0,6,17,0,-1,24,0,5,12,0,4,16,
+        0,-12,22,0,23,21,15,-10,35,0,-26,18,0,-4,0,0,-4,23,0,-7,
+        21,0,42,0,0,8,18,0,-12,19,0,-1,22,8,5,0,-15,0,0,0,
+        12,0,-2,-11,0,-12,0,13,0,7,0,-15,-23,0,-19,-1,0,0,-27,0,
+        -30,4,0,-11,0,0,0,8,0,-26,14,0,-8,2,16,12,12,0,5,18,
+        0,-1,-11,0,0,18,0,10,3,0,-4,1,0,-25,21,0,-16,6,0,-17,
+        -55,2,13,7,0,22,15,0,5,-24,0,-57,9,0,14,-12,-5,0,-7,0,
+        -37,-11,-6,0,-28,-49,-35,18,11,31,1,-7,-12,-35,32,0,-16,-5,-41,-9,
+        -8,-2,-8,-17,0,36,-15,-23,7,0,0,8,17,-11,-2,1,-6,14,-17,-17,
+        4,17,0,-26,11,0,12,-6,-26,3,2,0,0,0,0,23,9,0,-10,3,
+        -12,-36,14,-14,0,0,-15,0,14,0,-15,-3,-3,-7,-3,-19,-14,22,0,1,
+        16,0,-40,8,-15,-17,-4,23,-5,28,-15,44,17,-18,-13,2,1,-43,20,32,
+        -11,30,2,4,7,0,-33,-4,0,-10,35,1,-11,13,-4,-38,15,7,24,-3,
+        -13,-12,36,-15,-30,7,0,41,0,-4,-2,11,-16,-16,25,41,16,24,18,-11,
+        15,11,-24,14,17,13,0,-9,2,28,8,-31,12,-4,-17,8,-8,1,7,-55,
+        0,5,-23,-24,-5,-14,-10,-22,-24,7,-6,-31,17,-5,-5,1,-17,-3,-5,32,
+        4,-2,23,-8,34,5,-2,0,7,0,-6,14,-20,-10,9,7,1,12,1,15,
+        7,-19,11,14,13,0,-19,0,44,15,-13,8,7,-9,-12,3,4,52,40,22,
+        -2,-25,18,-31,3,5,0,0,-4,9,28,12,9,7,-1,-16,7,-13,0,0,
+        -3,8,0,22,5,29,1,2,0,-30,47,1,0,-4,7,-15,-7,1,-9,11,
+        0,0,-17,22,-25,-2,0,-2,15,0,-31,1,-2,-5,13,0,0,5,18,13,
+        7,11,5,16,0,2,-31,17,0,8,18,12,5,0,1,36,0,23,1,13,
+        5,1,0,-7,-56,13,12,30,0,22,19,2,-3,15,34,6,6,16,5,6,
+        20,-2,6,32,15,-3,15,-3,24,6,-38,4,17,-16,28,5,-21,17,6,-8,
+        10,4,0,-2,25,-11,3,13,1,6,31,43,-5,26,6,13,38,11,16,8,
+        -9,14,-8,-14,3,27,9,13,6,0,19,-5,-8,20,27,11,14,42,54,0,
+        29,23,10,24,-11,5,10,0,-1,0,7,13,32,24,6,9,0,15,-2,-15,
+        17,4,-2,-45,3,-22,18,9,-12,1,6,-16,0,-6,-49,10,-18,-21,0,5,
+        -23,-49,0,-20,-10,14,-26,14,4,-5,26,18,-17,6,14,-7,16,27,13,22,
+        4,-5,16,-12,-15,6,23,13,-27,-15,0,22,-5,-10,31,15,-6,31,31,-6,
+        57,25,11,3,10,7,49,7,-5,40,0,-6,14,32,30,-1,1,-2,18,3,
+        -17,6,0,0,0,0,0,0,0,0,17,0,0,0,0,0,0,0,0,8,
+        0,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,15,0,0,
+        14,22,0,0,0,0,11,0,0,0,0,0,0,0,0,12,0,0,0,0,
+        0,0,0,0,-2,0,0,0,0,0,0,0,0,6,0,0,0,0,0,19,
+        0,-3,0,14,0,0,0,0,0,0,0,10,22,0,0,0,0,0,0,0,
+        0,29,0,0,0,0,0,0,0,11,15,0,0,0,0,0,0,0,17,22,
+        0,13,20,0,0,0,0,-2,19,0,0,0,0,0,0,0,-5,13,0,0,
+        0,0,0,0,0,-6,2,0,0,0,0,0,0,0,-1,22,0,0,0,0,
+        3,9,-2,17,0,-4,0,0,0,0,0,0,15,0,-14,0,0,0,0,0,
+        0,17,0,-2,0,0,0,0,0,0,14,0,-25,0,0,0,0,0,0,17,
+        0,-1,20,19,8,0,0,0,18,0,5,0,0,0,0,0,0,11,0,-5,
+        0,0,0,0,0,0,5,0,-30,0,0,0,0,0,0,8,0,-4,0,0,
+        0,28,0,-17,-2,10,0,25,0,6,0,10,0,8,-8,-17,0,0,-24,0,
+        0,0,-4,14,0,3,0,-10,0,3,-3,10,15,0,13,0,-4,0,5,0,
+        -4,-5,-84,5,20,-4,6,0,0,-18,15,0,0,0,0,0,0,5,-2,14,
+        0,7,0,-17,0,-31,0,0,9,8,-10,-43,9,0,0,0,1,-1,0,11,
+        16,-3,-6,15,-9,-12,0,0,-10,32,-10,0,13,0,2,6,-49,0,21,-11,
+        0,0,0,-17,10,0,-9,19,9,0,5,1,5,18,0,-3,17,3,0,-6,
+        0,-4,-3,18,14,34,37,0,-5,0,3,4,0,10,4,0,0,3,-13,-18,
+        11,0,13,5,-9,0,23,0,3,-4,-1,2,27,32,0,0,0,-2,4,0,
+        19,23,34,-2,33,21,7,9,-23,15,0,-19,0,-9,0,11,-9,-21,0,-46,
+        -16,0,0,-24,1,20,-80,-15,5,-1,0,-19,10,11,2,14,25,0,-15,0,
+        -21,0,-7,0,-21,15,19,9,0,0,0,14,4,6,-7,0,0,0,0,29,
+        -8,5,-11,-5,0,-23,0,-32,0,0,10,-6,28,-15,-8,0,0,0,3,-1,
+        -8,9,0,1,3,-21,-8,7,0,2,0,0,0,-13,17,0,18,0,11,0,
+        -1,0,6,35,-18,18,8,21,3,0,0,-2,24,25,24,0,-15,0,0,42,
+        23,6,0,15,0,4,27,33,17,28,28,0,-3,42,-5,-33,0,0,18,37,
+        5,16,0,16,0,0,2,13,-3,0,13,0,-1,0,54,0,0,0,0,12,
+        7,9,7,0,0,24,28,16,6,27,3,0,0,6,5,17,0,11,6,20,
+        0,20,22,2,5,17,11,21,19,0,0,0,18,13,8,17,40,29,0,0,
+        37,-9,12,0,29,40,31,7,31,37,13,20,32,9,36,-11,0,0,0,27,
+        26,24,17,29,1,0,0,18,-8,13,0,5,6,-3,0,50,0,0,0,0,
+        17,28,24,0,14,0,12,24,33,21,0,-10,0,0,-16,28,10,-10,52,0,
+        11,0,-24,-32,46,-13,-11,18,46,13,-27,0,-25,16,-3,-27,25,0,9,0,
+        0,0,-9,21,-33,10,0,-1,26,13,13,18,22,3,-3,9,-4,49,0,0,
+        -4,-3,-4,12,0,9,0,0,-21,-24,7,-23,20,0,-18,0,-16,0,0,0,
+        0,13,-20,-3,-26,0,20,9,7,12,5,0,0,-4,0,0,0,0,0,16,
+        0,0,18,25,0,20,0,0,6,0,0,-14,0,0,0,0,0,4,0,0,
+        -5,0,0,17,0,0,-11,0,0,-10,6,0,4,0,0,2,0,0,-38,0,
+        0,20,0,-15,5,0,0,-4,0,0,0,0,0,-8,0,0,-32,-10,0,23,
+        0,0,-10,0,0,-17,0,0,-2,0,-11,-7,8,0,-23,12,0,0,0,0,
+        16,17,0,21,26,0,20,0,0,-7,12,0,-9,11,0,0,0,-1,-6,7,
+        0,-11,-9,0,1,25,0,-19,-14,0,-15,-14,0,23,98,0,-8,23,0,0,
+        -17,0,7,-18,-3,-6,28,0,-12,11,0,0,0,0,-18,-5,0,-30,-15,0,
+        14,0,0,-13,7,0,-18,3,0,-5,-1,-9,14,0,-18,6,0,-11,0,0,
+        0,14,0,1,10,-23,-3,19,0,-16,2,0,-11,-7,0,-14,0,0,-17,2,
+        0,-15,12,0,-4,16,0,-40,-11,0,-22,-5,4,-10,15,0,12,3,0,-25,
+        -43,0,0,10,0,-12,9,0,-14,9,0,-10,0,0,0,-4,0,-22,-22,-12,
+        -20,9,0,-31,-8,0,-22,-13,0,-11,-1,0,-8,2,7,0,-6,4,-25,-7,
+        0,0,3,21,12,16,21,-15,40,21,2,0,5,0,1,14,-12,15,-39,-1,
+        -5,5,0,7,5,-25,-8,17,0,-20,-1,-12,-9,-5,-16,11,-8,-16,4,21,
+        0,-51,-26,0,19,-37,-12,2,5,0,3,9,-4,6,33,0,-18,-2,-9,-10,
+        -9,-17,14,0,-30,-12,-4,0,-10,-8,-13,-5,-7,-23,-15,6,-2,-5,12,-18,
+        11,16,-14,4,9,-3,2,27,-1,14,25,12,1,7,-14,-20,25,17,10,33,
+        13,-19,-2,-18,-40,15,-19,-30,18,-18,-14,-38,-37,-24,12,0,37,4,0,-7,
+        49,17,-24,7,0,41,2,5,1,-2,-12,-8,19,-8,-14,19,16,-8,-18,-35,
+        -34,10,5,26,0,16,-18,-16,-27,-23,14,10,-17,5,-4,-14,7,-11,-10,7,
+        -19,-7,-28,-19,-6,7,-6,-4,18,-22,19,0,-9,-1,14,3,-23,24,-8,11,
+        21,-13,-17,-10,-32,-5,10,-36,33,10,-42,-13,-28,-44,-15,12,-1,18,0,-7,
+        -10,9,22,20,0,0,0,0,-15,10,-13,-14,-1,11,-26,0,0,-31,-8,-19,
+        -38,-30,9,-1,6,0,-8,-12,-19,-41,-24,14,4,-18,9,-11,13,0,5,5,
+        0,4,3,24,0,21,0,-8,21,25,23,5,45,14,24,33,18,28,14,9,
+        -11,-7,4,0,0,0,-13,0,-5,-3,0,-10,5,0,-18,4,18,4,18,8,
+        -2,10,-8,-4,0,22,0,31,3,-12,1,0,15,-4,0,0,2,12,-7,-1,
+        0,-17,-22,19,11,16,0,-11,-5,-5,-13,-20,17,14,-2,15,-1,17,52,9,
+        23,14,-5,25,7,8,28,-5,-2,9,20,16,-3,3,-22,-4,5,9,-52,9,
+        18,2,28,8,-4,3,-21,-39,24,-19,-3,23,9,-9,-6,-10,20,9,-6,14,
+        -1,-2,-17,19,-5,0,-3,0,26,-10,4,-12,-4,-6,-5,28,1,-29,15,20,
+        -8,-19,11,-7,11,-18,19,0,18,6,6,0,4,17,-11,14,-1,-14,17,0,
+        -6,31,2,-20,-2,0,-21,13,-22,-17,-8,17,-7,47,-32,-12,32,-40,-11,20,
+        11,-16,20,15,-21,2,6,-18,-9,24,-1,25,10,-19,-3,11,-10,19,8,-9,
+        18,13,-16,9,27,3,-7,0,0,21,-8,-17,22,0,-13,-2,4,6,-12,0,
+        14,6,11,5,-27,7,-5,23,0,-8,6,36,0,-2,14,0,21,-6,-19,1,
+        0,0,0,0,0,18,0,0,24,0,0,0,16,0,32,0,0,10,0,0,
+        -8,0,0,24,0,6,4,0,0,0,0,0,13,0,0,12,0,0,7,14,
+        0,10,0,0,1,0,0,-18,0,0,34,0,4,12,0,0,7,0,0,26,
+        0,0,-5,0,0,-9,9,0,8,0,0,7,0,0,-3,0,0,8,0,-4,
+        -6,8,0,0,0,0,5,24,0,17,19,0,0,27,0,36,5,0,1,18,
+        0,-7,-6,0,20,8,0,-1,23,0,0,0,0,15,7,0,15,20,0,3,
+        28,0,9,8,0,3,2,0,-34,22,0,26,14,-5,4,28,0,4,6,0,
+        17,-5,0,-6,8,0,-12,9,0,9,0,0,5,10,0,-5,24,0,-1,23,
+        1,15,0,-16,0,0,0,18,0,-16,24,0,3,0,24,0,31,0,-22,17,
+        0,-6,2,0,0,48,0,-9,13,0,-10,0,0,0,20,0,-28,25,0,-2,
+        16,22,14,10,0,-6,12,0,-30,-1,0,0,17,0,3,17,0,13,16,0,
+        -7,32,0,-17,7,0,-17,-10,14,8,0,0,0,15,0,1,-1,0,13,11,
+        0,3,-10,-5,0,0,-33,-34,-5,7,0,13,13,6,36,30,-30,56,-19,-20,
+        1,7,0,-5,6,-10,3,12,-8,8,-2,0,3,-29,6,-9,8,0,-2,4,
+        -20,-6,-6,-13,-9,-16,-24,-9,1,0,-16,-16,0,-11,-16,-18,5,8,0,0,
+        15,-23,-6,9,0,-7,1,-13,-12,7,-29,25,0,0,1,8,0,-17,-4,-16,
+        -16,-9,-22,-23,14,0,-15,3,-20,-1,9,-2,-6,29,8,33,32,-5,35,20,
+        12,-4,14,7,-18,20,23,0,30,4,-7,6,0,5,27,36,5,30,-10,-9,
+        15,-14,-26,8,-7,22,-10,-25,-22,21,-3,-45,-3,0,35,-6,-20,-4,16,-2,
+        -2,26,-4,10,25,3,-7,1,-1,-23,8,15,0,0,15,-6,21,6,-26,6,
+        13,-28,2,-14,-17,11,-29,-50,-2,-13,16,25,-17,15,23,-10,14,14,-18,43,
+        26,-13,1,13,-12,-5,15,13,-4,27,7,12,-4,0,3,10,4,25,26,-43,
+        -3,3,-13,-9,6,-7,8,-15,-14,-6,12,2,11,-21,0,-2,-2,-23,3,11,
+        -14,-1,22,-10,17,12,-12,-9,7,-8,-23,0,-9,43,0,-40,-6,11,16,-20,
+        0,-5,-16,-1,-20,4,0,-2,-10,0,-15,10,11,-2,15,0,13,27,20,4,
+        14,17,-4,15,13,5,3,26,-12,22,14,5,-9,0,-2,0,0,-3,22,14,
+        10,6,0,-3,4,19,0,5,14,-1,7,9,-10,-3,9,0,0,12,-1,10,
+        0,7,25,0,7,26,16,21,-1,0,-11,-13,17,31,13,0,-4,13,10,5,
+        -5,17,19,5,17,-7,2,18,-1,-13,-3,3,18,8,-3,25,22,10,29,24,
+        -2,34,17,0,21,27,15,19,21,0,36,30,11,3,-2,-6,-17,43,20,25,
+        28,12,-3,20,17,11,3,-13,12,-9,-21,-7,21,1,-16,-9,0,15,-8,-11,
+        22,17,-6,20,33,35,27,30,28,-12,16,4,2,5,29,16,0,-2,4,24,
+        21,-3,3,8,11,-5,-19,12,9,-1,10,-12,-30,23,7,-17,25,16,-10,6,
+        10,-19,19,2,-9,25,22,8,12,13,-4,38,21,0,9,-13,-10,1,11,-10,
+        26,22,10,-3,16,7,10,-3,-20,6,-13,-30,-9,14,2,-22,-18,0,11,-19,
+        -26,32,6,-15,22,29,12,29,30,14,-3,11,3,-8,-2,-18,18,0,-16,6,
+        26,22,-1,-1,-14,9,-7,-34,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-12,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,21,-37,-14,18,-10,-51,10,98,-77,3,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,
+        0,40,23,0,67,30,0,28,31,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-25,0,0,-14,
+        0,0,-21,0,-39,-36,-13,-37,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-14,0,-47,11,0,
+        -26,-27,83,-37,3,31,-29,-2,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,20,13,41,20,
+        4,19,25,-13,23,20,10,30,16,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-49,-3,-43,10,
+        0,-32,-31,0,-34,-34,-14,-31,-23,14,19,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,64,
+        9,66,39,-33,5,22,0,24,20,-23,8,19,-1,-1,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-11,-10,-12,-5,-40,20,-11,0,-10,1,0,-7,-12,14,10,5,10,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-44,-4,-43,-23,0,-28,-35,0,-33,-39,-13,-22,-25,6,7,
+        -2,3,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-9,17,-26,-28,0,-37,-17,-16,-35,-3,
+        15,-35,-13,25,-16,14,11,-13,13,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,
+        0,0,0,0,0,27,16,-11,8,22,4,21,14,6,36,34,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-42,0,-43,-26,0,0,-14,0,-20,-20,3,-21,-21,17,11,2,15,
+        9,-3,18,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-32,13,-4,-65,0,-15,-60,0,-56,
+        -21,-9,-25,-31,16,-8,0,1,-14,-10,0,0,-11,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        18,37,20,16,13,0,-11,5,1,3,-2,-2,-10,15,11,2,11,2,12,13,
+        18,2,11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-25,0,-11,-41,0,15,-9,0,-50,-21,
+        -20,-16,-19,9,12,-4,8,3,-7,10,9,-6,7,11,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-18,18,0,28,0,0,-31,0,-43,12,15,-8,-2,16,9,4,11,3,21,
+        30,17,13,12,5,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,8,14,0,-8,0,-12,-16,
+        -7,-5,1,-7,-9,-16,11,9,-6,7,0,11,11,8,1,10,2,10,11,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-38,-52,-46,-42,-27,-35,-28,0,-35,-30,-10,-24,-24,7,
+        6,-2,3,1,-5,10,3,-11,8,3,8,1,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,43,13,-24,-16,37,-5,32,21,-7,29,56,
+        -24,3,23,7,36,19,-10,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,20,0,49,-43,28,18,28,29,-2,40,59,-32,0,4,41,33,
+        34,18,-43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -43,0,0,-7,35,0,26,-13,-21,-37,36,0,12,0,-15,-1,2,2,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,23,0,
+        -32,36,12,16,-7,50,33,52,0,19,22,10,31,6,-13,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-29,0,0,0,25,
+        2,20,26,14,39,20,-13,0,18,36,33,-1,-9,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,-25,13,0,
+        0,4,-14,0,28,0,0,0,28,0,36,7,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,4,0,3,27,39,
+        -4,15,10,53,80,-42,-40,38,8,38,12,5,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,15,0,46,24,
+        24,-1,23,15,78,24,0,0,22,25,39,33,13,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-60,0,0,
+        -7,15,-49,22,34,-9,-44,23,-22,0,10,15,10,0,4,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-25,46,-29,-23,27,-68,-21,0,-38,
+        -16,-7,-40,-25,11,-15,0,5,-17,-2,17,-14,-17,2,-12,14,4,-16,10,23,
+        41,-21,49,41,14,0,36,-15,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,16,32,0,
+        0,32,0,16,3,-17,-21,-8,3,-1,-1,-4,-2,12,12,1,-16,2,-9,11,
+        -12,-7,40,34,0,31,0,0,40,0,0,-1,-30,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -54,0,-52,-58,0,-24,-58,-18,-20,-35,-28,-38,-34,-2,-8,-28,0,-7,-18,-7,
+        -9,-20,-2,-6,-2,-10,-9,-67,0,0,0,0,0,0,0,0,-38,-23,-28,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,-35,-2,-38,-36,0,-37,-35,0,-45,-22,-9,-29,-26,4,
+        -11,-6,-9,-14,-19,0,-11,-20,-9,-14,-2,-13,-16,1,0,-36,56,0,0,-7,
+        0,0,-23,-14,-36,-31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,16,-16,-36,-5,2,6,22,
+        19,10,5,1,0,-3,11,8,-4,7,-2,14,6,7,0,7,0,7,5,0,
+        34,32,59,21,29,0,39,19,26,3,-1,-8,-8,1,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-24,2,-41,-33,0,-30,-18,-35,-19,-14,-10,-6,-18,8,4,-2,0,-2,-6,
+        4,10,-4,5,1,6,-4,-5,-17,35,18,-12,3,0,1,27,12,-14,-10,-15,
+        -19,-1,-15,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-22,0,-32,41,0,-24,-16,0,-29,2,
+        6,-17,-8,7,0,-5,-3,-3,15,13,7,1,-1,-3,14,-5,-3,33,-4,-16,
+        52,31,0,39,40,0,2,-3,-17,-12,-2,-12,2,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        -16,29,-14,-13,-1,0,-15,9,-30,0,-11,-9,-13,8,1,-8,0,-7,9,5,
+        3,-6,3,-2,6,-3,0,27,4,23,14,61,-8,14,11,0,2,-13,-10,-10,
+        -1,-5,-3,-11,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,-27,0,-15,-40,0,-30,-34,0,-21,
+        -19,-13,-10,-21,1,-4,-5,-5,-6,-5,8,3,-9,-1,-4,4,-7,-7,-17,0,
+        -4,-16,14,-36,1,-16,0,-14,-21,-14,-17,-8,-11,-7,-10,-14,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,-29,65,-59,-31,37,-25,-18,0,-8,0,28,-28,-11,28,-6,23,13,
+        -9,15,37,1,-6,15,-3,25,12,-7,-12,26,0,-7,65,-79,-24,66,1,5,
+        18,-28,-11,28,-7,28,18,-6,-2,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,-51,0,
+        0,0,0,0,0,28,26,5,11,21,11,19,12,8,42,37,23,22,12,12,
+        28,7,6,18,0,0,0,50,0,37,-5,0,38,12,1,8,20,8,24,16,
+        5,41,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,-31,0,0,-24,0,-23,-39,0,0,-33,
+        -3,-33,-20,19,15,-1,16,10,3,24,12,-3,14,9,19,8,6,-64,0,0,
+        -52,0,-27,-53,0,9,-20,-10,-21,-17,14,6,15,17,11,-30,6,-45,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,-10,0,-27,10,-8,0,-11,0,-7,-29,-17,-23,-20,5,0,
+        2,10,5,-10,2,-7,3,3,-10,7,0,0,15,4,-60,-2,0,-9,0,0,
+        0,-18,-3,-21,-7,0,-9,0,0,-6,-16,16,-18,-8,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-16,14,1,0,0,-12,-43,0,-20,4,-1,-11,-4,10,6,-10,5,0,15,
+        3,6,-5,5,6,6,3,3,45,39,38,35,23,2,24,20,-5,8,-5,-7,
+        -7,1,-2,-1,-1,-4,36,19,16,3,-1,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-24,7,
+        -26,-14,-40,-29,-5,0,-32,-17,-14,-12,-18,3,2,-12,-1,-5,-9,-3,4,-10,
+        1,-1,-1,1,-5,1,7,-10,2,27,0,18,-2,33,-14,-19,-14,-17,-3,-10,
+        -10,-8,-12,-4,12,11,-13,-2,-13,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,-9,47,12,
+        13,-25,21,26,11,11,19,-10,-5,17,11,14,11,5,27,28,16,8,13,7,
+        26,7,6,18,27,0,17,36,0,11,26,-65,13,11,-9,-4,17,11,30,13,
+        11,-2,26,-22,2,20,15,-1,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-3,0,-23,-43,30,
+        -45,-16,11,-10,0,-11,-11,-11,5,-2,-11,0,-4,12,4,2,-4,1,-2,3,
+        -5,-7,47,44,18,36,41,0,18,45,0,9,-12,-8,-13,-2,-9,-6,-9,-14,
+        35,28,23,0,-8,-10,22,-12,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,-38,-48,-32,-34,-16,
+        -17,-33,1,-30,-28,-22,-25,-22,2,-4,-10,-3,-8,-11,3,-3,-16,-1,-6,0,
+        -6,-7,-26,12,-31,-14,20,-28,-40,-16,-33,-24,-14,-26,-22,-4,-10,-10,-10,-15,
+        -18,-2,-24,-23,-4,-15,-17,-10,-15,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,-9,0,0,0,0,0,0,0,0,0,-7,-63,0,0,0,-10,0,0,0,
+        0,0,-12,-12,-19,4,3,19,14,-14,2,3,-1,-18,-4,3,-7,-3,11,19,
+        -2,21,13,-16,14,9,7,9,8,5,5,10,-9,-13,-5,-7,0,-11,-14,8,
+        -24,-13,-11,-11,-7,5,4,-11,0,-13,17,0,-25,-3,15,1,3,4,0,1,
+        9,2,10,11,17,-21,-6,11,-12,5,-3,-8,1,-2,-2,-1,7,4,6,6,
+        -11,-14,-33,-2,-9,-6,-14,39,-8,-8,-5,-7,-5,6,4,4,5,4,-9,0,
+        0,0,0,0,0,0,0,5,19,0,3,16,-3,11,7,1,15,0,0,0,
+        0,0,0,0,0,0,-2,4,-8,2,14,7,19,8,5,17,18,0,0,0,
+        0,0,0,0,0,0,8,49,-46,1,12,5,7,10,3,13,-4,14,-7,-30,
+        -46,2,-16,-14,-33,-2,-22,-7,-5,-11,-8,3,-3,1,2,-1,0,8,3,-7,
+        1,3,-15,-7,15,13,2,-5,-18,-3,-7,-6,-5,5,1,4,3,2,6,7,
+        9,-3,0,-11,-9,-5,-10,-10,-11,-13,-7,-13,-8,-14,-8,-9,0,-1,-2,1,
+        -1,-3,1,3,-6,-3,-4,-4,-12,26,9,24,1,3,2,13,-1,0,-3,-2,
+        9,2,9,7,6,12,15,12,0,4,-1,8,8,11,0,-9,-30,-5,-10,4,
+        -10,-1,-6,-4,-3,4,1,3,3,1,6,5,5,-1,0,-3,5,0,-14,-10,
+        -15,-5,-12,-14,-9,-27,-12,-10,-9,-12,-7,3,-1,2,3,-1,0,4,4,-5,
+        -1,-4,3,-1,-3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,11,0,0,-16,
+        0,0,0,0,0,0,0,0,0,-14,0,0,0,0,0,0,0,0,0,0,
+        -12,3,0,4,-3,-2,-2,-15,-3,-10,11,-15,-12,-12,-13,-8,14,13,16,15,
+        13,8,4,14,13,-1,-5,-2,-2,5,-6,-12,0,1,11,5,7,17,26,-7,
+        -7,-5,-6,1,1,6,36,31,22,9,18,5,14,-3,-1,-4,-5,-1,4,0,
+        7,9,5,-1,11,12,11,12,6,10,1,-3,-2,0,4,3,5,3,-1,17,
+        7,-7,6,15,14,9,-6,-7,-10,-6,-4,2,1,2,3,1,0,0,0,0,
+        0,0,0,0,0,-5,-6,-3,1,10,-1,9,7,0,11,11,0,0,0,0,
+        0,10,0,0,-10,38,0,1,12,6,11,8,7,11,11,0,0,0,0,0,
+        0,12,0,0,-16,-52,-13,-1,8,3,9,9,6,8,5,77,13,36,0,5,
+        -2,-32,-1,22,-16,-11,-7,-19,-9,-2,-4,-1,0,-4,-2,3,-3,-11,11,14,
+        3,12,9,-8,5,4,2,-2,-3,-4,-7,2,-1,1,1,-1,9,8,7,-4,
+        -3,-12,17,-1,-2,-1,-2,5,14,13,-8,-12,-7,-9,-2,-3,-3,-1,-3,-2,
+        7,1,-7,-5,-6,7,-27,8,5,24,-8,-3,-1,14,-4,-3,-4,-1,7,2,
+        8,7,5,3,7,-2,-2,6,2,3,7,10,15,11,33,-10,6,11,-12,1,
+        -4,-6,-3,2,-1,1,0,-1,13,13,10,-3,-3,-5,7,-3,-14,3,-18,-11,
+        -5,3,-20,5,-19,-15,-13,-14,-8,-1,-3,-3,0,-3,-7,-3,-6,-9,-4,-7,
+        -3,-4,-8,0,0,0,0,0,0,0,0,-39,0,5,-3,0,25,-6,-27,-6,
+        -16,-44,-27,-1,0,50,0,0,26,-44,0,29,-2,29,57,6,-9,44,0,9,
+        14,-3,-32,18,-29,-80,16,-15,0,0,0,0,16,-9,0,49,-15,-16,0,0,
+        0,0,0,0,-50,0,-13,-4,-9,0,0,0,0,0,0,0,0,-29,-14,-7,
+        -11,33,-42,-13,-33,5,-8,13,2,-13,-6,0,-4,-9,22,33,5,25,17,-22,
+        17,23,-3,12,15,0,3,15,-12,-8,-17,-13,-11,-18,8,-18,-10,-17,-3,-12,
+        -12,6,5,-11,20,-35,-63,10,5,-15,1,-5,0,6,5,-2,15,6,15,2,
+        -5,-6,1,16,-1,1,-7,-15,-1,-3,-14,-5,11,7,9,8,-28,-25,-13,-12,
+        -8,-25,-2,9,-23,-15,-8,-17,-11,5,5,7,5,3,0,0,0,0,31,0,
+        0,28,-21,4,0,-52,-1,17,-4,24,7,-2,25,18,14,0,0,15,0,-11,
+        8,0,49,0,-21,23,18,11,8,19,5,13,28,0,0,0,66,-6,0,0,
+        28,-18,42,4,-2,-10,15,5,21,9,5,-3,8,11,12,26,-14,0,-4,19,
+        63,-8,-6,-19,-20,-5,-14,-1,-4,1,-3,-7,-1,-8,-10,-15,18,12,24,13,
+        18,-11,12,24,15,1,0,-3,-6,6,2,7,3,1,14,19,7,-8,-1,-4,
+        25,-8,3,6,5,-2,-5,-11,-8,-9,-17,-10,0,0,2,0,-2,1,11,7,
+        -10,-4,-7,-23,24,9,-25,-4,-12,19,7,-25,5,10,-1,0,13,7,15,9,
+        6,8,10,4,1,10,6,12,17,17,4,4,23,11,2,21,5,1,-6,-9,
+        -7,3,1,4,0,-1,16,13,6,-7,-3,-6,12,-4,-17,-3,-13,-24,12,-12,
+        -9,19,-11,-16,-13,-19,-13,1,-2,1,1,-4,-12,0,-12,-15,-3,-10,-3,-4,
+        -12,16,-20,29,-3,14,-12,-34,-19,-15,-51,14,31,11,-7,16,-17,-9,-25,-49,
+        -36,-49,24,23,5,3,22,-23,49,20,34,16,24,35,1,49,48,-9,-3,-24,
+        -25,-2,-30,18,33,-11,30,-37,-4,-9,-22,-1,-22,-20,-13,-18,3,0,-7,-1,
+        18,-6,-1,-14,-14,2,0,30,21,20,3,24,11,34,4,-3,-10,-10,9,1,
+        16,1,-14,-15,-23,-18,1,-5,6,0,-8,-11,8,5,19,37,44,-31,-18,-32,
+        -31,19,31,17,-4,9,3,18,6,-15,2,1,24,30,27,-4,19,14,24,5,
+        16,4,-13,5,-1,15,1,-10,9,2,-24,1,-6,3,0,-13,-1,-5,-2,4,
+        1,2,-20,-28,-17,-22,-10,-10,-8,-8,11,-8,-12,-15,-17,-3,-7,18,18,27,
+        0,10,-3,22,9,19,14,3,11,0,20,5,10,8,10,-10,-1,-11,9,6,
+        -7
+    }
+};
@@ -0,0 +1,129 @@
+// bench.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// AI探索のベンチマーク（ホスト用）
+// 固定の局面集を固定の深さで探索し, 局面ごとのノード数・時間・最善手を表示する.
+// 探索アルゴリズムを変えたときに, 同じ深さでのノード数を比べるために使う.
+// 各局面の前に置換表を消去するので, 結果は局面の順序に依存しない.
+//
+// ビルド
+//   gcc -O2 -I.. bench.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c -lm -o bench
+//
+//   -DAI_STATS=0 を付けると探索の統計（葉・βカット・置換表・パスの数）を数えない版になる.
+//
+//   ニューラルネット評価の版は -DAI_EVAL=AI_EVAL_NN を付け, ../nn.c ../nn_weights.c も加えてビルドする.
+//
+//   小さい盤（-DBOARD_SIZE=4 か 6）では初期局面を完全読みし, 既知の結果（bench_positions.h）と照合する.
+//   6x6 は空き32マスから読み切るので -DAI_ENDGAME_EMPTIES=32 も付ける（1コアで約26分, 約89億ノード）.
+//   一致しなければ終了コード1を返す.
+//
+//   8x8 では最後に, 思考時間内に完全読みが終わらない局面で反復深化に戻れるか確かめる.
+//   完全読みを打ち切ったあと深さ2以上を完了できなければ終了コード1を返す.
+//
+// 使い方
+//   ./bench [深さ(既定6)]
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "bitboard.h"
+#include "ai.h"
+#include "bench_positions.h"
+
+int main(int argc, char *argv[])
+{
+    struct Board brd;
+    unsigned long nodes, total_nodes = 0;
+    unsigned long start, elapsed, total_elapsed = 0;
+    int depth = (argc > 1) ? atoi(argv[1]) : 6;
+    int i, x, y;
+#ifdef BENCH_PERFECT_SCORE
+    int score, errors = 0;
+#elif defined(FALLBACK_TIME_MS) && AI_STATS
+    int empties, errors = 0;
+#endif
+#if AI_STATS
+    const struct AiStats *st;
+#endif
+
+    if(depth < 1) depth = 1;
+    if(depth > AI_MAX_DEPTH) depth = AI_MAX_DEPTH;
+
+    printf("bench : depth %d\n", depth);
+
+    for(i = 0; i < NUM_POSITIONS; i++)
+    {
+        brd.stones[stone_red]   = POSITIONS[i].p;
+        brd.stones[stone_green] = POSITIONS[i].o;
+
+        ai_new_game();
+        srand(1);
+
+        start = ai_port_get_ms();
+        if(!ai_select_move(&brd, stone_red, depth, 0, &x, &y))
+        {
+            x = y = -1;
+        }
+        elapsed = ai_port_get_ms() - start;
+        nodes   = ai_get_node_count();
+
+        total_nodes   += nodes;
+        total_elapsed += elapsed;
+
+        printf("%-8s : %10lu nodes %7lu ms  move (%d, %d)\n", POSITIONS[i].name, nodes, elapsed, x, y);
+
+#if AI_STATS
+        st = ai_get_stats();
+        printf("           leaves %lu, cutoffs %lu, tt hits %lu, passes %lu, depth %d\n",
+               st->leaves, st->cutoffs, st->tt_hits, st->pass_nodes, st->depth);
+#endif
+
+#ifdef BENCH_PERFECT_SCORE
+        // 完全読みの値を既知の結果と照合する
+        if(MAT_WIDTH * MAT_HEIGHT - bb_count(POSITIONS[i].p | POSITIONS[i].o) > AI_ENDGAME_EMPTIES)
+        {
+            printf("           not solved (build with -DAI_ENDGAME_EMPTIES=%d)\n", MAT_WIDTH * MAT_HEIGHT - 4);
+            errors++;
+            continue;
+        }
+
+        score = ai_get_score();
+        if(score > SCORE_WIN / 2)  score -= SCORE_WIN;
+        if(score < -SCORE_WIN / 2) score += SCORE_WIN;
+
+        printf("           perfect play %+d : %s\n", score, (score == BENCH_PERFECT_SCORE) ? "OK" : "NG");
+        if(score != BENCH_PERFECT_SCORE) errors++;
+#endif
+    }
+
+    printf("total    : %10lu nodes %7lu ms %8.1f knps\n", total_nodes, total_elapsed,
+           total_elapsed ? (double)total_nodes / (double)total_elapsed : 0.0);
+
+#if defined(FALLBACK_TIME_MS) && AI_STATS
+    // 完全読みの打ち切り. 思考時間の半分で完全読みをやめ, 残りで反復深化する.
+    // 完全読みで決めたら深さは空きマス数になるので, それより浅い深さ2以上なら反復深化で決めている.
+    empties = MAT_WIDTH * MAT_HEIGHT - bb_count(FALLBACK_POSITION.p | FALLBACK_POSITION.o);
+    if(empties <= AI_ENDGAME_EMPTIES)
+    {
+        brd.stones[stone_red]   = FALLBACK_POSITION.p;
+        brd.stones[stone_green] = FALLBACK_POSITION.o;
+
+        ai_new_game();
+        srand(1);
+
+        ai_select_move(&brd, stone_red, AI_MAX_DEPTH, FALLBACK_TIME_MS, &x, &y);
+        st = ai_get_stats();
+
+        printf("fallback : %10lu nodes %7lu ms  depth %d in %d ms : %s\n", ai_get_node_count(), st->elapsed_ms,
+               st->depth, FALLBACK_TIME_MS, (st->depth >= 2 && st->depth < empties) ? "OK" : "NG");
+        if(st->depth < 2 || st->depth >= empties) errors++;
+    }
+
+    return errors ? 1 : 0;
+#elif defined(BENCH_PERFECT_SCORE)
+    return errors ? 1 : 0;
+#else
+    return 0;
+#endif
+}
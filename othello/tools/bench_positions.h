@@ -0,0 +1,66 @@
+// bench_positions.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// ベンチマーク局面集（bench.c, smpbench.c で共有）
+
+#ifndef BENCH_POSITIONS_H
+#define BENCH_POSITIONS_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+// ベンチマーク局面. 手番側を赤として探索する.
+struct BenchPosition{
+    const char *name; // 局面名
+    uint64_t    p;    // 手番側
+    uint64_t    o;    // 相手側
+};
+
+#if BOARD_SIZE == 4
+// 小さい盤は初期局面. 終局まで読み切れるので, 完全読みの値を既知の結果と照合する.
+// 4x4 は後手の 11 対 3 の勝ち（空き2マスは勝った側に数える）.
+#define BENCH_PERFECT_SCORE (-10) // 初期局面の手番側（先手）から見た最終石差
+
+static const struct BenchPosition POSITIONS[] =
+{
+    {"start",    0x0000000000040200ULL, 0x0000000000020400ULL}
+};
+#elif BOARD_SIZE == 6
+// 6x6 は後手の 20 対 16 の勝ち
+#define BENCH_PERFECT_SCORE (-4)
+
+static const struct BenchPosition POSITIONS[] =
+{
+    {"start",    0x0000000008040000ULL, 0x0000000004080000ULL}
+};
+#else
+// 乱数対局から保存した序盤〜終盤の局面
+static const struct BenchPosition POSITIONS[] =
+{
+    {"start",    0x0000000810000000ULL, 0x0000001008000000ULL},
+    {"a-ply10",  0x0000301010100000ULL, 0x00080c080e020100ULL},
+    {"a-ply20",  0x0102202030080000ULL, 0x020d1c1c0e122100ULL},
+    {"a-ply30",  0x010101120f100000ULL, 0x020e7e2c702e6500ULL},
+    {"a-ply44",  0x01c1013e5c180448ULL, 0x020efec1a3a77320ULL},
+    {"b-ply16",  0x0020100800700000ULL, 0x080c0c343c040200ULL},
+    {"b-ply26",  0x0202001a04060201ULL, 0x482c1e2478709000ULL},
+    {"b-ply36",  0x2230001c00000201ULL, 0x4c0e7f627f769400ULL},
+    {"c-ply16",  0x00002010300a0002ULL, 0x2848d80808040201ULL},
+    {"c-ply26",  0x80083c1a11280002ULL, 0x6e40c00068070201ULL},
+    {"c-ply36",  0x800c083061880400ULL, 0x6e40f60a1a277207ULL},
+    {"d-ply16",  0x0408005008140800ULL, 0x0000b8a8b0202000ULL},
+    {"d-ply26",  0x0428106834206020ULL, 0x0040a89688540a04ULL},
+    {"d-ply36",  0x140a523b34301000ULL, 0x2070a8c488446a74ULL}
+};
+
+// 完全読みの打ち切りを確かめる局面（a-ply44, 空き16マス）と思考時間 [ms].
+// 完全読みには思考時間より十分長くかかり, 反復深化なら深さ2がすぐに終わる.
+#define FALLBACK_TIME_MS 10
+static const struct BenchPosition FALLBACK_POSITION =
+    {"a-ply44",  0x01c1013e5c180448ULL, 0x020efec1a3a77320ULL};
+#endif
+
+#define NUM_POSITIONS ((int)(sizeof(POSITIONS) / sizeof(POSITIONS[0])))
+
+#endif /* BENCH_POSITIONS_H */
@@ -0,0 +1,247 @@
+// bookgen.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 定石データの生成ツール（ホスト用）
+// 初期局面から序盤の木を広げ, 各局面の最善手を book_data.c として書き出す.
+// 1. 局面の全ての手を深さ指定の探索で評価する
+// 2. 最善の手から指定の石差以内の手だけを, 指定の手数まで再帰的に広げる
+//    （少し悪い手を相手が打っても定石から外れないように, 両方の手番で同じように広げる）
+// 3. 広げた先の値をミニマックスで戻し, その値で最善手を決める
+// 対称形と手順違いで同じになる局面は正規形（book.h）で1つにまとめる.
+//
+// ビルド
+//   gcc -O2 -I.. bookgen.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c ../book.c ../book_data.c -lm -o bookgen
+//   book_data.c がまだなければ, 中身が空の表（book_size = 0）を用意してからビルドする.
+//
+// 使い方
+//   ./bookgen [手数(既定10)] [探索深さ(既定8)] [展開する石差(既定2)] > ../book_data.c
+//   経過は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "book.h"
+#include "ai.h"
+
+#define NODE_BITS 20                  // 局面表の大きさ (2^NODE_BITS)
+#define NODE_COUNT (1UL << NODE_BITS)
+#define KEYS_PER_LINE 8               // 出力の1行あたりのキーの数
+#define MOVES_PER_LINE 20             // 出力の1行あたりの手の数
+
+// 広げた局面. 正規形で持つ.
+struct Node{
+    uint64_t p;     // 手番側
+    uint64_t o;     // 相手側
+    uint32_t key;   // 正規形のキー
+    int      value; // 手番側から見た値
+    uint8_t  move;  // 正規形での最善手
+    uint8_t  used;  // 使用中なら1
+};
+
+static struct Node *nodes;
+static unsigned long num_nodes;
+static unsigned long num_searches;
+
+static int max_plies;
+static int search_depth;
+static int expand_margin;
+
+// 手番側p, 相手側oの局面を探索して手番側から見た値を返す
+static int search_score(uint64_t p, uint64_t o)
+{
+    struct Board brd;
+
+    brd.stones[stone_red]   = p;
+    brd.stones[stone_green] = o;
+    num_searches++;
+
+    return ai_search_score(&brd, stone_red, search_depth);
+}
+
+// 正規形の局面を局面表から探す. なければ空きを返す.
+static struct Node *find_node(uint64_t p, uint64_t o, uint32_t key)
+{
+    unsigned long i = key & (NODE_COUNT - 1);
+
+    while(nodes[i].used && (nodes[i].p != p || nodes[i].o != o))
+    {
+        i = (i + 1) & (NODE_COUNT - 1);
+    }
+
+    return &nodes[i];
+}
+
+// 手番側p, 相手側oの局面を ply 手目として広げ, 手番側から見た値を返す
+static int expand(uint64_t p, uint64_t o, int ply)
+{
+    struct Node *node;
+    uint64_t moves = bb_moves(p, o);
+    uint64_t flips, cp[AI_MAX_MOVES], co[AI_MAX_MOVES];
+    int score[AI_MAX_MOVES], sqs[AI_MAX_MOVES];
+    int i, n = 0, sq, sym, v, best = -INF, value = -INF, best_sq = 0;
+    uint32_t key;
+
+    key  = book_key(p, o, &sym);
+    node = find_node(bb_symmetry(p, sym), bb_symmetry(o, sym), key);
+
+    if(node->used) return node->value;
+
+    // 全ての手を評価する
+    while(moves)
+    {
+        sq = bb_first(moves);
+        moves &= moves - 1;
+
+        flips   = bb_flips(p, o, sq);
+        cp[n]   = o & ~flips;
+        co[n]   = p | flips | BB_BIT(sq);
+        score[n] = -search_score(cp[n], co[n]);
+        sqs[n]  = sq;
+        if(score[n] > best) best = score[n];
+        n++;
+    }
+
+    // 最善に近い手だけ先まで広げる
+    for(i = 0; i < n; i++)
+    {
+        v = score[i];
+
+        if(ply + 1 < max_plies && v >= best - expand_margin && bb_moves(cp[i], co[i]))
+        {
+            v = -expand(cp[i], co[i], ply + 1);
+        }
+
+        if(v > value)
+        {
+            value   = v;
+            best_sq = sqs[i];
+        }
+    }
+
+    // 再帰の間に局面表の同じ位置が埋まっているかもしれないので探し直す
+    node = find_node(bb_symmetry(p, sym), bb_symmetry(o, sym), key);
+
+    if(num_nodes + 1 >= NODE_COUNT)
+    {
+        fprintf(stderr, "node table full\n");
+        exit(1);
+    }
+
+    node->p     = bb_symmetry(p, sym);
+    node->o     = bb_symmetry(o, sym);
+    node->key   = key;
+    node->value = value;
+    node->move  = (uint8_t)bb_first(bb_symmetry(BB_BIT(best_sq), sym));
+    node->used  = 1;
+    num_nodes++;
+
+    if(num_nodes % 100 == 0) fprintf(stderr, "positions %lu, searches %lu\n", num_nodes, num_searches);
+
+    return value;
+}
+
+// キーの昇順
+static int compare_key(const void *a, const void *b)
+{
+    uint32_t ka = (*(const struct Node * const *)a)->key;
+    uint32_t kb = (*(const struct Node * const *)b)->key;
+
+    return (ka > kb) - (ka < kb);
+}
+
+// book_data.c を書き出す
+static void write_book(void)
+{
+    struct Node **list;
+    unsigned long i, j, n = 0, m = 0, dropped = 0;
+
+    list = (struct Node **)malloc(sizeof(struct Node *) * (num_nodes + 1));
+    if(list == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+
+    for(i = 0; i < NODE_COUNT; i++)
+    {
+        if(nodes[i].used) list[n++] = &nodes[i];
+    }
+
+    qsort(list, n, sizeof(struct Node *), compare_key);
+
+    // キーが衝突した局面はどちらも表に入れない
+    for(i = 0; i < n; i = j)
+    {
+        for(j = i + 1; j < n && list[j]->key == list[i]->key; j++);
+
+        if(j - i == 1) list[m++] = list[i];
+        else           dropped += j - i;
+    }
+
+    printf("// book_data.c\n");
+    printf("// Created on : 2026/10/17\n");
+    printf("// Author : T.Ijiro\n");
+    printf("//\n");
+    printf("// 定石データ. tools/bookgen.c が生成する. 手で編集しない.\n");
+    printf("// 序盤 %d 手まで, 探索深さ %d, 最善から %d 石以内の手を展開. 局面数 %lu（%lu バイト）\n",
+           max_plies, search_depth, expand_margin / PATTERN_SCALE, m, m * 5);
+    printf("\n#include <stdint.h>\n#include \"book.h\"\n\n");
+
+    printf("const unsigned int book_size = %lu;\n\n", m);
+
+    printf("const uint32_t book_keys[] =\n{\n");
+    for(i = 0; i < m; i++)
+    {
+        if(i % KEYS_PER_LINE == 0) printf("    ");
+        printf("0x%08lX", (unsigned long)list[i]->key);
+        if(i < m - 1) printf(",");
+        printf((i % KEYS_PER_LINE == KEYS_PER_LINE - 1 || i == m - 1) ? "\n" : " ");
+    }
+    printf("};\n\n");
+
+    printf("const uint8_t book_moves[] =\n{\n");
+    for(i = 0; i < m; i++)
+    {
+        if(i % MOVES_PER_LINE == 0) printf("    ");
+        printf("%d", list[i]->move);
+        if(i < m - 1) printf(",");
+        printf((i % MOVES_PER_LINE == MOVES_PER_LINE - 1 || i == m - 1) ? "\n" : " ");
+    }
+    printf("};\n");
+
+    fprintf(stderr, "positions %lu, key collisions dropped %lu\n", m, dropped);
+
+    free(list);
+}
+
+int main(int argc, char *argv[])
+{
+    struct Board brd;
+
+    max_plies     = (argc > 1) ? atoi(argv[1]) : 10;
+    search_depth  = (argc > 2) ? atoi(argv[2]) : 8;
+    expand_margin = ((argc > 3) ? atoi(argv[3]) : 2) * PATTERN_SCALE;
+
+    if(max_plies < 1) max_plies = 1;
+    if(search_depth < 1) search_depth = 1;
+
+    nodes = (struct Node *)calloc(NODE_COUNT, sizeof(struct Node));
+    if(nodes == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    ai_new_game();
+    init_board(&brd);
+    expand(brd.stones[stone_red], brd.stones[stone_green], 0);
+
+    write_book();
+
+    free(nodes);
+
+    return 0;
+}
@@ -0,0 +1,445 @@
+// cli.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// テキストプロトコルのエンジン（ホスト用）
+// 標準入力から1行1コマンドを読み, 標準出力に1行で応答する. 他のエンジンとの対局スクリプトや
+// 一括の解析から, 実機なしでAIを動かすために使う.
+// 応答は成功なら "= 結果", 失敗なら "? 理由" で始まる（GTPと同じ）. 空行と # で始まる行は無視する.
+//
+// 座標は標準のオセロの表記で, 列 a〜h と行 1〜8. 初期局面は d5, e4 が先手, d4, e5 が後手で,
+// 先手の最初の手は d3, c4, f5, e6. 小さい盤（BOARD_SIZE）では盤の中の列と行だけ.
+// エンジンの盤面は標準の表記と左右が逆なので, 列 a〜h は x = 7〜0 に, 行 1〜8 は y = 0〜7 に対応する.
+// 例 : d3 は (4, 2). position と board の盤面の文字列も同じ向き.
+// 色は X が赤（先手, 黒）, O が緑（後手, 白）.
+//
+// コマンド
+//   new                        初期局面にする（置換表と持ち時間も戻す）
+//   position <64文字> <X|O>     盤面と手番を決める. 盤面は a1, b1, ..., h1, a2, ..., h8 の順に X, O, -（空き）.
+//                              小さい盤では マス数（MAT_WIDTH x MAT_HEIGHT）文字.
+//   move <座標|pass>            手を打つ. pass は置ける場所がないときだけ.
+//   undo                       1手戻す
+//   go [depth N] [time MS]     今の局面を探索して最善手を返す（打たない）. 既定は深さ DEFAULT_DEPTH, 時間制限なし.
+//                              time だけ指定したら深さは AI_MAX_DEPTH まで. time -1 なら持ち時間から配る（実機と同じ）.
+//                              応答 : = <座標|pass> score <石差> depth <深さ> nodes <ノード数> time <ms> knps <速度>
+//                              score は手番側から見た石差の予測. 完全読みで決めたら exact を付ける.
+//                              MCTSでは score と depth の代わりに win <勝率>, nodes はプレイアウト数.
+//                              定石で決めたら = <座標> depth book.
+//   engine <alphabeta|mcts>    探索エンジンを切り替える
+//   book <on|off>              定石を使うか（既定 on）
+//   threads <N>                探索スレッド数（AI_SMP でビルドしたとき）
+//   eval                       今の局面の静的評価値（手番側から見た石差）
+//   moves                      置ける手の一覧（a1, b1, ..., h8 の順）
+//   board                      盤面と手番を position と同じ形式で返す
+//   quit                       終了する
+//
+// ビルド
+//   gcc -O2 -I.. cli.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c ../book.c ../book_data.c -lm -o cli
+//   並列探索を使うときは -DAI_SMP=1 -pthread を付ける.
+//
+// 使い方
+//   ./cli
+//   例 : printf 'new\nmove f5\ngo depth 10\nquit\n' | ./cli
+//   座標の向きの確認 : sh cli_test.sh
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "book.h"
+#include "ai.h"
+
+#define DEFAULT_DEPTH 8   // go の既定の探索深さ
+#define MAX_HISTORY   128 // 戻せる手数（着手60 + パス）
+#define LINE_SIZE     256 // 1行の最大長
+
+// 局面
+struct Position{
+    struct Board     brd;
+    enum stone_color sc; // 手番
+};
+
+static struct Position pos;                     // 今の局面
+static struct Position history[MAX_HISTORY];    // 打つ前の局面
+static int             num_history;
+static int             use_book = 1;
+
+// 列と盤面の x の変換. 左右を逆にするだけなので, どちら向きにも同じ式で変換できる.
+#define FILE_X(f) (MAT_WIDTH - 1 - (f))
+
+// 座標を読む. 読めなければ-1.
+static int parse_square(const char *s)
+{
+    if(s == NULL || s[0] < 'a' || s[0] >= 'a' + MAT_WIDTH || s[1] < '1' || s[1] >= '1' + MAT_HEIGHT || s[2] != '\0') return -1;
+
+    return BB_SQ(FILE_X(s[0] - 'a'), s[1] - '1');
+}
+
+// 座標を書く
+static const char *square_name(int x, int y)
+{
+    static char name[3];
+
+    name[0] = (char)('a' + FILE_X(x));
+    name[1] = (char)('1' + y);
+    name[2] = '\0';
+
+    return name;
+}
+
+// 色の文字
+static char color_char(enum stone_color sc)
+{
+    return (sc == stone_red) ? 'X' : 'O';
+}
+
+// 新しい局面にする
+static void set_position(const struct Board *brd, enum stone_color sc)
+{
+    pos.brd     = *brd;
+    pos.sc      = sc;
+    num_history = 0;
+    ai_new_game();
+}
+
+// new
+static void cmd_new(void)
+{
+    struct Board brd;
+
+    init_board(&brd);
+    set_position(&brd, stone_red);
+    printf("=\n");
+}
+
+// position <64文字> <X|O>
+static void cmd_position(const char *stones, const char *side)
+{
+    struct Board brd;
+    int i, sq;
+
+    if(stones == NULL || side == NULL || strlen(stones) != MAT_WIDTH * MAT_HEIGHT
+    || (strcmp(side, "X") != 0 && strcmp(side, "O") != 0))
+    {
+        printf("? usage: position <%d chars of X, O, -> <X|O>\n", MAT_WIDTH * MAT_HEIGHT);
+        return;
+    }
+
+    brd.stones[stone_red]   = 0;
+    brd.stones[stone_green] = 0;
+
+    for(i = 0; i < MAT_WIDTH * MAT_HEIGHT; i++)
+    {
+        sq = BB_SQ(FILE_X(i % MAT_WIDTH), i / MAT_WIDTH);
+
+        switch(stones[i])
+        {
+            case 'X': brd.stones[stone_red]   |= BB_BIT(sq); break;
+            case 'O': brd.stones[stone_green] |= BB_BIT(sq); break;
+            case '-': break;
+            default:
+                printf("? bad square character '%c'\n", stones[i]);
+                return;
+        }
+    }
+
+    set_position(&brd, (side[0] == 'X') ? stone_red : stone_green);
+    printf("=\n");
+}
+
+// move <座標|pass>
+static void cmd_move(const char *arg)
+{
+    uint64_t moves = get_placeable_mask(&pos.brd, pos.sc);
+    int sq;
+
+    if(arg == NULL)
+    {
+        printf("? usage: move <square|pass>\n");
+        return;
+    }
+
+    if(strcmp(arg, "pass") == 0)
+    {
+        if(moves)
+        {
+            printf("? pass is not allowed\n");
+            return;
+        }
+        if(!get_placeable_mask(&pos.brd, OPPONENT(pos.sc)))
+        {
+            printf("? game over\n");
+            return;
+        }
+        sq = -1;
+    }
+    else
+    {
+        sq = parse_square(arg);
+        if(sq < 0 || !(moves & BB_BIT(sq)))
+        {
+            printf("? illegal move %s\n", arg);
+            return;
+        }
+    }
+
+    if(num_history >= MAX_HISTORY)
+    {
+        printf("? too many moves\n");
+        return;
+    }
+
+    history[num_history++] = pos;
+
+    if(sq >= 0)
+    {
+        flip_stones(make_flip_mask(&pos.brd, BB_SQ_X(sq), BB_SQ_Y(sq), pos.sc), &pos.brd, pos.sc);
+        place(&pos.brd, BB_SQ_X(sq), BB_SQ_Y(sq), pos.sc);
+    }
+    pos.sc = OPPONENT(pos.sc);
+
+    printf("=\n");
+}
+
+// undo
+static void cmd_undo(void)
+{
+    if(num_history == 0)
+    {
+        printf("? nothing to undo\n");
+        return;
+    }
+
+    pos = history[--num_history];
+    printf("=\n");
+}
+
+// go [depth N] [time MS]
+static void cmd_go(char *args)
+{
+    char *key, *val;
+    int depth = 0, x, y, score;
+    long time_ms = 0;
+    unsigned long limit, start, elapsed, nodes;
+#if AI_STATS
+    const struct AiStats *st;
+#endif
+
+    for(key = strtok(args, " \t"); key != NULL; key = strtok(NULL, " \t"))
+    {
+        val = strtok(NULL, " \t");
+        if(val == NULL) break;
+
+        if(strcmp(key, "depth") == 0)     depth   = atoi(val);
+        else if(strcmp(key, "time") == 0) time_ms = atol(val);
+        else break;
+    }
+
+    if(key != NULL)
+    {
+        printf("? usage: go [depth N] [time MS]\n");
+        return;
+    }
+
+    if(depth <= 0) depth = (time_ms != 0) ? AI_MAX_DEPTH : DEFAULT_DEPTH;
+    if(depth > AI_MAX_DEPTH) depth = AI_MAX_DEPTH;
+
+    if(!get_placeable_mask(&pos.brd, pos.sc))
+    {
+        if(get_placeable_mask(&pos.brd, OPPONENT(pos.sc))) printf("= pass\n");
+        else                                               printf("? game over\n");
+        return;
+    }
+
+    if(use_book && book_lookup(&pos.brd, pos.sc, &x, &y))
+    {
+        printf("= %s depth book\n", square_name(x, y));
+        return;
+    }
+
+    limit = (time_ms < 0) ? ai_time_budget(&pos.brd, pos.sc) : (unsigned long)time_ms;
+
+    start = ai_port_get_ms();
+    ai_select_move(&pos.brd, pos.sc, depth, limit, &x, &y);
+    elapsed = ai_port_get_ms() - start;
+    nodes   = ai_get_node_count();
+    score   = ai_get_score();
+
+    printf("= %s", square_name(x, y));
+
+#if AI_MCTS
+    if(ai_get_engine() == AI_ENGINE_MCTS)
+    {
+        printf(" win %.3f", score / 1000.0);
+    }
+    else
+#endif
+    {
+        if(score > SCORE_WIN / 2 || score < -SCORE_WIN / 2)
+        {
+            printf(" score %+d exact", (score > 0) ? score - SCORE_WIN : score + SCORE_WIN);
+        }
+        else
+        {
+            printf(" score %+.2f", (double)score / PATTERN_SCALE);
+        }
+
+#if AI_STATS
+        st = ai_get_stats();
+        printf(" depth %d", st->depth);
+#endif
+    }
+
+    printf(" nodes %lu time %lu knps %.1f\n", nodes, elapsed, elapsed ? (double)nodes / elapsed : 0.0);
+}
+
+// engine <alphabeta|mcts>
+static void cmd_engine(const char *arg)
+{
+#if AI_MCTS
+    if(arg != NULL && strcmp(arg, "alphabeta") == 0)
+    {
+        ai_set_engine(AI_ENGINE_ALPHABETA);
+    }
+    else if(arg != NULL && strcmp(arg, "mcts") == 0)
+    {
+        ai_set_engine(AI_ENGINE_MCTS);
+    }
+    else
+    {
+        printf("? usage: engine <alphabeta|mcts>\n");
+        return;
+    }
+
+    printf("=\n");
+#else
+    (void)arg;
+    printf("? mcts is not built in\n");
+#endif
+}
+
+// book <on|off>
+static void cmd_book(const char *arg)
+{
+    if(arg != NULL && strcmp(arg, "on") == 0)       use_book = 1;
+    else if(arg != NULL && strcmp(arg, "off") == 0) use_book = 0;
+    else
+    {
+        printf("? usage: book <on|off>\n");
+        return;
+    }
+
+    printf("=\n");
+}
+
+// threads <N>
+static void cmd_threads(const char *arg)
+{
+#if AI_SMP
+    if(arg == NULL || atoi(arg) < 1)
+    {
+        printf("? usage: threads <N>\n");
+        return;
+    }
+
+    ai_set_threads(atoi(arg));
+    printf("=\n");
+#else
+    (void)arg;
+    printf("? built without AI_SMP\n");
+#endif
+}
+
+// eval
+static void cmd_eval(void)
+{
+    printf("= %+.2f\n", (double)evaluate_board(&pos.brd, pos.sc) / PATTERN_SCALE);
+}
+
+// moves
+static void cmd_moves(void)
+{
+    uint64_t moves = get_placeable_mask(&pos.brd, pos.sc);
+    int i, sq;
+
+    printf("=");
+
+    // 表記の順（a1, b1, ..., h8）に並べる
+    for(i = 0; i < MAT_WIDTH * MAT_HEIGHT; i++)
+    {
+        sq = BB_SQ(FILE_X(i % MAT_WIDTH), i / MAT_WIDTH);
+        if(moves & BB_BIT(sq)) printf(" %s", square_name(BB_SQ_X(sq), BB_SQ_Y(sq)));
+    }
+
+    printf("\n");
+}
+
+// board
+static void cmd_board(void)
+{
+    char stones[MAT_WIDTH * MAT_HEIGHT + 1];
+    int i, sq;
+
+    for(i = 0; i < MAT_WIDTH * MAT_HEIGHT; i++)
+    {
+        sq = BB_SQ(FILE_X(i % MAT_WIDTH), i / MAT_WIDTH);
+
+        if(pos.brd.stones[stone_red] & BB_BIT(sq))        stones[i] = 'X';
+        else if(pos.brd.stones[stone_green] & BB_BIT(sq)) stones[i] = 'O';
+        else                                              stones[i] = '-';
+    }
+    stones[MAT_WIDTH * MAT_HEIGHT] = '\0';
+
+    printf("= %s %c\n", stones, color_char(pos.sc));
+}
+
+int main(void)
+{
+    char line[LINE_SIZE];
+    char *cmd, *rest, *arg1, *arg2;
+    struct Board brd;
+
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    init_board(&brd);
+    set_position(&brd, stone_red);
+
+    while(fgets(line, sizeof(line), stdin) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+
+        cmd = strtok(line, " \t");
+        if(cmd == NULL || cmd[0] == '#') continue;
+
+        // 残りの引数. go は自分で区切る.
+        rest = strtok(NULL, "");
+        if(rest == NULL) rest = line + strlen(line);
+        if(strcmp(cmd, "go") != 0)
+        {
+            arg1 = strtok(rest, " \t");
+            arg2 = strtok(NULL, " \t");
+        }
+        else
+        {
+            arg1 = arg2 = NULL;
+        }
+
+        if(strcmp(cmd, "new") == 0)           cmd_new();
+        else if(strcmp(cmd, "position") == 0) cmd_position(arg1, arg2);
+        else if(strcmp(cmd, "move") == 0)     cmd_move(arg1);
+        else if(strcmp(cmd, "undo") == 0)     cmd_undo();
+        else if(strcmp(cmd, "go") == 0)       cmd_go(rest);
+        else if(strcmp(cmd, "engine") == 0)   cmd_engine(arg1);
+        else if(strcmp(cmd, "book") == 0)     cmd_book(arg1);
+        else if(strcmp(cmd, "threads") == 0)  cmd_threads(arg1);
+        else if(strcmp(cmd, "eval") == 0)     cmd_eval();
+        else if(strcmp(cmd, "moves") == 0)    cmd_moves();
+        else if(strcmp(cmd, "board") == 0)    cmd_board();
+        else if(strcmp(cmd, "quit") == 0)     break;
+        else                                  printf("? unknown command %s\n", cmd);
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#!/bin/sh
+# cli_test.sh
+# Created on : 2026/10/17
+# Author : T.Ijiro
+#
+# cli の座標が標準のオセロの表記になっているかの確認（ホスト用）
+# 初期局面の合法手と, 標準の定石（虎定石）を打った後の盤面と合法手を期待値と比べる.
+# 期待値は標準の表記（d5, e4 が先手）で別に並べたもの. 一致しなければ終了コード1を返す.
+#
+# 使い方（cli をビルドしてから）
+#   sh cli_test.sh [cli のパス(既定 ./cli)]
+
+CLI=${1:-./cli}
+
+expected='=
+= d3 c4 f5 e6
+=
+=
+=
+=
+=
+=
+=
+=
+=
+=
+= ------------------XO-O----XXOO-----XOX-----OOX------O----------- X
+= c2 d2 e2 f2 g2 e3 g4 c6 d7 f7 d8
+? illegal move e8'
+
+actual=$(printf 'new\nmoves\nmove f5\nmove d6\nmove c3\nmove d3\nmove c4\nmove f4\nmove f6\nmove f3\nmove e6\nmove e7\nboard\nmoves\nmove e8\nquit\n' | "$CLI")
+
+if [ "$actual" = "$expected" ]; then
+    echo "cli_test : OK"
+    exit 0
+fi
+
+echo "cli_test : NG"
+echo "expected :"
+echo "$expected"
+echo "actual :"
+echo "$actual"
+exit 1
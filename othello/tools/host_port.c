@@ -0,0 +1,19 @@
+// host_port.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// ホスト（Linux）用の移植層. AIエンジンをリンクするツールと一緒にビルドする.
+
+#include <time.h>
+#include "ai.h"
+
+// 現在時刻 [ms]
+unsigned long ai_port_get_ms(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000L);
+}
+
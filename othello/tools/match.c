@@ -0,0 +1,389 @@
+// match.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// AI同士の対局ツール（ホスト用）
+// 2つの設定（エンジン, 探索深さ, 思考時間）で多数の対局を行い,
+// 勝率・Elo差とその誤差・探索速度・1手の最大思考時間を表示する.
+//
+// エンジンはAIのソースを共有ライブラリにしたもの. 評価関数や探索を変えて比べるときは別々にビルドする.
+// 2つのエンジンは dlmopen で別の名前空間に読み込むので, 同じファイルでも静的変数（置換表, 持ち時間など）は共有しない.
+// 開始局面は序盤をランダムに打った局面. 同じ局面を先後入れ替えて2局ずつ打つ.
+// 対局は fork した子プロセスに分け, 全コアで並列に行う.
+//
+// ビルド
+//   gcc -O2 -shared -fPIC -I.. host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c -lm -o engine.so
+//   gcc -O2 -I.. match.c ../bitboard.c -ldl -lm -o match
+//   MCTSのエンジンは -DAI_ENGINE=AI_ENGINE_MCTS を付けて別の名前でビルドする（mcts.so など）.
+//   ニューラルネット評価のエンジンは -DAI_EVAL=AI_EVAL_NN を付け, ../nn.c ../nn_weights.c も加えてビルドする（nn.so など）.
+//
+// 使い方
+//   ./match [-n 対局数] [-j 並列数] [-p 序盤の手数] [-s 乱数の種] エンジンA[:深さ[:思考時間]] エンジンB[:深さ[:思考時間]]
+//     対局数       既定 1000（先後の組にするので偶数に切り上げる）
+//     並列数       既定 コア数
+//     序盤の手数   ランダムに打つ手数. 既定 8
+//     深さ         既定 6
+//     思考時間     1手あたり [ms]. 0なら深さまで必ず読む. -1なら持ち時間から配る（実機と同じ）. 既定 0
+//   例 : ./match -n 2000 ./new.so:8 ./old.so:8
+//   例 : ./match -n 200 ./mcts.so:16:20 ./engine.so:16:20   （1手20msでのMCTSとαβの比較）
+//        MCTSは深さの代わりに 深さ x MCTS_PLAYOUTS_PER_DEPTH 回のプレイアウトで止まる（思考時間が0のとき）.
+//   例 : ./match -n 400 ./nn.so:16:20 ./engine.so:16:20     （1手20msでのニューラルネット評価とパターン評価の比較）
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <dlfcn.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "bitboard.h"
+
+#define MAX_JOBS 256
+#define DEFAULT_DEPTH 6
+
+// エンジンの関数（ai.h と同じ形）
+typedef void (*new_game_fn)(void);
+typedef unsigned long (*time_budget_fn)(const struct Board *, enum stone_color);
+typedef int (*select_move_fn)(const struct Board *, enum stone_color, int, unsigned long, int *, int *);
+typedef unsigned long (*node_count_fn)(void);
+
+// 対局者の設定
+struct Engine{
+    const char     *path;        // 共有ライブラリのパス
+    int             depth;       // 探索深さ
+    long            time_ms;     // 1手の思考時間. 0:無制限, -1:持ち時間から配る
+    new_game_fn     new_game;
+    time_budget_fn  time_budget;
+    select_move_fn  select_move;
+    node_count_fn   node_count;
+};
+
+// 対局者ごとの集計
+struct SideStats{
+    unsigned long long nodes;    // 探索ノード数の合計
+    unsigned long long think_us; // 思考時間の合計 [us]
+    unsigned long long max_us;   // 1手の最大思考時間 [us]
+    unsigned long      moves;    // 着手数
+};
+
+// 子プロセスの集計. Aから見た勝ち負け.
+struct Result{
+    unsigned long    wins;
+    unsigned long    losses;
+    unsigned long    draws;
+    long             disc_diff; // 石差の合計
+    struct SideStats side[2];   // [0]:A, [1]:B
+};
+
+static struct Engine engines[2];
+
+// 現在時刻 [us]
+static unsigned long long now_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long long)ts.tv_sec * 1000000ULL + (unsigned long long)(ts.tv_nsec / 1000L);
+}
+
+// 開始局面用の乱数（xorshift64）. 局面番号ごとに種を決めるので, 並列数によらず同じ局面になる.
+static uint64_t next_random(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+
+    return *s;
+}
+
+// 引数 "パス[:深さ[:思考時間]]" を読む
+static void parse_engine(struct Engine *e, char *arg)
+{
+    char *c1 = strchr(arg, ':');
+    char *c2;
+
+    e->path    = arg;
+    e->depth   = DEFAULT_DEPTH;
+    e->time_ms = 0;
+
+    if(c1 == NULL) return;
+
+    *c1 = '\0';
+    e->depth = atoi(c1 + 1);
+
+    c2 = strchr(c1 + 1, ':');
+    if(c2 != NULL) e->time_ms = atol(c2 + 1);
+}
+
+// エンジンを別の名前空間に読み込む
+static void load_engine(struct Engine *e)
+{
+    void *h = dlmopen(LM_ID_NEWLM, e->path, RTLD_NOW | RTLD_LOCAL);
+
+    if(h == NULL)
+    {
+        fprintf(stderr, "%s\n", dlerror());
+        exit(1);
+    }
+
+    e->new_game    = (new_game_fn)dlsym(h, "ai_new_game");
+    e->time_budget = (time_budget_fn)dlsym(h, "ai_time_budget");
+    e->select_move = (select_move_fn)dlsym(h, "ai_select_move");
+    e->node_count  = (node_count_fn)dlsym(h, "ai_get_node_count");
+
+    if(!e->new_game || !e->time_budget || !e->select_move || !e->node_count)
+    {
+        fprintf(stderr, "%s : AI functions not found\n", e->path);
+        exit(1);
+    }
+}
+
+// 開始局面を作る. 序盤を plies 手ランダムに打つ. 途中で終局する並びは作り直す.
+static void make_opening(struct Board *brd, enum stone_color *sc, int index, int plies, unsigned long seed)
+{
+    uint64_t s = (uint64_t)seed * 0x9E3779B97F4A7C15ULL + (uint64_t)index * 0xBF58476D1CE4E5B9ULL + 1;
+    uint64_t moves, flips;
+    int ply, k, sq;
+
+    while(1)
+    {
+        init_board(brd);
+        *sc = stone_red;
+
+        for(ply = 0; ply < plies; ply++)
+        {
+            moves = get_placeable_mask(brd, *sc);
+            if(!moves) break;
+
+            k = (int)(next_random(&s) % (uint64_t)bb_count(moves));
+            while(k--) moves &= moves - 1;
+            sq = bb_first(moves);
+
+            flips = make_flip_mask(brd, BB_SQ_X(sq), BB_SQ_Y(sq), *sc);
+            flip_stones(flips, brd, *sc);
+            place(brd, BB_SQ_X(sq), BB_SQ_Y(sq), *sc);
+            *sc = OPPONENT(*sc);
+        }
+
+        if(ply == plies && get_placeable_mask(brd, *sc)) return;
+    }
+}
+
+// 1局打つ. a_color がAの色.
+static void play_game(const struct Board *start, enum stone_color sc, enum stone_color a_color, struct Result *r)
+{
+    struct Board brd = *start;
+    struct Engine *e;
+    struct SideStats *st;
+    unsigned long long t0, dt;
+    unsigned long limit;
+    uint64_t flips;
+    int passes = 0, x, y, side, diff;
+
+    engines[0].new_game();
+    engines[1].new_game();
+
+    while(passes < 2)
+    {
+        if(!get_placeable_mask(&brd, sc))
+        {
+            passes++;
+            sc = OPPONENT(sc);
+            continue;
+        }
+
+        passes = 0;
+        side   = (sc == a_color) ? 0 : 1;
+        e      = &engines[side];
+        st     = &r->side[side];
+
+        limit = (e->time_ms < 0) ? e->time_budget(&brd, sc) : (unsigned long)e->time_ms;
+
+        t0 = now_us();
+        e->select_move(&brd, sc, e->depth, limit, &x, &y);
+        dt = now_us() - t0;
+
+        st->nodes    += e->node_count();
+        st->think_us += dt;
+        st->moves++;
+        if(dt > st->max_us) st->max_us = dt;
+
+        flips = make_flip_mask(&brd, x, y, sc);
+        flip_stones(flips, &brd, sc);
+        place(&brd, x, y, sc);
+        sc = OPPONENT(sc);
+    }
+
+    diff = count_stones(&brd, a_color) - count_stones(&brd, OPPONENT(a_color));
+
+    if(diff > 0)      r->wins++;
+    else if(diff < 0) r->losses++;
+    else              r->draws++;
+    r->disc_diff += diff;
+}
+
+// 子プロセス. 対局番号 job, job + jobs, ... を打つ.
+static void run_worker(int job, int jobs, int games, int plies, unsigned long seed, struct Result *r)
+{
+    struct Board start;
+    enum stone_color sc;
+    int g;
+
+    memset(r, 0, sizeof(*r));
+    load_engine(&engines[0]);
+    load_engine(&engines[1]);
+
+    for(g = job; g < games; g += jobs)
+    {
+        // 偶数番はAが赤, 奇数番は同じ局面でAが緑
+        make_opening(&start, &sc, g / 2, plies, seed);
+        play_game(&start, sc, (g & 1) ? stone_green : stone_red, r);
+    }
+}
+
+// 得点率からElo差
+static double elo(double score)
+{
+    if(score <= 0.0) return -INFINITY;
+    if(score >= 1.0) return INFINITY;
+
+    return -400.0 * log10(1.0 / score - 1.0);
+}
+
+// 使い方の表示
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n games] [-j jobs] [-p plies] [-s seed] A.so[:depth[:ms]] B.so[:depth[:ms]]\n", prog);
+}
+
+// 対局者ごとの結果の表示
+static void print_side(const char *name, const struct Engine *e, const struct SideStats *st)
+{
+    double sec = st->think_us / 1e6;
+
+    printf("%s : %s depth %d time %ld\n", name, e->path, e->depth, e->time_ms);
+    printf("    %.1f knps, %.2f ms/move average, %.2f ms worst\n",
+           (sec > 0.0) ? st->nodes / sec / 1000.0 : 0.0,
+           st->moves ? st->think_us / 1000.0 / st->moves : 0.0,
+           st->max_us / 1000.0);
+}
+
+int main(int argc, char *argv[])
+{
+    struct Result total, r;
+    int fds[MAX_JOBS];
+    pid_t pids[MAX_JOBS];
+    int games = 1000, jobs = (int)sysconf(_SC_NPROCESSORS_ONLN), plies = 8;
+    unsigned long seed = 1;
+    int opt, j, k, fd[2];
+    unsigned long n;
+    double score, var, sd, lo, hi;
+
+    while((opt = getopt(argc, argv, "n:j:p:s:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': games = atoi(optarg);          break;
+            case 'j': jobs  = atoi(optarg);          break;
+            case 'p': plies = atoi(optarg);          break;
+            case 's': seed  = strtoul(optarg, 0, 0); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(argc - optind != 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    parse_engine(&engines[0], argv[optind]);
+    parse_engine(&engines[1], argv[optind + 1]);
+
+    if(games < 2) games = 2;
+    games += games & 1;
+    if(jobs < 1) jobs = 1;
+    if(jobs > MAX_JOBS) jobs = MAX_JOBS;
+    if(jobs > games) jobs = games;
+    if(plies < 0) plies = 0;
+
+    // 子プロセスで対局し, 集計をパイプで受け取る
+    for(j = 0; j < jobs; j++)
+    {
+        if(pipe(fd) != 0)
+        {
+            perror("pipe");
+            return 1;
+        }
+
+        pids[j] = fork();
+
+        if(pids[j] < 0)
+        {
+            perror("fork");
+            return 1;
+        }
+
+        if(pids[j] == 0)
+        {
+            close(fd[0]);
+            run_worker(j, jobs, games, plies, seed, &r);
+            if(write(fd[1], &r, sizeof(r)) != (ssize_t)sizeof(r)) _exit(1);
+            _exit(0);
+        }
+
+        close(fd[1]);
+        fds[j] = fd[0];
+    }
+
+    memset(&total, 0, sizeof(total));
+
+    for(j = 0; j < jobs; j++)
+    {
+        if(read(fds[j], &r, sizeof(r)) != (ssize_t)sizeof(r))
+        {
+            fprintf(stderr, "worker %d failed\n", j);
+            return 1;
+        }
+
+        close(fds[j]);
+        waitpid(pids[j], NULL, 0);
+
+        total.wins      += r.wins;
+        total.losses    += r.losses;
+        total.draws     += r.draws;
+        total.disc_diff += r.disc_diff;
+
+        for(k = 0; k < 2; k++)
+        {
+            total.side[k].nodes    += r.side[k].nodes;
+            total.side[k].think_us += r.side[k].think_us;
+            total.side[k].moves    += r.side[k].moves;
+            if(r.side[k].max_us > total.side[k].max_us) total.side[k].max_us = r.side[k].max_us;
+        }
+    }
+
+    // 勝ち1, 引き分け0.5, 負け0 の平均と標準誤差. 95%の範囲をEloに直す.
+    n     = total.wins + total.losses + total.draws;
+    score = (total.wins + 0.5 * total.draws) / n;
+    var   = (total.wins + 0.25 * total.draws) / n - score * score;
+    sd    = sqrt(var / n);
+    lo    = elo(score - 1.96 * sd);
+    hi    = elo(score + 1.96 * sd);
+
+    printf("games %lu (%d openings x 2, %d random plies, %d jobs)\n", n, games / 2, plies, jobs);
+    printf("A : %lu wins, %lu losses, %lu draws, score %.1f%%, average disc diff %+.2f\n",
+           total.wins, total.losses, total.draws, score * 100.0, (double)total.disc_diff / n);
+    printf("Elo (A - B) : %+.1f  (95%%: %+.1f .. %+.1f)\n", elo(score), lo, hi);
+    print_side("A", &engines[0], &total.side[0]);
+    print_side("B", &engines[1], &total.side[1]);
+
+    return 0;
+}
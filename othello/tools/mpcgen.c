@@ -0,0 +1,320 @@
+// mpcgen.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// Multi-ProbCut の回帰係数の生成ツール（ホスト用）
+// 局面ファイル（posfile.h）から局面を等間隔に取り出し, 深さ1から MPC_MAX_DEPTH まで探索した値を記録する.
+// 深さ d の値 v と浅い深さ d' の値 s の組を進行度と深さごとに集め, 最小二乗法で v = a * s + b と誤差の標準偏差を求めて
+// mpc_data.c として書き出す（mpc.h）.
+// 勝ち負けが決まった値（SCORE_WIN 込み）の組は使わない. 組が MIN_SAMPLES に満たない深さは刈らない（shallow = 0）.
+//
+// 局面は fork した子プロセスに分け, 全コアで並列に探索する.
+//
+// ビルド（刈らない探索の値を使うので MPC を切り, 完全読みもしない）
+//   gcc -O2 -DAI_MPC=0 -DAI_ENDGAME_EMPTIES=0 -I.. mpcgen.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c -lm -o mpcgen
+//
+// 使い方
+//   ./mpcgen [-n 局面数] [-j 並列数] 局面ファイル > ../mpc_data.c
+//     局面数  既定 2000
+//     並列数  既定 コア数
+//   経過と係数の一覧は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "ai.h"
+#include "mpc.h"
+#include "posfile.h"
+
+#define MAX_JOBS 256
+#define MIN_SAMPLES 50      // 係数を求めるのに必要な組の数
+#define REPORT_POSITIONS 50 // 経過を表示する局面数の間隔（子プロセスごと）
+
+// 深さ d の浅い探索の深さ
+#define SHALLOW_DEPTH(d) (((d) / 2 > 1) ? (d) / 2 : 1)
+
+// 回帰の集計. 進行度と深さごと.
+struct Sums{
+    double n;   // 組の数
+    double sx;  // 浅い探索の値の和
+    double sy;  // 深い探索の値の和
+    double sxx;
+    double sxy;
+    double syy;
+};
+
+// 子プロセスの集計
+struct Result{
+    struct Sums   sums[PATTERN_PHASES][MPC_MAX_DEPTH + 1];
+    unsigned long positions; // 局面数
+    unsigned long nodes;     // 探索ノード数
+};
+
+// 1局面を深さ1から MPC_MAX_DEPTH まで探索して r に足す
+static void sample_position(const struct PosRecord *rec, struct Result *r)
+{
+    struct Board brd;
+    enum stone_color sc = (enum stone_color)rec->side;
+    int score[MPC_MAX_DEPTH + 1];
+    int d, s, phase;
+    struct Sums *sm;
+
+    brd.stones[sc]           = rec->p;
+    brd.stones[OPPONENT(sc)] = rec->o;
+    phase = pattern_phase(MAT_WIDTH * MAT_HEIGHT - bb_count(rec->p | rec->o));
+
+    ai_new_game();
+
+    for(d = 1; d <= MPC_MAX_DEPTH; d++)
+    {
+        score[d] = ai_search_score(&brd, sc, d);
+        r->nodes += ai_get_node_count();
+    }
+
+    for(d = MPC_MIN_DEPTH; d <= MPC_MAX_DEPTH; d++)
+    {
+        s = SHALLOW_DEPTH(d);
+
+        if(score[d] > SCORE_WIN / 2 || score[d] < -SCORE_WIN / 2) continue;
+        if(score[s] > SCORE_WIN / 2 || score[s] < -SCORE_WIN / 2) continue;
+
+        sm = &r->sums[phase][d];
+        sm->n   += 1.0;
+        sm->sx  += score[s];
+        sm->sy  += score[d];
+        sm->sxx += (double)score[s] * score[s];
+        sm->sxy += (double)score[s] * score[d];
+        sm->syy += (double)score[d] * score[d];
+    }
+
+    r->positions++;
+}
+
+// 子プロセス. 取り出した局面のうち job, job + jobs, ... 番目を探索する.
+static void run_worker(const struct PosRecord *recs, size_t count, int samples, int job, int jobs, struct Result *r)
+{
+    size_t stride = count / (size_t)samples;
+    int i;
+
+    memset(r, 0, sizeof(*r));
+
+    for(i = job; i < samples; i += jobs)
+    {
+        sample_position(&recs[(size_t)i * stride], r);
+
+        if(job == 0 && r->positions % REPORT_POSITIONS == 0)
+        {
+            fprintf(stderr, "%lu / %d positions\n", r->positions * (unsigned long)jobs, samples);
+        }
+    }
+}
+
+// 集計を足す
+static void add_result(struct Result *total, const struct Result *r)
+{
+    int ph, d;
+
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        for(d = 0; d <= MPC_MAX_DEPTH; d++)
+        {
+            total->sums[ph][d].n   += r->sums[ph][d].n;
+            total->sums[ph][d].sx  += r->sums[ph][d].sx;
+            total->sums[ph][d].sy  += r->sums[ph][d].sy;
+            total->sums[ph][d].sxx += r->sums[ph][d].sxx;
+            total->sums[ph][d].sxy += r->sums[ph][d].sxy;
+            total->sums[ph][d].syy += r->sums[ph][d].syy;
+        }
+    }
+
+    total->positions += r->positions;
+    total->nodes     += r->nodes;
+}
+
+// 最小二乗法で係数を求める. 求められなければ shallow = 0.
+static struct MpcParam fit(const struct Sums *sm, int d, double *corr)
+{
+    struct MpcParam mp;
+    double vx, vy, cxy, a, b, e;
+
+    memset(&mp, 0, sizeof(mp));
+    *corr = 0.0;
+
+    if(sm->n < MIN_SAMPLES) return mp;
+
+    vx  = sm->sxx / sm->n - (sm->sx / sm->n) * (sm->sx / sm->n);
+    vy  = sm->syy / sm->n - (sm->sy / sm->n) * (sm->sy / sm->n);
+    cxy = sm->sxy / sm->n - (sm->sx / sm->n) * (sm->sy / sm->n);
+
+    if(vx <= 0.0 || vy <= 0.0 || cxy <= 0.0) return mp;
+
+    a = cxy / vx;
+    b = sm->sy / sm->n - a * sm->sx / sm->n;
+    e = vy - a * cxy; // 残差の分散
+    if(e < 0.0) e = 0.0;
+
+    *corr = cxy / sqrt(vx * vy);
+
+    mp.shallow = (int8_t)SHALLOW_DEPTH(d);
+    mp.a       = (int16_t)floor(a * MPC_A_SCALE + 0.5);
+    mp.b       = (int16_t)floor(b + 0.5);
+    mp.sigma   = (int16_t)ceil(sqrt(e));
+    if(mp.a < 1) mp.a = 1;
+
+    return mp;
+}
+
+// mpc_data.c を標準出力に書き出す
+static void write_params(const struct Result *total)
+{
+    struct MpcParam mp;
+    double corr;
+    int ph, d;
+
+    printf("// mpc_data.c\n");
+    printf("// Created on : 2026/10/17\n");
+    printf("// Author : T.Ijiro\n");
+    printf("//\n");
+    printf("// Multi-ProbCut の回帰係数. tools/mpcgen.c が生成する. 手で編集しない.\n");
+    printf("// 局面数 %lu. 各行は深さ d の { 浅い探索の深さ, a x %d, b, sigma }.\n", total->positions, MPC_A_SCALE);
+    printf("\n#include <stdint.h>\n#include \"mpc.h\"\n\n");
+    printf("const struct MpcParam mpc_params[PATTERN_PHASES][MPC_MAX_DEPTH + 1] =\n{\n");
+
+    fprintf(stderr, "phase depth shallow      n      a      b  sigma   corr\n");
+
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        printf("    {\n");
+
+        for(d = 0; d <= MPC_MAX_DEPTH; d++)
+        {
+            memset(&mp, 0, sizeof(mp));
+            corr = 0.0;
+            if(d >= MPC_MIN_DEPTH) mp = fit(&total->sums[ph][d], d, &corr);
+
+            printf("        { %d, %4d, %4d, %4d }%s // 深さ %d\n",
+                   mp.shallow, mp.a, mp.b, mp.sigma, (d < MPC_MAX_DEPTH) ? "," : " ", d);
+
+            if(d >= MPC_MIN_DEPTH)
+            {
+                fprintf(stderr, "%5d %5d %7d %6.0f %6.3f %6d %6d %6.3f\n",
+                        ph, d, mp.shallow, total->sums[ph][d].n, (double)mp.a / MPC_A_SCALE, mp.b, mp.sigma, corr);
+            }
+        }
+
+        printf("    }%s\n", (ph < PATTERN_PHASES - 1) ? "," : "");
+    }
+
+    printf("};\n");
+}
+
+// 使い方の表示
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n positions] [-j jobs] positions\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    static struct Result total, r;
+    const struct PosRecord *recs;
+    size_t count;
+    int fds[MAX_JOBS];
+    pid_t pids[MAX_JOBS];
+    int samples = 2000, jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int opt, j, pfd[2];
+    unsigned long start, elapsed;
+
+    while((opt = getopt(argc, argv, "n:j:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': samples = atoi(optarg); break;
+            case 'j': jobs    = atoi(optarg); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(argc - optind != 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    recs = posfile_map(argv[optind], &count);
+    if(!recs) return 1;
+
+    if(samples < 1) samples = 1;
+    if((size_t)samples > count) samples = (int)count;
+    if(jobs < 1) jobs = 1;
+    if(jobs > MAX_JOBS) jobs = MAX_JOBS;
+    if(jobs > samples) jobs = samples;
+
+    fprintf(stderr, "%s : %d of %lu positions, depth %d - %d, %d jobs\n",
+            argv[optind], samples, (unsigned long)count, MPC_MIN_DEPTH, MPC_MAX_DEPTH, jobs);
+
+    start = ai_port_get_ms();
+
+    // 子プロセスで探索し, 集計をパイプで受け取る
+    for(j = 0; j < jobs; j++)
+    {
+        if(pipe(pfd) != 0)
+        {
+            perror("pipe");
+            return 1;
+        }
+
+        pids[j] = fork();
+
+        if(pids[j] < 0)
+        {
+            perror("fork");
+            return 1;
+        }
+
+        if(pids[j] == 0)
+        {
+            close(pfd[0]);
+            run_worker(recs, count, samples, j, jobs, &r);
+            if(write(pfd[1], &r, sizeof(r)) != (ssize_t)sizeof(r)) _exit(1);
+            _exit(0);
+        }
+
+        close(pfd[1]);
+        fds[j] = pfd[0];
+    }
+
+    memset(&total, 0, sizeof(total));
+
+    for(j = 0; j < jobs; j++)
+    {
+        if(read(fds[j], &r, sizeof(r)) != (ssize_t)sizeof(r))
+        {
+            fprintf(stderr, "worker %d failed\n", j);
+            return 1;
+        }
+
+        close(fds[j]);
+        waitpid(pids[j], NULL, 0);
+        add_result(&total, &r);
+    }
+
+    posfile_unmap(recs, count);
+    elapsed = ai_port_get_ms() - start;
+
+    fprintf(stderr, "%lu positions, %lu ms (%.1f knps per job)\n",
+            total.positions, elapsed, elapsed ? (double)total.nodes / elapsed / jobs : 0.0);
+
+    write_params(&total);
+
+    return 0;
+}
@@ -0,0 +1,546 @@
+// nntrain.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// ニューラルネット評価（nn.h）の学習ツール（ホスト用）
+// 学習用局面ファイル（posfile.h）の局面で nn.h と同じ形のネットを浮動小数点で学習し,
+// int8 に量子化して nn_weights.c を書き出す.
+//
+// 教師値は探索の評価値と最終石差を混ぜたもの（1/PATTERN_SCALE 石）.
+//   t = λ * score + (1 - λ) * result * PATTERN_SCALE
+// 出力との二乗誤差をミニバッチの Adam で減らす. 局面は使うたびに8通りの対称形から1つを選ぶ.
+// 重みは量子化したときに int8 に収まる範囲に切り, 中間層の値は量子化後と同じく 0〜1 で切る.
+// 対局番号の 1/VALIDATION_DIV の対局は検証用にして学習に使わない.
+//
+// エポックごとに検証局面の誤差（浮動小数点のネット, 量子化したネット）を表示する.
+// 比較のため, 最初に同じ局面でのパターン評価（evaluate_board と同じ式）の誤差も表示する.
+// 量子化したネットの検証誤差が最小だったエポックの重みを nn_weights.c として標準出力に書き出す.
+//
+// ビルド
+//   gcc -O3 -march=native -I.. nntrain.c ../bitboard.c ../pattern.c ../pattern_weights.c -lm -o nntrain
+//
+// 使い方
+//   ./nntrain [-e エポック数] [-l λ] [-r 学習率] [-s 乱数の種] 局面ファイル > ../nn_weights.c
+//     エポック数  既定 40
+//     λ          教師値の評価値の割合. 既定 0.5
+//     学習率      Adam の初期値. エポックごとに LR_DECAY 倍にする. 既定 0.002
+//   経過と誤差は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "nn.h"
+#include "posfile.h"
+
+#define VALIDATION_DIV 20   // 検証用にする対局の割合の逆数
+#define BATCH_SIZE     256  // ミニバッチの局面数
+#define LR_DECAY       0.92 // エポックごとの学習率の減衰
+#define ADAM_BETA1     0.9
+#define ADAM_BETA2     0.999
+#define ADAM_EPS       1e-8
+#define LINE_VALUES    16   // 出力の1行あたりの値の数
+
+// 量子化したときに収まる範囲
+#define W1_MAX 1.0f                                      // int8 x NN_ONE
+#define W2_MAX (127.0f / (float)(1 << NN_W_SHIFT))       // int8 x (1 << NN_W_SHIFT)
+#define B1_MAX ((32767.0f - BB_SQUARES * 127.0f) / NN_ONE) // int16 のアキュムレータがあふれない範囲
+
+// ネットの重み. 並びは nn.h と同じ.
+struct Net{
+    float w1[2][BB_SQUARES][NN_HIDDEN1];
+    float b1[NN_HIDDEN1];
+    float w2[NN_HIDDEN2][NN_HIDDEN1];
+    float b2[NN_HIDDEN2];
+    float w3[NN_HIDDEN2];
+    float b3;
+};
+
+#define NUM_PARAMS ((int)(sizeof(struct Net) / sizeof(float)))
+
+// 量子化したネット. nn_weights.c に書き出す値.
+struct QNet{
+    int8_t  w1[2][BB_SQUARES][NN_HIDDEN1];
+    int16_t b1[NN_HIDDEN1];
+    int8_t  w2[NN_HIDDEN2][NN_HIDDEN1];
+    int32_t b2[NN_HIDDEN2];
+    int8_t  w3[NN_HIDDEN2];
+    int32_t b3;
+};
+
+static struct Net net;      // 学習中の重み
+static struct Net grad;     // ミニバッチの勾配
+static struct Net adam_m;   // Adam の1次モーメント
+static struct Net adam_v;   // Adam の2次モーメント
+static struct QNet qnet;    // 量子化した重み
+static struct QNet best;    // 検証誤差が最小だった量子化した重み
+
+// 局面
+static const struct PosRecord *recs;
+static size_t num_recs;
+static size_t *train_idx;   // 学習局面の番号. エポックごとに並べ替える.
+static size_t num_train;
+
+static double lambda = 0.5;
+static uint64_t rng = 88172645463325252ULL;
+
+// 乱数（xorshift64）
+static uint64_t next_random(void)
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+
+    return rng;
+}
+
+// -1〜1 の一様乱数
+static float random_unit(void)
+{
+    return (float)((double)(next_random() >> 11) / (double)(1ULL << 53) * 2.0 - 1.0);
+}
+
+// 検証用の局面か
+static int is_valid(const struct PosRecord *r)
+{
+    return r->game % VALIDATION_DIV == 0;
+}
+
+// 教師値 [1/PATTERN_SCALE 石]
+static double target(const struct PosRecord *r)
+{
+    return lambda * r->score + (1.0 - lambda) * r->result * PATTERN_SCALE;
+}
+
+// 範囲に収める
+static float clampf(float v, float lim)
+{
+    return (v > lim) ? lim : (v < -lim) ? -lim : v;
+}
+
+// 丸めて整数にする
+static long round_to(double v)
+{
+    return (long)floor(v + 0.5);
+}
+
+// 1局面の順伝播と逆伝播. 出力 [1.0 = NN_OUT_STONES 石] を返す.
+// g が NULL でなければ, 出力の誤差 dy を逆伝播して勾配を g に足す.
+static float forward_backward(uint64_t p, uint64_t o, float dy_scale, float t, struct Net *g)
+{
+    float h1[NN_HIDDEN1], a1[NN_HIDDEN1], d1[NN_HIDDEN1];
+    float h2[NN_HIDDEN2], a2[NN_HIDDEN2], d2[NN_HIDDEN2];
+    uint64_t b;
+    float y, dy;
+    int i, j, k, sq;
+
+    memcpy(h1, net.b1, sizeof(h1));
+    for(k = 0; k < 2; k++)
+    {
+        for(b = k ? o : p; b; b &= b - 1)
+        {
+            sq = bb_first(b);
+            for(i = 0; i < NN_HIDDEN1; i++) h1[i] += net.w1[k][sq][i];
+        }
+    }
+    for(i = 0; i < NN_HIDDEN1; i++) a1[i] = (h1[i] < 0.0f) ? 0.0f : (h1[i] > 1.0f) ? 1.0f : h1[i];
+
+    y = net.b3;
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        h2[j] = net.b2[j];
+        for(i = 0; i < NN_HIDDEN1; i++) h2[j] += net.w2[j][i] * a1[i];
+        a2[j] = (h2[j] < 0.0f) ? 0.0f : (h2[j] > 1.0f) ? 1.0f : h2[j];
+        y += net.w3[j] * a2[j];
+    }
+
+    if(g == NULL) return y;
+
+    // 二乗誤差の微分
+    dy = 2.0f * (y - t) * dy_scale;
+
+    g->b3 += dy;
+    memset(d1, 0, sizeof(d1));
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        g->w3[j] += dy * a2[j];
+        d2[j] = (h2[j] > 0.0f && h2[j] < 1.0f) ? dy * net.w3[j] : 0.0f;
+        if(d2[j] == 0.0f) continue;
+
+        g->b2[j] += d2[j];
+        for(i = 0; i < NN_HIDDEN1; i++)
+        {
+            g->w2[j][i] += d2[j] * a1[i];
+            d1[i] += d2[j] * net.w2[j][i];
+        }
+    }
+
+    for(i = 0; i < NN_HIDDEN1; i++)
+    {
+        if(!(h1[i] > 0.0f && h1[i] < 1.0f)) d1[i] = 0.0f;
+        g->b1[i] += d1[i];
+    }
+
+    for(k = 0; k < 2; k++)
+    {
+        for(b = k ? o : p; b; b &= b - 1)
+        {
+            sq = bb_first(b);
+            for(i = 0; i < NN_HIDDEN1; i++) g->w1[k][sq][i] += d1[i];
+        }
+    }
+
+    return y;
+}
+
+// 重みを量子化する. 範囲の外の値は学習中に切っているので丸めるだけ.
+static void quantize_net(void)
+{
+    const double ws = (double)(1 << NN_W_SHIFT);
+    int i, j, k, sq;
+
+    for(k = 0; k < 2; k++)
+    {
+        for(sq = 0; sq < BB_SQUARES; sq++)
+        {
+            for(i = 0; i < NN_HIDDEN1; i++) qnet.w1[k][sq][i] = (int8_t)round_to(net.w1[k][sq][i] * NN_ONE);
+        }
+    }
+
+    for(i = 0; i < NN_HIDDEN1; i++) qnet.b1[i] = (int16_t)round_to(net.b1[i] * NN_ONE);
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        for(i = 0; i < NN_HIDDEN1; i++) qnet.w2[j][i] = (int8_t)round_to(net.w2[j][i] * ws);
+        qnet.b2[j] = (int32_t)round_to(net.b2[j] * NN_ONE * ws);
+        qnet.w3[j] = (int8_t)round_to(net.w3[j] * ws);
+    }
+
+    qnet.b3 = (int32_t)round_to(net.b3 * NN_ONE * ws);
+}
+
+// 量子化したネットの評価値 [1/PATTERN_SCALE 石]. nn.c の整数だけの経路と同じ式.
+static int qnet_eval(uint64_t p, uint64_t o)
+{
+    int32_t h[NN_HIDDEN1];
+    int32_t out = qnet.b3, sum, a;
+    long score;
+    uint64_t b;
+    int i, j, k, sq;
+
+    for(i = 0; i < NN_HIDDEN1; i++) h[i] = qnet.b1[i];
+    for(k = 0; k < 2; k++)
+    {
+        for(b = k ? o : p; b; b &= b - 1)
+        {
+            sq = bb_first(b);
+            for(i = 0; i < NN_HIDDEN1; i++) h[i] += qnet.w1[k][sq][i];
+        }
+    }
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        sum = qnet.b2[j];
+        for(i = 0; i < NN_HIDDEN1; i++)
+        {
+            a = (h[i] < 0) ? 0 : (h[i] > NN_ONE) ? NN_ONE : h[i];
+            sum += a * qnet.w2[j][i];
+        }
+        sum = (sum < 0) ? 0 : (sum >> NN_W_SHIFT);
+        if(sum > NN_ONE) sum = NN_ONE;
+        out += sum * qnet.w3[j];
+    }
+
+    score = (long)out * (NN_OUT_STONES * PATTERN_SCALE) / ((long)NN_ONE << NN_W_SHIFT);
+    if(score > NN_OUT_STONES * PATTERN_SCALE)  score = NN_OUT_STONES * PATTERN_SCALE;
+    if(score < -NN_OUT_STONES * PATTERN_SCALE) score = -NN_OUT_STONES * PATTERN_SCALE;
+
+    return (int)score;
+}
+
+// パターン評価. エンジンの evaluate_board と同じ式.
+static int pattern_score(uint64_t p, uint64_t o)
+{
+    int phase = pattern_phase(MAT_WIDTH * MAT_HEIGHT - bb_count(p | o));
+    int mob   = bb_count(bb_moves(p, o)) - bb_count(bb_moves(o, p));
+
+    return pattern_eval(p, o, phase) + mob * pattern_mobility[phase];
+}
+
+// 検証局面の二乗平均誤差 [石]. which は 0:浮動小数点のネット, 1:量子化したネット, 2:パターン評価.
+static double valid_rmse(int which)
+{
+    const double out_scale = NN_OUT_STONES * PATTERN_SCALE;
+    const struct PosRecord *r;
+    double e, sq = 0.0;
+    long n = 0;
+    size_t i;
+
+    for(i = 0; i < num_recs; i++)
+    {
+        r = &recs[i];
+        if(!is_valid(r)) continue;
+
+        if(which == 0)      e = forward_backward(r->p, r->o, 0.0f, 0.0f, NULL) * out_scale;
+        else if(which == 1) e = qnet_eval(r->p, r->o);
+        else                e = pattern_score(r->p, r->o);
+
+        e -= target(r);
+        sq += e * e;
+        n++;
+    }
+
+    return (n > 0) ? sqrt(sq / n) / PATTERN_SCALE : 0.0;
+}
+
+// Adam で1ステップ更新し, 量子化で収まる範囲に切る
+static void adam_step(double lr, long step)
+{
+    float *w = (float *)&net, *g = (float *)&grad, *m = (float *)&adam_m, *v = (float *)&adam_v;
+    double c1 = 1.0 - pow(ADAM_BETA1, (double)step);
+    double c2 = 1.0 - pow(ADAM_BETA2, (double)step);
+    int i, j, k, sq;
+
+    for(i = 0; i < NUM_PARAMS; i++)
+    {
+        m[i] = (float)(ADAM_BETA1 * m[i] + (1.0 - ADAM_BETA1) * g[i]);
+        v[i] = (float)(ADAM_BETA2 * v[i] + (1.0 - ADAM_BETA2) * g[i] * g[i]);
+        w[i] -= (float)(lr * (m[i] / c1) / (sqrt(v[i] / c2) + ADAM_EPS));
+    }
+
+    for(k = 0; k < 2; k++)
+    {
+        for(sq = 0; sq < BB_SQUARES; sq++)
+        {
+            for(i = 0; i < NN_HIDDEN1; i++) net.w1[k][sq][i] = clampf(net.w1[k][sq][i], W1_MAX);
+        }
+    }
+
+    for(i = 0; i < NN_HIDDEN1; i++) net.b1[i] = clampf(net.b1[i], B1_MAX);
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        for(i = 0; i < NN_HIDDEN1; i++) net.w2[j][i] = clampf(net.w2[j][i], W2_MAX);
+        net.w3[j] = clampf(net.w3[j], W2_MAX);
+    }
+}
+
+// 1エポック分学習する. 学習局面の二乗平均誤差 [石] を返す.
+static double train_epoch(double lr, long *step)
+{
+    const float out_scale = (float)(NN_OUT_STONES * PATTERN_SCALE);
+    const struct PosRecord *r;
+    double e, sq = 0.0;
+    size_t i, j, tmp;
+    int sym;
+
+    // 局面の順番を混ぜる
+    for(i = num_train - 1; i > 0; i--)
+    {
+        j = (size_t)(next_random() % (i + 1));
+        tmp = train_idx[i]; train_idx[i] = train_idx[j]; train_idx[j] = tmp;
+    }
+
+    memset(&grad, 0, sizeof(grad));
+
+    for(i = 0; i < num_train; i++)
+    {
+        r   = &recs[train_idx[i]];
+        sym = (int)(next_random() % 8);
+
+        e = forward_backward(bb_symmetry(r->p, sym), bb_symmetry(r->o, sym), 1.0f / BATCH_SIZE,
+                             (float)(target(r) / out_scale), &grad) * out_scale - target(r);
+        sq += e * e;
+
+        if((i + 1) % BATCH_SIZE == 0 || i + 1 == num_train)
+        {
+            (*step)++;
+            adam_step(lr, *step);
+            memset(&grad, 0, sizeof(grad));
+        }
+    }
+
+    return sqrt(sq / num_train) / PATTERN_SCALE;
+}
+
+// 重みを初期化する. 中間層がはじめから 0〜1 の範囲に入りやすいようにする.
+static void init_net(void)
+{
+    int i, j, k, sq;
+
+    for(k = 0; k < 2; k++)
+    {
+        for(sq = 0; sq < BB_SQUARES; sq++)
+        {
+            for(i = 0; i < NN_HIDDEN1; i++) net.w1[k][sq][i] = 0.1f * random_unit();
+        }
+    }
+
+    for(i = 0; i < NN_HIDDEN1; i++) net.b1[i] = 0.5f;
+
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        for(i = 0; i < NN_HIDDEN1; i++) net.w2[j][i] = random_unit() / sqrtf((float)NN_HIDDEN1);
+        net.b2[j] = 0.5f;
+        net.w3[j] = 0.1f * random_unit();
+    }
+
+    net.b3 = 0.0f;
+}
+
+// 1つの配列を書き出す
+static void write_values(const char *decl, const int32_t *v, int n)
+{
+    int i;
+
+    printf("%s =\n{\n", decl);
+    for(i = 0; i < n; i++)
+    {
+        if(i % LINE_VALUES == 0) printf("    ");
+        printf("%d", v[i]);
+        if(i < n - 1) printf(",");
+        if(i % LINE_VALUES == LINE_VALUES - 1 || i == n - 1) printf("\n");
+        else printf(" ");
+    }
+    printf("};\n\n");
+}
+
+// nn_weights.c を標準出力に書き出す
+static void write_weights(const struct QNet *q, const char *note)
+{
+    static int32_t v[2 * BB_SQUARES * NN_HIDDEN1];
+    int i, j, k, sq, n;
+
+    printf("// nn_weights.c\n");
+    printf("// Created on : 2026/10/17\n");
+    printf("// Author : T.Ijiro\n");
+    printf("//\n");
+    printf("// ニューラルネット評価の学習済みの重み. tools/nntrain.c が生成する. 手で編集しない.\n");
+    printf("// %s\n", note);
+    printf("\n#include <stdint.h>\n#include \"nn.h\"\n\n");
+
+    // 中間層1の重みはマスごとに1行
+    printf("const int8_t nn_w1[2][BB_SQUARES][NN_HIDDEN1] =\n{\n");
+    for(k = 0; k < 2; k++)
+    {
+        printf("    {\n");
+        for(sq = 0; sq < BB_SQUARES; sq++)
+        {
+            printf("        {");
+            for(i = 0; i < NN_HIDDEN1; i++) printf("%d%s", q->w1[k][sq][i], (i < NN_HIDDEN1 - 1) ? "," : "");
+            printf("}%s\n", (sq < BB_SQUARES - 1) ? "," : "");
+        }
+        printf("    }%s\n", (k == 0) ? "," : "");
+    }
+    printf("};\n\n");
+
+    for(i = 0; i < NN_HIDDEN1; i++) v[i] = q->b1[i];
+    write_values("const int16_t nn_b1[NN_HIDDEN1]", v, NN_HIDDEN1);
+
+    printf("const int8_t nn_w2[NN_HIDDEN2][NN_HIDDEN1] =\n{\n");
+    for(j = 0; j < NN_HIDDEN2; j++)
+    {
+        printf("    {");
+        for(i = 0; i < NN_HIDDEN1; i++) printf("%d%s", q->w2[j][i], (i < NN_HIDDEN1 - 1) ? "," : "");
+        printf("}%s\n", (j < NN_HIDDEN2 - 1) ? "," : "");
+    }
+    printf("};\n\n");
+
+    for(n = 0; n < NN_HIDDEN2; n++) v[n] = q->b2[n];
+    write_values("const int32_t nn_b2[NN_HIDDEN2]", v, NN_HIDDEN2);
+
+    for(n = 0; n < NN_HIDDEN2; n++) v[n] = q->w3[n];
+    write_values("const int8_t nn_w3[NN_HIDDEN2]", v, NN_HIDDEN2);
+
+    printf("const int32_t nn_b3 = %d;\n", q->b3);
+}
+
+// 使い方の表示
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-e epochs] [-l lambda] [-r rate] [-s seed] positions > ../nn_weights.c\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    int epochs = 40, epoch, best_epoch = -1, opt;
+    double lr = 0.002, train_err, float_err, q_err, best_err = 1e30;
+    long step = 0;
+    size_t i;
+    char note[200];
+
+    while((opt = getopt(argc, argv, "e:l:r:s:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'e': epochs = atoi(optarg); break;
+            case 'l': lambda = atof(optarg); break;
+            case 'r': lr     = atof(optarg); break;
+            case 's': rng    = strtoull(optarg, NULL, 0) | 1; break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(argc - optind != 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    recs = posfile_map(argv[optind], &num_recs);
+    if(recs == NULL) return 1;
+
+    train_idx = (size_t *)malloc(sizeof(size_t) * num_recs);
+    if(train_idx == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for(i = 0; i < num_recs; i++)
+    {
+        if(!is_valid(&recs[i])) train_idx[num_train++] = i;
+    }
+
+    fprintf(stderr, "positions %lu (train %lu), network %d-%d-%d-1, %d parameters, lambda %.2f\n",
+            (unsigned long)num_recs, (unsigned long)num_train, NN_INPUTS, NN_HIDDEN1, NN_HIDDEN2, NUM_PARAMS, lambda);
+    fprintf(stderr, "pattern eval : valid %.3f stones\n", valid_rmse(2));
+
+    init_net();
+
+    for(epoch = 0; epoch < epochs; epoch++)
+    {
+        train_err = train_epoch(lr, &step);
+        quantize_net();
+        float_err = valid_rmse(0);
+        q_err     = valid_rmse(1);
+
+        if(q_err < best_err)
+        {
+            best_err   = q_err;
+            best_epoch = epoch;
+            best       = qnet;
+        }
+
+        fprintf(stderr, "epoch %2d : train %.3f, valid %.3f, quantized %.3f stones (lr %.5f)\n",
+                epoch, train_err, float_err, q_err, lr);
+        lr *= LR_DECAY;
+    }
+
+    fprintf(stderr, "best     : epoch %d, quantized %.3f stones\n", best_epoch, best_err);
+
+    sprintf(note, "局面 %lu, λ %.2f, エポック %d/%d, 検証誤差 %.3f 石（二乗平均）",
+            (unsigned long)num_recs, lambda, best_epoch, epochs, best_err);
+    write_weights(&best, note);
+
+    free(train_idx);
+    posfile_unmap(recs, num_recs);
+
+    return 0;
+}
@@ -0,0 +1,275 @@
+// patgen.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// パターン評価の重みの学習ツール（ホスト用）
+// 1. 今の pattern_weights.c のAIで自己対戦して, 局面と最終石差を集める
+//    序盤の数手と途中の一部の手はランダムに打ち, 局面をばらつかせる.
+//    空きマスが AI_ENDGAME_EMPTIES 以下では完全読みで打つので, そこから先の石差は正確な値になる.
+// 2. 局面を8通りの対称形に増やし, 進行度ごとに重みを最小二乗で合わせる
+// 3. pattern_weights.c を標準出力に書き出す
+// 出力した重みで再ビルドして繰り返すと, 自己対戦の質が上がっていく.
+//
+// ビルド（自己対戦を速くするため完全読みは空き12マスから）
+//   gcc -O2 -DAI_ENDGAME_EMPTIES=12 -I.. patgen.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c -lm -o patgen
+//
+// 使い方
+//   ./patgen [対局数(既定20000)] [探索深さ(既定2)] > ../pattern_weights.c
+//   経過と誤差は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "ai.h"
+#include "pattern_out.h"
+
+#define OPENING_RANDOM_MIN 4    // 序盤にランダムに打つ手数の最小
+#define OPENING_RANDOM_MAX 12   // 序盤にランダムに打つ手数の最大
+#define RANDOM_MOVE_PERCENT 5   // 途中でランダムに打つ確率 [%]
+#define VALIDATION_PERCENT 5    // 検証用に取り分ける対局の割合 [%]
+#define EPOCHS 40               // 学習の反復回数
+#ifndef LEARNING_RATE
+#define LEARNING_RATE 0.03      // 1回の更新で誤差のどれだけを重みに戻すか. 全特徴が同時に動くので 1/特徴数 程度.
+#endif
+#define REGULARIZATION 8.0      // 重みを0に寄せる強さ（リッジ回帰. 重みの二乗に掛けて誤差に足す）
+
+// 学習局面. 手番側から見た値.
+struct Sample{
+    uint64_t p;        // 手番側
+    uint64_t o;        // 相手側
+    int8_t   label;    // 最終石差
+    int8_t   mobility; // 着手可能数の差
+    uint8_t  phase;    // 進行度
+    uint8_t  valid;    // 検証用なら1
+};
+
+static struct Sample *samples;
+static long num_samples;
+static long cap_samples;
+
+// 学習中の重み
+static float weights[PATTERN_PHASES][PATTERN_SIZE];
+static float mobility_w[PATTERN_PHASES];
+static float bias_w[PATTERN_PHASES];
+
+// 勾配の集計
+static double grad[PATTERN_PHASES][PATTERN_SIZE];
+static unsigned int count[PATTERN_PHASES][PATTERN_SIZE];
+
+static void add_sample(uint64_t p, uint64_t o, int valid)
+{
+    struct Sample *s;
+
+    if(num_samples == cap_samples)
+    {
+        cap_samples = cap_samples ? cap_samples * 2 : 65536;
+        samples = (struct Sample *)realloc(samples, sizeof(struct Sample) * (size_t)cap_samples);
+        if(samples == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+
+    s = &samples[num_samples++];
+    s->p        = p;
+    s->o        = o;
+    s->label    = 0;
+    s->mobility = (int8_t)(bb_count(bb_moves(p, o)) - bb_count(bb_moves(o, p)));
+    s->phase    = (uint8_t)pattern_phase(MAT_WIDTH * MAT_HEIGHT - bb_count(p | o));
+    s->valid    = (uint8_t)valid;
+}
+
+// 1局自己対戦して局面を集める
+static void play_game(int depth, int valid)
+{
+    struct Board brd;
+    enum stone_color sc = stone_red;
+    long first = num_samples;
+    long i;
+    uint64_t moves, flips;
+    int ply = 0, passes = 0;
+    int random_plies = OPENING_RANDOM_MIN + rand() % (OPENING_RANDOM_MAX - OPENING_RANDOM_MIN + 1);
+    int x, y, sq, k, diff, empties;
+    enum stone_color sides[64];
+
+    init_board(&brd);
+    ai_new_game();
+
+    while(passes < 2)
+    {
+        moves = get_placeable_mask(&brd, sc);
+
+        if(!moves)
+        {
+            passes++;
+            sc = OPPONENT(sc);
+            continue;
+        }
+
+        passes = 0;
+        empties = MAT_WIDTH * MAT_HEIGHT - bb_count(brd.stones[stone_red] | brd.stones[stone_green]);
+
+        if(ply >= random_plies)
+        {
+            sides[num_samples - first] = sc;
+            add_sample(brd.stones[sc], brd.stones[OPPONENT(sc)], valid);
+        }
+
+        if(ply < random_plies || (empties > AI_ENDGAME_EMPTIES && rand() % 100 < RANDOM_MOVE_PERCENT))
+        {
+            k = rand() % bb_count(moves);
+            while(k--) moves &= moves - 1;
+            sq = bb_first(moves);
+        }
+        else
+        {
+            ai_select_move(&brd, sc, depth, 0, &x, &y);
+            sq = BB_SQ(x, y);
+        }
+
+        flips = make_flip_mask(&brd, BB_SQ_X(sq), BB_SQ_Y(sq), sc);
+        flip_stones(flips, &brd, sc);
+        place(&brd, BB_SQ_X(sq), BB_SQ_Y(sq), sc);
+        sc = OPPONENT(sc);
+        ply++;
+    }
+
+    // 最終石差（赤から見た値）. 空きマスは勝った側に数える.
+    diff = count_stones(&brd, stone_red) - count_stones(&brd, stone_green);
+    empties = MAT_WIDTH * MAT_HEIGHT - bb_count(brd.stones[stone_red] | brd.stones[stone_green]);
+    if(diff > 0) diff += empties;
+    if(diff < 0) diff -= empties;
+
+    for(i = first; i < num_samples; i++)
+    {
+        samples[i].label = (int8_t)((sides[i - first] == stone_red) ? diff : -diff);
+    }
+}
+
+// 予測値 [1/PATTERN_SCALE 石]
+static double predict(const struct Sample *s, const uint32_t *idx)
+{
+    double pred = bias_w[s->phase] + mobility_w[s->phase] * s->mobility;
+    int i;
+
+    for(i = 0; i < PATTERN_NUM_FEATURES; i++)
+    {
+        pred += weights[s->phase][idx[i]];
+    }
+
+    return pred;
+}
+
+// 1回分の学習. 学習局面の二乗誤差 [石] を返し, 検証局面の誤差を valid_err に入れる.
+static double train_epoch(double *valid_err)
+{
+    static double grad_mob[PATTERN_PHASES], sq_mob[PATTERN_PHASES], grad_bias[PATTERN_PHASES];
+    static double num[PATTERN_PHASES];
+    uint32_t idx[PATTERN_NUM_FEATURES];
+    const struct Sample *s;
+    double err, train_sq = 0.0, valid_sq = 0.0;
+    long i, n_train = 0, n_valid = 0;
+    int k, f, ph;
+
+    memset(grad, 0, sizeof(grad));
+    memset(count, 0, sizeof(count));
+    memset(grad_mob, 0, sizeof(grad_mob));
+    memset(sq_mob, 0, sizeof(sq_mob));
+    memset(grad_bias, 0, sizeof(grad_bias));
+    memset(num, 0, sizeof(num));
+
+    for(i = 0; i < num_samples; i++)
+    {
+        s = &samples[i];
+
+        for(k = 0; k < 8; k++)
+        {
+            pattern_features(bb_symmetry(s->p, k), bb_symmetry(s->o, k), idx);
+            err = s->label * PATTERN_SCALE - predict(s, idx);
+
+            if(s->valid)
+            {
+                valid_sq += err * err;
+                n_valid++;
+                continue;
+            }
+
+            train_sq += err * err;
+            n_train++;
+
+            for(f = 0; f < PATTERN_NUM_FEATURES; f++)
+            {
+                grad[s->phase][idx[f]] += err;
+                count[s->phase][idx[f]]++;
+            }
+
+            grad_mob[s->phase]  += err * s->mobility;
+            sq_mob[s->phase]    += (double)s->mobility * s->mobility;
+            grad_bias[s->phase] += err;
+            num[s->phase]       += 1.0;
+        }
+    }
+
+    // 出現回数で割った平均誤差の分だけ重みを動かす
+    // 正則化の項で出現の少ない重みが大きくなりすぎないようにする. int8 の重みが飽和しにくくなる.
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        for(f = 0; f < PATTERN_SIZE; f++)
+        {
+            if(count[ph][f])
+            {
+                weights[ph][f] += (float)(LEARNING_RATE * (grad[ph][f] - REGULARIZATION * weights[ph][f])
+                                        / (count[ph][f] + REGULARIZATION));
+            }
+        }
+
+        if(sq_mob[ph] > 0.0) mobility_w[ph] += (float)(LEARNING_RATE * grad_mob[ph] / sq_mob[ph]);
+        if(num[ph] > 0.0)    bias_w[ph]     += (float)(LEARNING_RATE * grad_bias[ph] / num[ph]);
+    }
+
+    *valid_err = (n_valid > 0) ? valid_sq / n_valid : 0.0;
+
+    return (n_train > 0) ? train_sq / n_train : 0.0;
+}
+
+int main(int argc, char *argv[])
+{
+    int games = (argc > 1) ? atoi(argv[1]) : 20000;
+    int depth = (argc > 2) ? atoi(argv[2]) : 2;
+    int g, epoch;
+    double train_err, valid_err = 0.0;
+    char note[160];
+
+    if(games < 1) games = 1;
+    if(depth < 1) depth = 1;
+    if(depth > AI_MAX_DEPTH) depth = AI_MAX_DEPTH;
+
+    srand(1);
+
+    for(g = 0; g < games; g++)
+    {
+        play_game(depth, rand() % 100 < VALIDATION_PERCENT);
+
+        if((g + 1) % 1000 == 0) fprintf(stderr, "games %d, samples %ld\n", g + 1, num_samples);
+    }
+
+    for(epoch = 0; epoch < EPOCHS; epoch++)
+    {
+        train_err = train_epoch(&valid_err);
+        fprintf(stderr, "epoch %2d : train %.3f, valid %.3f discs\n", epoch,
+                sqrt(train_err) / PATTERN_SCALE, sqrt(valid_err) / PATTERN_SCALE);
+    }
+
+    sprintf(note, "自己対戦 %d 局（探索深さ %d）, 学習局面 %ld（対称形込みで x8）, 検証誤差 %.2f 石",
+            games, depth, num_samples, sqrt(valid_err) / PATTERN_SCALE);
+    write_pattern_weights(weights, mobility_w, bias_w, "patgen.c", note);
+
+    free(samples);
+
+    return 0;
+}
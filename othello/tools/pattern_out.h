@@ -0,0 +1,126 @@
+// pattern_out.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 学習した重みを pattern_weights.c の形で書き出す（patgen.c, tune.c で共有）
+
+#ifndef PATTERN_OUT_H
+#define PATTERN_OUT_H
+
+#include <stdio.h>
+#include "pattern.h"
+
+#define LINE_VALUES 20 // 出力の1行あたりの値の数
+
+// 丸めて範囲に収める
+static int quantize(float w, int lim, long *clipped)
+{
+    int v = (int)((w >= 0.0f) ? w + 0.5f : w - 0.5f);
+
+    if(v > lim)
+    {
+        (*clipped)++;
+        return lim;
+    }
+
+    if(v < -lim)
+    {
+        (*clipped)++;
+        return -lim;
+    }
+
+    return v;
+}
+
+// 形の重みが int8 に収まる最小の倍率（左シフト量）. PATTERN_MAX_SHIFT でも収まらない分は飽和させる.
+static int choose_shift(const float *w, int size)
+{
+    float max = 0.0f;
+    int i, shift = 0;
+
+    for(i = 0; i < size; i++)
+    {
+        if(w[i] > max)  max = w[i];
+        if(-w[i] > max) max = -w[i];
+    }
+
+    while(shift < PATTERN_MAX_SHIFT && max >= 127.5f * (float)(1 << shift)) shift++;
+
+    return shift;
+}
+
+// pattern_weights.c を標準出力に書き出す
+// tool は生成したツールのファイル名, note は学習条件の説明（1行）.
+// 重みは進行度と形ごとに倍率を選んで int8 に丸める.
+static void write_pattern_weights(const float weights[PATTERN_PHASES][PATTERN_SIZE],
+                                  const float mobility_w[PATTERN_PHASES], const float bias_w[PATTERN_PHASES],
+                                  const char *tool, const char *note)
+{
+    int shift[PATTERN_PHASES][PATTERN_NUM_SHAPES];
+    long clipped = 0;
+    int ph, sh, i;
+
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        for(sh = 0; sh < PATTERN_NUM_SHAPES; sh++)
+        {
+            shift[ph][sh] = choose_shift(&weights[ph][pattern_shape_ofs[sh]],
+                                         (int)(pattern_shape_ofs[sh + 1] - pattern_shape_ofs[sh]));
+        }
+    }
+
+    printf("// pattern_weights.c\n");
+    printf("// Created on : 2026/10/17\n");
+    printf("// Author : T.Ijiro\n");
+    printf("//\n");
+    printf("// パターン評価の学習済みの重み. tools/%s が生成する. 手で編集しない.\n", tool);
+    printf("// %s\n", note);
+    printf("\n#include <stdint.h>\n#include \"pattern.h\"\n\n");
+
+    printf("const int16_t pattern_mobility[PATTERN_PHASES] =\n{\n    ");
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        printf("%d%s", quantize(mobility_w[ph], 32767, &clipped), (ph < PATTERN_PHASES - 1) ? ", " : "\n};\n\n");
+    }
+
+    printf("const int16_t pattern_bias[PATTERN_PHASES] =\n{\n    ");
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        printf("%d%s", quantize(bias_w[ph], 32767, &clipped), (ph < PATTERN_PHASES - 1) ? ", " : "\n};\n\n");
+    }
+
+    printf("const uint8_t pattern_shift[PATTERN_PHASES][PATTERN_NUM_SHAPES] =\n{\n");
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        printf("    {");
+        for(sh = 0; sh < PATTERN_NUM_SHAPES; sh++)
+        {
+            printf("%d%s", shift[ph][sh], (sh < PATTERN_NUM_SHAPES - 1) ? ", " : "}");
+        }
+        printf("%s\n", (ph < PATTERN_PHASES - 1) ? "," : "");
+    }
+    printf("};\n\n");
+
+    printf("const int8_t pattern_weights[PATTERN_PHASES][PATTERN_SIZE] =\n{\n");
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        printf("    {\n");
+
+        for(i = 0, sh = 0; i < PATTERN_SIZE; i++)
+        {
+            while(i >= (int)pattern_shape_ofs[sh + 1]) sh++;
+
+            if(i % LINE_VALUES == 0) printf("        ");
+            printf("%d", quantize(weights[ph][i] / (float)(1 << shift[ph][sh]), 127, &clipped));
+            if(i < PATTERN_SIZE - 1) printf(",");
+            if(i % LINE_VALUES == LINE_VALUES - 1 || i == PATTERN_SIZE - 1) printf("\n");
+        }
+
+        printf("    }%s\n", (ph < PATTERN_PHASES - 1) ? "," : "");
+    }
+    printf("};\n");
+
+    fprintf(stderr, "clipped weights : %ld\n", clipped);
+}
+
+#endif /* PATTERN_OUT_H */
@@ -0,0 +1,313 @@
+// perft.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 合法手生成の検証・速度計測ツール（ホスト用）
+// 指定した深さまでの末端ノード数を数え, 既知の値と照合して nodes/s を表示する.
+// ルート付近で分割した部分木を全コアのスレッドで分担する.
+//
+// 数え方
+// ・パスも1手として深さを1つ消費する
+// ・両者とも置けない（終局）ノードは深さが残っていても末端として1と数える
+//
+// ビルド
+//   gcc -O2 -pthread -I.. perft.c ../bitboard.c -o perft
+//   小さい盤は -DBOARD_SIZE=4 か -DBOARD_SIZE=6 を付ける.
+//
+// 使い方
+//   ./perft [最大深さ(既定:局面ごとの検証深さ)] [スレッド数(既定:全コア)]
+//   不一致があれば終了コード1を返す.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "bitboard.h"
+
+#define MAX_DEPTH   16   // 扱う最大深さ
+#define MAX_TASKS   4096 // 分割した部分木の最大数
+#define MAX_THREADS 256  // 最大スレッド数
+#define SPLIT_DEPTH 2    // 部分木に分割する深さ
+
+// 検証用局面. 既知の値が0の深さは照合しない.
+struct Position{
+    const char *name;                  // 局面名
+    uint64_t    p;                     // 手番側
+    uint64_t    o;                     // 相手側
+    int         depth;                 // 既定の検証深さ
+    uint64_t    expected[MAX_DEPTH];   // 深さ1〜の末端ノード数
+};
+
+// 部分木
+struct Task{
+    uint64_t p;
+    uint64_t o;
+    int      depth;
+    int      passed;
+    uint64_t nodes;
+};
+
+// スレッド間で共有する作業キュー
+struct Queue{
+    struct Task     tasks[MAX_TASKS];
+    int             count;
+    int             next;
+    pthread_mutex_t lock;
+};
+
+// init_board の初期局面と, 乱数対局から保存した局面.
+// 初期局面以外の値は配列ベースの8方向走査の実装と照合済み.
+// 小さい盤（BOARD_SIZE）は初期局面だけ. 値は同じ配列ベースの実装で求めた. 4x4 は終局まで全部数える.
+#if BOARD_SIZE == 4
+static const struct Position POSITIONS[] =
+{
+    {"start",  0x0000000000020400ULL, 0x0000000000040200ULL, 16,
+        {4ULL, 12ULL, 44ULL, 128ULL, 424ULL, 1256ULL, 3624ULL, 9116ULL, 20044ULL, 36540ULL,
+         50704ULL, 57436ULL, 59564ULL, 59980ULL, 60060ULL, 60060ULL}}
+};
+#elif BOARD_SIZE == 6
+static const struct Position POSITIONS[] =
+{
+    {"start",  0x0000000004080000ULL, 0x0000000008040000ULL, 11,
+        {4ULL, 12ULL, 56ULL, 244ULL, 1364ULL, 7604ULL, 47740ULL, 308716ULL, 2114912ULL,
+         14976792ULL, 108820292ULL}}
+};
+#else
+static const struct Position POSITIONS[] =
+{
+    {"start",  0x0000000810000000ULL, 0x0000001008000000ULL, 11,
+        {4ULL, 12ULL, 56ULL, 244ULL, 1396ULL, 8200ULL, 55092ULL, 390216ULL, 3005288ULL,
+         24571284ULL, 212258800ULL, 1939886636ULL}},
+    {"ply10",  0x0000301010100000ULL, 0x00080c080e020100ULL, 7,
+        {7ULL, 55ULL, 485ULL, 4416ULL, 42193ULL, 413110ULL, 4346974ULL}},
+    {"ply20",  0x0102202030080000ULL, 0x020d1c1c0e122100ULL, 6,
+        {11ULL, 121ULL, 1436ULL, 16046ULL, 207546ULL, 2290379ULL, 31254303ULL}},
+    {"ply30",  0x010101120f100000ULL, 0x020e7e2c702e6500ULL, 6,
+        {18ULL, 113ULL, 2028ULL, 14402ULL, 249813ULL, 1987353ULL, 32528074ULL}},
+    {"ply44",  0x01c1013e5c180448ULL, 0x020efec1a3a77320ULL, 8,
+        {11ULL, 102ULL, 1003ULL, 8357ULL, 73165ULL, 533960ULL, 4051809ULL, 24996553ULL}},
+    {"ply50",  0x21a1213670400008ULL, 0x424edec98fbf7fe0ULL, 10,
+        {10ULL, 50ULL, 378ULL, 1734ULL, 9518ULL, 35589ULL, 125300ULL, 310238ULL, 538339ULL,
+         546692ULL}},
+    {"pass",   0x7260d6d99fbf7fe0ULL, 0x099f292660400008ULL, 10,
+        {3ULL, 17ULL, 46ULL, 178ULL, 397ULL, 713ULL, 718ULL, 719ULL, 719ULL, 719ULL}}
+};
+#endif
+
+#define NUM_POSITIONS ((int)(sizeof(POSITIONS) / sizeof(POSITIONS[0])))
+
+// 末端ノード数を数える
+static uint64_t perft(uint64_t p, uint64_t o, int depth, int passed)
+{
+    uint64_t moves, flips, nodes = 0;
+    int sq;
+
+    if(depth == 0) return 1;
+
+    moves = bb_moves(p, o);
+
+    // パス. 続けてパスなら終局.
+    if(!moves)
+    {
+        if(passed) return 1;
+
+        return perft(o, p, depth - 1, 1);
+    }
+
+    // 深さ1は合法手数がそのまま末端ノード数
+    if(depth == 1) return (uint64_t)bb_count(moves);
+
+    while(moves)
+    {
+        sq = bb_first(moves);
+        moves &= moves - 1;
+
+        flips = bb_flips(p, o, sq);
+        nodes += perft(o & ~flips, p | flips | BB_BIT(sq), depth - 1, 0);
+    }
+
+    return nodes;
+}
+
+// ルートから split 手分展開して部分木をキューに積む.
+// 深さが尽きた, または終局した部分木は展開時に数え終えて leaf_nodes に加える.
+static void split(struct Queue *q, uint64_t p, uint64_t o, int depth, int passed, int split_depth, uint64_t *leaf_nodes)
+{
+    uint64_t moves, flips;
+    int sq;
+
+    if(depth == 0)
+    {
+        (*leaf_nodes)++;
+        return;
+    }
+
+    if(split_depth == 0 || q->count >= MAX_TASKS)
+    {
+        if(q->count < MAX_TASKS)
+        {
+            q->tasks[q->count].p      = p;
+            q->tasks[q->count].o      = o;
+            q->tasks[q->count].depth  = depth;
+            q->tasks[q->count].passed = passed;
+            q->tasks[q->count].nodes  = 0;
+            q->count++;
+        }
+        else
+        {
+            *leaf_nodes += perft(p, o, depth, passed);
+        }
+
+        return;
+    }
+
+    moves = bb_moves(p, o);
+
+    if(!moves)
+    {
+        if(passed)
+        {
+            (*leaf_nodes)++;
+            return;
+        }
+
+        split(q, o, p, depth - 1, 1, split_depth - 1, leaf_nodes);
+        return;
+    }
+
+    while(moves)
+    {
+        sq = bb_first(moves);
+        moves &= moves - 1;
+
+        flips = bb_flips(p, o, sq);
+        split(q, o & ~flips, p | flips | BB_BIT(sq), depth - 1, 0, split_depth - 1, leaf_nodes);
+    }
+}
+
+// ワーカースレッド. キューから部分木を取り出して数える.
+static void *worker(void *arg)
+{
+    struct Queue *q = (struct Queue *)arg;
+    struct Task *t;
+    int idx;
+
+    while(1)
+    {
+        pthread_mutex_lock(&q->lock);
+        idx = q->next++;
+        pthread_mutex_unlock(&q->lock);
+
+        if(idx >= q->count) break;
+
+        t = &q->tasks[idx];
+        t->nodes = perft(t->p, t->o, t->depth, t->passed);
+    }
+
+    return NULL;
+}
+
+// 並列perft
+static uint64_t parallel_perft(struct Queue *q, uint64_t p, uint64_t o, int depth, int num_threads)
+{
+    pthread_t threads[MAX_THREADS];
+    uint64_t nodes = 0;
+    int i;
+
+    q->count = 0;
+    q->next  = 0;
+
+    split(q, p, o, depth, 0, SPLIT_DEPTH, &nodes);
+
+    for(i = 0; i < num_threads; i++)
+    {
+        pthread_create(&threads[i], NULL, worker, q);
+    }
+
+    for(i = 0; i < num_threads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    for(i = 0; i < q->count; i++)
+    {
+        nodes += q->tasks[i].nodes;
+    }
+
+    return nodes;
+}
+
+// 経過時間計測用 [s]
+static double now_sec(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+    static struct Queue queue;
+    const struct Position *pos;
+    uint64_t nodes, total_nodes = 0;
+    double start, elapsed, total_elapsed = 0.0;
+    int max_depth   = (argc > 1) ? atoi(argv[1]) : 0;
+    int num_threads = (argc > 2) ? atoi(argv[2]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int i, depth, last_depth, errors = 0;
+
+    if(max_depth < 0) max_depth = 0;
+    if(max_depth > MAX_DEPTH) max_depth = MAX_DEPTH;
+    if(num_threads < 1) num_threads = 1;
+    if(num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+
+    pthread_mutex_init(&queue.lock, NULL);
+
+    printf("perft : %d thread(s)\n", num_threads);
+
+    for(i = 0; i < NUM_POSITIONS; i++)
+    {
+        pos = &POSITIONS[i];
+
+        last_depth = (max_depth > 0) ? max_depth : pos->depth;
+
+        for(depth = 1; depth <= last_depth; depth++)
+        {
+            start   = now_sec();
+            nodes   = parallel_perft(&queue, pos->p, pos->o, depth, num_threads);
+            elapsed = now_sec() - start;
+
+            total_nodes   += nodes;
+            total_elapsed += elapsed;
+
+            printf("%-6s depth %2d : %14llu nodes %9.3f s %9.2f Mnps",
+                   pos->name, depth, (unsigned long long)nodes, elapsed,
+                   (elapsed > 0.0) ? (double)nodes / elapsed * 1e-6 : 0.0);
+
+            if(pos->expected[depth - 1] == 0)
+            {
+                printf("\n");
+            }
+            else if(pos->expected[depth - 1] == nodes)
+            {
+                printf("  OK\n");
+            }
+            else
+            {
+                printf("  NG (expected %llu)\n", (unsigned long long)pos->expected[depth - 1]);
+                errors++;
+            }
+        }
+    }
+
+    printf("total : %llu nodes %.3f s %.2f Mnps, %d error(s)\n",
+           (unsigned long long)total_nodes, total_elapsed,
+           (total_elapsed > 0.0) ? (double)total_nodes / total_elapsed * 1e-6 : 0.0, errors);
+
+    pthread_mutex_destroy(&queue.lock);
+
+    return errors ? 1 : 0;
+}
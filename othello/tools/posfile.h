@@ -0,0 +1,132 @@
+// posfile.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 学習用局面ファイルの形式（ホスト用）
+// ヘッダなしで PosRecord を並べただけのファイル. 1局面24バイト, リトルエンディアン.
+// ファイル全体を mmap すれば読み込み処理なしで配列として使える.
+// 書き込みは1対局分ずつ O_APPEND で追記するので, 複数のプロセスが同じファイルに書き足してよい.
+
+#ifndef POSFILE_H
+#define POSFILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// 1局面. 値はすべて手番側から見た値.
+struct PosRecord{
+    uint64_t p;      // 手番側のコマ
+    uint64_t o;      // 相手側のコマ
+    uint8_t  side;   // 手番の色（enum stone_color）
+    int8_t   result; // 最終石差. 空きマスは勝った側に数える.
+    int16_t  score;  // 探索の評価値 [1/PATTERN_SCALE 石]. 完全読みなら SCORE_WIN を除いた石差 x PATTERN_SCALE.
+    uint32_t game;   // 対局番号. 同じ対局の局面を学習用と検証用に分けないために使う.
+};
+
+typedef char posfile_record_size_check[(sizeof(struct PosRecord) == 24) ? 1 : -1];
+
+// 追記用に開くときに対局番号を調べる末尾の局面数.
+// 並列に書いた対局は番号順に並ばないので, 最後の1局面ではなく末尾のこの範囲の最大を使う.
+// 1局は60局面ほどなので, 同時に書くプロセスの数よりずっと多い対局分を見る.
+#define POSFILE_TAIL_RECORDS 16384
+
+// ファイル全体を読み取り専用で mmap する. 局面数を count に入れる. 失敗したらNULL.
+static inline const struct PosRecord *posfile_map(const char *path, size_t *count)
+{
+    struct stat st;
+    void *p;
+    int fd = open(path, O_RDONLY);
+
+    *count = 0;
+
+    if(fd < 0)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(struct PosRecord))
+    {
+        fprintf(stderr, "%s : empty or unreadable\n", path);
+        close(fd);
+        return NULL;
+    }
+
+    p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(p == MAP_FAILED)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    // 書き込み途中の端数は使わない
+    *count = (size_t)st.st_size / sizeof(struct PosRecord);
+
+    return (const struct PosRecord *)p;
+}
+
+// posfile_map で開いたファイルを閉じる
+static inline void posfile_unmap(const struct PosRecord *recs, size_t count)
+{
+    munmap((void *)recs, count * sizeof(struct PosRecord));
+}
+
+// 追記用に開く. なければ作る. 書き込み途中で止まった端数は切り捨てる.
+// 末尾の POSFILE_TAIL_RECORDS 局面の最大の対局番号 + 1 を next_game に入れる. 失敗したら-1.
+// ファイル全体は読まないので, 局面数によらず開く時間は変わらない.
+static inline int posfile_open_append(const char *path, uint32_t *next_game)
+{
+    static struct PosRecord tail[POSFILE_TAIL_RECORDS];
+    struct stat st;
+    off_t size;
+    ssize_t got;
+    size_t i, n;
+    int fd = open(path, O_RDWR | O_CREAT | O_APPEND, 0644);
+
+    *next_game = 0;
+
+    if(fd < 0 || fstat(fd, &st) != 0)
+    {
+        perror(path);
+        if(fd >= 0) close(fd);
+        return -1;
+    }
+
+    size = st.st_size - st.st_size % (off_t)sizeof(struct PosRecord);
+
+    if(size != st.st_size && ftruncate(fd, size) != 0)
+    {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+
+    // 末尾の局面だけを読む
+    n = (size_t)(size / (off_t)sizeof(struct PosRecord));
+    if(n > POSFILE_TAIL_RECORDS) n = POSFILE_TAIL_RECORDS;
+    if(n == 0) return fd;
+
+    got = pread(fd, tail, n * sizeof(struct PosRecord), size - (off_t)(n * sizeof(struct PosRecord)));
+    if(got != (ssize_t)(n * sizeof(struct PosRecord)))
+    {
+        perror(path);
+        close(fd);
+        return -1;
+    }
+
+    for(i = 0; i < n; i++)
+    {
+        if(tail[i].game >= *next_game) *next_game = tail[i].game + 1;
+    }
+
+    return fd;
+}
+
+#endif /* POSFILE_H */
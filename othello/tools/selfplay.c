@@ -0,0 +1,304 @@
+// selfplay.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 学習用局面の生成ツール（ホスト用）
+// 今のAIで自己対戦し, 局面・探索の評価値・最終石差を局面ファイル（posfile.h）に追記する.
+// 序盤の数手はランダムに打ち, 途中の一部の手もランダムに打って局面をばらつかせる.
+// 途中のランダムな手も先に探索して評価値を記録してから打つ. ランダムに打った序盤の局面は記録しない.
+// 空きマスが AI_ENDGAME_EMPTIES 以下では完全読みで打つので, そこから先の評価値と石差は正確な値になる.
+//
+// 対局は fork した子プロセスに分け, 全コアで並列に行う. 各プロセスは1対局ずつファイルに追記する.
+// 既存のファイルに追記するときは, 対局番号を既存の最大の番号の次から振る.
+// 序盤と乱数は対局番号から決めるので, 並列数によらず同じ対局になる.
+//
+// ビルド（自己対戦を速くするため完全読みは空き14マスから）
+//   gcc -O2 -DAI_ENDGAME_EMPTIES=14 -I.. selfplay.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c -lm -o selfplay
+//
+// 使い方
+//   ./selfplay [-n 対局数] [-j 並列数] [-d 探索深さ] [-p 序盤の手数] [-r ランダムな手の確率] [-s 乱数の種] 局面ファイル
+//     対局数       既定 10000
+//     並列数       既定 コア数
+//     探索深さ     既定 4
+//     序盤の手数   ランダムに打つ手数の最大. OPENING_RANDOM_MIN からこの値までで対局ごとに決める. 既定 12
+//     確率         序盤の後でランダムに打つ確率 [%]. 既定 5
+//   経過と局面数は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "ai.h"
+#include "posfile.h"
+
+#define MAX_JOBS 256
+#define OPENING_RANDOM_MIN 4   // 序盤にランダムに打つ手数の最小
+#define MAX_RECORDS 64         // 1対局の局面数の上限（着手は最大60手）
+#define REPORT_GAMES 1000      // 経過を表示する対局数の間隔（子プロセスごと）
+
+// 子プロセスの集計
+struct Result{
+    unsigned long games;   // 対局数
+    unsigned long records; // 局面数
+    unsigned long nodes;   // 探索ノード数
+};
+
+// 生成の設定
+static int depth         = 4;
+static int opening_max   = 12;
+static int random_pct    = 5;
+static unsigned long seed = 1;
+
+// 乱数（xorshift64）. 対局番号ごとに種を決めるので, 並列数によらず同じ対局になる.
+static uint64_t next_random(uint64_t *s)
+{
+    *s ^= *s << 13;
+    *s ^= *s >> 7;
+    *s ^= *s << 17;
+
+    return *s;
+}
+
+// 置ける手からランダムに1つ選んでマス番号を返す
+static int random_move(uint64_t moves, uint64_t *s)
+{
+    int k = (int)(next_random(s) % (uint64_t)bb_count(moves));
+
+    while(k--) moves &= moves - 1;
+
+    return bb_first(moves);
+}
+
+// 探索の評価値を記録用の値にする. 完全読みの値は石差 x PATTERN_SCALE にする.
+static int16_t record_score(int score)
+{
+    if(score > SCORE_WIN / 2)  score = (score - SCORE_WIN) * PATTERN_SCALE;
+    if(score < -SCORE_WIN / 2) score = (score + SCORE_WIN) * PATTERN_SCALE;
+    if(score > INT16_MAX) score = INT16_MAX;
+    if(score < -INT16_MAX) score = -INT16_MAX;
+
+    return (int16_t)score;
+}
+
+// 1局打って局面を recs に入れ, 局面数を返す
+static int play_game(uint32_t game, struct PosRecord *recs, struct Result *r)
+{
+    struct Board brd;
+    enum stone_color sc = stone_red;
+    uint64_t s = (uint64_t)seed * 0x9E3779B97F4A7C15ULL + (uint64_t)game * 0xBF58476D1CE4E5B9ULL + 1;
+    uint64_t moves, flips;
+    int opening, ply = 0, passes = 0, n = 0, i, x, y, sq, diff, empties;
+
+    init_board(&brd);
+    ai_new_game();
+    srand((unsigned int)next_random(&s));
+    opening = OPENING_RANDOM_MIN + (int)(next_random(&s) % (uint64_t)(opening_max - OPENING_RANDOM_MIN + 1));
+
+    while(passes < 2)
+    {
+        moves = get_placeable_mask(&brd, sc);
+        if(!moves)
+        {
+            passes++;
+            sc = OPPONENT(sc);
+            continue;
+        }
+        passes = 0;
+
+        if(ply < opening)
+        {
+            sq = random_move(moves, &s);
+            x  = BB_SQ_X(sq);
+            y  = BB_SQ_Y(sq);
+        }
+        else
+        {
+            ai_select_move(&brd, sc, depth, 0, &x, &y);
+            r->nodes += ai_get_node_count();
+
+            recs[n].p     = brd.stones[sc];
+            recs[n].o     = brd.stones[OPPONENT(sc)];
+            recs[n].side  = (uint8_t)sc;
+            recs[n].score = record_score(ai_get_score());
+            recs[n].game  = game;
+            n++;
+
+            if((int)(next_random(&s) % 100) < random_pct)
+            {
+                sq = random_move(moves, &s);
+                x  = BB_SQ_X(sq);
+                y  = BB_SQ_Y(sq);
+            }
+        }
+
+        flips = make_flip_mask(&brd, x, y, sc);
+        flip_stones(flips, &brd, sc);
+        place(&brd, x, y, sc);
+        sc = OPPONENT(sc);
+        ply++;
+    }
+
+    // 最終石差. 空きマスは勝った側に数える.
+    diff    = count_stones(&brd, stone_red) - count_stones(&brd, stone_green);
+    empties = MAT_WIDTH * MAT_HEIGHT - bb_count(brd.stones[stone_red] | brd.stones[stone_green]);
+    if(diff > 0) diff += empties;
+    if(diff < 0) diff -= empties;
+
+    for(i = 0; i < n; i++)
+    {
+        recs[i].result = (int8_t)((recs[i].side == stone_red) ? diff : -diff);
+    }
+
+    return n;
+}
+
+// 子プロセス. 対局番号 base + job, base + job + jobs, ... を打つ.
+static int run_worker(int fd, uint32_t base, int job, int jobs, int games, struct Result *r)
+{
+    struct PosRecord recs[MAX_RECORDS];
+    size_t bytes;
+    int g, n;
+
+    memset(r, 0, sizeof(*r));
+    memset(recs, 0, sizeof(recs));
+
+    for(g = job; g < games; g += jobs)
+    {
+        n     = play_game(base + (uint32_t)g, recs, r);
+        bytes = (size_t)n * sizeof(recs[0]);
+
+        // 1対局を1回の write で追記する. 他のプロセスの局面とは混ざらない.
+        if(write(fd, recs, bytes) != (ssize_t)bytes)
+        {
+            perror("write");
+            return 0;
+        }
+
+        r->games++;
+        r->records += (unsigned long)n;
+
+        if(job == 0 && r->games % REPORT_GAMES == 0)
+        {
+            fprintf(stderr, "%lu / %d games\n", r->games * (unsigned long)jobs, games);
+        }
+    }
+
+    return 1;
+}
+
+// 使い方の表示
+static void usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s [-n games] [-j jobs] [-d depth] [-p plies] [-r percent] [-s seed] positions\n", prog);
+}
+
+int main(int argc, char *argv[])
+{
+    struct Result total, r;
+    int fds[MAX_JOBS];
+    pid_t pids[MAX_JOBS];
+    int games = 10000, jobs = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int opt, j, fd, pfd[2];
+    uint32_t base;
+    unsigned long start, elapsed;
+
+    while((opt = getopt(argc, argv, "n:j:d:p:r:s:")) != -1)
+    {
+        switch(opt)
+        {
+            case 'n': games       = atoi(optarg);          break;
+            case 'j': jobs        = atoi(optarg);          break;
+            case 'd': depth       = atoi(optarg);          break;
+            case 'p': opening_max = atoi(optarg);          break;
+            case 'r': random_pct  = atoi(optarg);          break;
+            case 's': seed        = strtoul(optarg, 0, 0); break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if(argc - optind != 1)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if(games < 1) games = 1;
+    if(jobs < 1) jobs = 1;
+    if(jobs > MAX_JOBS) jobs = MAX_JOBS;
+    if(jobs > games) jobs = games;
+    if(depth < 1) depth = 1;
+    if(depth > AI_MAX_DEPTH) depth = AI_MAX_DEPTH;
+    if(opening_max < OPENING_RANDOM_MIN) opening_max = OPENING_RANDOM_MIN;
+
+    fd = posfile_open_append(argv[optind], &base);
+    if(fd < 0) return 1;
+
+    fprintf(stderr, "%s : games %u - %u, depth %d, %d jobs\n",
+            argv[optind], (unsigned)base, (unsigned)(base + (uint32_t)games - 1), depth, jobs);
+
+    start = ai_port_get_ms();
+
+    // 子プロセスで対局し, 集計をパイプで受け取る
+    for(j = 0; j < jobs; j++)
+    {
+        if(pipe(pfd) != 0)
+        {
+            perror("pipe");
+            return 1;
+        }
+
+        pids[j] = fork();
+
+        if(pids[j] < 0)
+        {
+            perror("fork");
+            return 1;
+        }
+
+        if(pids[j] == 0)
+        {
+            close(pfd[0]);
+            if(!run_worker(fd, base, j, jobs, games, &r)) _exit(1);
+            if(write(pfd[1], &r, sizeof(r)) != (ssize_t)sizeof(r)) _exit(1);
+            _exit(0);
+        }
+
+        close(pfd[1]);
+        fds[j] = pfd[0];
+    }
+
+    memset(&total, 0, sizeof(total));
+
+    for(j = 0; j < jobs; j++)
+    {
+        if(read(fds[j], &r, sizeof(r)) != (ssize_t)sizeof(r))
+        {
+            fprintf(stderr, "worker %d failed\n", j);
+            return 1;
+        }
+
+        close(fds[j]);
+        waitpid(pids[j], NULL, 0);
+
+        total.games   += r.games;
+        total.records += r.records;
+        total.nodes   += r.nodes;
+    }
+
+    close(fd);
+    elapsed = ai_port_get_ms() - start;
+
+    fprintf(stderr, "%lu games, %lu positions, %lu ms (%.1f games/s, %.1f knps per job)\n",
+            total.games, total.records, elapsed,
+            elapsed ? total.games * 1000.0 / elapsed : 0.0,
+            elapsed ? (double)total.nodes / elapsed / jobs : 0.0);
+
+    return 0;
+}
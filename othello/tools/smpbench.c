@@ -0,0 +1,114 @@
+// smpbench.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 並列探索（Lazy SMP）のベンチマーク（ホスト用）
+// bench と同じ局面集で, スレッド数を変えたときの
+//   1. 固定の深さまでの探索時間と, 1スレッドに対する速度比
+//   2. 固定の思考時間で完了した深さの平均と, 1スレッドに対する深さの伸び
+// を表示する. 各局面の前に置換表を消去する.
+//
+// ビルド
+//   gcc -O2 -DAI_SMP=1 -pthread -I.. smpbench.c host_port.c ../ai.c ../tt.c ../bitboard.c ../pattern.c ../pattern_weights.c ../mcts.c ../mpc_data.c -lm -o smpbench
+//
+// 使い方
+//   ./smpbench [最大スレッド数(既定はCPU数)] [深さ(既定10)] [思考時間ms(既定1000)]
+//   スレッド数は 1, 2, 4, ... と倍にして最大スレッド数まで調べる.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include "bitboard.h"
+#include "ai.h"
+#include "bench_positions.h"
+
+#if !AI_SMP || !AI_STATS
+#error "smpbench needs -DAI_SMP=1 and AI_STATS"
+#endif
+
+// 局面集を深さ depth まで探索した時間 [ms]. nodes に全スレッドのノード数の合計を入れる.
+static unsigned long run_fixed_depth(int depth, unsigned long *nodes)
+{
+    struct Board brd;
+    unsigned long start, elapsed = 0;
+    int i, x, y;
+
+    *nodes = 0;
+
+    for(i = 0; i < NUM_POSITIONS; i++)
+    {
+        brd.stones[stone_red]   = POSITIONS[i].p;
+        brd.stones[stone_green] = POSITIONS[i].o;
+
+        ai_new_game();
+        srand(1);
+
+        start = ai_port_get_ms();
+        ai_select_move(&brd, stone_red, depth, 0, &x, &y);
+        elapsed += ai_port_get_ms() - start;
+        *nodes  += ai_get_node_count();
+    }
+
+    return elapsed;
+}
+
+// 局面集を time_ms ずつ探索して完了した深さの平均
+static double run_fixed_time(unsigned long time_ms)
+{
+    struct Board brd;
+    int i, x, y, total = 0;
+
+    for(i = 0; i < NUM_POSITIONS; i++)
+    {
+        brd.stones[stone_red]   = POSITIONS[i].p;
+        brd.stones[stone_green] = POSITIONS[i].o;
+
+        ai_new_game();
+        srand(1);
+
+        ai_select_move(&brd, stone_red, AI_MAX_DEPTH, time_ms, &x, &y);
+        total += ai_get_stats()->depth;
+    }
+
+    return (double)total / NUM_POSITIONS;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_threads = (argc > 1) ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int depth = (argc > 2) ? atoi(argv[2]) : 10;
+    unsigned long time_ms = (argc > 3) ? strtoul(argv[3], NULL, 10) : 1000;
+    unsigned long elapsed, elapsed1 = 0, nodes;
+    double avg, avg1 = 0.0;
+    int t;
+
+    if(max_threads < 1) max_threads = 1;
+    if(max_threads > AI_SMP_MAX_THREADS) max_threads = AI_SMP_MAX_THREADS;
+    if(depth < 1) depth = 1;
+    if(depth > AI_MAX_DEPTH) depth = AI_MAX_DEPTH;
+
+    printf("fixed depth %d\n", depth);
+    printf("threads      time       nodes  speedup\n");
+    for(t = 1; ; t = (t * 2 > max_threads && t < max_threads) ? max_threads : t * 2)
+    {
+        ai_set_threads(t);
+        elapsed = run_fixed_depth(depth, &nodes);
+        if(t == 1) elapsed1 = elapsed;
+        printf("%7d %7lu ms %11lu %8.2f\n", t, elapsed, nodes, elapsed ? (double)elapsed1 / (double)elapsed : 0.0);
+        if(t >= max_threads) break;
+    }
+
+    printf("\nfixed time %lu ms per position\n", time_ms);
+    printf("threads  depth   gain\n");
+    for(t = 1; ; t = (t * 2 > max_threads && t < max_threads) ? max_threads : t * 2)
+    {
+        ai_set_threads(t);
+        avg = run_fixed_time(time_ms);
+        if(t == 1) avg1 = avg;
+        printf("%7d %6.2f %+6.2f\n", t, avg, avg - avg1);
+        if(t >= max_threads) break;
+    }
+
+    return 0;
+}
@@ -0,0 +1,371 @@
+// tune.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 評価関数の重みの調整ツール（ホスト用, Texel法）
+// 学習用局面ファイル（posfile.h）の局面について, 評価値から勝率を予測する
+//   予測勝率 = 1 / (1 + exp(-評価値 / K))
+// と実際の勝敗（勝ち1, 引き分け0.5, 負け0）の二乗誤差が小さくなるように, パターンの重み・
+// 着手可能数の重み・手番の有利さを合わせて pattern_weights.c を書き出す.
+// 1. 今の pattern_weights.c の重みで誤差が最小になる K を求める（評価値の単位はそのまま）
+// 2. 今の重みから始めて, 重みごとの対角ガウス・ニュートン法で誤差を減らす
+//    パターンの重みは pattern_weights.c の int8 と最大の倍率で表せる範囲で動かす.
+// 3. 検証誤差が最小だった反復の重みを pattern_weights.c として標準出力に書き出す
+//
+// 局面はスレッドに分けて並列に処理し, 勾配はスレッドごとに足してから合わせる.
+// 局面ファイルは mmap で読むので, メモリに載せるのは重みと勾配だけ.
+// 対局番号の 1/VALIDATION_DIV の対局は検証用にして学習に使わない.
+//
+// ビルド
+//   gcc -O3 -march=native -pthread -I.. tune.c ../bitboard.c ../pattern.c ../pattern_weights.c -lm -o tune
+//
+// 使い方
+//   ./tune 局面ファイル [反復回数(既定50)] [スレッド数(既定はCPU数)] > ../pattern_weights.c
+//   経過と誤差は標準エラーに表示する.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "bitboard.h"
+#include "pattern.h"
+#include "posfile.h"
+#include "pattern_out.h"
+
+#define MAX_THREADS    64
+#define VALIDATION_DIV 20    // 検証用にする対局の割合の逆数
+#define LEARNING_RATE  0.05  // ガウス・ニュートンの1回の更新の何割を重みに戻すか. 全特徴が同時に動くので小さめ.
+#define REGULARIZATION 8.0   // 重みを0に寄せる強さ（平均的な局面何個分をヘッセ行列の対角に足すか. リッジ回帰.）
+#define WEIGHT_MAX     (127.0f * (1 << PATTERN_MAX_SHIFT)) // パターンの重みの上限
+#define K_MIN          8.0   // K の探索範囲 [1/PATTERN_SCALE 石]
+#define K_MAX          2048.0
+
+// 学習中の重み
+static float weights[PATTERN_PHASES][PATTERN_SIZE];
+static float mobility_w[PATTERN_PHASES];
+static float bias_w[PATTERN_PHASES];
+
+// 検証誤差が最小だった重み
+static float best_weights[PATTERN_PHASES][PATTERN_SIZE];
+static float best_mobility_w[PATTERN_PHASES];
+static float best_bias_w[PATTERN_PHASES];
+
+// 局面
+static const struct PosRecord *recs;
+static size_t num_recs;
+
+// スレッドごとの作業領域
+struct Worker{
+    pthread_t tid;
+    size_t    begin, end;                      // 担当する局面の範囲
+    double    k;                               // 勝率の尺度
+    int       want_grad;                       // 勾配も求めるか
+    double    train_sq, valid_sq;              // 二乗誤差の合計
+    long      n_train, n_valid;                // 局面数
+    double   *grad;                            // [PATTERN_PHASES * PATTERN_SIZE] 誤差 x ヤコビアン
+    double   *hess;                            // [PATTERN_PHASES * PATTERN_SIZE] ヤコビアンの二乗
+    double    grad_mob[PATTERN_PHASES], hess_mob[PATTERN_PHASES];
+    double    grad_bias[PATTERN_PHASES], hess_bias[PATTERN_PHASES];
+};
+
+static struct Worker workers[MAX_THREADS];
+static int num_threads;
+
+// 検証用の局面か
+static int is_valid(const struct PosRecord *r)
+{
+    return r->game % VALIDATION_DIV == 0;
+}
+
+// 実際の勝敗
+static double target(const struct PosRecord *r)
+{
+    return (r->result > 0) ? 1.0 : (r->result < 0) ? 0.0 : 0.5;
+}
+
+// 担当範囲の誤差と勾配を求める
+static void *work(void *arg)
+{
+    struct Worker *w = (struct Worker *)arg;
+    uint32_t idx[PATTERN_NUM_FEATURES];
+    const struct PosRecord *r;
+    const float *pw;
+    double e, s, err, jac;
+    size_t i;
+    int f, ph, mob;
+
+    w->train_sq = w->valid_sq = 0.0;
+    w->n_train  = w->n_valid  = 0;
+    if(w->want_grad)
+    {
+        memset(w->grad, 0, sizeof(double) * PATTERN_PHASES * PATTERN_SIZE);
+        memset(w->hess, 0, sizeof(double) * PATTERN_PHASES * PATTERN_SIZE);
+        memset(w->grad_mob, 0, sizeof(w->grad_mob));
+        memset(w->hess_mob, 0, sizeof(w->hess_mob));
+        memset(w->grad_bias, 0, sizeof(w->grad_bias));
+        memset(w->hess_bias, 0, sizeof(w->hess_bias));
+    }
+
+    for(i = w->begin; i < w->end; i++)
+    {
+        r   = &recs[i];
+        ph  = pattern_phase(MAT_WIDTH * MAT_HEIGHT - bb_count(r->p | r->o));
+        mob = bb_count(bb_moves(r->p, r->o)) - bb_count(bb_moves(r->o, r->p));
+        pw  = weights[ph];
+
+        // 評価値. エンジンの evaluate_board と同じ式.
+        pattern_features(r->p, r->o, idx);
+        e = bias_w[ph] + mobility_w[ph] * mob;
+        for(f = 0; f < PATTERN_NUM_FEATURES; f++)
+        {
+            e += pw[idx[f]];
+        }
+
+        s   = 1.0 / (1.0 + exp(-e / w->k));
+        err = target(r) - s;
+
+        if(is_valid(r))
+        {
+            w->valid_sq += err * err;
+            w->n_valid++;
+            continue;
+        }
+
+        w->train_sq += err * err;
+        w->n_train++;
+
+        if(!w->want_grad) continue;
+
+        // 予測勝率の評価値での微分
+        jac = s * (1.0 - s) / w->k;
+
+        for(f = 0; f < PATTERN_NUM_FEATURES; f++)
+        {
+            w->grad[ph * PATTERN_SIZE + idx[f]] += err * jac;
+            w->hess[ph * PATTERN_SIZE + idx[f]] += jac * jac;
+        }
+
+        w->grad_mob[ph]  += err * jac * mob;
+        w->hess_mob[ph]  += jac * jac * mob * mob;
+        w->grad_bias[ph] += err * jac;
+        w->hess_bias[ph] += jac * jac;
+    }
+
+    return NULL;
+}
+
+// 全スレッドで1回分の誤差（と勾配）を求める. 学習局面の平均二乗誤差を返し, 検証局面の分を valid_err に入れる.
+static double run(double k, int want_grad, double *valid_err)
+{
+    double train_sq = 0.0, valid_sq = 0.0;
+    long n_train = 0, n_valid = 0;
+    int t;
+
+    for(t = 0; t < num_threads; t++)
+    {
+        workers[t].k         = k;
+        workers[t].want_grad = want_grad;
+        pthread_create(&workers[t].tid, NULL, work, &workers[t]);
+    }
+
+    for(t = 0; t < num_threads; t++)
+    {
+        pthread_join(workers[t].tid, NULL);
+        train_sq += workers[t].train_sq;
+        valid_sq += workers[t].valid_sq;
+        n_train  += workers[t].n_train;
+        n_valid  += workers[t].n_valid;
+    }
+
+    if(valid_err != NULL) *valid_err = (n_valid > 0) ? valid_sq / n_valid : 0.0;
+
+    return (n_train > 0) ? train_sq / n_train : 0.0;
+}
+
+// 今の重みで誤差が最小になる K を黄金分割探索で求める
+static double fit_k(void)
+{
+    const double g = 0.6180339887;
+    double lo = log(K_MIN), hi = log(K_MAX);
+    double a = hi - g * (hi - lo), b = lo + g * (hi - lo);
+    double fa = run(exp(a), 0, NULL), fb = run(exp(b), 0, NULL);
+    int i;
+
+    for(i = 0; i < 30; i++)
+    {
+        if(fa < fb)
+        {
+            hi = b; b = a; fb = fa;
+            a  = hi - g * (hi - lo);
+            fa = run(exp(a), 0, NULL);
+        }
+        else
+        {
+            lo = a; a = b; fa = fb;
+            b  = lo + g * (hi - lo);
+            fb = run(exp(b), 0, NULL);
+        }
+    }
+
+    return exp((lo + hi) / 2.0);
+}
+
+// スレッドごとの勾配を合わせて重みを更新する
+static void update(void)
+{
+    double g, h, reg, sum_h = 0.0;
+    long n = 0;
+    size_t i;
+    int t, ph;
+
+    // 1局面あたりのヤコビアンの二乗の平均を正則化の単位にする
+    for(t = 0; t < num_threads; t++)
+    {
+        for(ph = 0; ph < PATTERN_PHASES; ph++)
+        {
+            sum_h += workers[t].hess_bias[ph];
+        }
+        n += workers[t].n_train;
+    }
+    reg = (n > 0) ? REGULARIZATION * sum_h / n : 0.0;
+
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        for(i = 0; i < PATTERN_SIZE; i++)
+        {
+            g = h = 0.0;
+            for(t = 0; t < num_threads; t++)
+            {
+                g += workers[t].grad[ph * PATTERN_SIZE + i];
+                h += workers[t].hess[ph * PATTERN_SIZE + i];
+            }
+
+            // 正則化の項で重みを0に寄せ, 出現の少ない重みが大きくなりすぎないようにする
+            if(h > 0.0) weights[ph][i] += (float)(LEARNING_RATE * (g - reg * weights[ph][i]) / (h + reg));
+            if(weights[ph][i] > WEIGHT_MAX)  weights[ph][i] = WEIGHT_MAX;
+            if(weights[ph][i] < -WEIGHT_MAX) weights[ph][i] = -WEIGHT_MAX;
+        }
+    }
+
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        g = h = 0.0;
+        for(t = 0; t < num_threads; t++)
+        {
+            g += workers[t].grad_mob[ph];
+            h += workers[t].hess_mob[ph];
+        }
+        if(h > 0.0) mobility_w[ph] += (float)(LEARNING_RATE * g / h);
+
+        g = h = 0.0;
+        for(t = 0; t < num_threads; t++)
+        {
+            g += workers[t].grad_bias[ph];
+            h += workers[t].hess_bias[ph];
+        }
+        if(h > 0.0) bias_w[ph] += (float)(LEARNING_RATE * g / h);
+    }
+}
+
+// 今の重みを検証誤差最小として残す
+static void save_best(void)
+{
+    memcpy(best_weights, weights, sizeof(weights));
+    memcpy(best_mobility_w, mobility_w, sizeof(mobility_w));
+    memcpy(best_bias_w, bias_w, sizeof(bias_w));
+}
+
+int main(int argc, char *argv[])
+{
+    int epochs = (argc > 2) ? atoi(argv[2]) : 50;
+    int epoch, t, ph, sh, i, best_epoch = -1;
+    double k, train_err, valid_err = 0.0, best_err;
+    char note[160];
+
+    if(argc < 2)
+    {
+        fprintf(stderr, "usage : %s positions [epochs] [threads] > ../pattern_weights.c\n", argv[0]);
+        return 1;
+    }
+
+    num_threads = (argc > 3) ? atoi(argv[3]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if(num_threads < 1) num_threads = 1;
+    if(num_threads > MAX_THREADS) num_threads = MAX_THREADS;
+
+    recs = posfile_map(argv[1], &num_recs);
+    if(recs == NULL) return 1;
+
+    fprintf(stderr, "positions %lu, threads %d\n", (unsigned long)num_recs, num_threads);
+
+    // 局面を等分してスレッドに割り当てる
+    for(t = 0; t < num_threads; t++)
+    {
+        workers[t].begin = num_recs * (size_t)t / (size_t)num_threads;
+        workers[t].end   = num_recs * (size_t)(t + 1) / (size_t)num_threads;
+        workers[t].grad  = (double *)malloc(sizeof(double) * PATTERN_PHASES * PATTERN_SIZE);
+        workers[t].hess  = (double *)malloc(sizeof(double) * PATTERN_PHASES * PATTERN_SIZE);
+        if(workers[t].grad == NULL || workers[t].hess == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            return 1;
+        }
+    }
+
+    // 今の重みから始める
+    for(ph = 0; ph < PATTERN_PHASES; ph++)
+    {
+        for(i = 0, sh = 0; i < PATTERN_SIZE; i++)
+        {
+            while(i >= (int)pattern_shape_ofs[sh + 1]) sh++;
+            weights[ph][i] = (float)(pattern_weights[ph][i] * (1 << pattern_shift[ph][sh]));
+        }
+        mobility_w[ph] = pattern_mobility[ph];
+        bias_w[ph]     = pattern_bias[ph];
+    }
+
+    k = fit_k();
+    train_err = run(k, 0, &valid_err);
+    fprintf(stderr, "K %.1f : train %.5f, valid %.5f\n", k, train_err, valid_err);
+    best_err = valid_err;
+    save_best();
+
+    // 各反復の誤差は更新前の重みの値
+    for(epoch = 0; epoch < epochs; epoch++)
+    {
+        train_err = run(k, 1, &valid_err);
+        if(valid_err < best_err)
+        {
+            best_err   = valid_err;
+            best_epoch = epoch;
+            save_best();
+        }
+        update();
+        fprintf(stderr, "epoch %2d : train %.5f, valid %.5f\n", epoch, train_err, valid_err);
+    }
+
+    train_err = run(k, 0, &valid_err);
+    fprintf(stderr, "final    : train %.5f, valid %.5f\n", train_err, valid_err);
+    if(valid_err < best_err)
+    {
+        best_err   = valid_err;
+        best_epoch = epochs;
+        save_best();
+    }
+    fprintf(stderr, "best     : epoch %d, valid %.5f\n", best_epoch, best_err);
+
+    sprintf(note, "Texel法 局面 %lu, K %.1f, 反復 %d/%d, 検証誤差 %.5f（勝率の二乗誤差）",
+            (unsigned long)num_recs, k, best_epoch, epochs, best_err);
+    write_pattern_weights(best_weights, best_mobility_w, best_bias_w, "tune.c", note);
+
+    for(t = 0; t < num_threads; t++)
+    {
+        free(workers[t].grad);
+        free(workers[t].hess);
+    }
+    posfile_unmap(recs, num_recs);
+
+    return 0;
+}
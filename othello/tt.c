@@ -0,0 +1,221 @@
+// tt.c
+// Created on : 2026/10/17
+// Author : T.Ijiro
+
+#include <stdint.h>
+#include <string.h>
+#include "bitboard.h"
+#include "tt.h"
+
+// Zobristハッシュ用乱数 [色][マス]. splitmix64で生成した固定値（ROM配置）.
+static const uint64_t ZOBRIST[2][BB_SQUARES] =
+{
+    {
+        0x2C3AFA272651936BULL, 0x211DD2A39AE04773ULL, 0xE64D06AF3C098C86ULL, 0xED0411F4EBC06D1BULL,
+        0xB1A4816CD397AA6BULL, 0x7C66FEA14D3D71BAULL, 0xB9507976BDE9E5EDULL, 0x4288FEA1562429E7ULL,
+        0xEFEB0947D5054896ULL, 0xCE6471728C1846BEULL, 0x3A4A74F76FF47B1FULL, 0x3A14BA2A3025F1D1ULL,
+        0x6E322B5BB699D0C7ULL, 0x48A5BE35F74A5E83ULL, 0x95596750F17096B2ULL, 0x9954BF8F10057004ULL,
+        0x72D96D087FB1FB07ULL, 0x89470CA3236708D5ULL, 0xF2DC32EAAFB1EBA0ULL, 0xC6066D35106B2621ULL,
+        0xE87C4E2E22E5E63BULL, 0x266E6D92B0D311F3ULL, 0x4580B65D7A85F063ULL, 0x1A74E094981A51B4ULL,
+        0xC3B5C5B2516EFE45ULL, 0x2E2653DDA7C6BD2FULL, 0x4DDD0D7580C7A678ULL, 0x2601513F8B17B55DULL,
+        0x7DD245097EF97D58ULL, 0x229F189108051B74ULL, 0xB477A8789CF3D064ULL, 0x2EADD7FC02FD2CD2ULL,
+        0x3CD63467D5C11997ULL, 0xEDF19C6E1C3262B9ULL, 0x629F02C14D87C918ULL, 0x37972743998ABEE3ULL,
+        0x4E753193CF594C47ULL, 0x5B1E577DB3118166ULL, 0x3D9187237A28B7E0ULL, 0xD9D1D96C52ADFDDBULL,
+        0x356EEC7E69515764ULL, 0x4E02351B10BA106DULL, 0x94CF35B7D142B54CULL, 0x66D418A32069B830ULL,
+        0xB31768DE2634F6E9ULL, 0x515D01569767C010ULL, 0xDDA0A474011E98CFULL, 0x79E1FC08107D8075ULL,
+        0xA713180A31272F5BULL, 0x71C96BD62074CFA9ULL, 0xC71FCEF565347375ULL, 0xB33485F9EBDB3061ULL,
+        0x63B19C7943F47F62ULL, 0x44B641544D8D7219ULL, 0xC415FEE1E6E4EACAULL, 0x07F6995330D5713BULL,
+        0xD491EF7A4B8567D4ULL, 0x2D181CDFE64738BDULL, 0x5A9EA46738424907ULL, 0xAEFC41B26E25B8B2ULL,
+        0x8061130ECF9DD8C3ULL, 0x4F02AB2074FB3B70ULL, 0x5F007D23F86A703BULL, 0x4601AF284B94B681ULL
+    },
+    {
+        0x86EAC12EF079B85EULL, 0x84567141379D45A6ULL, 0xC72447BBF48D137FULL, 0x6DFA2EF7571DD635ULL,
+        0x37868CA30488D4B6ULL, 0xE123B01F5E7E4323ULL, 0x38B87835AA822129ULL, 0x676EAA066B4A3830ULL,
+        0xA411C84F1791230EULL, 0xA248057E9F692DC2ULL, 0xB5541D3AA5867704ULL, 0xE5BF62F1710CF9CAULL,
+        0x01639A578A28204DULL, 0xC493256900CD734EULL, 0x3C27DE925B639F04ULL, 0x5AC971C239C07AD0ULL,
+        0x1B622BAE23C6AD74ULL, 0xB547EEF2E19D8D8CULL, 0xF3DBC99B83C50D79ULL, 0x9FA1BD61698057E6ULL,
+        0xF99CDDB2AEC268BBULL, 0x96E67F4EBEAA3E4DULL, 0x41232DA97A02F2E2ULL, 0xCB2221684175EC95ULL,
+        0x4368B5D83334DC3DULL, 0xFF22FD60054B7E62ULL, 0x385E20574A7060D0ULL, 0x5714A0010D0E8570ULL,
+        0x0770324CAE48B08DULL, 0xABC66DB3070339FAULL, 0x5367166F4C0275BDULL, 0xD85489ADEFB06DA6ULL,
+        0x8C6A99C78E4B36A3ULL, 0xC5216F52DB5B0F49ULL, 0x5500ACF2CB7DDE4BULL, 0x5F484B23E4680EF3ULL,
+        0x3884AA0A5939B8DAULL, 0xE47E4B91A98F5607ULL, 0x331991CA3F880F07ULL, 0xDCC69591D3FC688BULL,
+        0xB2636F26BD3AB215ULL, 0x6165BB90114C8095ULL, 0xAFD332643BFEBF8DULL, 0x5BEC1D645425A1B6ULL,
+        0xEEB79D5A7BFB6751ULL, 0xD1381AB4D05383E2ULL, 0xEF4B9BED40E7E65DULL, 0xC7C7B39BAD7E95D0ULL,
+        0x9907D7627CFAE71CULL, 0x8B98650B05D7D2D2ULL, 0x4AC5900D773CA7FAULL, 0x1CB5458960F393F6ULL,
+        0x67CE386FC896D0FBULL, 0x864C88F5E60B24F3ULL, 0x43DD9E6C57B6F615ULL, 0x0A4EEAE1BC868E47ULL,
+        0xA83AD07E373057C0ULL, 0xDF2A514BB5DB1FFAULL, 0x25F6CA9F1F70EDF9ULL, 0xE12CD04B96BE2D6FULL,
+        0x799BEA40D2787B40ULL, 0x5156CE714CDECED9ULL, 0x13825D017328305FULL, 0xA47BB6902273E3FAULL
+    }
+};
+
+// 手番交代用乱数
+#define ZOBRIST_SIDE 0x149CB28B2F2B9CA3ULL
+
+// 置換表本体
+static struct TTEntry tt_table[TT_NUM_BUCKETS][TT_BUCKET_SIZE];
+
+// 現在の探索の世代
+static uint8_t tt_gen;
+
+// 局面のハッシュを最初から計算
+uint64_t tt_hash(const struct Board *brd, enum stone_color sc)
+{
+    uint64_t hash = (sc == stone_green) ? ZOBRIST_SIDE : 0;
+    uint64_t b;
+    int c, sq;
+
+    for(c = stone_red; c <= stone_green; c++)
+    {
+        b = brd->stones[c];
+
+        while(b)
+        {
+            sq = bb_first(b);
+            b &= b - 1;
+            hash ^= ZOBRIST[c][sq];
+        }
+    }
+
+    return hash;
+}
+
+// マスsqにscが置いてflipsがひっくり返った後のハッシュ（手番交代込み）
+uint64_t tt_hash_move(uint64_t hash, int sq, uint64_t flips, enum stone_color sc)
+{
+    int f;
+
+    hash ^= ZOBRIST[sc][sq] ^ ZOBRIST_SIDE;
+
+    // ひっくり返ったマスは両方の色の乱数が入れ替わる
+    while(flips)
+    {
+        f = bb_first(flips);
+        flips &= flips - 1;
+        hash ^= ZOBRIST[stone_red][f] ^ ZOBRIST[stone_green][f];
+    }
+
+    return hash;
+}
+
+// パス後のハッシュ
+uint64_t tt_hash_pass(uint64_t hash)
+{
+    return hash ^ ZOBRIST_SIDE;
+}
+
+// テーブル全消去
+void tt_clear(void)
+{
+    memset(tt_table, 0, sizeof(tt_table));
+    tt_gen = 0;
+}
+
+// 新しい探索を始める
+void tt_new_search(void)
+{
+    tt_gen++;
+}
+
+// エントリの中身から作る検査値
+static uint32_t tt_check(const struct TTEntry *e)
+{
+    return (uint32_t)e->score
+         ^ ((uint32_t)e->move << 24 | (uint32_t)(uint8_t)e->depth << 16 | (uint32_t)e->bound << 8 | e->gen);
+}
+
+// 局面を引く
+// エントリを手元にコピーしてから検査するので, 他のスレッドがその後に書き換えても影響しない.
+int tt_probe(uint64_t hash, struct TTEntry *e)
+{
+    const struct TTEntry *bucket = tt_table[hash & (TT_NUM_BUCKETS - 1)];
+    uint32_t key = (uint32_t)(hash >> 32);
+    int i;
+
+    for(i = 0; i < TT_BUCKET_SIZE; i++)
+    {
+        *e = bucket[i];
+        e->key ^= tt_check(e);
+
+        if(e->bound != tt_none && e->key == key) return 1;
+    }
+
+    return 0;
+}
+
+// 局面を書き込む
+// 新しい中身を手元で作ってから, 検査値をXORしたキーと一緒に書き込む.
+void tt_store(uint64_t hash, int depth, int score, enum tt_bound bound, int move)
+{
+    struct TTEntry *bucket = tt_table[hash & (TT_NUM_BUCKETS - 1)];
+    struct TTEntry cur[TT_BUCKET_SIZE];
+    struct TTEntry n;
+    uint32_t key = (uint32_t)(hash >> 32);
+    int i, c = 0;
+
+    for(i = 0; i < TT_BUCKET_SIZE; i++)
+    {
+        cur[i] = bucket[i];
+        cur[i].key ^= tt_check(&cur[i]);
+    }
+
+    // 置き換え先を選ぶ
+    // 同じ局面 > 空き > 古い世代 > 浅い深さ
+    // 同じ局面が後ろのスロットにあるとき空きに2つ目を書かないよう, 先にバケット全体から探す.
+    // 今は後ろのスロットが埋まるのは前が埋まってからで, 空きに戻るのは tt_clear だけなので, この形にはならない.
+    // 空きを作る操作（エントリの無効化など）を足しても同じ局面が2つにならないよう, 順番を分けておく.
+    for(i = 0; i < TT_BUCKET_SIZE; i++)
+    {
+        if(cur[i].bound != tt_none && cur[i].key == key)
+        {
+            c = i;
+            break;
+        }
+    }
+
+    if(i == TT_BUCKET_SIZE)
+    {
+        for(i = 0; i < TT_BUCKET_SIZE; i++)
+        {
+            if(cur[i].bound == tt_none)
+            {
+                c = i;
+                break;
+            }
+
+            if(cur[i].gen != tt_gen && cur[c].gen == tt_gen)
+            {
+                c = i;
+            }
+            else if((cur[i].gen != tt_gen) == (cur[c].gen != tt_gen) && cur[i].depth < cur[c].depth)
+            {
+                c = i;
+            }
+        }
+    }
+    n = cur[c];
+
+    // 同じ局面で今回の世代のより深い結果は残す. ただし最善手だけは更新する.
+    if(n.bound != tt_none && n.key == key && n.gen == tt_gen && n.depth > depth)
+    {
+        if(move == TT_NO_MOVE) return;
+        n.move = (uint8_t)move;
+    }
+    else
+    {
+        // 同じ局面で最善手が分からない場合は前の最善手を引き継ぐ
+        if(move == TT_NO_MOVE && n.bound != tt_none && n.key == key)
+        {
+            move = n.move;
+        }
+
+        n.key   = key;
+        n.score = score;
+        n.move  = (uint8_t)move;
+        n.depth = (int8_t)depth;
+        n.bound = (uint8_t)bound;
+        n.gen   = tt_gen;
+    }
+
+    n.key ^= tt_check(&n);
+    bucket[c] = n;
+}
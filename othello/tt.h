@@ -0,0 +1,76 @@
+// tt.h
+// Created on : 2026/10/17
+// Author : T.Ijiro
+//
+// 置換表（トランスポジションテーブル）
+// Zobristハッシュをキーに, 探索済み局面の評価値の範囲・深さ・最善手を覚えておく.
+// 1バケットに TT_BUCKET_SIZE 個のエントリを持ち, 同じ局面 → 古い世代 → 浅い深さ の順に置き換える.
+//
+// テーブルの大きさは TT_BITS で変更できる（バケット数 = 2^TT_BITS）.
+// RX210ではRAMが少ないので小さな静的配列, ホストでは大きな配列を既定とする.
+//
+// ホストの並列探索（ai.h の AI_SMP）では全スレッドがロックなしで1つの表を共有する.
+// キーには中身から作った検査値をXORして書き込み, 読むときに戻して比べるので,
+// 書き込みと読み出しが重なって中身が混ざったエントリは別の局面として捨てられる.
+
+#ifndef TT_H
+#define TT_H
+
+#include <stdint.h>
+#include "bitboard.h"
+
+#ifndef TT_BITS
+#if defined(__RX)
+#define TT_BITS 8   // 256バケット x 2エントリ x 12バイト = 6KB
+#else
+#define TT_BITS 18  // 262144バケット x 2エントリ x 12バイト = 6MB
+#endif
+#endif
+
+#define TT_BUCKET_SIZE 2               // 1バケットのエントリ数
+#define TT_NUM_BUCKETS (1UL << TT_BITS) // バケット数
+
+// 最善手なし
+#define TT_NO_MOVE 0xFF
+
+// 評価値の種類
+enum tt_bound{
+    tt_none,  // 空きエントリ
+    tt_exact, // 正確な値
+    tt_lower, // 下限値（β以上でカットした）
+    tt_upper  // 上限値（αを超えなかった）
+};
+
+// エントリ. 評価値は手番側から見た値.
+struct TTEntry{
+    uint32_t key;   // ハッシュ上位32bit ^ 検査値. インデックスは下位ビットから作る.
+    int32_t  score; // 評価値
+    uint8_t  move;  // 最善手のマス番号
+    int8_t   depth; // 残り探索深さ
+    uint8_t  bound; // enum tt_bound
+    uint8_t  gen;   // 書き込んだ探索の世代
+};
+
+// 局面のハッシュを最初から計算
+uint64_t tt_hash(const struct Board *brd, enum stone_color sc);
+
+// マスsqにscが置いてflipsがひっくり返った後のハッシュ（手番交代込み）
+uint64_t tt_hash_move(uint64_t hash, int sq, uint64_t flips, enum stone_color sc);
+
+// パス後のハッシュ
+uint64_t tt_hash_pass(uint64_t hash);
+
+// テーブル全消去
+void tt_clear(void);
+
+// 新しい探索を始める. 世代を進めて古いエントリを置き換えやすくする.
+void tt_new_search(void);
+
+// 局面を引く. 見つかったら e にコピーして1, 見つからなければ0を返す.
+// e の key は検査値を戻したハッシュ上位32bit.
+int tt_probe(uint64_t hash, struct TTEntry *e);
+
+// 局面を書き込む
+void tt_store(uint64_t hash, int depth, int score, enum tt_bound bound, int move);
+
+#endif /* TT_H */